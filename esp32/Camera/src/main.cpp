@@ -2,26 +2,217 @@
 #include "esp_camera.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
+#include <HttpSession.h>
+#include <FrameRingLog.h>
+#include "SD_MMC.h"
+#include <time.h>
 
 // ====== CAMERA MODEL ======
 #define CAMERA_MODEL_AI_THINKER
-#include "camera_pins.h"
+#include <CameraPins.h>
+#include <CameraSetup.h>
 #include <esp_wifi.h>
 #include <esp_bt.h>
+#include "esp_heap_caps.h"
 
 // ====== CONFIGURATION ======
 const char* ssid = "Ken Phone";
 const char* password = "Estri333";
 const char* serverURL = "http://157.230.250.226:5000/upload";
+const char* chunkURL = "http://157.230.250.226:5000/upload/chunk";
 
 #define CAPTURE_INTERVAL_MS 60000
 #define SLEEP_DURATION_S 60
 
+// ====== FAST WAKE ======
+// The last good association (BSSID, channel, DHCP lease) is kept in RTC
+// memory across deep sleep, so a wake can join directly with a static IP
+// instead of scanning and running DHCP. A failed fast join falls back to
+// the normal path and clears the cache.
+#ifndef FAST_WAKE
+#define FAST_WAKE 1
+#endif
+// Production builds skip the serial settle delays
+#ifndef PRODUCTION_BUILD
+#define PRODUCTION_BUILD 0
+#endif
+#define FAST_JOIN_TIMEOUT_MS 3000
+#define WIFI_JOIN_TIMEOUT_MS 15000
+#define RTC_NET_MAGIC 0x534D5354  // "SMST"
+
+struct RtcNetCache {
+  uint32_t magic;
+  uint8_t bssid[6];
+  int32_t channel;
+  uint32_t ip, gateway, subnet, dns;
+};
+
+RTC_DATA_ATTR RtcNetCache rtcNet;
+RTC_DATA_ATTR uint32_t rtcLastWakeToUploadMs = 0;  // reported on the next wake
+bool fastJoinUsed = false;
+volatile uint32_t firstUploadMs = 0;              // millis() when the first frame landed
+
+// Per-wake phase marks (ms since boot at the end of each phase). A wake's
+// totals are only known just before sleep, so they go out with the next
+// wake's uploads as X-Perf; image_server.py forwards them to
+// nus-smartstop-diag/<deviceId>/perf.
+struct WakePerf {
+  uint32_t gateMs, cameraMs, wifiMs, uploadMs, awakeMs;
+  uint32_t heapMin, uploadStackFree;
+};
+RTC_DATA_ATTR WakePerf rtcPerf = {};
+WakePerf wakePerf = {};
+
+// ====== CHANGE GATE ======
+// Before powering up WiFi, a QQVGA grayscale frame is reduced to a 40x30
+// thumbnail and compared block-by-block (mean absolute difference, after
+// removing the global brightness shift) with the thumbnail of the last
+// uploaded scene. Unchanged scenes go straight back to sleep.
+#ifndef CHANGE_GATE
+#define CHANGE_GATE 1
+#endif
+#define THUMB_SCALE 4                 // QQVGA 160x120 -> 40x30
+#define THUMB_W (160 / THUMB_SCALE)
+#define THUMB_H (120 / THUMB_SCALE)
+#define GATE_BLOCK 5                  // 5x5 thumb pixels -> 8x6 blocks
+#define BLOCK_DIFF_THRESH 12          // mean |diff| per pixel (0-255) for a block to count
+#define CHANGE_MIN_BLOCKS 2
+#define FORCE_UPLOAD_WAKES 15         // heartbeat upload even if nothing changed
+#define GATE_WARMUP_FRAMES 3          // let auto-exposure settle
+
+RTC_DATA_ATTR uint8_t rtcThumb[THUMB_W * THUMB_H];  // last uploaded scene
+RTC_DATA_ATTR bool rtcThumbValid = false;
+RTC_DATA_ATTR uint16_t rtcSkippedWakes = 0;
+uint8_t thumb[THUMB_W * THUMB_H];
+bool thumbOk = false;  // thumb holds this wake's scene
+int changedBlocks = -1;                             // -1 = gate not run / no reference
+
+// ====== RESOLUTION CONTROLLER ======
+// Picks frame size + JPEG quality per wake so one frame fits a byte budget
+// (last measured throughput x TARGET_UPLOAD_MS), capped by RSSI. The sensor
+// is initialised at the largest size and stepped down at runtime once the
+// join has reported RSSI. State survives deep sleep in RTC memory.
+struct CaptureLevel {
+  framesize_t size;
+  uint16_t w, h;
+  uint8_t quality;
+  float nominalBpp;                   // typical JPEG bytes per pixel at this quality
+};
+
+constexpr CaptureLevel LEVELS[] = {  // largest first
+  { FRAMESIZE_UXGA, 1600, 1200, 10, 0.13f },
+  { FRAMESIZE_UXGA, 1600, 1200, 12, 0.11f },
+  { FRAMESIZE_SXGA, 1280, 1024, 12, 0.11f },
+  { FRAMESIZE_XGA,  1024,  768, 12, 0.11f },
+  { FRAMESIZE_SVGA,  800,  600, 12, 0.12f },
+  { FRAMESIZE_VGA,   640,  480, 14, 0.11f },
+};
+const int N_LEVELS = sizeof(LEVELS) / sizeof(LEVELS[0]);
+const int SVGA_LEVEL = 4;             // ceiling without PSRAM
+
+#define TARGET_UPLOAD_MS 4000         // airtime budget per frame
+#define DEFAULT_BUDGET_BYTES 120000   // until a throughput has been measured
+#define MIN_BUDGET_BYTES 20000
+#define CTL_EMA_ALPHA 0.5f
+#define RTC_CTL_MAGIC 0x43544C31      // "CTL1"
+
+struct RtcCaptureCtl {
+  uint32_t magic;
+  float throughputBps;                // EMA of bytes / upload second
+  float sizeRatio;                    // EMA of measured / nominal size (scene complexity)
+  uint8_t level;
+};
+
+RTC_DATA_ATTR RtcCaptureCtl rtcCtl;
+int captureLevel = 0;
+uint32_t captureBudget = 0;
+int minLevel = 0;                     // raised to SVGA_LEVEL without PSRAM
+
+// ====== BURST ======
+// Each wake captures BURST_FRAMES frames BURST_INTERVAL_MS apart. Frames are
+// handed to UploadTask as they land, so capture and upload overlap.
+#ifndef BURST_FRAMES
+#define BURST_FRAMES 3
+#endif
+#define BURST_INTERVAL_MS 500
+#define FB_COUNT_PSRAM 3          // UXGA JPEG buffers are 375 KB each (w*h/5), fits 4 MB PSRAM
+#define UPLOAD_RETRIES 3
+#define UPLOAD_RETRY_DELAY_MS 2000
+#define UPLOAD_DRAIN_TIMEOUT_MS 90000
+#define UPLOAD_ABORT_GRACE_MS 15000   // one request timeout plus margin
+
+// Resumable upload: the frame goes out in UPLOAD_CHUNK_SIZE pieces to
+// /upload/chunk, and a retry resumes at the first unacknowledged byte
+// instead of resending the whole JPEG. 0 = single POST to /upload.
+#ifndef UPLOAD_CHUNKED
+#define UPLOAD_CHUNKED 1
+#endif
+#ifndef UPLOAD_CHUNK_SIZE
+#define UPLOAD_CHUNK_SIZE 16384
+#endif
+#define UPLOAD_CHUNK_TIMEOUT_MS 10000
+
+struct UploadJob {
+  camera_fb_t *fb;                // nullptr marks the end of the burst
+  uint8_t index;
+  uint32_t uploadId;              // random per frame, names the server-side partial
+  size_t sent;                    // bytes acknowledged by the server (chunked mode)
+  uint8_t level;                  // LEVELS[] index the frame was captured at
+  bool backlog;                   // replayed from the SD frame log
+  int64_t capturedAt;             // backlog frames only: unix seconds at capture, 0 if unknown
+  uint32_t backlogSeq;
+};
+
+QueueHandle_t uploadQueue;
+SemaphoreHandle_t fbSlots;        // frames the app may hold; driver keeps one to fill
+SemaphoreHandle_t uploadDone;
+volatile int uploadedCount = 0;
+// Past UPLOAD_DRAIN_TIMEOUT_MS, captureBurst() asks UploadTask to give up.
+// If it is still inside a request after the grace period it is left running
+// and goToSleep() skips the camera, SD and WiFi teardown it may be using
+volatile bool uploadAbort = false;
+bool uploadStuck = false;
+HttpSession uploadSession;        // keep-alive socket shared by every chunk and retry
+
+// ====== STORE AND FORWARD ======
+// Frames that fail to upload go into a preallocated ring log on the SD card
+// (fixed slots, one index header, no per-shot files) and are drained on a
+// later wake once the server is reachable again.
+#ifndef STORE_AND_FORWARD
+#define STORE_AND_FORWARD 1
+#endif
+#define FRAME_LOG_PATH "/frames.log"
+// The driver's JPEG buffer is w*h/5 bytes, so no frame of the largest level
+// can exceed it; a slot holds that plus its header sector (~376 KB)
+constexpr uint32_t MAX_JPEG_BYTES = (uint32_t)LEVELS[0].w * LEVELS[0].h / 5;
+constexpr uint32_t FRAME_SLOT_SIZE =
+  ((MAX_JPEG_BYTES + FrameRingLog::SECTOR - 1) / FrameRingLog::SECTOR + 1) * FrameRingLog::SECTOR;
+#define FRAME_SLOT_COUNT 64            // ~24 MB on the card
+#define BACKLOG_DRAIN_MAX 5            // per wake, bounds awake time
+
+FrameRingLog frameLog;
+RTC_DATA_ATTR uint32_t rtcBacklog = 0;  // pending frames, so a wake only mounts SD when needed
+
 // ====== FUNCTION DECLARATIONS ======
-void setupCamera();
-void setupWiFi();
-bool captureAndUploadPhoto();
-bool uploadToServer(camera_fb_t *fb, int attemptNum);
+void setupCamera(bool thumbnail = false);
+bool captureThumbnail(uint8_t *dst);
+int compareThumbnails(const uint8_t *a, const uint8_t *b);
+int chooseCaptureLevel(int rssi);
+void applyCaptureLevel(int level);
+void recordUpload(size_t bytes, uint32_t ms, bool ok);
+bool openFrameLog();
+void storeFrame(const UploadJob &job);
+int drainBacklog(int maxFrames);
+void addFrameHeaders(HTTPClient &http, const UploadJob &job);
+void startWiFi();
+bool waitWiFi();
+void cacheAssociation();
+int captureBurst(int frames);
+void UploadTask(void *pv);
+bool uploadToServer(UploadJob &job, int attemptNum);
+bool uploadChunked(UploadJob &job);
+void reportHttpResult(int code, const String &response);
+void addTelemetryHeaders(HTTPClient &http, const UploadJob &job);
 void setupLedFlash(int pin);
 void goToSleep();
 
@@ -29,7 +220,9 @@ void goToSleep();
 void setup() {
   // setCpuFrequencyMhz(80);
   Serial.begin(115200);
+#if !PRODUCTION_BUILD
   delay(1000); // Give some buffer time for serial to start
+#endif
   // Serial.setDebugOutput(true);
   Serial.printf("CPU frequency: %d MHz\n", getCpuFrequencyMhz());
   Serial.printf("XTAL frequency: %d MHz\n", getXtalFrequencyMhz());
@@ -39,28 +232,70 @@ void setup() {
   Serial.println("=== ESP32 Camera Photo Capture & Upload ===");
   Serial.println("CS3237 Group 10 - Image Gallery Integration");
 
-  setupWiFi();
+  thumbOk = CHANGE_GATE && captureThumbnail(thumb);
+  if (thumbOk && rtcThumbValid) {
+    changedBlocks = compareThumbnails(thumb, rtcThumb);
+    Serial.printf("Scene change: %d blocks (threshold %d), %u wakes skipped\n",
+                  changedBlocks, CHANGE_MIN_BLOCKS, (unsigned)rtcSkippedWakes);
+    if (changedBlocks < CHANGE_MIN_BLOCKS && rtcSkippedWakes + 1 < FORCE_UPLOAD_WAKES) {
+      rtcSkippedWakes++;
+      Serial.println("No change, skipping capture + upload");
+      goToSleep();
+    }
+  }
+
+  wakePerf.gateMs = millis();
+
+  // Association runs in the WiFi task while the camera sensor initialises
+  startWiFi();
   setupCamera();
+  wakePerf.cameraMs = millis();
+  bool online = waitWiFi();
+  wakePerf.wifiMs = millis();
+  // Runs in the background during the burst; the RTC keeps the time across
+  // deep sleep, so offline wakes can stamp stored frames
+  if (online) configTime(0, 0, "pool.ntp.org");
+  if (online) applyCaptureLevel(chooseCaptureLevel(WiFi.RSSI()));
+  else captureLevel = minLevel;
 
 #if defined(LED_GPIO_NUM)
   setupLedFlash(LED_GPIO_NUM);
 #endif
 
   Serial.println("A: Setup complete!");
-  Serial.println("B: Taking photo and uploading to Flask server...");
+  Serial.printf("B: Taking %d photo(s) and uploading to Flask server...\n", BURST_FRAMES);
 
-  bool success = captureAndUploadPhoto();
-  if (success)
+  int uploaded = captureBurst(BURST_FRAMES);
+  if (uploaded == BURST_FRAMES)
     Serial.println("✅ Photo uploaded successfully!");
   else
-    Serial.println("❌ Failed to upload photo.");
+    Serial.printf("❌ Uploaded %d of %d photos.\n", uploaded, BURST_FRAMES);
+  rtcLastWakeToUploadMs = firstUploadMs;
+  wakePerf.uploadMs = firstUploadMs;
+  if (uploaded > 0) {
+    // The uploaded scene becomes the new reference, if the gate saw it;
+    // otherwise the previous reference stays
+    if (thumbOk) {
+      memcpy(rtcThumb, thumb, sizeof(rtcThumb));
+      rtcThumbValid = true;
+    }
+    rtcSkippedWakes = 0;
+  }
+  Serial.printf("Wake-to-upload: %u ms (%s join)\n", (unsigned)firstUploadMs, fastJoinUsed ? "fast" : "full");
+
+  if (STORE_AND_FORWARD && rtcBacklog && !uploadStuck && WiFi.status() == WL_CONNECTED) {
+    int drained = drainBacklog(BACKLOG_DRAIN_MAX);
+    Serial.printf("Backlog: %d uploaded, %u still queued\n", drained, (unsigned)rtcBacklog);
+  }
 
   // Sleep logic
   Serial.println();
   Serial.println("=== Entering deep sleep mode ===");
   Serial.printf("Sleeping for %d seconds...\n", SLEEP_DURATION_S);
 
+#if !PRODUCTION_BUILD
   delay(1000); // Give time for serial output to complete
+#endif
 
   goToSleep();
 
@@ -69,39 +304,62 @@ void setup() {
 }
 
 void goToSleep() {
+  wakePerf.awakeMs = millis();
+  wakePerf.heapMin = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  // Gate-skipped wakes never stamp the phases; keep the last full wake's
+  if (wakePerf.gateMs) rtcPerf = wakePerf;
+  Serial.printf("Wake phases: gate %u, camera %u, wifi %u, upload %u, awake %u ms; heap min %u\n",
+                (unsigned)wakePerf.gateMs, (unsigned)wakePerf.cameraMs, (unsigned)wakePerf.wifiMs,
+                (unsigned)wakePerf.uploadMs, (unsigned)wakePerf.awakeMs, (unsigned)wakePerf.heapMin);
+
   Serial.println("\n========================================");
   Serial.println("Preparing for Deep Sleep...");
   
-  // --- 1. SHUTDOWN CAMERA ---
-  Serial.println("  - De-initializing camera...");
-  esp_err_t cam_err = esp_camera_deinit();
-  if (cam_err != ESP_OK) {
-    Serial.printf("  - Camera deinit failed (0x%x)\n", cam_err);
-  }
-  
-  // Assert powerdown pin for the camera sensor.
-  // This is critical for stopping the sensor's power draw.
-  Serial.println("  - Asserting camera power-down pin.");
-  pinMode(PWDN_GPIO_NUM, OUTPUT);
-  digitalWrite(PWDN_GPIO_NUM, HIGH); // Assumes HIGH powers down the sensor
-
-  // --- 2. SHUTDOWN RADIO (WiFi & Bluetooth) ---
-  Serial.println("  - Shutting down WiFi...");
-  if (WiFi.isConnected()) {
-    WiFi.disconnect(true, true); // disconnect, disable autoconnect, and erase credentials
-  }
-  WiFi.mode(WIFI_OFF);
-  esp_wifi_stop();
+  // A stuck UploadTask may still hold a frame, the SD card or a socket;
+  // deep sleep stops it, so leave the drivers alone
+  if (uploadStuck) {
+    Serial.println("  - UploadTask still running, skipping driver teardown");
+  } else {
+    // --- 1. SHUTDOWN CAMERA ---
+    Serial.println("  - De-initializing camera...");
+    esp_err_t cam_err = esp_camera_deinit();
+    if (cam_err != ESP_OK) {
+      Serial.printf("  - Camera deinit failed (0x%x)\n", cam_err);
+    }
+
+    if (frameLog.ready()) {
+      Serial.println("  - Closing SD frame log...");
+      frameLog.end();
+      SD_MMC.end();
+    }
+
+    // Assert powerdown pin for the camera sensor.
+    // This is critical for stopping the sensor's power draw.
+    Serial.println("  - Asserting camera power-down pin.");
+    pinMode(PWDN_GPIO_NUM, OUTPUT);
+    digitalWrite(PWDN_GPIO_NUM, HIGH); // Assumes HIGH powers down the sensor
 
-  Serial.println("  - Shutting down Bluetooth...");
-  btStop(); // Stop Bluetooth
-  esp_bt_controller_disable(); // Disable the controller
+    // --- 2. SHUTDOWN RADIO (WiFi & Bluetooth) ---
+    Serial.println("  - Shutting down WiFi...");
+    if (WiFi.isConnected()) {
+      WiFi.disconnect(true); // keep stored credentials, no flash write every cycle
+    }
+    WiFi.mode(WIFI_OFF);
+    esp_wifi_stop();
+
+    Serial.println("  - Shutting down Bluetooth...");
+    btStop(); // Stop Bluetooth
+    esp_bt_controller_disable(); // Disable the controller
+  }
 
   // --- 3. SHUTDOWN RTC DOMAINS (Aggressive) ---
   // This saves the most power by turning off parts of the chip.
   Serial.println("  - Powering down RTC domains...");
   esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_PERIPH, ESP_PD_OPTION_OFF);
-  esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_SLOW_MEM, ESP_PD_OPTION_OFF);
+  // RTC slow memory holds every RTC_DATA_ATTR variable: the fast-wake cache,
+  // the reference thumbnail, the capture controller, the SD backlog count
+  // and the previous wake's phase marks. It must stay powered.
+  esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_SLOW_MEM, ESP_PD_OPTION_ON);
   esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_FAST_MEM, ESP_PD_OPTION_OFF);
   
   // Isolate GPIO 12 (used for SD card) to prevent power leak during sleep
@@ -120,72 +378,84 @@ void goToSleep() {
 }
 
 // ====== WIFI SETUP ======
-void setupWiFi() {
-  WiFi.begin(ssid, password);
+// Non-blocking: kicks off association, waitWiFi() collects the result
+void startWiFi() {
+  WiFi.persistent(false);
+  WiFi.mode(WIFI_STA);
   WiFi.setSleep(false);
-  Serial.printf("Connecting to WiFi (%s)...\n", ssid);
 
-  int retries = 0;
-  while (WiFi.status() != WL_CONNECTED && retries < 30) {
-    delay(500);
-    Serial.print(".");
-    retries++;
+  fastJoinUsed = FAST_WAKE && rtcNet.magic == RTC_NET_MAGIC;
+  if (fastJoinUsed) {
+    Serial.printf("Fast join to %s (ch %d, cached IP)...\n", ssid, (int)rtcNet.channel);
+    WiFi.config(IPAddress(rtcNet.ip), IPAddress(rtcNet.gateway), IPAddress(rtcNet.subnet), IPAddress(rtcNet.dns));
+    WiFi.begin(ssid, password, rtcNet.channel, rtcNet.bssid, true);
+  } else {
+    Serial.printf("Connecting to WiFi (%s)...\n", ssid);
+    WiFi.begin(ssid, password);
+  }
+}
+
+bool waitWiFi() {
+  unsigned long start = millis();
+  unsigned long timeout = fastJoinUsed ? FAST_JOIN_TIMEOUT_MS : WIFI_JOIN_TIMEOUT_MS;
+  while (WiFi.status() != WL_CONNECTED && millis() - start < timeout) delay(50);
+
+  if (WiFi.status() != WL_CONNECTED && fastJoinUsed) {
+    // AP moved channel or lease changed: forget the cache and do a full join
+    Serial.println("\n⚠️ Fast join failed, falling back to scan + DHCP");
+    rtcNet.magic = 0;
+    WiFi.disconnect();
+    WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+    fastJoinUsed = false;
+    startWiFi();
+    return waitWiFi();
   }
 
   if (WiFi.status() == WL_CONNECTED) {
-    Serial.printf("\nWiFi connected, IP: %s\n", WiFi.localIP().toString().c_str());
+    Serial.printf("\nWiFi connected in %lu ms, IP: %s\n", millis() - start, WiFi.localIP().toString().c_str());
     Serial.print("Signal strength (RSSI): ");
     Serial.print(WiFi.RSSI());
     Serial.println(" dBm");
-  } else {
-    Serial.println("\n⚠️ WiFi connection failed. Continuing without upload.");
+    if (FAST_WAKE && !fastJoinUsed) cacheAssociation();
+    return true;
   }
+  Serial.println("\n⚠️ WiFi connection failed. Continuing without upload.");
+  return false;
 }
 
-// ====== CAMERA SETUP ======
-void setupCamera() {
-  Serial.println("Initializing camera...");
-
-camera_config_t config = {
-  // --- All Pins (Your order was correct) ---
-  .pin_pwdn = PWDN_GPIO_NUM,
-  .pin_reset = RESET_GPIO_NUM,
-  .pin_xclk = XCLK_GPIO_NUM,
-  .pin_sscb_sda = SIOD_GPIO_NUM,
-  .pin_sscb_scl = SIOC_GPIO_NUM,
-  .pin_d7 = Y9_GPIO_NUM,
-  .pin_d6 = Y8_GPIO_NUM,
-  .pin_d5 = Y7_GPIO_NUM,
-  .pin_d4 = Y6_GPIO_NUM,
-  .pin_d3 = Y5_GPIO_NUM,
-  .pin_d2 = Y4_GPIO_NUM,
-  .pin_d1 = Y3_GPIO_NUM,
-  .pin_d0 = Y2_GPIO_NUM,
-  .pin_vsync = VSYNC_GPIO_NUM,
-  .pin_href = HREF_GPIO_NUM,
-  .pin_pclk = PCLK_GPIO_NUM,
-
-  .xclk_freq_hz = 20000000,
-  .ledc_timer = LEDC_TIMER_0,
-  .ledc_channel = LEDC_CHANNEL_0,
-
-  .pixel_format = PIXFORMAT_JPEG,
-  .frame_size = FRAMESIZE_UXGA,
-
-  .jpeg_quality = 12,
-  .fb_count = 1,
-  .fb_location = CAMERA_FB_IN_PSRAM,
-  .grab_mode = CAMERA_GRAB_LATEST
-};
+void cacheAssociation() {
+  memcpy(rtcNet.bssid, WiFi.BSSID(), sizeof(rtcNet.bssid));
+  rtcNet.channel = WiFi.channel();
+  rtcNet.ip = (uint32_t)WiFi.localIP();
+  rtcNet.gateway = (uint32_t)WiFi.gatewayIP();
+  rtcNet.subnet = (uint32_t)WiFi.subnetMask();
+  rtcNet.dns = (uint32_t)WiFi.dnsIP();
+  rtcNet.magic = RTC_NET_MAGIC;
+}
 
-  if (!psramFound()) {
+// ====== CAMERA SETUP ======
+// thumbnail: QQVGA grayscale in DRAM for the change gate
+void setupCamera(bool thumbnail) {
+  Serial.println(thumbnail ? "Initializing camera (thumbnail)..." : "Initializing camera...");
+
+  CameraProfile profile = {
+    PIXFORMAT_JPEG, FRAMESIZE_UXGA, 12, 1, CAMERA_FB_IN_PSRAM, CAMERA_GRAB_LATEST
+  };
+  camera_config_t config = makeCameraConfig<BoardPins>(profile);
+
+  if (thumbnail) {
+    config.pixel_format = PIXFORMAT_GRAYSCALE;
+    config.frame_size = FRAMESIZE_QQVGA;
+    config.fb_location = CAMERA_FB_IN_DRAM;
+  } else if (!psramFound()) {
     Serial.println("⚠️ PSRAM not found! Lowering resolution...");
     config.frame_size = FRAMESIZE_SVGA;
+    minLevel = SVGA_LEVEL;
     config.fb_location = CAMERA_FB_IN_DRAM;
   } else {
     Serial.println("✅ PSRAM detected!");
     config.jpeg_quality = 10;
-    config.fb_count = 2;
+    config.fb_count = FB_COUNT_PSRAM;
   }
 
   esp_err_t err = esp_camera_init(&config);
@@ -201,45 +471,277 @@ camera_config_t config = {
     s->set_saturation(s, -2);
   }
 
-  Serial.println("✅ Camera initialized!");
+  if (thumbnail) return;
+
+  // The driver needs one free buffer to capture into
+  int slots = config.fb_count > 1 ? config.fb_count - 1 : 1;
+  fbSlots = xSemaphoreCreateCounting(slots, slots);
+  Serial.printf("✅ Camera initialized! (%d frame buffers)\n", (int)config.fb_count);
 }
 
-// ====== CAPTURE + UPLOAD ======
-bool captureAndUploadPhoto() {
-  Serial.println("📸 Capturing photo...");
-  camera_fb_t *fb = esp_camera_fb_get();
+// ====== CHANGE GATE ======
+// Grabs one settled QQVGA frame, box-filters it into dst, then releases the
+// camera so setupCamera() can bring it back up in JPEG mode
+bool captureThumbnail(uint8_t *dst) {
+  setupCamera(true);
+  camera_fb_t *fb = nullptr;
+  for (int i = 0; i <= GATE_WARMUP_FRAMES; i++) {
+    if (fb) esp_camera_fb_return(fb);
+    fb = esp_camera_fb_get();
+    if (!fb) break;
+  }
+
+  bool ok = fb && fb->width == THUMB_W * THUMB_SCALE && fb->height == THUMB_H * THUMB_SCALE;
+  if (ok) {
+    for (int ty = 0; ty < THUMB_H; ty++) {
+      for (int tx = 0; tx < THUMB_W; tx++) {
+        uint32_t sum = 0;
+        for (int y = 0; y < THUMB_SCALE; y++) {
+          const uint8_t *row = fb->buf + (ty * THUMB_SCALE + y) * fb->width + tx * THUMB_SCALE;
+          for (int x = 0; x < THUMB_SCALE; x++) sum += row[x];
+        }
+        dst[ty * THUMB_W + tx] = sum / (THUMB_SCALE * THUMB_SCALE);
+      }
+    }
+  } else {
+    Serial.println("⚠️ Thumbnail capture failed, gate bypassed");
+  }
+
+  if (fb) esp_camera_fb_return(fb);
+  esp_camera_deinit();
+  return ok;
+}
+
+// Number of blocks whose mean absolute difference exceeds BLOCK_DIFF_THRESH.
+// The global mean shift is removed first so exposure/lighting drift alone
+// does not count as change.
+int compareThumbnails(const uint8_t *a, const uint8_t *b) {
+  int32_t shift = 0;
+  for (int i = 0; i < THUMB_W * THUMB_H; i++) shift += a[i] - b[i];
+  shift /= THUMB_W * THUMB_H;
+
+  int changed = 0;
+  for (int by = 0; by < THUMB_H; by += GATE_BLOCK) {
+    for (int bx = 0; bx < THUMB_W; bx += GATE_BLOCK) {
+      uint32_t sad = 0;
+      for (int y = by; y < by + GATE_BLOCK; y++) {
+        for (int x = bx; x < bx + GATE_BLOCK; x++) {
+          int d = a[y * THUMB_W + x] - b[y * THUMB_W + x] - shift;
+          sad += d < 0 ? -d : d;
+        }
+      }
+      if (sad > (uint32_t)BLOCK_DIFF_THRESH * GATE_BLOCK * GATE_BLOCK) changed++;
+    }
+  }
+  return changed;
+}
 
-  if (!fb) {
-    Serial.println("❌ Camera capture failed!");
+// ====== STORE AND FORWARD ======
+bool openFrameLog() {
+  if (frameLog.ready()) return true;
+  // 1-bit mode keeps GPIO 4 (flash LED) and 12/13 free
+  if (!SD_MMC.begin("/sdcard", true) || SD_MMC.cardType() == CARD_NONE) {
+    Serial.println("⚠️ SD card not available, frame dropped");
     return false;
   }
+  // A backlog is transient: after a geometry change, start a fresh one
+  if (!frameLog.begin(SD_MMC, FRAME_LOG_PATH, FRAME_SLOT_SIZE, FRAME_SLOT_COUNT, true)) {
+    Serial.println("⚠️ Frame log open failed");
+    return false;
+  }
+  Serial.printf("Frame log: %u/%u slots pending, %u dropped\n",
+                (unsigned)frameLog.pending(), (unsigned)frameLog.capacity(), (unsigned)frameLog.dropped());
+  return true;
+}
 
-  Serial.printf("Captured %dx%d image (%u bytes)\n", fb->width, fb->height, fb->len);
+void storeFrame(const UploadJob &job) {
+  if (!openFrameLog()) return;
+  if (frameLog.append(job.fb->buf, job.fb->len, job.level)) {
+    Serial.printf("💾 Stored %u bytes for later (%u queued)\n", (unsigned)job.fb->len, (unsigned)frameLog.pending());
+  } else {
+    Serial.println("⚠️ Frame log append failed");
+  }
+  rtcBacklog = frameLog.pending();
+}
 
-  bool success = false;
-  for (int i = 1; i <= 3; i++) {
-    if (uploadToServer(fb, i)) {
-      success = true;
-      break;
+// Uploads the oldest stored frames; stops at the first failure so
+// order is preserved. Returns frames uploaded.
+int drainBacklog(int maxFrames) {
+  if (!openFrameLog()) return 0;
+  uint8_t *buf = (uint8_t *)ps_malloc(frameLog.maxFrameBytes());
+  if (!buf) return 0;
+
+  int done = 0;
+  FrameRingLog::Frame frame;
+  while (done < maxFrames && frameLog.peek(frame)) {
+    if (!frameLog.read(frame, buf)) {
+      frameLog.pop();  // data CRC mismatch, nothing worth sending
+      continue;
     }
-    Serial.printf("Retrying upload... (%d/3)\n", i);
-    delay(2000);
+    camera_fb_t fb = {};
+    fb.buf = buf;
+    fb.len = frame.len;
+    fb.format = PIXFORMAT_JPEG;
+    // meta is the capture level storeFrame() recorded
+    uint8_t level = frame.meta < (uint32_t)N_LEVELS ? frame.meta : N_LEVELS - 1;
+    UploadJob job = { &fb, 0, esp_random(), 0, level, true, frame.capturedAt, frame.seq };
+
+    bool ok = false;
+    for (int i = 1; i <= UPLOAD_RETRIES && !ok; i++) ok = uploadToServer(job, i);
+    if (!ok) break;
+    frameLog.pop();
+    done++;
   }
+  free(buf);
+  rtcBacklog = frameLog.pending();
+  return done;
+}
 
-  esp_camera_fb_return(fb);
-  return success;
+// ====== RESOLUTION CONTROLLER ======
+int chooseCaptureLevel(int rssi) {
+  if (rtcCtl.magic != RTC_CTL_MAGIC) {
+    rtcCtl = { RTC_CTL_MAGIC, 0.0f, 1.0f, 0 };
+  }
+
+  // Weak links get a smaller ceiling regardless of the budget
+  int floorLevel = rssi >= -67 ? 0 : rssi >= -75 ? 2 : rssi >= -82 ? 3 : 4;
+  if (floorLevel < minLevel) floorLevel = minLevel;
+
+  float budget = rtcCtl.throughputBps > 0
+                   ? rtcCtl.throughputBps * TARGET_UPLOAD_MS / 1000.0f
+                   : DEFAULT_BUDGET_BYTES;
+  captureBudget = budget < MIN_BUDGET_BYTES ? MIN_BUDGET_BYTES : (uint32_t)budget;
+
+  int level = N_LEVELS - 1;
+  for (int l = floorLevel; l < N_LEVELS; l++) {
+    const CaptureLevel &c = LEVELS[l];
+    float estimate = c.nominalBpp * c.w * c.h * rtcCtl.sizeRatio;
+    if (estimate <= captureBudget) { level = l; break; }
+  }
+  // Hysteresis from the previous wake's level: step down at once, but up by
+  // at most one level per wake, so one fast upload cannot swing the next
+  // burst straight to UXGA
+  if (level < rtcCtl.level - 1) level = rtcCtl.level - 1;
+
+  Serial.printf("Capture level %d (%ux%u q%u): RSSI %d dBm, budget %u B, %.0f B/s\n",
+                level, LEVELS[level].w, LEVELS[level].h, LEVELS[level].quality, rssi,
+                (unsigned)captureBudget, rtcCtl.throughputBps);
+  return level;
+}
+
+void applyCaptureLevel(int level) {
+  captureLevel = level;
+  rtcCtl.level = level;
+  sensor_t *s = esp_camera_sensor_get();
+  s->set_framesize(s, LEVELS[level].size);
+  s->set_quality(s, LEVELS[level].quality);
+  // The frame in flight still has the old size
+  camera_fb_t *stale = esp_camera_fb_get();
+  if (stale) esp_camera_fb_return(stale);
+}
+
+// Called by UploadTask after each frame (including all its retries)
+void recordUpload(size_t bytes, uint32_t ms, bool ok) {
+  if (rtcCtl.magic != RTC_CTL_MAGIC) return;
+  if (!ok) {
+    rtcCtl.throughputBps *= 0.5f;  // failed uploads shrink the budget quickly
+    return;
+  }
+  float bps = bytes * 1000.0f / (ms ? ms : 1);
+  rtcCtl.throughputBps = rtcCtl.throughputBps > 0
+                           ? rtcCtl.throughputBps + CTL_EMA_ALPHA * (bps - rtcCtl.throughputBps)
+                           : bps;
+  const CaptureLevel &c = LEVELS[captureLevel];
+  float ratio = bytes / (c.nominalBpp * c.w * c.h);
+  rtcCtl.sizeRatio += CTL_EMA_ALPHA * (ratio - rtcCtl.sizeRatio);
+}
+
+// ====== CAPTURE + UPLOAD ======
+// Returns the number of frames uploaded once UploadTask has drained the burst
+int captureBurst(int frames) {
+  uploadQueue = xQueueCreate(FB_COUNT_PSRAM, sizeof(UploadJob));
+  uploadDone = xSemaphoreCreateBinary();
+  uploadedCount = 0;
+  uploadAbort = false;
+  xTaskCreatePinnedToCore(UploadTask, "UploadTask", 8192, NULL, 1, NULL, 0);
+
+  TickType_t wake = xTaskGetTickCount();
+  for (int i = 0; i < frames; i++) {
+    if (i) vTaskDelayUntil(&wake, pdMS_TO_TICKS(BURST_INTERVAL_MS));
+
+    // Blocks only if every spare buffer is still waiting to be uploaded
+    xSemaphoreTake(fbSlots, portMAX_DELAY);
+    Serial.printf("📸 Capturing photo %d/%d...\n", i + 1, frames);
+    camera_fb_t *fb = esp_camera_fb_get();
+    if (!fb) {
+      Serial.println("❌ Camera capture failed!");
+      xSemaphoreGive(fbSlots);
+      continue;
+    }
+    Serial.printf("Captured %dx%d image (%u bytes)\n", (int)fb->width, (int)fb->height, (unsigned)fb->len);
+
+    UploadJob job = { fb, (uint8_t)i, esp_random(), 0, (uint8_t)captureLevel, false, 0, 0 };
+    xQueueSend(uploadQueue, &job, portMAX_DELAY);
+  }
+
+  UploadJob end = { nullptr, 0, 0, 0, 0, false, 0, 0 };
+  xQueueSend(uploadQueue, &end, portMAX_DELAY);
+  if (xSemaphoreTake(uploadDone, pdMS_TO_TICKS(UPLOAD_DRAIN_TIMEOUT_MS)) != pdTRUE) {
+    // Let the request in flight finish; the rest of the burst goes to the backlog
+    Serial.println("⚠️ Upload still running, abandoning the rest of the burst.");
+    uploadAbort = true;
+    if (xSemaphoreTake(uploadDone, pdMS_TO_TICKS(UPLOAD_ABORT_GRACE_MS)) != pdTRUE) {
+      Serial.println("⚠️ UploadTask stuck, sleeping without teardown.");
+      uploadStuck = true;
+    }
+  }
+  return uploadedCount;
+}
+
+void UploadTask(void *pv) {
+  UploadJob job;
+  for (;;) {
+    xQueueReceive(uploadQueue, &job, portMAX_DELAY);
+    if (!job.fb) break;
+
+    bool ok = false;
+    unsigned long t0 = millis();
+    for (int i = 1; i <= UPLOAD_RETRIES && !ok && !uploadAbort; i++) {
+      if (WiFi.status() != WL_CONNECTED) break;  // straight to the SD backlog
+      if (i > 1) {
+        Serial.printf("Retrying upload from byte %u... (%d/%d)\n", (unsigned)job.sent, i - 1, UPLOAD_RETRIES);
+        vTaskDelay(pdMS_TO_TICKS(UPLOAD_RETRY_DELAY_MS)); // capture keeps running meanwhile
+      }
+      ok = uploadToServer(job, i);
+    }
+    if (ok) {
+      if (!firstUploadMs) firstUploadMs = millis();
+      uploadedCount++;
+    }
+    // Skipped frames say nothing about throughput; they still go to the backlog
+    if (WiFi.status() == WL_CONNECTED && !uploadAbort) recordUpload(job.fb->len, millis() - t0, ok);
+    if (!ok && STORE_AND_FORWARD) storeFrame(job);
+
+    esp_camera_fb_return(job.fb);
+    xSemaphoreGive(fbSlots);
+  }
+  wakePerf.uploadStackFree = uxTaskGetStackHighWaterMark(NULL);
+  xSemaphoreGive(uploadDone);
+  vTaskDelete(NULL);
 }
 
 // ====== UPLOAD TO SERVER ======
-bool uploadToServer(camera_fb_t *fb, int attemptNum) {
+bool uploadToServer(UploadJob &job, int attemptNum) {
+  camera_fb_t *fb = job.fb;
   if (WiFi.status() != WL_CONNECTED) {
     Serial.println("⚠️ WiFi disconnected, skipping upload.");
     return false;
   }
+  if (UPLOAD_CHUNKED) return uploadChunked(job);
 
-  HTTPClient http;
-  http.setTimeout(30000);
-  if (!http.begin(serverURL)) {
+  HTTPClient &http = uploadSession.http();
+  uploadSession.timeoutMs = 30000;
+  if (!uploadSession.begin(serverURL)) {
     Serial.println("❌ HTTP begin failed!");
     return false;
   }
@@ -247,10 +749,104 @@ bool uploadToServer(camera_fb_t *fb, int attemptNum) {
   http.addHeader("X-API-Key", "Complex_Secret_Key_Group10_2025");
   http.addHeader("Content-Type", "image/jpeg");
   http.addHeader("Device-ID", "esp32-smartstop-camera-001");
+  addFrameHeaders(http, job);
+  addTelemetryHeaders(http, job);
 
   int code = http.POST(fb->buf, fb->len);
   String response = http.getString();
+  reportHttpResult(code, response);
+
+  uploadSession.end(code);
+  return (code == 200);
+}
 
+bool uploadChunked(UploadJob &job) {
+  camera_fb_t *fb = job.fb;
+  const char *offsetHeader[] = {"X-Upload-Offset"};
+  char uploadId[24];
+  snprintf(uploadId, sizeof(uploadId), "%08x-%u", (unsigned)job.uploadId, (unsigned)job.index);
+
+  HTTPClient &http = uploadSession.http();
+  uploadSession.timeoutMs = UPLOAD_CHUNK_TIMEOUT_MS;
+  while (job.sent < fb->len) {
+    size_t n = min((size_t)UPLOAD_CHUNK_SIZE, fb->len - job.sent);
+    if (!uploadSession.begin(chunkURL)) {
+      Serial.println("❌ HTTP begin failed!");
+      return false;
+    }
+    http.collectHeaders(offsetHeader, 1);
+    http.addHeader("X-API-Key", "Complex_Secret_Key_Group10_2025");
+    http.addHeader("Content-Type", "application/octet-stream");
+    http.addHeader("Device-ID", "esp32-smartstop-camera-001");
+    addFrameHeaders(http, job);
+    http.addHeader("X-Upload-Id", uploadId);
+    http.addHeader("X-Upload-Offset", String((unsigned)job.sent));
+    http.addHeader("X-Upload-Total", String((unsigned)fb->len));
+    addTelemetryHeaders(http, job);
+
+    int code = http.POST(fb->buf + job.sent, n);
+    String serverOffset = http.header("X-Upload-Offset");
+    String response = http.getString();  // drain the body so the socket can be reused
+    uploadSession.end(code);
+    if (code == 200) {
+      job.sent += n;
+      Serial.printf("Chunk ok: %u/%u bytes\n", (unsigned)job.sent, (unsigned)fb->len);
+      if (job.sent == fb->len) reportHttpResult(code, response);
+    } else if (code == 409 && serverOffset.length()) {
+      // Server is missing earlier bytes: rewind to what it holds
+      job.sent = serverOffset.toInt();
+      Serial.printf("Server resumes at byte %u\n", (unsigned)job.sent);
+    } else {
+      reportHttpResult(code, response);
+      return false;
+    }
+  }
+  Serial.printf("Session: %u requests, %u reused connections\n",
+                (unsigned)uploadSession.requests(), (unsigned)uploadSession.reused());
+  return true;
+}
+
+// Frame position in its burst, or its sequence number (and age, when both
+// stamps come from a synced clock) when replayed from the SD backlog
+void addFrameHeaders(HTTPClient &http, const UploadJob &job) {
+  if (job.backlog) {
+    http.addHeader("X-Backlog-Seq", String(job.backlogSeq));
+    if (job.capturedAt && FrameRingLog::clockSynced()) {
+      int64_t age = time(nullptr) - job.capturedAt;
+      if (age >= 0) http.addHeader("X-Captured-Age-S", String((long)age));
+    }
+    return;
+  }
+  http.addHeader("X-Burst-Index", String(job.index));
+  http.addHeader("X-Burst-Size", String(BURST_FRAMES));
+}
+
+// Capture settings the frame was taken with (a backlog frame's own, not this
+// wake's) plus boot timing for the server: time since wake for this request,
+// and the previous cycle's full wake-to-first-upload time
+void addTelemetryHeaders(HTTPClient &http, const UploadJob &job) {
+  const CaptureLevel &c = LEVELS[job.level];
+  http.addHeader("X-Capture-Level", String(job.level));
+  http.addHeader("X-Frame-Size", String(c.w) + "x" + String(c.h));
+  http.addHeader("X-JPEG-Quality", String(c.quality));
+  http.addHeader("X-Byte-Budget", String(captureBudget));
+  http.addHeader("X-Wake-Ms", String(millis()));
+  http.addHeader("X-Fast-Wake", fastJoinUsed ? "1" : "0");
+  if (rtcLastWakeToUploadMs) http.addHeader("X-Prev-Wake-To-Upload-Ms", String(rtcLastWakeToUploadMs));
+  if (changedBlocks >= 0) http.addHeader("X-Change-Blocks", String(changedBlocks));
+  http.addHeader("X-Skipped-Wakes", String(rtcSkippedWakes));
+  if (rtcPerf.awakeMs) {
+    char perf[192];
+    snprintf(perf, sizeof(perf),
+             "gate_ms=%u,camera_ms=%u,wifi_ms=%u,upload_ms=%u,awake_ms=%u,heap_min=%u,upload_stack_free=%u",
+             (unsigned)rtcPerf.gateMs, (unsigned)rtcPerf.cameraMs, (unsigned)rtcPerf.wifiMs,
+             (unsigned)rtcPerf.uploadMs, (unsigned)rtcPerf.awakeMs, (unsigned)rtcPerf.heapMin,
+             (unsigned)rtcPerf.uploadStackFree);
+    http.addHeader("X-Perf", perf);
+  }
+}
+
+void reportHttpResult(int code, const String &response) {
   Serial.printf("HTTP Response Code: %d\n", code);
   // Detailed error reporting
   if (code == -1) {
@@ -276,9 +872,6 @@ bool uploadToServer(camera_fb_t *fb, int attemptNum) {
     Serial.println("Server response:");
     Serial.println(response);
   }
-
-  http.end();
-  return (code == 200);
 }
 
 // ====== LED FLASH ======
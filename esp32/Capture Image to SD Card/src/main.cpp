@@ -2,78 +2,61 @@
 #include "esp_camera.h"
 #include "FS.h"
 #include "SD_MMC.h"
+#include <FrameRingLog.h>
 #include "soc/soc.h"
 #include "soc/rtc_cntl_reg.h"
+#include "esp_heap_caps.h"
 
-// ... [Keep your same Pin Definitions here] ...
-#define PWDN_GPIO_NUM     32
-#define RESET_GPIO_NUM    -1
-#define XCLK_GPIO_NUM      0
-#define SIOD_GPIO_NUM     26
-#define SIOC_GPIO_NUM     27
-#define Y9_GPIO_NUM       35
-#define Y8_GPIO_NUM       34
-#define Y7_GPIO_NUM       39
-#define Y6_GPIO_NUM       36
-#define Y5_GPIO_NUM       21
-#define Y4_GPIO_NUM       19
-#define Y3_GPIO_NUM       18
-#define Y2_GPIO_NUM        5
-#define VSYNC_GPIO_NUM    25
-#define HREF_GPIO_NUM     23
-#define PCLK_GPIO_NUM     22
-
-int pictureNumber = 0;
-
-// --- NEW FUNCTION: Read/Write picture number to SD ---
-void getPictureNumber() {
-  fs::FS &fs = SD_MMC;
-  File file = fs.open("/picture_count.txt", FILE_READ);
-  if (!file) {
-    Serial.println("No picture_count.txt found, starting from 0.");
-    pictureNumber = 0;
-  } else {
-    String s = file.readStringUntil('\n');
-    pictureNumber = s.toInt();
-    Serial.printf("Found existing picture count: %d\n", pictureNumber);
-    file.close();
-  }
-}
+// AI-Thinker ESP32-CAM; pin map and config builder from smartstop_core
+#define CAMERA_MODEL_AI_THINKER
+#include <CameraPins.h>
+#include <CameraSetup.h>
 
-void savePictureNumber() {
-  fs::FS &fs = SD_MMC;
-  File file = fs.open("/picture_count.txt", FILE_WRITE);
-  if (file) {
-    file.print(pictureNumber);
-    file.close();
-  }
-}
+// --- Frames go into one preallocated ring log instead of /imageN.jpg files ---
+// Same FrameRingLog format as the camera uploader's backlog. Sized to half
+// the card (up to 1 GB); oldest frames are overwritten once it is full.
+// Turn it back into image<seq>.jpg files on a PC with
+//   python3 ml_models/extract_frame_log.py /path/to/card/dataset.log out_dir
+#define FRAME_LOG_PATH "/dataset.log"
+#define FRAME_SLOT_SIZE (128 * 1024)   // SVGA q10 is ~40-90 KB
+#define FRAME_SLOT_MAX 8192
+
+// --- Capture pipeline ---
+// The framebuffer is copied into a PSRAM pool slot and handed straight back
+// to the driver; a writer task on core 0 streams the copy to SD through a
+// DMA-capable staging buffer in whole sectors.
+#define CAPTURE_INTERVAL_MS 500        // 2 fps
+#define FRAME_POOL 3                   // frames in flight between capture and SD
+#define STAGING_BYTES (32 * 1024)      // per SD transfer, internal DMA RAM
+// 4-bit needs GPIO 4, which drives the flash LED: every write would light
+// the scene mid-exposure while the writer overlaps the next capture. Only
+// enable it on boards without the LED on GPIO 4.
+#ifndef SD_BUS_4BIT
+#define SD_BUS_4BIT 0
+#endif
+#define FLASH_LED_GPIO 4
+#define STATS_EVERY 20                 // frames between throughput reports
+
+struct PooledFrame {
+  uint8_t *buf;
+  size_t len;
+};
+
+FrameRingLog frameLog;
+PooledFrame framePool[FRAME_POOL];
+QueueHandle_t freeFrames;              // pool indices ready for capture
+QueueHandle_t writeFrames;             // pool indices waiting for SD
+
+uint32_t framesSaved = 0;
+uint32_t framesSkipped = 0;            // pool full, SD fell behind
+uint32_t writeErrors = 0;
+uint64_t bytesWritten = 0;
+uint32_t writeMsTotal = 0;
 // ----------------------------------------------------
 
 
 void initCamera() {
-    // ... [Keep your EXACT same camera init code here] ...
-      camera_config_t config;
-  config.ledc_channel = LEDC_CHANNEL_0;
-  config.ledc_timer = LEDC_TIMER_0;
-  config.pin_d0 = Y2_GPIO_NUM;
-  config.pin_d1 = Y3_GPIO_NUM;
-  config.pin_d2 = Y4_GPIO_NUM;
-  config.pin_d3 = Y5_GPIO_NUM;
-  config.pin_d4 = Y6_GPIO_NUM;
-  config.pin_d5 = Y7_GPIO_NUM;
-  config.pin_d6 = Y8_GPIO_NUM;
-  config.pin_d7 = Y9_GPIO_NUM;
-  config.pin_xclk = XCLK_GPIO_NUM;
-  config.pin_pclk = PCLK_GPIO_NUM;
-  config.pin_vsync = VSYNC_GPIO_NUM;
-  config.pin_href = HREF_GPIO_NUM;
-  config.pin_sccb_sda = SIOD_GPIO_NUM;
-  config.pin_sccb_scl = SIOC_GPIO_NUM;
-  config.pin_pwdn = PWDN_GPIO_NUM;
-  config.pin_reset = RESET_GPIO_NUM;
-  config.xclk_freq_hz = 20000000;
-  config.pixel_format = PIXFORMAT_JPEG;
+  camera_config_t config = makeCameraConfig<BoardPins>(CAMERA_JPEG_PSRAM);
   
   // --- IMAGE QUALITY SETTINGS ---
   // FRAMESIZE_UXGA (1600x1200) is okay for SD card saving (it has enough buffer)
@@ -82,10 +65,12 @@ void initCamera() {
     config.frame_size = FRAMESIZE_SVGA; //
     config.jpeg_quality = 10; // 0-63, lower is higher quality
     config.fb_count = 2;
+    config.grab_mode = CAMERA_GRAB_LATEST; // newest frame, not one queued during the last write
   } else {
     config.frame_size = FRAMESIZE_SVGA;
     config.jpeg_quality = 12;
     config.fb_count = 1;
+    config.fb_location = CAMERA_FB_IN_DRAM;
   }
 
   // Init Camera
@@ -104,10 +89,20 @@ void initCamera() {
 
 void initSDCard() {
     // ... [Keep your EXACT same SD card init code here] ...
-      // Start SD card using 1-bit mode (saves pins if needed, but slightly slower)
-  // or just SD_MMC.begin() for standard 4-bit mode.
-  // 1-bit mode is often more stable on cheaper boards:
-  if(!SD_MMC.begin("/sdcard", true)){ 
+      // 4-bit mode roughly quadruples bus bandwidth (see SD_BUS_4BIT). Some
+  // cheaper boards are unstable in it, so fall back to 1-bit if the mount fails.
+  bool mounted = SD_BUS_4BIT && SD_MMC.begin("/sdcard", false, false, SDMMC_FREQ_HIGHSPEED);
+  if (mounted) {
+    Serial.println("SD Card mounted (4-bit, 40 MHz)");
+  } else {
+    mounted = SD_MMC.begin("/sdcard", true, false, SDMMC_FREQ_HIGHSPEED);
+    if (mounted) Serial.println("SD Card mounted (1-bit, 40 MHz)");
+    else if ((mounted = SD_MMC.begin("/sdcard", true))) Serial.println("SD Card mounted (1-bit)");
+    // GPIO 4 is free in 1-bit mode; hold the flash LED off
+    pinMode(FLASH_LED_GPIO, OUTPUT);
+    digitalWrite(FLASH_LED_GPIO, LOW);
+  }
+  if (!mounted) {
     Serial.println("SD Card Mount Failed");
     return;
   }
@@ -118,37 +113,92 @@ void initSDCard() {
     return;
   }
   Serial.println("SD Card initialized.");
+
+  // Depends only on the card size, so the same log is reused across boots
+  uint32_t slots = min<uint64_t>(FRAME_SLOT_MAX, SD_MMC.totalBytes() / 2 / FRAME_SLOT_SIZE);
+  Serial.println("Opening frame log (first run preallocates it)...");
+  // Never reformat: a geometry mismatch (other card, changed constants)
+  // would wipe the collected dataset
+  if (!frameLog.begin(SD_MMC, FRAME_LOG_PATH, FRAME_SLOT_SIZE, slots)) {
+    Serial.println("Frame log open failed; extract and remove " FRAME_LOG_PATH " to start a new one");
+    return;
+  }
+  Serial.printf("Frame log: %u/%u slots used\n", (unsigned)frameLog.pending(), (unsigned)frameLog.capacity());
+
+  uint8_t *staging = (uint8_t *)heap_caps_malloc(STAGING_BYTES, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  if (staging) {
+    frameLog.setStaging(staging, STAGING_BYTES);
+  } else {
+    Serial.println("No DMA staging buffer, writing straight from PSRAM");
+  }
+}
+
+// Owns frameLog after setup(); only task that touches the card
+void sdWriterTask(void *param) {
+  int slot;
+  for (;;) {
+    xQueueReceive(writeFrames, &slot, portMAX_DELAY);
+    PooledFrame &f = framePool[slot];
+
+    uint32_t t0 = millis();
+    bool ok = frameLog.append(f.buf, f.len);
+    uint32_t ms = millis() - t0;
+    if (ok) {
+      framesSaved++;
+      bytesWritten += f.len;
+      writeMsTotal += ms;
+    } else {
+      writeErrors++;
+    }
+    xQueueSend(freeFrames, &slot, 0);
+
+    if (ok && framesSaved % STATS_EVERY == 0) {
+      Serial.printf("SD: %u saved, %u skipped, %u errors, avg %u ms/frame, %.2f MB/s (%u stored, %u overwritten)\n",
+                    (unsigned)framesSaved, (unsigned)framesSkipped, (unsigned)writeErrors,
+                    (unsigned)(writeMsTotal / STATS_EVERY),
+                    writeMsTotal ? (bytesWritten / 1048576.0f) / (writeMsTotal / 1000.0f) : 0.0f,
+                    (unsigned)frameLog.pending(), (unsigned)frameLog.dropped());
+      bytesWritten = 0;
+      writeMsTotal = 0;
+    }
+  }
+}
+
+bool initPipeline() {
+  freeFrames = xQueueCreate(FRAME_POOL, sizeof(int));
+  writeFrames = xQueueCreate(FRAME_POOL, sizeof(int));
+  if (!freeFrames || !writeFrames) return false;
+  for (int i = 0; i < FRAME_POOL; i++) {
+    framePool[i].buf = (uint8_t *)ps_malloc(frameLog.maxFrameBytes());
+    if (!framePool[i].buf) return false;
+    xQueueSend(freeFrames, &i, 0);
+  }
+  xTaskCreatePinnedToCore(sdWriterTask, "sdWriter", 4096, NULL, 2, NULL, 0);
+  return true;
 }
 
 void takeSavePhoto() {
   camera_fb_t * fb = NULL;
   
   // 1. Take Picture
-  Serial.println("Taking picture...");
   fb = esp_camera_fb_get();
   if(!fb) {
     Serial.println("Camera capture failed");
     return;
   }
 
-  // 2. Generate File Path
-  pictureNumber++; // Increment first
-  String path = "/image" + String(pictureNumber) + ".jpg";
-  Serial.printf("Picture file name: %s\n", path.c_str());
-
-  // 3. Save to SD Card
-  fs::FS &fs = SD_MMC;
-  File file = fs.open(path.c_str(), FILE_WRITE);
-  if(!file){
-    Serial.println("Failed to open file in writing mode");
+  // 2. Copy into a free pool slot and give the framebuffer straight back
+  int slot;
+  if (fb->len > frameLog.maxFrameBytes()) {
+    Serial.printf("Frame too large for a slot: %u bytes\n", fb->len);
+    framesSkipped++;
+  } else if (xQueueReceive(freeFrames, &slot, 0) != pdTRUE) {
+    framesSkipped++;  // SD is behind; drop rather than stall the camera
   } else {
-    file.write(fb->buf, fb->len); 
-    Serial.printf("Saved: %s, Size: %u bytes\n", path.c_str(), fb->len);
-    
-    // --- NEW: Save the new number immediately ---
-    savePictureNumber(); 
+    memcpy(framePool[slot].buf, fb->buf, fb->len);
+    framePool[slot].len = fb->len;
+    xQueueSend(writeFrames, &slot, 0);
   }
-  file.close();
   esp_camera_fb_return(fb);
 }
 
@@ -160,13 +210,19 @@ void setup() {
 
   initCamera();
   initSDCard();
-  
-  // --- NEW: Read the last number on boot ---
-  getPictureNumber();
+  if (!frameLog.ready() || !initPipeline()) {
+    Serial.println("SD pipeline unavailable, halting");
+    while (true) delay(1000);
+  }
 }
 
 void loop() {
+  static uint32_t nextShot = 0;
+  uint32_t now = millis();
+  if ((int32_t)(now - nextShot) < 0) {
+    delay(nextShot - now);
+    return;
+  }
+  nextShot = now + CAPTURE_INTERVAL_MS;
   takeSavePhoto();
-  Serial.println("Waiting 5 seconds...");
-  delay(5000);
 }
\ No newline at end of file
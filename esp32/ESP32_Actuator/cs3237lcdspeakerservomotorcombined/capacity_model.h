@@ -0,0 +1,9210 @@
+// Generated by server/flask/Deployment/export_model_header.py from busstop_xgboost.json.
+// Do not edit; re-run the exporter after retraining.
+#pragma once
+#include <TreeEnsemble.h>
+
+namespace capacity_model {
+
+// Training column order (BusStopPredictor.feature_columns); -1 marks a
+// missing reading, as in run_inference.py
+enum Feature : uint8_t {
+  DENSITY,
+  SENSORS_CENTER_DISTANCE,
+  SENSORS_CENTER_OCCUPIED,
+  SENSORS_LEFT_DISTANCE,
+  SENSORS_LEFT_OCCUPIED,
+  SENSORS_RIGHT_DISTANCE,
+  SENSORS_RIGHT_OCCUPIED,
+  PEOPLE_COUNT,
+  VOICE,
+  CROWD_LEVEL,
+  CONFIDENCE,
+  FEATURE_COUNT
+};
+
+constexpr TreeNode NODES[9168] = {
+  {1, 2, 9, 0, 2.0f},
+  {3, 4, 9, 0, 1.0f},
+  {5, 6, 9, 0, 3.0f},
+  {7, 8, 7, 0, 6.0f},
+  {9, 10, 0, 0, 0.67f},
+  {11, 12, 0, 0, 1.0f},
+  {13, 14, 7, 0, 22.0f},
+  {15, 16, 2, 0, 1.0f},
+  {17, 18, 7, 0, 12.0f},
+  {19, 20, 1, 0, 11.21964f},
+  {21, 22, 7, 0, 15.0f},
+  {23, 24, 5, 0, 8.89814f},
+  {-1, -1, 0, 0, 1.1017741f},
+  {25, 26, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 1.4528167f},
+  {27, 28, 7, 0, 4.0f},
+  {29, 30, 0, 0, 0.67f},
+  {31, 32, 7, 0, 8.0f},
+  {33, 34, 7, 0, 13.0f},
+  {35, 36, 7, 0, 13.0f},
+  {37, 38, 8, 0, 1.0f},
+  {39, 40, 5, 0, 10.198943f},
+  {41, 42, 7, 0, 20.0f},
+  {43, 44, 3, 0, 23.86014f},
+  {45, 46, 0, 0, 0.33f},
+  {47, 48, 1, 0, 6.9701552f},
+  {-1, -1, 0, 0, 1.2507356f},
+  {49, 50, 7, 0, 0.0f},
+  {-1, -1, 0, 0, -0.7006081f},
+  {-1, -1, 0, 0, -0.4076863f},
+  {51, 52, 1, 0, 7.036378f},
+  {-1, -1, 0, 0, -0.5237643f},
+  {53, 54, 0, 0, 0.67f},
+  {55, 56, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.24319442f},
+  {57, 58, 0, 0, 0.33f},
+  {59, 60, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.85771304f},
+  {-1, -1, 0, 0, -0.30544445f},
+  {61, 62, 7, 0, 13.0f},
+  {63, 64, 1, 0, 3.0097222f},
+  {65, 66, 10, 0, 0.62730575f},
+  {-1, -1, 0, 0, 0.5534667f},
+  {67, 68, 7, 0, 21.0f},
+  {69, 70, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.19591665f},
+  {71, 72, 4, 0, 1.0f},
+  {73, 74, 5, 0, 3.0662608f},
+  {-1, -1, 0, 0, 0.343875f},
+  {-1, -1, 0, 0, -0.8024977f},
+  {-1, -1, 0, 0, -1.0211008f},
+  {-1, -1, 0, 0, 0.14387499f},
+  {-1, -1, 0, 0, -0.054083347f},
+  {-1, -1, 0, 0, -0.41762504f},
+  {-1, -1, 0, 0, -0.054083347f},
+  {-1, -1, 0, 0, 0.14591666f},
+  {-1, -1, 0, 0, -0.12653336f},
+  {-1, -1, 0, 0, -0.18571763f},
+  {-1, -1, 0, 0, -0.30572093f},
+  {-1, -1, 0, 0, 0.18418054f},
+  {-1, -1, 0, 0, 0.05986109f},
+  {-1, -1, 0, 0, 0.031671207f},
+  {-1, -1, 0, 0, 0.14210553f},
+  {-1, -1, 0, 0, 0.055354144f},
+  {-1, -1, 0, 0, -0.053891923f},
+  {-1, -1, 0, 0, 0.09319442f},
+  {-1, -1, 0, 0, 0.24048384f},
+  {-1, -1, 0, 0, 0.54783434f},
+  {-1, -1, 0, 0, 0.6726157f},
+  {-1, -1, 0, 0, -0.17211114f},
+  {-1, -1, 0, 0, 0.34319443f},
+  {-1, -1, 0, 0, -0.10612502f},
+  {-1, -1, 0, 0, -0.0040833475f},
+  {-1, -1, 0, 0, 0.24591665f},
+  {-1, -1, 0, 0, 1.00265f},
+  {76, 77, 9, 0, 2.0f},
+  {78, 79, 9, 0, 1.0f},
+  {80, 81, 9, 0, 3.0f},
+  {82, 83, 7, 0, 6.0f},
+  {84, 85, 0, 0, 0.67f},
+  {86, 87, 0, 0, 1.0f},
+  {88, 89, 7, 0, 28.0f},
+  {90, 91, 2, 0, 1.0f},
+  {92, 93, 7, 0, 11.0f},
+  {94, 95, 1, 0, 11.21964f},
+  {96, 97, 7, 0, 16.0f},
+  {98, 99, 5, 0, 8.89814f},
+  {-1, -1, 0, 0, 0.99515086f},
+  {100, 101, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 1.4057052f},
+  {102, 103, 7, 0, 4.0f},
+  {104, 105, 0, 0, 0.67f},
+  {106, 107, 0, 0, 0.67f},
+  {108, 109, 7, 0, 13.0f},
+  {110, 111, 7, 0, 13.0f},
+  {112, 113, 8, 0, 1.0f},
+  {114, 115, 7, 0, 13.0f},
+  {116, 117, 7, 0, 20.0f},
+  {118, 119, 3, 0, 21.570833f},
+  {120, 121, 0, 0, 0.33f},
+  {122, 123, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 1.2120972f},
+  {124, 125, 0, 0, 0.67f},
+  {-1, -1, 0, 0, -0.6318447f},
+  {-1, -1, 0, 0, -0.36931583f},
+  {126, 127, 1, 0, 7.036378f},
+  {128, 129, 2, 0, 1.0f},
+  {-1, -1, 0, 0, -0.051379204f},
+  {130, 131, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.22292821f},
+  {132, 133, 4, 0, 1.0f},
+  {134, 135, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.7767068f},
+  {-1, -1, 0, 0, -0.28508148f},
+  {136, 137, 7, 0, 0.0f},
+  {138, 139, 5, 0, 26.488493f},
+  {140, 141, 5, 0, 8.548659f},
+  {-1, -1, 0, 0, 0.5091893f},
+  {142, 143, 7, 0, 21.0f},
+  {144, 145, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.1861208f},
+  {146, 147, 4, 0, 1.0f},
+  {148, 149, 3, 0, 8.306931f},
+  {-1, -1, 0, 0, 0.47666955f},
+  {-1, -1, 0, 0, -0.8659859f},
+  {-1, -1, 0, 0, 0.13604155f},
+  {-1, -1, 0, 0, 0.13308434f},
+  {-1, -1, 0, 0, -0.051379204f},
+  {-1, -1, 0, 0, -0.47600612f},
+  {-1, -1, 0, 0, -0.38445243f},
+  {-1, -1, 0, 0, 0.13862081f},
+  {-1, -1, 0, 0, -0.124742925f},
+  {-1, -1, 0, 0, -0.2787947f},
+  {-1, -1, 0, 0, -0.16805477f},
+  {-1, -1, 0, 0, 0.16729735f},
+  {-1, -1, 0, 0, 0.054872658f},
+  {-1, -1, 0, 0, 0.10367435f},
+  {-1, -1, 0, 0, -0.043921437f},
+  {-1, -1, 0, 0, 0.13114212f},
+  {-1, -1, 0, 0, -0.020448579f},
+  {-1, -1, 0, 0, 0.24264598f},
+  {-1, -1, 0, 0, 0.050099593f},
+  {-1, -1, 0, 0, 0.49431306f},
+  {-1, -1, 0, 0, 0.6072225f},
+  {-1, -1, 0, 0, -0.16063704f},
+  {-1, -1, 0, 0, 0.31780276f},
+  {-1, -1, 0, 0, -0.09816565f},
+  {-1, -1, 0, 0, -0.0038791657f},
+  {-1, -1, 0, 0, 1.0473062f},
+  {-1, -1, 0, 0, 0.1787229f},
+  {151, 152, 9, 0, 2.0f},
+  {153, 154, 9, 0, 1.0f},
+  {155, 156, 9, 0, 3.0f},
+  {157, 158, 7, 0, 5.0f},
+  {159, 160, 0, 0, 0.67f},
+  {161, 162, 0, 0, 1.0f},
+  {163, 164, 7, 0, 28.0f},
+  {165, 166, 2, 0, 1.0f},
+  {167, 168, 7, 0, 11.0f},
+  {169, 170, 1, 0, 11.21964f},
+  {171, 172, 7, 0, 16.0f},
+  {173, 174, 5, 0, 8.89814f},
+  {-1, -1, 0, 0, 0.898846f},
+  {175, 176, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 1.2676905f},
+  {177, 178, 0, 0, 0.67f},
+  {179, 180, 0, 0, 0.67f},
+  {181, 182, 7, 0, 7.0f},
+  {183, 184, 7, 0, 13.0f},
+  {185, 186, 7, 0, 13.0f},
+  {187, 188, 7, 0, 5.0f},
+  {189, 190, 7, 0, 13.0f},
+  {191, 192, 7, 0, 20.0f},
+  {193, 194, 3, 0, 21.570833f},
+  {195, 196, 0, 0, 0.33f},
+  {197, 198, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 1.0925709f},
+  {199, 200, 7, 0, 3.0f},
+  {-1, -1, 0, 0, 0.12923947f},
+  {-1, -1, 0, 0, -0.33455667f},
+  {201, 202, 1, 0, 7.036378f},
+  {203, 204, 2, 0, 1.0f},
+  {205, 206, 0, 0, 0.67f},
+  {207, 208, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.20435087f},
+  {209, 210, 2, 0, 0.0f},
+  {211, 212, 10, 0, 0.926643f},
+  {-1, -1, 0, 0, -0.71882266f},
+  {-1, -1, 0, 0, -0.30964088f},
+  {213, 214, 7, 0, 0.0f},
+  {215, 216, 5, 0, 26.488493f},
+  {217, 218, 5, 0, 8.28008f},
+  {-1, -1, 0, 0, 0.46845412f},
+  {219, 220, 8, 0, 0.0f},
+  {221, 222, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.17681475f},
+  {223, 224, 4, 0, 1.0f},
+  {225, 226, 3, 0, 8.306931f},
+  {-1, -1, 0, 0, 0.434961f},
+  {-1, -1, 0, 0, -0.79477125f},
+  {-1, -1, 0, 0, -0.63927436f},
+  {-1, -1, 0, 0, 0.12310302f},
+  {-1, -1, 0, 0, -0.048810244f},
+  {-1, -1, 0, 0, -0.5041381f},
+  {-1, -1, 0, 0, -0.33394995f},
+  {-1, -1, 0, 0, -0.3669336f},
+  {-1, -1, 0, 0, -0.048810244f},
+  {-1, -1, 0, 0, 0.13168979f},
+  {-1, -1, 0, 0, -0.11434771f},
+  {-1, -1, 0, 0, -0.31283018f},
+  {-1, -1, 0, 0, -0.2028131f},
+  {-1, -1, 0, 0, 0.13554095f},
+  {-1, -1, 0, 0, -0.021657228f},
+  {-1, -1, 0, 0, 0.09357979f},
+  {-1, -1, 0, 0, -0.039591152f},
+  {-1, -1, 0, 0, 0.11833292f},
+  {-1, -1, 0, 0, -0.018659318f},
+  {-1, -1, 0, 0, 0.2270807f},
+  {-1, -1, 0, 0, 0.08546389f},
+  {-1, -1, 0, 0, 0.33855984f},
+  {-1, -1, 0, 0, 0.47785527f},
+  {-1, -1, 0, 0, -0.1499279f},
+  {-1, -1, 0, 0, 0.29056257f},
+  {-1, -1, 0, 0, -0.09080324f},
+  {-1, -1, 0, 0, -0.0036851882f},
+  {-1, -1, 0, 0, 0.94839394f},
+  {-1, -1, 0, 0, 0.16978674f},
+  {228, 229, 9, 0, 2.0f},
+  {230, 231, 9, 0, 1.0f},
+  {232, 233, 9, 0, 3.0f},
+  {234, 235, 7, 0, 5.0f},
+  {236, 237, 0, 0, 0.67f},
+  {238, 239, 0, 0, 1.0f},
+  {240, 241, 7, 0, 24.0f},
+  {242, 243, 2, 0, 1.0f},
+  {244, 245, 7, 0, 11.0f},
+  {246, 247, 1, 0, 11.21964f},
+  {248, 249, 7, 0, 15.0f},
+  {250, 251, 5, 0, 8.89814f},
+  {-1, -1, 0, 0, 0.811861f},
+  {252, 253, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 1.0868067f},
+  {254, 255, 7, 0, 0.0f},
+  {256, 257, 0, 0, 0.67f},
+  {258, 259, 7, 0, 8.0f},
+  {260, 261, 7, 0, 13.0f},
+  {262, 263, 7, 0, 13.0f},
+  {264, 265, 7, 0, 5.0f},
+  {266, 267, 5, 0, 10.198943f},
+  {268, 269, 7, 0, 20.0f},
+  {270, 271, 3, 0, 21.570833f},
+  {272, 273, 0, 0, 0.33f},
+  {274, 275, 1, 0, 6.9701552f},
+  {-1, -1, 0, 0, 0.93869776f},
+  {276, 277, 0, 0, 0.67f},
+  {278, 279, 7, 0, 2.0f},
+  {-1, -1, 0, 0, -0.303069f},
+  {280, 281, 1, 0, 7.036378f},
+  {282, 283, 2, 0, 1.0f},
+  {284, 285, 10, 0, 0.93222106f},
+  {286, 287, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.18732166f},
+  {288, 289, 0, 0, 0.33f},
+  {290, 291, 8, 0, 1.0f},
+  {292, 293, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.2864178f},
+  {294, 295, 7, 0, 0.0f},
+  {296, 297, 1, 0, 3.0097222f},
+  {298, 299, 10, 0, 0.62730575f},
+  {-1, -1, 0, 0, 0.4309778f},
+  {300, 301, 7, 0, 21.0f},
+  {302, 303, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.167974f},
+  {304, 305, 4, 0, 1.0f},
+  {306, 307, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 0.30210978f},
+  {-1, -1, 0, 0, -0.57364625f},
+  {-1, -1, 0, 0, 0.122777514f},
+  {-1, -1, 0, 0, -0.83719045f},
+  {-1, -1, 0, 0, -0.61942875f},
+  {-1, -1, 0, 0, 0.113870285f},
+  {-1, -1, 0, 0, -0.046369743f},
+  {-1, -1, 0, 0, -0.43648314f},
+  {-1, -1, 0, 0, -0.3148485f},
+  {-1, -1, 0, 0, -0.30427966f},
+  {-1, -1, 0, 0, -0.045632746f},
+  {-1, -1, 0, 0, 0.12510529f},
+  {-1, -1, 0, 0, -0.10481876f},
+  {-1, -1, 0, 0, -0.12207728f},
+  {-1, -1, 0, 0, -0.22771803f},
+  {-1, -1, 0, 0, 0.14084715f},
+  {-1, -1, 0, 0, 0.039004866f},
+  {-1, -1, 0, 0, -0.66828984f},
+  {-1, -1, 0, 0, -0.1886159f},
+  {-1, -1, 0, 0, 0.12013532f},
+  {-1, -1, 0, 0, 0.025810415f},
+  {-1, -1, 0, 0, 0.039617326f},
+  {-1, -1, 0, 0, -0.04899345f},
+  {-1, -1, 0, 0, 0.06767609f},
+  {-1, -1, 0, 0, 0.1810707f},
+  {-1, -1, 0, 0, 0.39884603f},
+  {-1, -1, 0, 0, 0.5040504f},
+  {-1, -1, 0, 0, -0.13993269f},
+  {-1, -1, 0, 0, 0.2656572f},
+  {-1, -1, 0, 0, -0.08399301f},
+  {-1, -1, 0, 0, -0.0035009384f},
+  {-1, -1, 0, 0, 0.76829684f},
+  {-1, -1, 0, 0, 0.2921613f},
+  {309, 310, 9, 0, 2.0f},
+  {311, 312, 9, 0, 1.0f},
+  {313, 314, 9, 0, 3.0f},
+  {315, 316, 7, 0, 6.0f},
+  {317, 318, 0, 0, 0.67f},
+  {319, 320, 0, 0, 1.0f},
+  {321, 322, 7, 0, 29.0f},
+  {323, 324, 2, 0, 1.0f},
+  {325, 326, 7, 0, 12.0f},
+  {327, 328, 1, 0, 11.21964f},
+  {329, 330, 7, 0, 16.0f},
+  {331, 332, 5, 0, 8.89814f},
+  {333, 334, 7, 0, 28.0f},
+  {335, 336, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 1.0486838f},
+  {337, 338, 7, 0, 3.0f},
+  {339, 340, 0, 0, 0.67f},
+  {341, 342, 7, 0, 8.0f},
+  {343, 344, 7, 0, 13.0f},
+  {345, 346, 7, 0, 13.0f},
+  {347, 348, 7, 0, 5.0f},
+  {349, 350, 7, 0, 13.0f},
+  {351, 352, 7, 0, 20.0f},
+  {353, 354, 3, 0, 21.570833f},
+  {355, 356, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 0.6476972f},
+  {-1, -1, 0, 0, 1.0488561f},
+  {357, 358, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 0.8931697f},
+  {359, 360, 7, 0, 0.0f},
+  {-1, -1, 0, 0, -0.4948897f},
+  {-1, -1, 0, 0, -0.27454484f},
+  {361, 362, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, -0.34779215f},
+  {363, 364, 10, 0, 0.93222106f},
+  {365, 366, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.17171153f},
+  {367, 368, 4, 0, 1.0f},
+  {369, 370, 10, 0, 0.926643f},
+  {-1, -1, 0, 0, -0.5910925f},
+  {-1, -1, 0, 0, -0.26493648f},
+  {371, 372, 7, 0, 0.0f},
+  {373, 374, 5, 0, 26.488493f},
+  {375, 376, 5, 0, 8.28008f},
+  {-1, -1, 0, 0, 0.39649957f},
+  {377, 378, 7, 0, 17.0f},
+  {379, 380, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.15957527f},
+  {381, 382, 4, 0, 1.0f},
+  {383, 384, 3, 0, 8.306931f},
+  {-1, -1, 0, 0, 0.3510986f},
+  {-1, -1, 0, 0, -0.5066678f},
+  {-1, -1, 0, 0, -0.71490085f},
+  {-1, -1, 0, 0, -0.015887516f},
+  {-1, -1, 0, 0, 0.12696f},
+  {-1, -1, 0, 0, -0.27444836f},
+  {-1, -1, 0, 0, -0.07290519f},
+  {-1, -1, 0, 0, 0.118850045f},
+  {-1, -1, 0, 0, -0.08889801f},
+  {-1, -1, 0, 0, -0.20861724f},
+  {-1, -1, 0, 0, -0.10905504f},
+  {-1, -1, 0, 0, 0.11281212f},
+  {-1, -1, 0, 0, -0.02761674f},
+  {-1, -1, 0, 0, 0.0771788f},
+  {-1, -1, 0, 0, -0.036058903f},
+  {-1, -1, 0, 0, 0.10148636f},
+  {-1, -1, 0, 0, -0.01707387f},
+  {-1, -1, 0, 0, 0.18887335f},
+  {-1, -1, 0, 0, 0.06640905f},
+  {-1, -1, 0, 0, 0.33694246f},
+  {-1, -1, 0, 0, 0.41283545f},
+  {-1, -1, 0, 0, -0.13060385f},
+  {-1, -1, 0, 0, 0.24288657f},
+  {-1, -1, 0, 0, -0.07769354f},
+  {-1, -1, 0, 0, -0.0033258914f},
+  {-1, -1, 0, 0, 0.7719485f},
+  {-1, -1, 0, 0, 0.14619194f},
+  {386, 387, 9, 0, 2.0f},
+  {388, 389, 9, 0, 1.0f},
+  {390, 391, 9, 0, 3.0f},
+  {392, 393, 7, 0, 5.0f},
+  {394, 395, 0, 0, 0.67f},
+  {396, 397, 0, 0, 1.0f},
+  {398, 399, 7, 0, 28.0f},
+  {400, 401, 2, 0, 1.0f},
+  {402, 403, 7, 0, 12.0f},
+  {404, 405, 1, 0, 11.21964f},
+  {406, 407, 7, 0, 16.0f},
+  {408, 409, 5, 0, 8.89814f},
+  {410, 411, 7, 0, 28.0f},
+  {412, 413, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 0.93569726f},
+  {414, 415, 0, 0, 0.67f},
+  {416, 417, 6, 0, 1.0f},
+  {418, 419, 1, 0, 12.221915f},
+  {420, 421, 7, 0, 13.0f},
+  {422, 423, 7, 0, 13.0f},
+  {424, 425, 8, 0, 1.0f},
+  {426, 427, 7, 0, 13.0f},
+  {428, 429, 7, 0, 20.0f},
+  {430, 431, 3, 0, 9.852974f},
+  {432, 433, 0, 0, 0.33f},
+  {434, 435, 1, 0, 6.2872834f},
+  {-1, -1, 0, 0, 0.9649477f},
+  {436, 437, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 0.7980176f},
+  {438, 439, 4, 0, 1.0f},
+  {-1, -1, 0, 0, 0.14197202f},
+  {440, 441, 3, 0, 3.892201f},
+  {442, 443, 1, 0, 3.0952337f},
+  {444, 445, 0, 0, 0.67f},
+  {446, 447, 4, 0, 1.0f},
+  {448, 449, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.1574022f},
+  {450, 451, 2, 0, 0.0f},
+  {452, 453, 8, 0, 1.0f},
+  {454, 455, 7, 0, 4.0f},
+  {-1, -1, 0, 0, -0.18742518f},
+  {456, 457, 7, 0, 0.0f},
+  {458, 459, 5, 0, 21.658485f},
+  {460, 461, 5, 0, 8.548659f},
+  {-1, -1, 0, 0, 0.3647796f},
+  {462, 463, 8, 0, 0.0f},
+  {464, 465, 7, 0, 13.0f},
+  {-1, -1, 0, 0, 0.1515965f},
+  {466, 467, 4, 0, 1.0f},
+  {468, 469, 3, 0, 6.576387f},
+  {-1, -1, 0, 0, 0.46840674f},
+  {470, 471, 3, 0, 8.306931f},
+  {-1, -1, 0, 0, 0.3203774f},
+  {-1, -1, 0, 0, -0.5614492f},
+  {-1, -1, 0, 0, -0.03587316f},
+  {-1, -1, 0, 0, -0.12085241f},
+  {-1, -1, 0, 0, -0.26501733f},
+  {-1, -1, 0, 0, 0.021014357f},
+  {-1, -1, 0, 0, 0.118496f},
+  {-1, -1, 0, 0, -0.2663757f},
+  {-1, -1, 0, 0, -0.017433358f},
+  {-1, -1, 0, 0, -0.35928333f},
+  {-1, -1, 0, 0, -0.08967409f},
+  {-1, -1, 0, 0, 0.11290755f},
+  {-1, -1, 0, 0, -0.08178619f},
+  {-1, -1, 0, 0, -0.24410605f},
+  {-1, -1, 0, 0, -0.1442536f},
+  {-1, -1, 0, 0, 0.11876529f},
+  {-1, -1, 0, 0, 0.026353423f},
+  {-1, -1, 0, 0, -0.5817578f},
+  {-1, -1, 0, 0, -0.3263272f},
+  {-1, -1, 0, 0, 0.069664f},
+  {-1, -1, 0, 0, -0.032503784f},
+  {-1, -1, 0, 0, 0.09405034f},
+  {-1, -1, 0, 0, -0.0043031885f},
+  {-1, -1, 0, 0, 0.16541182f},
+  {-1, -1, 0, 0, 0.028343234f},
+  {-1, -1, 0, 0, 0.2288075f},
+  {-1, -1, 0, 0, 0.35421097f},
+  {-1, -1, 0, 0, -0.035082962f},
+  {-1, -1, 0, 0, 0.22815171f},
+  {-1, -1, 0, 0, -0.07186649f},
+  {-1, -1, 0, 0, -0.0031596185f},
+  {-1, -1, 0, 0, 0.8396861f},
+  {-1, -1, 0, 0, 0.4052504f},
+  {-1, -1, 0, 0, 0.6991998f},
+  {-1, -1, 0, 0, 0.13888235f},
+  {473, 474, 9, 0, 2.0f},
+  {475, 476, 1, 0, 11.21964f},
+  {477, 478, 9, 0, 3.0f},
+  {479, 480, 0, 0, 0.67f},
+  {481, 482, 7, 0, 4.0f},
+  {483, 484, 0, 0, 1.0f},
+  {485, 486, 7, 0, 24.0f},
+  {487, 488, 9, 0, 1.0f},
+  {489, 490, 7, 0, 14.0f},
+  {491, 492, 7, 0, 0.0f},
+  {493, 494, 7, 0, 8.0f},
+  {495, 496, 5, 0, 8.89814f},
+  {497, 498, 7, 0, 28.0f},
+  {499, 500, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 0.8005027f},
+  {501, 502, 7, 0, 6.0f},
+  {503, 504, 7, 0, 13.0f},
+  {505, 506, 5, 0, 10.198943f},
+  {507, 508, 7, 0, 20.0f},
+  {509, 510, 1, 0, 37.34242f},
+  {511, 512, 7, 0, 2.0f},
+  {513, 514, 4, 0, 1.0f},
+  {-1, -1, 0, 0, -0.20343173f},
+  {515, 516, 3, 0, 9.852974f},
+  {517, 518, 0, 0, 0.33f},
+  {519, 520, 1, 0, 6.2872834f},
+  {-1, -1, 0, 0, 0.88775176f},
+  {521, 522, 5, 0, 8.217814f},
+  {-1, -1, 0, 0, 0.681971f},
+  {523, 524, 7, 0, 0.0f},
+  {525, 526, 7, 0, 11.0f},
+  {527, 528, 6, 0, 1.0f},
+  {529, 530, 10, 0, 0.926643f},
+  {531, 532, 7, 0, 0.0f},
+  {533, 534, 3, 0, 14.859064f},
+  {535, 536, 10, 0, 0.6094279f},
+  {-1, -1, 0, 0, 0.33559725f},
+  {537, 538, 1, 0, 11.328481f},
+  {539, 540, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.6340654f},
+  {-1, -1, 0, 0, -0.4735082f},
+  {-1, -1, 0, 0, -0.35134205f},
+  {-1, -1, 0, 0, -0.08519039f},
+  {541, 542, 7, 0, 21.0f},
+  {543, 544, 7, 0, 13.0f},
+  {-1, -1, 0, 0, 0.1440167f},
+  {545, 546, 4, 0, 1.0f},
+  {547, 548, 3, 0, 6.576387f},
+  {-1, -1, 0, 0, 0.4244936f},
+  {549, 550, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 0.14426686f},
+  {-1, -1, 0, 0, -0.3065982f},
+  {-1, -1, 0, 0, -0.5034224f},
+  {-1, -1, 0, 0, -0.23789184f},
+  {-1, -1, 0, 0, -0.010829366f},
+  {-1, -1, 0, 0, -0.17406665f},
+  {-1, -1, 0, 0, -0.085568085f},
+  {-1, -1, 0, 0, 0.093989626f},
+  {-1, -1, 0, 0, -0.03217416f},
+  {-1, -1, 0, 0, 0.1032512f},
+  {-1, -1, 0, 0, 0.012238319f},
+  {-1, -1, 0, 0, -0.016595868f},
+  {-1, -1, 0, 0, -0.08992915f},
+  {-1, -1, 0, 0, 0.024688913f},
+  {-1, -1, 0, 0, 0.12639788f},
+  {-1, -1, 0, 0, -0.048832417f},
+  {-1, -1, 0, 0, -0.49943635f},
+  {-1, -1, 0, 0, -0.30188736f},
+  {-1, -1, 0, 0, -0.06510989f},
+  {-1, -1, 0, 0, 0.29058063f},
+  {-1, -1, 0, 0, 0.38733697f},
+  {-1, -1, 0, 0, -0.03245175f},
+  {-1, -1, 0, 0, 0.20741068f},
+  {-1, -1, 0, 0, -0.06647654f},
+  {-1, -1, 0, 0, -0.0030016422f},
+  {-1, -1, 0, 0, 0.7677131f},
+  {-1, -1, 0, 0, 0.37147954f},
+  {-1, -1, 0, 0, 0.5667468f},
+  {-1, -1, 0, 0, 0.2821421f},
+  {552, 553, 9, 0, 2.0f},
+  {554, 555, 1, 0, 11.21964f},
+  {556, 557, 0, 0, 1.0f},
+  {558, 559, 0, 0, 0.67f},
+  {560, 561, 7, 0, 4.0f},
+  {562, 563, 7, 0, 26.0f},
+  {564, 565, 7, 0, 28.0f},
+  {566, 567, 7, 0, 7.0f},
+  {568, 569, 7, 0, 15.0f},
+  {570, 571, 7, 0, 0.0f},
+  {572, 573, 7, 0, 8.0f},
+  {574, 575, 5, 0, 8.574515f},
+  {-1, -1, 0, 0, 0.6954887f},
+  {576, 577, 9, 0, 3.0f},
+  {-1, -1, 0, 0, 0.78407466f},
+  {578, 579, 2, 0, 0.0f},
+  {580, 581, 7, 0, 12.0f},
+  {582, 583, 5, 0, 10.198943f},
+  {584, 585, 7, 0, 20.0f},
+  {586, 587, 1, 0, 37.34242f},
+  {588, 589, 7, 0, 1.0f},
+  {590, 591, 4, 0, 1.0f},
+  {-1, -1, 0, 0, -0.18563142f},
+  {592, 593, 9, 0, 3.0f},
+  {594, 595, 4, 0, 1.0f},
+  {596, 597, 1, 0, 6.2872834f},
+  {-1, -1, 0, 0, 0.6471355f},
+  {598, 599, 4, 0, 1.0f},
+  {600, 601, 9, 0, 1.0f},
+  {602, 603, 9, 0, 1.0f},
+  {604, 605, 0, 0, 0.33f},
+  {606, 607, 7, 0, 0.0f},
+  {608, 609, 10, 0, 0.7735864f},
+  {610, 611, 10, 0, 0.62730575f},
+  {-1, -1, 0, 0, 0.30874947f},
+  {612, 613, 1, 0, 11.328481f},
+  {614, 615, 4, 0, 1.0f},
+  {-1, -1, 0, 0, -0.61534184f},
+  {-1, -1, 0, 0, -0.4558165f},
+  {-1, -1, 0, 0, -0.3166164f},
+  {-1, -1, 0, 0, -0.08093085f},
+  {616, 617, 3, 0, 9.852974f},
+  {618, 619, 0, 0, 0.33f},
+  {620, 621, 7, 0, 13.0f},
+  {622, 623, 5, 0, 21.461452f},
+  {624, 625, 3, 0, 6.576387f},
+  {-1, -1, 0, 0, 0.3846973f},
+  {-1, -1, 0, 0, -0.40788022f},
+  {-1, -1, 0, 0, 0.01739771f},
+  {-1, -1, 0, 0, -0.20478693f},
+  {-1, -1, 0, 0, -0.07424934f},
+  {-1, -1, 0, 0, -0.19730508f},
+  {-1, -1, 0, 0, -0.1269282f},
+  {-1, -1, 0, 0, 0.078192115f},
+  {-1, -1, 0, 0, -0.070684984f},
+  {-1, -1, 0, 0, 0.09327022f},
+  {-1, -1, 0, 0, 0.0204356f},
+  {-1, -1, 0, 0, -0.008007764f},
+  {-1, -1, 0, 0, -0.06490826f},
+  {-1, -1, 0, 0, 0.042943098f},
+  {-1, -1, 0, 0, 0.12647825f},
+  {-1, -1, 0, 0, -0.046390798f},
+  {-1, -1, 0, 0, -0.450807f},
+  {-1, -1, 0, 0, -0.2660389f},
+  {-1, -1, 0, 0, -0.010016823f},
+  {-1, -1, 0, 0, 0.27969962f},
+  {-1, -1, 0, 0, 0.13957393f},
+  {-1, -1, 0, 0, 0.48483172f},
+  {-1, -1, 0, 0, 0.27098197f},
+  {-1, -1, 0, 0, -0.14888345f},
+  {-1, -1, 0, 0, 0.08717259f},
+  {-1, -1, 0, 0, 0.2356094f},
+  {-1, -1, 0, 0, -0.0028515817f},
+  {-1, -1, 0, 0, 0.7019091f},
+  {-1, -1, 0, 0, 0.34052297f},
+  {627, 628, 9, 0, 2.0f},
+  {629, 630, 1, 0, 11.21964f},
+  {631, 632, 0, 0, 1.0f},
+  {633, 634, 0, 0, 0.67f},
+  {635, 636, 7, 0, 3.0f},
+  {637, 638, 7, 0, 26.0f},
+  {639, 640, 7, 0, 30.0f},
+  {641, 642, 7, 0, 9.0f},
+  {643, 644, 7, 0, 13.0f},
+  {645, 646, 7, 0, 0.0f},
+  {647, 648, 7, 0, 6.0f},
+  {649, 650, 5, 0, 8.574515f},
+  {-1, -1, 0, 0, 0.6302867f},
+  {651, 652, 9, 0, 3.0f},
+  {-1, -1, 0, 0, 0.7353071f},
+  {653, 654, 2, 0, 0.0f},
+  {655, 656, 7, 0, 13.0f},
+  {657, 658, 7, 0, 0.0f},
+  {659, 660, 7, 0, 20.0f},
+  {661, 662, 1, 0, 38.15698f},
+  {663, 664, 7, 0, 1.0f},
+  {-1, -1, 0, 0, -0.32498416f},
+  {665, 666, 5, 0, 48.242767f},
+  {667, 668, 9, 0, 3.0f},
+  {669, 670, 4, 0, 1.0f},
+  {671, 672, 1, 0, 6.2872834f},
+  {-1, -1, 0, 0, 0.5927108f},
+  {673, 674, 7, 0, 7.0f},
+  {675, 676, 9, 0, 1.0f},
+  {677, 678, 0, 0, 0.33f},
+  {679, 680, 3, 0, 8.158109f},
+  {681, 682, 3, 0, 19.831232f},
+  {683, 684, 7, 0, 11.0f},
+  {685, 686, 5, 0, 4.859941f},
+  {-1, -1, 0, 0, 0.28404954f},
+  {687, 688, 5, 0, 43.96941f},
+  {689, 690, 5, 0, 34.90521f},
+  {-1, -1, 0, 0, -0.5553085f},
+  {-1, -1, 0, 0, -0.43402678f},
+  {-1, -1, 0, 0, -0.23991118f},
+  {-1, -1, 0, 0, -0.045172263f},
+  {691, 692, 3, 0, 23.86014f},
+  {693, 694, 0, 0, 0.33f},
+  {695, 696, 10, 0, 0.8141858f},
+  {697, 698, 5, 0, 21.461452f},
+  {699, 700, 3, 0, 6.576387f},
+  {-1, -1, 0, 0, 0.34863195f},
+  {-1, -1, 0, 0, -0.34914443f},
+  {-1, -1, 0, 0, -0.15368919f},
+  {-1, -1, 0, 0, -0.19220763f},
+  {-1, -1, 0, 0, -0.11155649f},
+  {-1, -1, 0, 0, -0.032038387f},
+  {-1, -1, 0, 0, -0.113931656f},
+  {-1, -1, 0, 0, 0.0977758f},
+  {-1, -1, 0, 0, 0.011988831f},
+  {-1, -1, 0, 0, 0.09098213f},
+  {-1, -1, 0, 0, -0.12690431f},
+  {-1, -1, 0, 0, -0.06524377f},
+  {-1, -1, 0, 0, -0.0006075138f},
+  {-1, -1, 0, 0, 0.12567541f},
+  {-1, -1, 0, 0, 0.052390605f},
+  {-1, -1, 0, 0, -0.41990548f},
+  {-1, -1, 0, 0, -0.15615603f},
+  {-1, -1, 0, 0, -0.12805477f},
+  {-1, -1, 0, 0, -0.33065414f},
+  {-1, -1, 0, 0, 0.249806f},
+  {-1, -1, 0, 0, 0.08268102f},
+  {-1, -1, 0, 0, 0.4403889f},
+  {-1, -1, 0, 0, 0.24775493f},
+  {-1, -1, 0, 0, 0.061204653f},
+  {-1, -1, 0, 0, -0.17236754f},
+  {-1, -1, 0, 0, 0.21499358f},
+  {-1, -1, 0, 0, -0.0027090074f},
+  {-1, -1, 0, 0, 0.6417454f},
+  {-1, -1, 0, 0, 0.31214607f},
+  {702, 703, 9, 0, 2.0f},
+  {704, 705, 1, 0, 11.21964f},
+  {706, 707, 0, 0, 1.0f},
+  {708, 709, 0, 0, 0.67f},
+  {710, 711, 7, 0, 4.0f},
+  {712, 713, 7, 0, 26.0f},
+  {714, 715, 7, 0, 28.0f},
+  {716, 717, 9, 0, 1.0f},
+  {718, 719, 7, 0, 15.0f},
+  {720, 721, 7, 0, 0.0f},
+  {722, 723, 7, 0, 7.0f},
+  {724, 725, 3, 0, 9.852974f},
+  {-1, -1, 0, 0, 0.5711973f},
+  {726, 727, 9, 0, 3.0f},
+  {-1, -1, 0, 0, 0.63917166f},
+  {728, 729, 7, 0, 4.0f},
+  {730, 731, 0, 0, 0.33f},
+  {732, 733, 3, 0, 31.012392f},
+  {734, 735, 7, 0, 20.0f},
+  {736, 737, 1, 0, 37.34242f},
+  {738, 739, 7, 0, 2.0f},
+  {740, 741, 4, 0, 1.0f},
+  {742, 743, 5, 0, 48.053078f},
+  {744, 745, 9, 0, 3.0f},
+  {746, 747, 7, 0, 13.0f},
+  {748, 749, 1, 0, 6.2872834f},
+  {-1, -1, 0, 0, 0.52487296f},
+  {750, 751, 7, 0, 0.0f},
+  {752, 753, 7, 0, 11.0f},
+  {754, 755, 6, 0, 1.0f},
+  {756, 757, 7, 0, 8.0f},
+  {758, 759, 1, 0, 6.0881815f},
+  {760, 761, 1, 0, 3.0097222f},
+  {762, 763, 5, 0, 4.410779f},
+  {-1, -1, 0, 0, 0.26132554f},
+  {764, 765, 8, 0, 0.0f},
+  {766, 767, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.46819067f},
+  {-1, -1, 0, 0, -0.34464827f},
+  {-1, -1, 0, 0, -0.26626313f},
+  {-1, -1, 0, 0, -0.06488877f},
+  {-1, -1, 0, 0, -0.20020042f},
+  {-1, -1, 0, 0, -0.042913627f},
+  {768, 769, 7, 0, 17.0f},
+  {770, 771, 5, 0, 8.217814f},
+  {772, 773, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.16075355f},
+  {774, 775, 3, 0, 6.576387f},
+  {-1, -1, 0, 0, 0.31594762f},
+  {-1, -1, 0, 0, -0.21931325f},
+  {-1, -1, 0, 0, -0.4080279f},
+  {-1, -1, 0, 0, -0.17603992f},
+  {-1, -1, 0, 0, -0.0053062798f},
+  {-1, -1, 0, 0, -0.06396421f},
+  {-1, -1, 0, 0, 0.07709581f},
+  {-1, -1, 0, 0, -0.1761427f},
+  {-1, -1, 0, 0, -0.09526002f},
+  {-1, -1, 0, 0, -0.0009584729f},
+  {-1, -1, 0, 0, 0.060210317f},
+  {-1, -1, 0, 0, 0.049043037f},
+  {-1, -1, 0, 0, -0.08077553f},
+  {-1, -1, 0, 0, 0.12712736f},
+  {-1, -1, 0, 0, 0.07249688f},
+  {-1, -1, 0, 0, -0.07376661f},
+  {-1, -1, 0, 0, -0.3740373f},
+  {-1, -1, 0, 0, -0.23023081f},
+  {-1, -1, 0, 0, -0.03449634f},
+  {-1, -1, 0, 0, 0.18612045f},
+  {-1, -1, 0, 0, 0.25212035f},
+  {-1, -1, 0, 0, 0.36640832f},
+  {-1, -1, 0, 0, 0.09886246f},
+  {-1, -1, 0, 0, 0.09658718f},
+  {-1, -1, 0, 0, -0.11061013f},
+  {-1, -1, 0, 0, 0.5867387f},
+  {-1, -1, 0, 0, 0.28613397f},
+  {777, 778, 9, 0, 2.0f},
+  {779, 780, 1, 0, 11.21964f},
+  {781, 782, 0, 0, 1.0f},
+  {783, 784, 0, 0, 0.67f},
+  {785, 786, 7, 0, 3.0f},
+  {787, 788, 7, 0, 26.0f},
+  {789, 790, 7, 0, 30.0f},
+  {791, 792, 7, 0, 9.0f},
+  {793, 794, 7, 0, 14.0f},
+  {795, 796, 7, 0, 0.0f},
+  {797, 798, 7, 0, 6.0f},
+  {799, 800, 5, 0, 8.574515f},
+  {-1, -1, 0, 0, 0.5176475f},
+  {801, 802, 9, 0, 3.0f},
+  {-1, -1, 0, 0, 0.60157394f},
+  {803, 804, 2, 0, 0.0f},
+  {805, 806, 7, 0, 13.0f},
+  {807, 808, 3, 0, 5.203249f},
+  {809, 810, 7, 0, 20.0f},
+  {811, 812, 3, 0, 12.934116f},
+  {813, 814, 7, 0, 1.0f},
+  {-1, -1, 0, 0, -0.2637386f},
+  {815, 816, 5, 0, 48.242767f},
+  {817, 818, 8, 0, 0.0f},
+  {819, 820, 10, 0, 0.9328334f},
+  {821, 822, 1, 0, 6.2872834f},
+  {-1, -1, 0, 0, 0.4802663f},
+  {823, 824, 4, 0, 1.0f},
+  {825, 826, 4, 0, 1.0f},
+  {827, 828, 0, 0, 0.33f},
+  {829, 830, 7, 0, 15.0f},
+  {831, 832, 3, 0, 4.080981f},
+  {833, 834, 3, 0, 31.012392f},
+  {835, 836, 8, 0, 0.0f},
+  {-1, -1, 0, 0, 0.24041946f},
+  {837, 838, 5, 0, 34.90521f},
+  {839, 840, 1, 0, 11.328481f},
+  {-1, -1, 0, 0, -0.45545492f},
+  {-1, -1, 0, 0, -0.35131618f},
+  {841, 842, 7, 0, 9.0f},
+  {-1, -1, 0, 0, -0.040767957f},
+  {843, 844, 0, 0, 0.33f},
+  {845, 846, 9, 0, 3.0f},
+  {847, 848, 5, 0, 8.89814f},
+  {-1, -1, 0, 0, -0.19235598f},
+  {849, 850, 3, 0, 6.576387f},
+  {-1, -1, 0, 0, 0.28632745f},
+  {-1, -1, 0, 0, -0.27514756f},
+  {-1, -1, 0, 0, 0.024671681f},
+  {-1, -1, 0, 0, -0.13238968f},
+  {-1, -1, 0, 0, -0.03121013f},
+  {-1, -1, 0, 0, -0.026024431f},
+  {-1, -1, 0, 0, -0.09217679f},
+  {-1, -1, 0, 0, 0.013725817f},
+  {-1, -1, 0, 0, 0.09742727f},
+  {-1, -1, 0, 0, 0.014674315f},
+  {-1, -1, 0, 0, 0.17111942f},
+  {-1, -1, 0, 0, -0.0036998973f},
+  {-1, -1, 0, 0, -0.06894883f},
+  {-1, -1, 0, 0, -0.008069f},
+  {-1, -1, 0, 0, 0.08753502f},
+  {-1, -1, 0, 0, -0.06391553f},
+  {-1, -1, 0, 0, -0.27739272f},
+  {-1, -1, 0, 0, -0.01756158f},
+  {-1, -1, 0, 0, -0.33701956f},
+  {-1, -1, 0, 0, -0.19906847f},
+  {-1, -1, 0, 0, -0.07335793f},
+  {-1, -1, 0, 0, -0.09702688f},
+  {-1, -1, 0, 0, 0.14278993f},
+  {-1, -1, 0, 0, 0.20856355f},
+  {-1, -1, 0, 0, 0.32165173f},
+  {-1, -1, 0, 0, 0.15891033f},
+  {-1, -1, 0, 0, -0.006132905f},
+  {-1, -1, 0, 0, 0.5364468f},
+  {-1, -1, 0, 0, 0.2622894f},
+  {852, 853, 9, 0, 2.0f},
+  {854, 855, 9, 0, 1.0f},
+  {856, 857, 0, 0, 1.0f},
+  {858, 859, 7, 0, 5.0f},
+  {860, 861, 7, 0, 12.0f},
+  {862, 863, 7, 0, 26.0f},
+  {864, 865, 7, 0, 30.0f},
+  {866, 867, 2, 0, 1.0f},
+  {868, 869, 7, 0, 12.0f},
+  {870, 871, 1, 0, 11.21964f},
+  {872, 873, 7, 0, 17.0f},
+  {874, 875, 3, 0, 9.852974f},
+  {876, 877, 1, 0, 4.63365f},
+  {878, 879, 1, 0, 7.600024f},
+  {-1, -1, 0, 0, 0.5430425f},
+  {880, 881, 0, 0, 0.67f},
+  {882, 883, 6, 0, 1.0f},
+  {884, 885, 1, 0, 12.221915f},
+  {886, 887, 5, 0, 8.28008f},
+  {888, 889, 7, 0, 0.0f},
+  {890, 891, 8, 0, 1.0f},
+  {892, 893, 5, 0, 10.198943f},
+  {894, 895, 1, 0, 4.059885f},
+  {896, 897, 1, 0, 6.197865f},
+  {898, 899, 7, 0, 13.0f},
+  {-1, -1, 0, 0, 0.25745526f},
+  {-1, -1, 0, 0, 0.5182178f},
+  {900, 901, 7, 0, 22.0f},
+  {902, 903, 5, 0, 5.63685f},
+  {904, 905, 4, 0, 1.0f},
+  {-1, -1, 0, 0, 0.119812444f},
+  {906, 907, 3, 0, 3.892201f},
+  {908, 909, 1, 0, 3.0952337f},
+  {910, 911, 10, 0, 0.93222106f},
+  {912, 913, 5, 0, 48.053078f},
+  {914, 915, 3, 0, 31.656399f},
+  {916, 917, 4, 0, 1.0f},
+  {918, 919, 10, 0, 0.64474505f},
+  {920, 921, 7, 0, 7.0f},
+  {922, 923, 7, 0, 3.0f},
+  {-1, -1, 0, 0, -0.06198535f},
+  {924, 925, 5, 0, 3.0662608f},
+  {926, 927, 7, 0, 14.0f},
+  {928, 929, 10, 0, 0.6955609f},
+  {930, 931, 10, 0, 0.7266901f},
+  {932, 933, 9, 0, 3.0f},
+  {934, 935, 1, 0, 6.4866323f},
+  {936, 937, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.1277772f},
+  {938, 939, 10, 0, 0.62730575f},
+  {-1, -1, 0, 0, 0.46450743f},
+  {940, 941, 8, 0, 0.0f},
+  {942, 943, 5, 0, 5.9532027f},
+  {-1, -1, 0, 0, -0.30595997f},
+  {-1, -1, 0, 0, 0.0187548f},
+  {-1, -1, 0, 0, -0.05157732f},
+  {-1, -1, 0, 0, -0.14386222f},
+  {-1, -1, 0, 0, 0.004902649f},
+  {-1, -1, 0, 0, 0.08970096f},
+  {-1, -1, 0, 0, -0.14242008f},
+  {-1, -1, 0, 0, -0.034035277f},
+  {-1, -1, 0, 0, -0.19303814f},
+  {-1, -1, 0, 0, -0.08167664f},
+  {-1, -1, 0, 0, 0.12987831f},
+  {-1, -1, 0, 0, -0.057380628f},
+  {-1, -1, 0, 0, -0.0864049f},
+  {-1, -1, 0, 0, 0.027773285f},
+  {-1, -1, 0, 0, -0.090097934f},
+  {-1, -1, 0, 0, 0.035416022f},
+  {-1, -1, 0, 0, -0.41355163f},
+  {-1, -1, 0, 0, -0.07316736f},
+  {-1, -1, 0, 0, -0.3706793f},
+  {-1, -1, 0, 0, -0.20647438f},
+  {-1, -1, 0, 0, 0.08910844f},
+  {-1, -1, 0, 0, 0.037881408f},
+  {-1, -1, 0, 0, -0.0460059f},
+  {-1, -1, 0, 0, 0.045417786f},
+  {-1, -1, 0, 0, 0.08217799f},
+  {-1, -1, 0, 0, 0.24980724f},
+  {-1, -1, 0, 0, 0.09274329f},
+  {-1, -1, 0, 0, 0.04076636f},
+  {-1, -1, 0, 0, 0.20141168f},
+  {-1, -1, 0, 0, 0.31530938f},
+  {-1, -1, 0, 0, -0.0012376892f},
+  {-1, -1, 0, 0, 0.16919522f},
+  {-1, -1, 0, 0, 0.08461833f},
+  {-1, -1, 0, 0, -0.10985855f},
+  {-1, -1, 0, 0, 0.120405965f},
+  {-1, -1, 0, 0, 0.37445015f},
+  {-1, -1, 0, 0, 0.13468628f},
+  {-1, -1, 0, 0, 0.38539267f},
+  {-1, -1, 0, 0, 0.066868305f},
+  {-1, -1, 0, 0, 0.235358f},
+  {945, 946, 9, 0, 2.0f},
+  {947, 948, 1, 0, 11.21964f},
+  {949, 950, 0, 0, 1.0f},
+  {951, 952, 0, 0, 0.67f},
+  {953, 954, 7, 0, 3.0f},
+  {955, 956, 7, 0, 26.0f},
+  {957, 958, 7, 0, 34.0f},
+  {959, 960, 4, 0, 1.0f},
+  {961, 962, 7, 0, 16.0f},
+  {963, 964, 7, 0, 0.0f},
+  {965, 966, 7, 0, 6.0f},
+  {967, 968, 7, 0, 21.0f},
+  {969, 970, 1, 0, 4.63365f},
+  {971, 972, 9, 0, 3.0f},
+  {-1, -1, 0, 0, 0.57133263f},
+  {973, 974, 2, 0, 0.0f},
+  {975, 976, 0, 0, 0.33f},
+  {977, 978, 3, 0, 31.012392f},
+  {979, 980, 7, 0, 20.0f},
+  {981, 982, 5, 0, 43.96941f},
+  {983, 984, 7, 0, 1.0f},
+  {-1, -1, 0, 0, -0.21126918f},
+  {985, 986, 5, 0, 48.053078f},
+  {987, 988, 7, 0, 0.0f},
+  {989, 990, 5, 0, 8.784322f},
+  {-1, -1, 0, 0, 0.2368588f},
+  {-1, -1, 0, 0, 0.47071457f},
+  {991, 992, 3, 0, 6.576387f},
+  {993, 994, 3, 0, 3.6904523f},
+  {995, 996, 7, 0, 7.0f},
+  {997, 998, 7, 0, 14.0f},
+  {999, 1000, 7, 0, 0.0f},
+  {1001, 1002, 10, 0, 0.9362309f},
+  {1003, 1004, 1, 0, 6.0881815f},
+  {1005, 1006, 1, 0, 3.0097222f},
+  {1007, 1008, 5, 0, 8.28008f},
+  {-1, -1, 0, 0, 0.2043426f},
+  {1009, 1010, 1, 0, 38.15698f},
+  {1011, 1012, 5, 0, 44.91239f},
+  {-1, -1, 0, 0, -0.38085482f},
+  {-1, -1, 0, 0, -0.28622094f},
+  {1013, 1014, 6, 0, 1.0f},
+  {-1, -1, 0, 0, -0.055741217f},
+  {1015, 1016, 4, 0, 1.0f},
+  {1017, 1018, 7, 0, 14.0f},
+  {1019, 1020, 3, 0, 9.5558405f},
+  {-1, -1, 0, 0, 0.023568822f},
+  {1021, 1022, 5, 0, 7.1836843f},
+  {-1, -1, 0, 0, 0.22328003f},
+  {1023, 1024, 3, 0, 3.471103f},
+  {-1, -1, 0, 0, 0.42543212f},
+  {-1, -1, 0, 0, -0.25223425f},
+  {-1, -1, 0, 0, -0.0633749f},
+  {-1, -1, 0, 0, -0.100967005f},
+  {-1, -1, 0, 0, 0.10035496f},
+  {-1, -1, 0, 0, 0.1662654f},
+  {-1, -1, 0, 0, 0.030695079f},
+  {-1, -1, 0, 0, -0.055599142f},
+  {-1, -1, 0, 0, 0.015600395f},
+  {-1, -1, 0, 0, 0.0011769037f},
+  {-1, -1, 0, 0, 0.053332753f},
+  {-1, -1, 0, 0, 0.048144247f},
+  {-1, -1, 0, 0, -0.06359901f},
+  {-1, -1, 0, 0, 0.09801854f},
+  {-1, -1, 0, 0, 0.014403248f},
+  {-1, -1, 0, 0, -0.28566572f},
+  {-1, -1, 0, 0, -0.12538862f},
+  {-1, -1, 0, 0, 0.08827198f},
+  {-1, -1, 0, 0, -0.15997316f},
+  {-1, -1, 0, 0, -0.16164893f},
+  {-1, -1, 0, 0, -0.03309045f},
+  {-1, -1, 0, 0, 0.102658704f},
+  {-1, -1, 0, 0, 0.22592564f},
+  {-1, -1, 0, 0, -0.12271606f},
+  {-1, -1, 0, 0, 0.1510072f},
+  {-1, -1, 0, 0, 0.23446842f},
+  {-1, -1, 0, 0, 0.056339312f},
+  {-1, -1, 0, 0, 0.40360743f},
+  {-1, -1, 0, 0, 0.1210013f},
+  {-1, -1, 0, 0, 0.35075945f},
+  {-1, -1, 0, 0, 0.060827702f},
+  {1026, 1027, 9, 0, 2.0f},
+  {1028, 1029, 9, 0, 1.0f},
+  {1030, 1031, 0, 0, 1.0f},
+  {1032, 1033, 7, 0, 4.0f},
+  {1034, 1035, 7, 0, 12.0f},
+  {1036, 1037, 7, 0, 26.0f},
+  {1038, 1039, 7, 0, 34.0f},
+  {1040, 1041, 7, 0, 0.0f},
+  {1042, 1043, 7, 0, 12.0f},
+  {1044, 1045, 1, 0, 11.21964f},
+  {1046, 1047, 7, 0, 17.0f},
+  {1048, 1049, 5, 0, 8.574515f},
+  {1050, 1051, 1, 0, 4.63365f},
+  {1052, 1053, 5, 0, 5.234737f},
+  {-1, -1, 0, 0, 0.5185942f},
+  {1054, 1055, 3, 0, 12.934116f},
+  {1056, 1057, 7, 0, 2.0f},
+  {1058, 1059, 1, 0, 12.221915f},
+  {1060, 1061, 5, 0, 8.28008f},
+  {1062, 1063, 7, 0, 0.0f},
+  {1064, 1065, 8, 0, 1.0f},
+  {1066, 1067, 5, 0, 10.198943f},
+  {1068, 1069, 3, 0, 5.5074186f},
+  {1070, 1071, 8, 0, 0.0f},
+  {1072, 1073, 10, 0, 0.9328334f},
+  {1074, 1075, 1, 0, 3.305006f},
+  {-1, -1, 0, 0, 0.42756572f},
+  {1076, 1077, 3, 0, 9.852974f},
+  {1078, 1079, 10, 0, 0.9348987f},
+  {1080, 1081, 5, 0, 17.981339f},
+  {1082, 1083, 3, 0, 41.819008f},
+  {-1, -1, 0, 0, -0.32502738f},
+  {-1, -1, 0, 0, -0.2225269f},
+  {1084, 1085, 10, 0, 0.93222106f},
+  {1086, 1087, 7, 0, 8.0f},
+  {1088, 1089, 3, 0, 31.656399f},
+  {1090, 1091, 4, 0, 1.0f},
+  {1092, 1093, 10, 0, 0.64474505f},
+  {1094, 1095, 7, 0, 7.0f},
+  {1096, 1097, 7, 0, 3.0f},
+  {-1, -1, 0, 0, -0.042942524f},
+  {1098, 1099, 5, 0, 3.0662608f},
+  {1100, 1101, 7, 0, 14.0f},
+  {1102, 1103, 3, 0, 3.6501553f},
+  {1104, 1105, 10, 0, 0.6562431f},
+  {1106, 1107, 1, 0, 7.5773983f},
+  {1108, 1109, 3, 0, 9.852974f},
+  {1110, 1111, 5, 0, 8.89814f},
+  {-1, -1, 0, 0, -0.18506213f},
+  {-1, -1, 0, 0, 0.24018188f},
+  {-1, -1, 0, 0, 0.06441154f},
+  {1112, 1113, 3, 0, 3.1390157f},
+  {-1, -1, 0, 0, 0.081291296f},
+  {1114, 1115, 7, 0, 22.0f},
+  {-1, -1, 0, 0, 0.4661068f},
+  {-1, -1, 0, 0, 0.04228912f},
+  {-1, -1, 0, 0, -0.11988945f},
+  {-1, -1, 0, 0, -0.24905379f},
+  {-1, -1, 0, 0, -0.034856584f},
+  {-1, -1, 0, 0, -0.11710405f},
+  {-1, -1, 0, 0, -0.025044251f},
+  {-1, -1, 0, 0, -0.16698192f},
+  {-1, -1, 0, 0, -0.08936043f},
+  {-1, -1, 0, 0, 0.11602183f},
+  {-1, -1, 0, 0, -0.049463224f},
+  {-1, -1, 0, 0, -0.07391342f},
+  {-1, -1, 0, 0, 0.024849892f},
+  {-1, -1, 0, 0, -0.074746855f},
+  {-1, -1, 0, 0, 0.035194166f},
+  {-1, -1, 0, 0, -0.35514355f},
+  {-1, -1, 0, 0, -0.060492296f},
+  {-1, -1, 0, 0, -0.31019753f},
+  {-1, -1, 0, 0, -0.16937365f},
+  {-1, -1, 0, 0, 0.07764267f},
+  {-1, -1, 0, 0, 0.031206876f},
+  {-1, -1, 0, 0, -0.040666405f},
+  {-1, -1, 0, 0, 0.04021486f},
+  {-1, -1, 0, 0, 0.08557704f},
+  {-1, -1, 0, 0, 0.23327501f},
+  {-1, -1, 0, 0, 0.021254634f},
+  {-1, -1, 0, 0, 0.07591901f},
+  {-1, -1, 0, 0, 0.10609406f},
+  {-1, -1, 0, 0, -0.0975607f},
+  {-1, -1, 0, 0, 0.16922021f},
+  {-1, -1, 0, 0, 0.057237364f},
+  {-1, -1, 0, 0, 0.11660713f},
+  {-1, -1, 0, 0, -0.012824488f},
+  {-1, -1, 0, 0, 0.28335425f},
+  {-1, -1, 0, 0, 0.3980908f},
+  {-1, -1, 0, 0, 0.2367496f},
+  {-1, -1, 0, 0, 0.31570005f},
+  {1117, 1118, 9, 0, 2.0f},
+  {1119, 1120, 1, 0, 11.21964f},
+  {1121, 1122, 0, 0, 1.0f},
+  {1123, 1124, 0, 0, 0.67f},
+  {1125, 1126, 7, 0, 4.0f},
+  {1127, 1128, 7, 0, 26.0f},
+  {1129, 1130, 7, 0, 34.0f},
+  {1131, 1132, 7, 0, 9.0f},
+  {1133, 1134, 7, 0, 16.0f},
+  {1135, 1136, 4, 0, 1.0f},
+  {1137, 1138, 7, 0, 8.0f},
+  {1139, 1140, 7, 0, 21.0f},
+  {1141, 1142, 1, 0, 4.63365f},
+  {1143, 1144, 9, 0, 3.0f},
+  {-1, -1, 0, 0, 0.47072393f},
+  {1145, 1146, 2, 0, 0.0f},
+  {1147, 1148, 0, 0, 0.33f},
+  {1149, 1150, 3, 0, 5.203249f},
+  {1151, 1152, 7, 0, 20.0f},
+  {1153, 1154, 5, 0, 43.96941f},
+  {-1, -1, 0, 0, 0.022920204f},
+  {1155, 1156, 4, 0, 1.0f},
+  {1157, 1158, 1, 0, 27.188059f},
+  {1159, 1160, 7, 0, 0.0f},
+  {1161, 1162, 1, 0, 3.0097222f},
+  {1163, 1164, 1, 0, 3.305006f},
+  {1165, 1166, 5, 0, 6.8829618f},
+  {1167, 1168, 3, 0, 6.576387f},
+  {1169, 1170, 7, 0, 23.0f},
+  {1171, 1172, 10, 0, 0.6204305f},
+  {1173, 1174, 3, 0, 12.934116f},
+  {1175, 1176, 5, 0, 7.042338f},
+  {1177, 1178, 7, 0, 11.0f},
+  {1179, 1180, 3, 0, 5.0814815f},
+  {1181, 1182, 7, 0, 13.0f},
+  {1183, 1184, 10, 0, 0.6984106f},
+  {-1, -1, 0, 0, 0.17228726f},
+  {1185, 1186, 7, 0, 2.0f},
+  {1187, 1188, 5, 0, 44.91239f},
+  {1189, 1190, 5, 0, 36.74928f},
+  {-1, -1, 0, 0, -0.02560749f},
+  {-1, -1, 0, 0, -0.039990067f},
+  {1191, 1192, 3, 0, 3.025743f},
+  {1193, 1194, 9, 0, 3.0f},
+  {1195, 1196, 7, 0, 14.0f},
+  {1197, 1198, 5, 0, 5.2813516f},
+  {1199, 1200, 5, 0, 8.784322f},
+  {-1, -1, 0, 0, 0.22216831f},
+  {-1, -1, 0, 0, 0.06119099f},
+  {-1, -1, 0, 0, 0.40294924f},
+  {-1, -1, 0, 0, 0.114012055f},
+  {1201, 1202, 5, 0, 7.1836843f},
+  {-1, -1, 0, 0, 0.17363094f},
+  {1203, 1204, 10, 0, 0.8941616f},
+  {1205, 1206, 3, 0, 3.6904523f},
+  {-1, -1, 0, 0, -0.33571535f},
+  {-1, -1, 0, 0, -0.14501971f},
+  {-1, -1, 0, 0, -0.048513215f},
+  {-1, -1, 0, 0, -0.103891484f},
+  {-1, -1, 0, 0, 0.07365789f},
+  {-1, -1, 0, 0, -0.05054322f},
+  {-1, -1, 0, 0, -0.070744805f},
+  {-1, -1, 0, 0, -0.042296007f},
+  {-1, -1, 0, 0, 0.029487675f},
+  {-1, -1, 0, 0, 0.28531018f},
+  {-1, -1, 0, 0, -0.019510755f},
+  {-1, -1, 0, 0, 0.02981703f},
+  {-1, -1, 0, 0, 0.024792332f},
+  {-1, -1, 0, 0, 0.09081604f},
+  {-1, -1, 0, 0, -0.26272732f},
+  {-1, -1, 0, 0, -0.20378263f},
+  {-1, -1, 0, 0, -0.026797896f},
+  {-1, -1, 0, 0, -0.18833119f},
+  {-1, -1, 0, 0, -0.1584283f},
+  {-1, -1, 0, 0, -0.11884918f},
+  {-1, -1, 0, 0, -0.026967907f},
+  {-1, -1, 0, 0, -0.10581f},
+  {-1, -1, 0, 0, 0.14930712f},
+  {-1, -1, 0, 0, 0.32422385f},
+  {-1, -1, 0, 0, -0.11644175f},
+  {-1, -1, 0, 0, 0.12108797f},
+  {-1, -1, 0, 0, 0.32753715f},
+  {-1, -1, 0, 0, 0.15150945f},
+  {-1, -1, 0, 0, 0.16910107f},
+  {-1, -1, 0, 0, 0.016559983f},
+  {-1, -1, 0, 0, 0.33484495f},
+  {-1, -1, 0, 0, 0.09451949f},
+  {-1, -1, 0, 0, 0.21096206f},
+  {-1, -1, 0, 0, 0.4161819f},
+  {-1, -1, 0, 0, 0.2826192f},
+  {-1, -1, 0, 0, 0.3704039f},
+  {1208, 1209, 9, 0, 2.0f},
+  {1210, 1211, 9, 0, 1.0f},
+  {1212, 1213, 0, 0, 1.0f},
+  {1214, 1215, 7, 0, 5.0f},
+  {1216, 1217, 7, 0, 12.0f},
+  {1218, 1219, 7, 0, 26.0f},
+  {1220, 1221, 7, 0, 30.0f},
+  {1222, 1223, 7, 0, 0.0f},
+  {1224, 1225, 6, 0, 1.0f},
+  {1226, 1227, 1, 0, 11.21964f},
+  {1228, 1229, 7, 0, 17.0f},
+  {1230, 1231, 7, 0, 16.0f},
+  {-1, -1, 0, 0, 0.32402512f},
+  {1232, 1233, 1, 0, 7.600024f},
+  {-1, -1, 0, 0, 0.36732838f},
+  {1234, 1235, 3, 0, 12.934116f},
+  {1236, 1237, 7, 0, 2.0f},
+  {1238, 1239, 4, 0, 1.0f},
+  {1240, 1241, 7, 0, 10.0f},
+  {1242, 1243, 7, 0, 0.0f},
+  {1244, 1245, 8, 0, 1.0f},
+  {1246, 1247, 5, 0, 3.1583395f},
+  {1248, 1249, 1, 0, 4.059885f},
+  {1250, 1251, 7, 0, 0.0f},
+  {1252, 1253, 3, 0, 7.437969f},
+  {1254, 1255, 7, 0, 22.0f},
+  {1256, 1257, 7, 0, 0.0f},
+  {1258, 1259, 5, 0, 17.981339f},
+  {1260, 1261, 3, 0, 41.819008f},
+  {1262, 1263, 7, 0, 1.0f},
+  {-1, -1, 0, 0, -0.17106533f},
+  {1264, 1265, 7, 0, 10.0f},
+  {1266, 1267, 10, 0, 0.7595118f},
+  {1268, 1269, 0, 0, 0.67f},
+  {1270, 1271, 3, 0, 31.656399f},
+  {1272, 1273, 10, 0, 0.64474505f},
+  {1274, 1275, 7, 0, 7.0f},
+  {1276, 1277, 7, 0, 3.0f},
+  {1278, 1279, 1, 0, 27.188059f},
+  {1280, 1281, 10, 0, 0.6030454f},
+  {1282, 1283, 1, 0, 9.290183f},
+  {1284, 1285, 3, 0, 7.8076744f},
+  {1286, 1287, 10, 0, 0.7266901f},
+  {1288, 1289, 9, 0, 3.0f},
+  {1290, 1291, 7, 0, 12.0f},
+  {1292, 1293, 5, 0, 3.1833074f},
+  {1294, 1295, 3, 0, 7.704718f},
+  {1296, 1297, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.31398988f},
+  {1298, 1299, 5, 0, 5.63685f},
+  {1300, 1301, 10, 0, 0.72917897f},
+  {-1, -1, 0, 0, 0.043816462f},
+  {-1, -1, 0, 0, -0.0936342f},
+  {-1, -1, 0, 0, -0.20322537f},
+  {-1, -1, 0, 0, -0.014491637f},
+  {-1, -1, 0, 0, -0.29674876f},
+  {-1, -1, 0, 0, -0.23404482f},
+  {-1, -1, 0, 0, -0.11442977f},
+  {-1, -1, 0, 0, -0.050031643f},
+  {-1, -1, 0, 0, 0.019850327f},
+  {-1, -1, 0, 0, -0.061841406f},
+  {-1, -1, 0, 0, -0.04479464f},
+  {-1, -1, 0, 0, 0.009684706f},
+  {-1, -1, 0, 0, 0.10140202f},
+  {-1, -1, 0, 0, -0.04487524f},
+  {-1, -1, 0, 0, -0.059762627f},
+  {-1, -1, 0, 0, 0.035177983f},
+  {-1, -1, 0, 0, -0.3086332f},
+  {-1, -1, 0, 0, -0.049899545f},
+  {-1, -1, 0, 0, -0.26189065f},
+  {-1, -1, 0, 0, -0.13821183f},
+  {-1, -1, 0, 0, -0.0035328865f},
+  {-1, -1, 0, 0, -0.03552885f},
+  {-1, -1, 0, 0, -0.05465147f},
+  {-1, -1, 0, 0, 0.08807666f},
+  {-1, -1, 0, 0, 0.01958641f},
+  {-1, -1, 0, 0, -0.066343784f},
+  {-1, -1, 0, 0, 0.16103409f},
+  {-1, -1, 0, 0, -0.007334566f},
+  {-1, -1, 0, 0, 0.063797094f},
+  {-1, -1, 0, 0, 0.019459773f},
+  {-1, -1, 0, 0, 0.13466914f},
+  {-1, -1, 0, 0, 0.29828587f},
+  {-1, -1, 0, 0, -0.21555991f},
+  {-1, -1, 0, 0, 0.013798173f},
+  {-1, -1, 0, 0, 0.09661769f},
+  {-1, -1, 0, 0, 0.17343603f},
+  {-1, -1, 0, 0, 0.0029639627f},
+  {-1, -1, 0, 0, 0.12296946f},
+  {-1, -1, 0, 0, 0.28843862f},
+  {-1, -1, 0, 0, 0.16012432f},
+  {-1, -1, 0, 0, 0.32812545f},
+  {-1, -1, 0, 0, 0.11047788f},
+  {-1, -1, 0, 0, 0.10477854f},
+  {-1, -1, 0, 0, 0.19526018f},
+  {1303, 1304, 9, 0, 2.0f},
+  {1305, 1306, 0, 0, 0.67f},
+  {1307, 1308, 0, 0, 1.0f},
+  {1309, 1310, 7, 0, 7.0f},
+  {1311, 1312, 5, 0, 10.198943f},
+  {1313, 1314, 7, 0, 26.0f},
+  {1315, 1316, 7, 0, 34.0f},
+  {1317, 1318, 2, 0, 1.0f},
+  {1319, 1320, 7, 0, 12.0f},
+  {1321, 1322, 7, 0, 16.0f},
+  {1323, 1324, 10, 0, 0.7735864f},
+  {1325, 1326, 7, 0, 21.0f},
+  {1327, 1328, 1, 0, 4.63365f},
+  {1329, 1330, 5, 0, 5.165702f},
+  {-1, -1, 0, 0, 0.39336523f},
+  {1331, 1332, 4, 0, 1.0f},
+  {1333, 1334, 6, 0, 1.0f},
+  {1335, 1336, 7, 0, 9.0f},
+  {1337, 1338, 0, 0, 0.33f},
+  {1339, 1340, 7, 0, 0.0f},
+  {1341, 1342, 10, 0, 0.6984106f},
+  {1343, 1344, 10, 0, 0.7632015f},
+  {1345, 1346, 3, 0, 3.025743f},
+  {1347, 1348, 8, 0, 0.0f},
+  {1349, 1350, 1, 0, 3.0097222f},
+  {1351, 1352, 1, 0, 3.305006f},
+  {1353, 1354, 5, 0, 6.8829618f},
+  {1355, 1356, 5, 0, 4.201236f},
+  {1357, 1358, 10, 0, 0.9348987f},
+  {1359, 1360, 10, 0, 0.6204305f},
+  {1361, 1362, 0, 0, 0.33f},
+  {1363, 1364, 1, 0, 9.89347f},
+  {1365, 1366, 0, 0, 0.33f},
+  {1367, 1368, 1, 0, 8.45157f},
+  {1369, 1370, 1, 0, 9.606114f},
+  {1371, 1372, 10, 0, 0.6035007f},
+  {1373, 1374, 5, 0, 13.116259f},
+  {1375, 1376, 3, 0, 19.831232f},
+  {1377, 1378, 7, 0, 11.0f},
+  {1379, 1380, 5, 0, 4.89638f},
+  {1381, 1382, 4, 0, 1.0f},
+  {1383, 1384, 1, 0, 7.200274f},
+  {-1, -1, 0, 0, 0.13636841f},
+  {1385, 1386, 1, 0, 7.600024f},
+  {1387, 1388, 7, 0, 0.0f},
+  {1389, 1390, 1, 0, 7.5773983f},
+  {1391, 1392, 5, 0, 8.34942f},
+  {1393, 1394, 5, 0, 5.2813516f},
+  {1395, 1396, 5, 0, 8.784322f},
+  {-1, -1, 0, 0, 0.18120389f},
+  {-1, -1, 0, 0, 0.0419302f},
+  {-1, -1, 0, 0, 0.33686084f},
+  {-1, -1, 0, 0, 0.092110254f},
+  {1397, 1398, 3, 0, 3.025743f},
+  {1399, 1400, 8, 0, 1.0f},
+  {1401, 1402, 5, 0, 8.632957f},
+  {-1, -1, 0, 0, 0.37239113f},
+  {-1, -1, 0, 0, -0.24798599f},
+  {-1, -1, 0, 0, -0.16296797f},
+  {-1, -1, 0, 0, 0.11243429f},
+  {-1, -1, 0, 0, 0.019427141f},
+  {-1, -1, 0, 0, -0.073147684f},
+  {-1, -1, 0, 0, 0.05644849f},
+  {-1, -1, 0, 0, 0.09285462f},
+  {-1, -1, 0, 0, -0.020487292f},
+  {-1, -1, 0, 0, -0.06590614f},
+  {-1, -1, 0, 0, -0.10679152f},
+  {-1, -1, 0, 0, -0.051177204f},
+  {-1, -1, 0, 0, 0.0078096525f},
+  {-1, -1, 0, 0, -0.052586365f},
+  {-1, -1, 0, 0, 0.051689614f},
+  {-1, -1, 0, 0, -0.040337604f},
+  {-1, -1, 0, 0, -0.0033635905f},
+  {-1, -1, 0, 0, 0.08844545f},
+  {-1, -1, 0, 0, -0.1109968f},
+  {-1, -1, 0, 0, -0.04636504f},
+  {-1, -1, 0, 0, 0.031507067f},
+  {-1, -1, 0, 0, -0.023115134f},
+  {-1, -1, 0, 0, 0.060026616f},
+  {-1, -1, 0, 0, 0.038486626f},
+  {-1, -1, 0, 0, 0.13874665f},
+  {-1, -1, 0, 0, -0.04958084f},
+  {-1, -1, 0, 0, 0.02686785f},
+  {-1, -1, 0, 0, 0.058015984f},
+  {-1, -1, 0, 0, -0.049386024f},
+  {-1, -1, 0, 0, -0.09410892f},
+  {-1, -1, 0, 0, -0.05168602f},
+  {-1, -1, 0, 0, 0.061315387f},
+  {-1, -1, 0, 0, -0.17776878f},
+  {-1, -1, 0, 0, 0.11319019f},
+  {-1, -1, 0, 0, 0.0023803012f},
+  {-1, -1, 0, 0, 0.2889957f},
+  {-1, -1, 0, 0, 0.12443066f},
+  {-1, -1, 0, 0, 0.14012864f},
+  {-1, -1, 0, 0, 0.009583569f},
+  {-1, -1, 0, 0, 0.116384044f},
+  {-1, -1, 0, 0, 0.27880916f},
+  {-1, -1, 0, 0, 0.38331673f},
+  {-1, -1, 0, 0, 0.056252927f},
+  {-1, -1, 0, 0, 0.19706717f},
+  {-1, -1, 0, 0, 0.33083484f},
+  {1404, 1405, 9, 0, 2.0f},
+  {1406, 1407, 0, 0, 0.67f},
+  {1408, 1409, 9, 0, 3.0f},
+  {1410, 1411, 7, 0, 7.0f},
+  {1412, 1413, 5, 0, 10.198943f},
+  {1414, 1415, 7, 0, 28.0f},
+  {1416, 1417, 7, 0, 34.0f},
+  {1418, 1419, 7, 0, 0.0f},
+  {1420, 1421, 7, 0, 12.0f},
+  {1422, 1423, 7, 0, 16.0f},
+  {1424, 1425, 5, 0, 39.780422f},
+  {1426, 1427, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 0.4080738f},
+  {1428, 1429, 10, 0, 0.8561354f},
+  {-1, -1, 0, 0, 0.34832227f},
+  {1430, 1431, 1, 0, 11.328481f},
+  {1432, 1433, 7, 0, 2.0f},
+  {1434, 1435, 7, 0, 9.0f},
+  {1436, 1437, 0, 0, 0.33f},
+  {1438, 1439, 3, 0, 5.203249f},
+  {1440, 1441, 10, 0, 0.6984106f},
+  {1442, 1443, 10, 0, 0.7735864f},
+  {1444, 1445, 3, 0, 14.859064f},
+  {1446, 1447, 7, 0, 16.0f},
+  {1448, 1449, 1, 0, 6.2872834f},
+  {1450, 1451, 10, 0, 0.8393944f},
+  {1452, 1453, 1, 0, 3.886703f},
+  {1454, 1455, 10, 0, 0.6204305f},
+  {1456, 1457, 1, 0, 37.34242f},
+  {1458, 1459, 7, 0, 1.0f},
+  {1460, 1461, 7, 0, 3.0f},
+  {1462, 1463, 1, 0, 8.45157f},
+  {1464, 1465, 3, 0, 3.1390157f},
+  {1466, 1467, 10, 0, 0.6035007f},
+  {1468, 1469, 9, 0, 1.0f},
+  {1470, 1471, 3, 0, 5.1185427f},
+  {1472, 1473, 8, 0, 1.0f},
+  {1474, 1475, 5, 0, 4.89638f},
+  {1476, 1477, 1, 0, 3.0097222f},
+  {1478, 1479, 10, 0, 0.7632015f},
+  {1480, 1481, 3, 0, 32.58397f},
+  {1482, 1483, 5, 0, 46.093723f},
+  {-1, -1, 0, 0, -0.07562006f},
+  {1484, 1485, 7, 0, 0.0f},
+  {1486, 1487, 3, 0, 7.437969f},
+  {1488, 1489, 3, 0, 6.576387f},
+  {-1, -1, 0, 0, 0.11187551f},
+  {1490, 1491, 5, 0, 5.2813516f},
+  {1492, 1493, 3, 0, 3.025743f},
+  {1494, 1495, 7, 0, 19.0f},
+  {1496, 1497, 3, 0, 6.721325f},
+  {-1, -1, 0, 0, -0.18598622f},
+  {-1, -1, 0, 0, -0.018760944f},
+  {-1, -1, 0, 0, -0.1724413f},
+  {-1, -1, 0, 0, -0.059923477f},
+  {-1, -1, 0, 0, -0.2614306f},
+  {-1, -1, 0, 0, -0.19427668f},
+  {-1, -1, 0, 0, -0.16549453f},
+  {-1, -1, 0, 0, -0.117671005f},
+  {-1, -1, 0, 0, -0.059408315f},
+  {-1, -1, 0, 0, -0.0963934f},
+  {-1, -1, 0, 0, -0.07158322f},
+  {-1, -1, 0, 0, -0.034078233f},
+  {-1, -1, 0, 0, -0.049080595f},
+  {-1, -1, 0, 0, 0.04677914f},
+  {-1, -1, 0, 0, -0.05219844f},
+  {-1, -1, 0, 0, -0.013004208f},
+  {-1, -1, 0, 0, 0.03674287f},
+  {-1, -1, 0, 0, 0.31853595f},
+  {-1, -1, 0, 0, 0.020064835f},
+  {-1, -1, 0, 0, -0.034818895f},
+  {-1, -1, 0, 0, -0.021381497f},
+  {-1, -1, 0, 0, 0.055024434f},
+  {-1, -1, 0, 0, 0.18296304f},
+  {-1, -1, 0, 0, 0.06633995f},
+  {-1, -1, 0, 0, -0.028767768f},
+  {-1, -1, 0, 0, 0.12727715f},
+  {-1, -1, 0, 0, -0.062349707f},
+  {-1, -1, 0, 0, -0.015982771f},
+  {-1, -1, 0, 0, 0.13355638f},
+  {-1, -1, 0, 0, -0.010139632f},
+  {-1, -1, 0, 0, 0.11141416f},
+  {-1, -1, 0, 0, -0.028604314f},
+  {-1, -1, 0, 0, 0.12919442f},
+  {-1, -1, 0, 0, 0.07941452f},
+  {-1, -1, 0, 0, 0.31602398f},
+  {-1, -1, 0, 0, 0.10696878f},
+  {-1, -1, 0, 0, 0.2508607f},
+  {-1, -1, 0, 0, 0.17229794f},
+  {-1, -1, 0, 0, -0.09261694f},
+  {-1, -1, 0, 0, 0.039669897f},
+  {-1, -1, 0, 0, 0.013262033f},
+  {-1, -1, 0, 0, 0.24033423f},
+  {-1, -1, 0, 0, 0.36704835f},
+  {-1, -1, 0, 0, 0.18080507f},
+  {1499, 1500, 9, 0, 2.0f},
+  {1501, 1502, 0, 0, 0.67f},
+  {1503, 1504, 0, 0, 1.0f},
+  {1505, 1506, 7, 0, 7.0f},
+  {1507, 1508, 5, 0, 10.198943f},
+  {1509, 1510, 7, 0, 26.0f},
+  {1511, 1512, 7, 0, 34.0f},
+  {1513, 1514, 2, 0, 1.0f},
+  {1515, 1516, 7, 0, 12.0f},
+  {1517, 1518, 7, 0, 13.0f},
+  {1519, 1520, 5, 0, 39.780422f},
+  {1521, 1522, 7, 0, 21.0f},
+  {1523, 1524, 1, 0, 8.116831f},
+  {1525, 1526, 10, 0, 0.60579807f},
+  {-1, -1, 0, 0, 0.32352287f},
+  {1527, 1528, 4, 0, 1.0f},
+  {1529, 1530, 0, 0, 0.33f},
+  {1531, 1532, 9, 0, 1.0f},
+  {1533, 1534, 0, 0, 0.33f},
+  {1535, 1536, 1, 0, 5.184029f},
+  {1537, 1538, 1, 0, 6.748502f},
+  {1539, 1540, 5, 0, 30.373415f},
+  {1541, 1542, 3, 0, 14.859064f},
+  {1543, 1544, 8, 0, 0.0f},
+  {1545, 1546, 1, 0, 3.0097222f},
+  {1547, 1548, 10, 0, 0.8393944f},
+  {-1, -1, 0, 0, 0.32805705f},
+  {1549, 1550, 7, 0, 21.0f},
+  {1551, 1552, 3, 0, 3.1390157f},
+  {1553, 1554, 10, 0, 0.6204305f},
+  {1555, 1556, 0, 0, 0.33f},
+  {1557, 1558, 10, 0, 0.8055525f},
+  {1559, 1560, 3, 0, 4.9835625f},
+  {1561, 1562, 5, 0, 11.843356f},
+  {1563, 1564, 1, 0, 3.0097222f},
+  {1565, 1566, 10, 0, 0.6035007f},
+  {1567, 1568, 10, 0, 0.7320588f},
+  {1569, 1570, 10, 0, 0.72977334f},
+  {1571, 1572, 3, 0, 19.831232f},
+  {1573, 1574, 7, 0, 19.0f},
+  {1575, 1576, 5, 0, 3.1583395f},
+  {1577, 1578, 5, 0, 29.677032f},
+  {1579, 1580, 1, 0, 6.615963f},
+  {1581, 1582, 5, 0, 46.093723f},
+  {-1, -1, 0, 0, -0.06931842f},
+  {1583, 1584, 1, 0, 7.5773983f},
+  {1585, 1586, 5, 0, 8.217814f},
+  {1587, 1588, 5, 0, 5.2813516f},
+  {1589, 1590, 5, 0, 8.784322f},
+  {1591, 1592, 7, 0, 29.0f},
+  {-1, -1, 0, 0, 0.26302576f},
+  {1593, 1594, 1, 0, 3.7434688f},
+  {1595, 1596, 3, 0, 9.170031f},
+  {1597, 1598, 10, 0, 0.881135f},
+  {1599, 1600, 3, 0, 5.203249f},
+  {-1, -1, 0, 0, -0.20569181f},
+  {-1, -1, 0, 0, -0.13207717f},
+  {-1, -1, 0, 0, 0.10775061f},
+  {-1, -1, 0, 0, 0.021706153f},
+  {-1, -1, 0, 0, 0.08440743f},
+  {-1, -1, 0, 0, -0.03965078f},
+  {-1, -1, 0, 0, -0.03013855f},
+  {-1, -1, 0, 0, -0.06528372f},
+  {-1, -1, 0, 0, -0.05101962f},
+  {-1, -1, 0, 0, -0.07932084f},
+  {-1, -1, 0, 0, -0.0022158802f},
+  {-1, -1, 0, 0, -0.04757224f},
+  {-1, -1, 0, 0, -0.04580854f},
+  {-1, -1, 0, 0, 0.042335168f},
+  {-1, -1, 0, 0, -0.0020025063f},
+  {-1, -1, 0, 0, -0.03468251f},
+  {-1, -1, 0, 0, 0.026178408f},
+  {-1, -1, 0, 0, -0.04582283f},
+  {-1, -1, 0, 0, 0.07385244f},
+  {-1, -1, 0, 0, -0.06245027f},
+  {-1, -1, 0, 0, 0.05919264f},
+  {-1, -1, 0, 0, 0.1345934f},
+  {-1, -1, 0, 0, 0.08661201f},
+  {-1, -1, 0, 0, -0.010591397f},
+  {-1, -1, 0, 0, -0.0229729f},
+  {-1, -1, 0, 0, 0.12082615f},
+  {-1, -1, 0, 0, -0.08097379f},
+  {-1, -1, 0, 0, -0.023930931f},
+  {-1, -1, 0, 0, 0.12242669f},
+  {-1, -1, 0, 0, -0.009379173f},
+  {-1, -1, 0, 0, 0.04576434f},
+  {-1, -1, 0, 0, -0.16893624f},
+  {-1, -1, 0, 0, 0.09336044f},
+  {-1, -1, 0, 0, 0.00488481f},
+  {-1, -1, 0, 0, 0.25067386f},
+  {-1, -1, 0, 0, 0.10257683f},
+  {-1, -1, 0, 0, 0.11506721f},
+  {-1, -1, 0, 0, 0.005133629f},
+  {-1, -1, 0, 0, 0.0883864f},
+  {-1, -1, 0, 0, 0.18172583f},
+  {-1, -1, 0, 0, -0.0019296646f},
+  {-1, -1, 0, 0, 0.1583954f},
+  {-1, -1, 0, 0, 0.29320073f},
+  {-1, -1, 0, 0, 0.07631674f},
+  {-1, -1, 0, 0, 0.10064626f},
+  {-1, -1, 0, 0, 0.23342672f},
+  {-1, -1, 0, 0, 0.2862115f},
+  {-1, -1, 0, 0, 0.17359415f},
+  {1602, 1603, 9, 0, 2.0f},
+  {1604, 1605, 0, 0, 0.67f},
+  {1606, 1607, 9, 0, 3.0f},
+  {1608, 1609, 7, 0, 6.0f},
+  {1610, 1611, 7, 0, 13.0f},
+  {1612, 1613, 7, 0, 28.0f},
+  {1614, 1615, 10, 0, 0.8561354f},
+  {1616, 1617, 7, 0, 0.0f},
+  {1618, 1619, 7, 0, 11.0f},
+  {1620, 1621, 7, 0, 0.0f},
+  {1622, 1623, 10, 0, 0.6094279f},
+  {1624, 1625, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 0.34753725f},
+  {1626, 1627, 7, 0, 21.0f},
+  {1628, 1629, 1, 0, 3.886703f},
+  {1630, 1631, 1, 0, 11.328481f},
+  {1632, 1633, 7, 0, 2.0f},
+  {1634, 1635, 7, 0, 9.0f},
+  {1636, 1637, 3, 0, 3.2109072f},
+  {1638, 1639, 3, 0, 19.831232f},
+  {1640, 1641, 7, 0, 10.0f},
+  {1642, 1643, 7, 0, 14.0f},
+  {1644, 1645, 5, 0, 4.859941f},
+  {1646, 1647, 7, 0, 16.0f},
+  {1648, 1649, 1, 0, 6.2872834f},
+  {1650, 1651, 1, 0, 6.9549685f},
+  {1652, 1653, 3, 0, 3.6904523f},
+  {1654, 1655, 5, 0, 3.0662608f},
+  {1656, 1657, 3, 0, 6.721325f},
+  {1658, 1659, 10, 0, 0.6204305f},
+  {1660, 1661, 1, 0, 28.0855f},
+  {1662, 1663, 7, 0, 1.0f},
+  {1664, 1665, 9, 0, 1.0f},
+  {1666, 1667, 1, 0, 28.756657f},
+  {1668, 1669, 3, 0, 29.96273f},
+  {1670, 1671, 10, 0, 0.6035007f},
+  {1672, 1673, 7, 0, 14.0f},
+  {1674, 1675, 1, 0, 5.527408f},
+  {-1, -1, 0, 0, -0.09058631f},
+  {1676, 1677, 3, 0, 29.040953f},
+  {1678, 1679, 3, 0, 3.5048244f},
+  {-1, -1, 0, 0, -0.07750769f},
+  {1680, 1681, 5, 0, 4.89638f},
+  {1682, 1683, 8, 0, 0.0f},
+  {1684, 1685, 3, 0, 15.336419f},
+  {1686, 1687, 7, 0, 0.0f},
+  {1688, 1689, 3, 0, 7.0555444f},
+  {1690, 1691, 7, 0, 0.0f},
+  {1692, 1693, 10, 0, 0.7609526f},
+  {1694, 1695, 1, 0, 4.1625104f},
+  {1696, 1697, 5, 0, 7.4071736f},
+  {1698, 1699, 10, 0, 0.72699755f},
+  {1700, 1701, 5, 0, 6.1160326f},
+  {1702, 1703, 0, 0, 1.0f},
+  {1704, 1705, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.32054397f},
+  {1706, 1707, 8, 0, 0.0f},
+  {-1, -1, 0, 0, -0.15771979f},
+  {-1, -1, 0, 0, -0.010443688f},
+  {-1, -1, 0, 0, -0.15359631f},
+  {-1, -1, 0, 0, -0.06203404f},
+  {-1, -1, 0, 0, -0.22121261f},
+  {-1, -1, 0, 0, -0.16154198f},
+  {-1, -1, 0, 0, -0.10327124f},
+  {-1, -1, 0, 0, -0.15323597f},
+  {-1, -1, 0, 0, -0.05941358f},
+  {-1, -1, 0, 0, -0.0913722f},
+  {-1, -1, 0, 0, -0.045538872f},
+  {-1, -1, 0, 0, 0.00053557614f},
+  {-1, -1, 0, 0, -0.046759892f},
+  {-1, -1, 0, 0, 0.07357706f},
+  {-1, -1, 0, 0, -0.022796964f},
+  {-1, -1, 0, 0, 0.02219551f},
+  {-1, -1, 0, 0, 0.0105283f},
+  {-1, -1, 0, 0, 0.12077091f},
+  {-1, -1, 0, 0, -0.063022256f},
+  {-1, -1, 0, 0, -0.0066881897f},
+  {-1, -1, 0, 0, 0.020969793f},
+  {-1, -1, 0, 0, -0.020446938f},
+  {-1, -1, 0, 0, 0.019672425f},
+  {-1, -1, 0, 0, -0.025283813f},
+  {-1, -1, 0, 0, -0.038570404f},
+  {-1, -1, 0, 0, 0.08365826f},
+  {-1, -1, 0, 0, 0.012138571f},
+  {-1, -1, 0, 0, 0.08293453f},
+  {-1, -1, 0, 0, 0.09259208f},
+  {-1, -1, 0, 0, -0.032335993f},
+  {-1, -1, 0, 0, 0.11025256f},
+  {-1, -1, 0, 0, 0.06680146f},
+  {-1, -1, 0, 0, 0.31193182f},
+  {-1, -1, 0, 0, 0.10720175f},
+  {-1, -1, 0, 0, 0.09973618f},
+  {-1, -1, 0, 0, 0.05358072f},
+  {-1, -1, 0, 0, 0.104842f},
+  {-1, -1, 0, 0, -0.060561467f},
+  {-1, -1, 0, 0, 0.1698359f},
+  {-1, -1, 0, 0, 0.019875813f},
+  {-1, -1, 0, 0, 0.2040782f},
+  {-1, -1, 0, 0, 0.06635368f},
+  {-1, -1, 0, 0, 0.24229987f},
+  {-1, -1, 0, 0, 0.14358248f},
+  {-1, -1, 0, 0, 0.0158988f},
+  {-1, -1, 0, 0, -0.015462621f},
+  {-1, -1, 0, 0, 0.22204721f},
+  {-1, -1, 0, 0, 0.0012900353f},
+  {-1, -1, 0, 0, 0.0025766373f},
+  {-1, -1, 0, 0, 0.17213051f},
+  {1709, 1710, 9, 0, 2.0f},
+  {1711, 1712, 0, 0, 0.67f},
+  {1713, 1714, 9, 0, 3.0f},
+  {1715, 1716, 7, 0, 7.0f},
+  {1717, 1718, 3, 0, 5.5074186f},
+  {1719, 1720, 7, 0, 28.0f},
+  {1721, 1722, 7, 0, 34.0f},
+  {1723, 1724, 7, 0, 0.0f},
+  {1725, 1726, 7, 0, 12.0f},
+  {1727, 1728, 3, 0, 5.0814815f},
+  {1729, 1730, 7, 0, 13.0f},
+  {1731, 1732, 1, 0, 6.2872834f},
+  {-1, -1, 0, 0, 0.31857577f},
+  {1733, 1734, 10, 0, 0.8561354f},
+  {-1, -1, 0, 0, 0.26552054f},
+  {1735, 1736, 9, 0, 1.0f},
+  {1737, 1738, 7, 0, 2.0f},
+  {1739, 1740, 4, 0, 1.0f},
+  {1741, 1742, 3, 0, 3.2109072f},
+  {1743, 1744, 3, 0, 3.025743f},
+  {1745, 1746, 10, 0, 0.6226886f},
+  {1747, 1748, 10, 0, 0.74845964f},
+  {1749, 1750, 5, 0, 21.658485f},
+  {1751, 1752, 0, 0, 1.0f},
+  {1753, 1754, 1, 0, 6.4866323f},
+  {1755, 1756, 7, 0, 20.0f},
+  {1757, 1758, 5, 0, 3.0662608f},
+  {1759, 1760, 3, 0, 41.819008f},
+  {1761, 1762, 3, 0, 4.269622f},
+  {1763, 1764, 1, 0, 3.0097222f},
+  {1765, 1766, 7, 0, 3.0f},
+  {1767, 1768, 7, 0, 10.0f},
+  {1769, 1770, 1, 0, 9.572734f},
+  {1771, 1772, 5, 0, 6.1160326f},
+  {1773, 1774, 10, 0, 0.8617883f},
+  {1775, 1776, 6, 0, 1.0f},
+  {1777, 1778, 3, 0, 3.3433104f},
+  {-1, -1, 0, 0, -0.03429753f},
+  {1779, 1780, 5, 0, 3.6240613f},
+  {1781, 1782, 5, 0, 3.6632886f},
+  {1783, 1784, 5, 0, 3.5704215f},
+  {1785, 1786, 5, 0, 8.460226f},
+  {-1, -1, 0, 0, -0.047459852f},
+  {1787, 1788, 1, 0, 5.578811f},
+  {1789, 1790, 7, 0, 0.0f},
+  {1791, 1792, 10, 0, 0.6030454f},
+  {1793, 1794, 0, 0, 0.67f},
+  {1795, 1796, 1, 0, 7.200274f},
+  {1797, 1798, 10, 0, 0.7671752f},
+  {1799, 1800, 1, 0, 3.7838314f},
+  {1801, 1802, 1, 0, 9.35647f},
+  {-1, -1, 0, 0, -0.10286184f},
+  {-1, -1, 0, 0, 0.024249371f},
+  {-1, -1, 0, 0, -0.1013407f},
+  {-1, -1, 0, 0, 0.037952755f},
+  {-1, -1, 0, 0, -0.23086667f},
+  {-1, -1, 0, 0, -0.16035204f},
+  {-1, -1, 0, 0, -0.12408041f},
+  {-1, -1, 0, 0, -0.083460964f},
+  {-1, -1, 0, 0, -0.054744955f},
+  {-1, -1, 0, 0, -0.026319062f},
+  {-1, -1, 0, 0, -0.025445158f},
+  {-1, -1, 0, 0, 0.038985234f},
+  {-1, -1, 0, 0, 0.07227049f},
+  {-1, -1, 0, 0, -0.04442191f},
+  {-1, -1, 0, 0, -0.011662447f},
+  {-1, -1, 0, 0, 0.04188654f},
+  {-1, -1, 0, 0, -0.024968697f},
+  {-1, -1, 0, 0, 0.024978383f},
+  {-1, -1, 0, 0, 0.13937554f},
+  {-1, -1, 0, 0, 0.030682562f},
+  {-1, -1, 0, 0, 0.08200315f},
+  {-1, -1, 0, 0, 0.2879867f},
+  {-1, -1, 0, 0, -0.07296675f},
+  {-1, -1, 0, 0, 0.03315554f},
+  {-1, -1, 0, 0, 0.045870673f},
+  {-1, -1, 0, 0, -0.06941758f},
+  {-1, -1, 0, 0, 0.021685285f},
+  {-1, -1, 0, 0, 0.088218294f},
+  {-1, -1, 0, 0, 0.07044836f},
+  {-1, -1, 0, 0, 0.12709488f},
+  {-1, -1, 0, 0, 0.28697726f},
+  {-1, -1, 0, 0, 0.097821526f},
+  {-1, -1, 0, 0, -0.1997336f},
+  {-1, -1, 0, 0, -0.03246361f},
+  {-1, -1, 0, 0, -0.028156508f},
+  {-1, -1, 0, 0, 0.07203807f},
+  {-1, -1, 0, 0, 0.008868027f},
+  {-1, -1, 0, 0, 0.13635656f},
+  {-1, -1, 0, 0, 0.18913098f},
+  {-1, -1, 0, 0, 0.11809794f},
+  {-1, -1, 0, 0, -0.0032719136f},
+  {-1, -1, 0, 0, 0.16887774f},
+  {-1, -1, 0, 0, 0.24821365f},
+  {-1, -1, 0, 0, 0.0024477958f},
+  {1804, 1805, 9, 0, 2.0f},
+  {1806, 1807, 0, 0, 0.67f},
+  {1808, 1809, 0, 0, 1.0f},
+  {1810, 1811, 7, 0, 5.0f},
+  {1812, 1813, 7, 0, 20.0f},
+  {1814, 1815, 7, 0, 21.0f},
+  {1816, 1817, 7, 0, 34.0f},
+  {1818, 1819, 7, 0, 0.0f},
+  {1820, 1821, 7, 0, 9.0f},
+  {1822, 1823, 5, 0, 10.198943f},
+  {-1, -1, 0, 0, 0.111802295f},
+  {1824, 1825, 8, 0, 0.0f},
+  {1826, 1827, 0, 0, 0.33f},
+  {1828, 1829, 10, 0, 0.60579807f},
+  {1830, 1831, 3, 0, 8.26907f},
+  {1832, 1833, 10, 0, 0.6204305f},
+  {1834, 1835, 7, 0, 1.0f},
+  {1836, 1837, 3, 0, 44.8162f},
+  {1838, 1839, 0, 0, 0.33f},
+  {1840, 1841, 7, 0, 0.0f},
+  {1842, 1843, 5, 0, 39.780422f},
+  {1844, 1845, 1, 0, 7.5773983f},
+  {1846, 1847, 7, 0, 0.0f},
+  {1848, 1849, 8, 0, 0.0f},
+  {1850, 1851, 9, 0, 3.0f},
+  {1852, 1853, 7, 0, 21.0f},
+  {1854, 1855, 3, 0, 3.1390157f},
+  {-1, -1, 0, 0, 0.2553909f},
+  {-1, -1, 0, 0, 0.05581236f},
+  {1856, 1857, 5, 0, 11.359684f},
+  {1858, 1859, 1, 0, 5.578811f},
+  {1860, 1861, 1, 0, 3.0097222f},
+  {1862, 1863, 7, 0, 3.0f},
+  {1864, 1865, 3, 0, 43.216217f},
+  {1866, 1867, 5, 0, 45.86561f},
+  {1868, 1869, 5, 0, 7.042338f},
+  {1870, 1871, 10, 0, 0.66068304f},
+  {1872, 1873, 3, 0, 5.203249f},
+  {1874, 1875, 7, 0, 12.0f},
+  {1876, 1877, 5, 0, 30.373415f},
+  {1878, 1879, 3, 0, 14.859064f},
+  {1880, 1881, 3, 0, 3.025743f},
+  {1882, 1883, 3, 0, 3.025743f},
+  {1884, 1885, 5, 0, 8.143963f},
+  {1886, 1887, 7, 0, 15.0f},
+  {-1, -1, 0, 0, -0.0051796916f},
+  {1888, 1889, 5, 0, 6.8829618f},
+  {1890, 1891, 5, 0, 8.548659f},
+  {1892, 1893, 1, 0, 5.7235174f},
+  {1894, 1895, 1, 0, 3.7434688f},
+  {1896, 1897, 3, 0, 9.170031f},
+  {1898, 1899, 10, 0, 0.881135f},
+  {1900, 1901, 3, 0, 5.203249f},
+  {-1, -1, 0, 0, 0.03220404f},
+  {-1, -1, 0, 0, -0.21706851f},
+  {-1, -1, 0, 0, 0.008027086f},
+  {-1, -1, 0, 0, -0.07423755f},
+  {-1, -1, 0, 0, -0.26242885f},
+  {-1, -1, 0, 0, -0.16283074f},
+  {-1, -1, 0, 0, -0.12141736f},
+  {-1, -1, 0, 0, -0.084794775f},
+  {-1, -1, 0, 0, -0.052622166f},
+  {-1, -1, 0, 0, 0.017214546f},
+  {-1, -1, 0, 0, -0.089725904f},
+  {-1, -1, 0, 0, 0.0016135693f},
+  {-1, -1, 0, 0, 0.05207473f},
+  {-1, -1, 0, 0, -0.030591665f},
+  {-1, -1, 0, 0, -0.04649852f},
+  {-1, -1, 0, 0, -0.024865558f},
+  {-1, -1, 0, 0, 0.11014583f},
+  {-1, -1, 0, 0, 0.0016486751f},
+  {-1, -1, 0, 0, -0.028827343f},
+  {-1, -1, 0, 0, 0.029102338f},
+  {-1, -1, 0, 0, -0.012588597f},
+  {-1, -1, 0, 0, -0.06092173f},
+  {-1, -1, 0, 0, 0.06721594f},
+  {-1, -1, 0, 0, -0.058315296f},
+  {-1, -1, 0, 0, -0.10586844f},
+  {-1, -1, 0, 0, 0.077450566f},
+  {-1, -1, 0, 0, -0.009990215f},
+  {-1, -1, 0, 0, -0.21038249f},
+  {-1, -1, 0, 0, 0.11162298f},
+  {-1, -1, 0, 0, -0.02043621f},
+  {-1, -1, 0, 0, -0.046546582f},
+  {-1, -1, 0, 0, 0.06547426f},
+  {-1, -1, 0, 0, 0.19662143f},
+  {-1, -1, 0, 0, 0.09820935f},
+  {-1, -1, 0, 0, 0.09578923f},
+  {-1, -1, 0, 0, -0.0020650865f},
+  {-1, -1, 0, 0, -0.002764193f},
+  {-1, -1, 0, 0, 0.01850319f},
+  {-1, -1, 0, 0, -0.016531754f},
+  {-1, -1, 0, 0, 0.12742285f},
+  {-1, -1, 0, 0, 0.22646697f},
+  {-1, -1, 0, 0, 0.050929356f},
+  {-1, -1, 0, 0, 0.067080535f},
+  {-1, -1, 0, 0, 0.17054303f},
+  {-1, -1, 0, 0, 0.21935621f},
+  {-1, -1, 0, 0, 0.1266053f},
+  {1903, 1904, 9, 0, 2.0f},
+  {1905, 1906, 0, 0, 0.67f},
+  {1907, 1908, 7, 0, 23.0f},
+  {1909, 1910, 7, 0, 7.0f},
+  {1911, 1912, 7, 0, 20.0f},
+  {1913, 1914, 0, 0, 1.0f},
+  {1915, 1916, 7, 0, 34.0f},
+  {1917, 1918, 6, 0, 1.0f},
+  {1919, 1920, 7, 0, 12.0f},
+  {1921, 1922, 5, 0, 10.198943f},
+  {-1, -1, 0, 0, 0.102858044f},
+  {1923, 1924, 9, 0, 3.0f},
+  {1925, 1926, 10, 0, 0.9100054f},
+  {1927, 1928, 5, 0, 8.143963f},
+  {-1, -1, 0, 0, 0.2331193f},
+  {1929, 1930, 4, 0, 1.0f},
+  {1931, 1932, 1, 0, 3.0097222f},
+  {1933, 1934, 1, 0, 3.0097222f},
+  {1935, 1936, 1, 0, 4.1400714f},
+  {1937, 1938, 1, 0, 6.1167192f},
+  {1939, 1940, 7, 0, 14.0f},
+  {1941, 1942, 4, 0, 1.0f},
+  {1943, 1944, 1, 0, 4.3037343f},
+  {1945, 1946, 3, 0, 3.025743f},
+  {1947, 1948, 1, 0, 3.0097222f},
+  {1949, 1950, 5, 0, 6.1160326f},
+  {1951, 1952, 7, 0, 25.0f},
+  {1953, 1954, 10, 0, 0.6204305f},
+  {1955, 1956, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 0.14471708f},
+  {1957, 1958, 0, 0, 0.33f},
+  {1959, 1960, 6, 0, 1.0f},
+  {1961, 1962, 10, 0, 0.78594303f},
+  {1963, 1964, 6, 0, 1.0f},
+  {1965, 1966, 1, 0, 6.1167192f},
+  {1967, 1968, 5, 0, 4.32732f},
+  {1969, 1970, 3, 0, 5.203249f},
+  {1971, 1972, 3, 0, 14.859064f},
+  {1973, 1974, 10, 0, 0.62730575f},
+  {1975, 1976, 1, 0, 5.3783803f},
+  {1977, 1978, 3, 0, 3.5048244f},
+  {1979, 1980, 0, 0, 0.33f},
+  {1981, 1982, 10, 0, 0.6030454f},
+  {1983, 1984, 10, 0, 0.8105315f},
+  {1985, 1986, 3, 0, 3.471103f},
+  {1987, 1988, 5, 0, 3.0662608f},
+  {-1, -1, 0, 0, 0.27459115f},
+  {1989, 1990, 10, 0, 0.63544995f},
+  {1991, 1992, 3, 0, 3.471103f},
+  {-1, -1, 0, 0, 0.11938172f},
+  {-1, -1, 0, 0, 0.29513404f},
+  {-1, -1, 0, 0, -0.1410417f},
+  {-1, -1, 0, 0, -0.08351882f},
+  {-1, -1, 0, 0, 0.10032215f},
+  {-1, -1, 0, 0, -0.000975717f},
+  {-1, -1, 0, 0, 0.08836792f},
+  {-1, -1, 0, 0, -0.011630789f},
+  {-1, -1, 0, 0, -0.024543641f},
+  {-1, -1, 0, 0, 0.04875463f},
+  {-1, -1, 0, 0, -0.04910759f},
+  {-1, -1, 0, 0, -0.025093937f},
+  {-1, -1, 0, 0, -0.0054470254f},
+  {-1, -1, 0, 0, 0.063469686f},
+  {-1, -1, 0, 0, -0.040227097f},
+  {-1, -1, 0, 0, 0.0077962703f},
+  {-1, -1, 0, 0, -0.023019299f},
+  {-1, -1, 0, 0, 0.029891465f},
+  {-1, -1, 0, 0, 0.078880936f},
+  {-1, -1, 0, 0, 0.008968341f},
+  {-1, -1, 0, 0, -0.0070229904f},
+  {-1, -1, 0, 0, -0.045010634f},
+  {-1, -1, 0, 0, -0.015237832f},
+  {-1, -1, 0, 0, 0.061671793f},
+  {-1, -1, 0, 0, 0.057940908f},
+  {-1, -1, 0, 0, -0.023650503f},
+  {-1, -1, 0, 0, 0.13820687f},
+  {-1, -1, 0, 0, 0.051196735f},
+  {-1, -1, 0, 0, 0.25376257f},
+  {-1, -1, 0, 0, 0.011993694f},
+  {-1, -1, 0, 0, -0.0911088f},
+  {-1, -1, 0, 0, 0.09234717f},
+  {-1, -1, 0, 0, 0.078874074f},
+  {-1, -1, 0, 0, -0.11150127f},
+  {-1, -1, 0, 0, 0.23355167f},
+  {-1, -1, 0, 0, 0.09961905f},
+  {-1, -1, 0, 0, -0.010740089f},
+  {-1, -1, 0, 0, 0.10416254f},
+  {-1, -1, 0, 0, 0.20106363f},
+  {-1, -1, 0, 0, 0.13401107f},
+  {-1, -1, 0, 0, 0.12786993f},
+  {-1, -1, 0, 0, 0.04170951f},
+  {1994, 1995, 9, 0, 2.0f},
+  {1996, 1997, 4, 0, 1.0f},
+  {1998, 1999, 0, 0, 1.0f},
+  {2000, 2001, 7, 0, 5.0f},
+  {2002, 2003, 10, 0, 0.6714846f},
+  {2004, 2005, 7, 0, 26.0f},
+  {2006, 2007, 7, 0, 28.0f},
+  {2008, 2009, 6, 0, 1.0f},
+  {2010, 2011, 7, 0, 10.0f},
+  {2012, 2013, 1, 0, 5.2430787f},
+  {2014, 2015, 10, 0, 0.74845964f},
+  {2016, 2017, 8, 0, 1.0f},
+  {2018, 2019, 1, 0, 8.116831f},
+  {2020, 2021, 3, 0, 5.2599554f},
+  {2022, 2023, 3, 0, 5.9865937f},
+  {2024, 2025, 7, 0, 0.0f},
+  {2026, 2027, 5, 0, 5.516025f},
+  {2028, 2029, 1, 0, 8.45157f},
+  {2030, 2031, 7, 0, 13.0f},
+  {2032, 2033, 3, 0, 7.109346f},
+  {2034, 2035, 1, 0, 9.390084f},
+  {2036, 2037, 10, 0, 0.73666394f},
+  {2038, 2039, 3, 0, 5.203249f},
+  {2040, 2041, 1, 0, 3.6501784f},
+  {2042, 2043, 3, 0, 7.0555444f},
+  {2044, 2045, 10, 0, 0.8393944f},
+  {-1, -1, 0, 0, 0.2265321f},
+  {2046, 2047, 10, 0, 0.8941616f},
+  {2048, 2049, 3, 0, 5.4294014f},
+  {2050, 2051, 1, 0, 8.174007f},
+  {2052, 2053, 5, 0, 3.8692317f},
+  {2054, 2055, 10, 0, 0.6204305f},
+  {2056, 2057, 7, 0, 1.0f},
+  {2058, 2059, 10, 0, 0.6455678f},
+  {2060, 2061, 0, 0, 0.67f},
+  {2062, 2063, 5, 0, 42.43611f},
+  {2064, 2065, 1, 0, 9.529186f},
+  {2066, 2067, 1, 0, 3.0097222f},
+  {2068, 2069, 5, 0, 8.494484f},
+  {2070, 2071, 10, 0, 0.6030454f},
+  {2072, 2073, 0, 0, 0.33f},
+  {2074, 2075, 3, 0, 5.791435f},
+  {2076, 2077, 10, 0, 0.6419955f},
+  {2078, 2079, 5, 0, 3.9921005f},
+  {2080, 2081, 5, 0, 30.373415f},
+  {2082, 2083, 1, 0, 5.6561294f},
+  {2084, 2085, 5, 0, 3.5704215f},
+  {2086, 2087, 3, 0, 9.170031f},
+  {2088, 2089, 3, 0, 3.025743f},
+  {2090, 2091, 1, 0, 9.662527f},
+  {2092, 2093, 1, 0, 3.715711f},
+  {2094, 2095, 7, 0, 29.0f},
+  {2096, 2097, 1, 0, 5.184029f},
+  {2098, 2099, 1, 0, 4.84522f},
+  {2100, 2101, 1, 0, 3.0097222f},
+  {2102, 2103, 1, 0, 4.324107f},
+  {2104, 2105, 10, 0, 0.86295253f},
+  {2106, 2107, 10, 0, 0.65128046f},
+  {-1, -1, 0, 0, 0.21722208f},
+  {2108, 2109, 1, 0, 3.0097222f},
+  {2110, 2111, 3, 0, 9.5558405f},
+  {-1, -1, 0, 0, -0.18820618f},
+  {-1, -1, 0, 0, -0.04310888f},
+  {-1, -1, 0, 0, -0.15593031f},
+  {-1, -1, 0, 0, -0.08598038f},
+  {-1, -1, 0, 0, 0.19275948f},
+  {-1, -1, 0, 0, 0.04528735f},
+  {-1, -1, 0, 0, 0.038353194f},
+  {-1, -1, 0, 0, -0.05280831f},
+  {-1, -1, 0, 0, -0.03458342f},
+  {-1, -1, 0, 0, -0.07957459f},
+  {-1, -1, 0, 0, -0.08154755f},
+  {-1, -1, 0, 0, -0.047370292f},
+  {-1, -1, 0, 0, 0.02637063f},
+  {-1, -1, 0, 0, -0.021935279f},
+  {-1, -1, 0, 0, 0.04753712f},
+  {-1, -1, 0, 0, -0.013615824f},
+  {-1, -1, 0, 0, -0.018301735f},
+  {-1, -1, 0, 0, 0.060496986f},
+  {-1, -1, 0, 0, 0.0180573f},
+  {-1, -1, 0, 0, -0.048849598f},
+  {-1, -1, 0, 0, -0.022787048f},
+  {-1, -1, 0, 0, -0.067494236f},
+  {-1, -1, 0, 0, 0.035083678f},
+  {-1, -1, 0, 0, -0.043606758f},
+  {-1, -1, 0, 0, 0.11251692f},
+  {-1, -1, 0, 0, 0.02239774f},
+  {-1, -1, 0, 0, 0.16978121f},
+  {-1, -1, 0, 0, -0.001372242f},
+  {-1, -1, 0, 0, -0.0055811717f},
+  {-1, -1, 0, 0, 0.11378435f},
+  {-1, -1, 0, 0, 0.032147687f},
+  {-1, -1, 0, 0, -0.02653489f},
+  {-1, -1, 0, 0, 0.0975863f},
+  {-1, -1, 0, 0, -0.0015564681f},
+  {-1, -1, 0, 0, -0.029695934f},
+  {-1, -1, 0, 0, 0.038096834f},
+  {-1, -1, 0, 0, 0.13427912f},
+  {-1, -1, 0, 0, -0.019606782f},
+  {-1, -1, 0, 0, -0.05487162f},
+  {-1, -1, 0, 0, 0.078527f},
+  {-1, -1, 0, 0, 0.029793331f},
+  {-1, -1, 0, 0, 0.11624718f},
+  {-1, -1, 0, 0, 0.20887375f},
+  {-1, -1, 0, 0, 0.038314056f},
+  {-1, -1, 0, 0, 0.18346894f},
+  {-1, -1, 0, 0, 0.07853351f},
+  {-1, -1, 0, 0, 0.04430542f},
+  {-1, -1, 0, 0, 0.27756128f},
+  {-1, -1, 0, 0, -0.07038962f},
+  {-1, -1, 0, 0, -0.006908798f},
+  {-1, -1, 0, 0, 0.121984296f},
+  {-1, -1, 0, 0, 0.028424311f},
+  {-1, -1, 0, 0, 0.008842564f},
+  {-1, -1, 0, 0, 0.11539552f},
+  {-1, -1, 0, 0, -0.035849f},
+  {-1, -1, 0, 0, 0.12387579f},
+  {-1, -1, 0, 0, 0.27568185f},
+  {-1, -1, 0, 0, 0.045169353f},
+  {2113, 2114, 9, 0, 2.0f},
+  {2115, 2116, 4, 0, 1.0f},
+  {2117, 2118, 7, 0, 23.0f},
+  {2119, 2120, 7, 0, 5.0f},
+  {2121, 2122, 10, 0, 0.6714846f},
+  {2123, 2124, 7, 0, 0.0f},
+  {2125, 2126, 7, 0, 35.0f},
+  {2127, 2128, 6, 0, 1.0f},
+  {2129, 2130, 7, 0, 10.0f},
+  {2131, 2132, 1, 0, 5.2430787f},
+  {2133, 2134, 10, 0, 0.75259924f},
+  {2135, 2136, 5, 0, 8.143963f},
+  {2137, 2138, 7, 0, 14.0f},
+  {2139, 2140, 5, 0, 8.143963f},
+  {-1, -1, 0, 0, 0.20635383f},
+  {2141, 2142, 5, 0, 43.96941f},
+  {2143, 2144, 5, 0, 5.516025f},
+  {2145, 2146, 1, 0, 44.662483f},
+  {2147, 2148, 7, 0, 13.0f},
+  {2149, 2150, 3, 0, 7.109346f},
+  {2151, 2152, 6, 0, 1.0f},
+  {2153, 2154, 5, 0, 10.198943f},
+  {2155, 2156, 1, 0, 5.527408f},
+  {2157, 2158, 1, 0, 4.027883f},
+  {2159, 2160, 1, 0, 4.1625104f},
+  {2161, 2162, 1, 0, 5.3783803f},
+  {2163, 2164, 10, 0, 0.9338815f},
+  {2165, 2166, 5, 0, 7.1836843f},
+  {2167, 2168, 3, 0, 7.2400966f},
+  {2169, 2170, 2, 0, 1.0f},
+  {2171, 2172, 5, 0, 45.070286f},
+  {2173, 2174, 10, 0, 0.6455678f},
+  {2175, 2176, 1, 0, 3.0097222f},
+  {2177, 2178, 1, 0, 38.58884f},
+  {2179, 2180, 9, 0, 1.0f},
+  {2181, 2182, 0, 0, 0.33f},
+  {2183, 2184, 5, 0, 8.494484f},
+  {2185, 2186, 10, 0, 0.6030454f},
+  {2187, 2188, 3, 0, 7.898526f},
+  {2189, 2190, 7, 0, 0.0f},
+  {2191, 2192, 5, 0, 6.6885986f},
+  {2193, 2194, 10, 0, 0.70347583f},
+  {2195, 2196, 8, 0, 1.0f},
+  {2197, 2198, 7, 0, 14.0f},
+  {2199, 2200, 3, 0, 5.203249f},
+  {2201, 2202, 5, 0, 3.0662608f},
+  {2203, 2204, 10, 0, 0.8518978f},
+  {-1, -1, 0, 0, 0.07497692f},
+  {2205, 2206, 0, 0, 0.33f},
+  {2207, 2208, 7, 0, 13.0f},
+  {2209, 2210, 1, 0, 8.273704f},
+  {2211, 2212, 7, 0, 21.0f},
+  {2213, 2214, 5, 0, 4.410779f},
+  {2215, 2216, 10, 0, 0.63544995f},
+  {2217, 2218, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.2459522f},
+  {-1, -1, 0, 0, 0.08173237f},
+  {-1, -1, 0, 0, -0.09217592f},
+  {-1, -1, 0, 0, -0.028262883f},
+  {-1, -1, 0, 0, 0.08634853f},
+  {-1, -1, 0, 0, -0.052782387f},
+  {-1, -1, 0, 0, 0.17990886f},
+  {-1, -1, 0, 0, 0.04189081f},
+  {-1, -1, 0, 0, 0.10733586f},
+  {-1, -1, 0, 0, -0.02287097f},
+  {-1, -1, 0, 0, -0.0396236f},
+  {-1, -1, 0, 0, -0.0010348415f},
+  {-1, -1, 0, 0, -0.07984393f},
+  {-1, -1, 0, 0, -0.004979086f},
+  {-1, -1, 0, 0, 0.027048374f},
+  {-1, -1, 0, 0, -0.020431815f},
+  {-1, -1, 0, 0, 0.04299951f},
+  {-1, -1, 0, 0, -0.012378043f},
+  {-1, -1, 0, 0, -0.016837578f},
+  {-1, -1, 0, 0, 0.0553115f},
+  {-1, -1, 0, 0, -0.06578305f},
+  {-1, -1, 0, 0, -0.007402897f},
+  {-1, -1, 0, 0, -0.00090036396f},
+  {-1, -1, 0, 0, -0.060262986f},
+  {-1, -1, 0, 0, -0.028285122f},
+  {-1, -1, 0, 0, 0.050210573f},
+  {-1, -1, 0, 0, 0.016219817f},
+  {-1, -1, 0, 0, 0.13077796f},
+  {-1, -1, 0, 0, -0.012295003f},
+  {-1, -1, 0, 0, 0.06842024f},
+  {-1, -1, 0, 0, -0.03370823f},
+  {-1, -1, 0, 0, 0.03974959f},
+  {-1, -1, 0, 0, 0.095116265f},
+  {-1, -1, 0, 0, 0.00046374864f},
+  {-1, -1, 0, 0, 0.17097156f},
+  {-1, -1, 0, 0, -0.036609415f},
+  {-1, -1, 0, 0, 0.09294326f},
+  {-1, -1, 0, 0, 0.17746064f},
+  {-1, -1, 0, 0, -0.007898522f},
+  {-1, -1, 0, 0, -0.10165272f},
+  {-1, -1, 0, 0, -0.04465599f},
+  {-1, -1, 0, 0, 0.035158254f},
+  {-1, -1, 0, 0, -0.2687178f},
+  {-1, -1, 0, 0, -0.030229984f},
+  {-1, -1, 0, 0, 0.034588613f},
+  {-1, -1, 0, 0, 0.077567056f},
+  {-1, -1, 0, 0, 0.036883928f},
+  {-1, -1, 0, 0, 0.19082706f},
+  {-1, -1, 0, 0, 0.16662143f},
+  {-1, -1, 0, 0, 0.10658487f},
+  {-1, -1, 0, 0, 0.11895565f},
+  {-1, -1, 0, 0, 0.004324913f},
+  {2220, 2221, 9, 0, 2.0f},
+  {2222, 2223, 4, 0, 1.0f},
+  {2224, 2225, 9, 0, 3.0f},
+  {2226, 2227, 6, 0, 1.0f},
+  {2228, 2229, 10, 0, 0.6714846f},
+  {2230, 2231, 7, 0, 28.0f},
+  {2232, 2233, 10, 0, 0.8561354f},
+  {2234, 2235, 7, 0, 4.0f},
+  {2236, 2237, 1, 0, 3.0097222f},
+  {2238, 2239, 7, 0, 14.0f},
+  {2240, 2241, 10, 0, 0.75259924f},
+  {2242, 2243, 1, 0, 6.2872834f},
+  {-1, -1, 0, 0, 0.22168894f},
+  {2244, 2245, 5, 0, 5.2813516f},
+  {2246, 2247, 5, 0, 5.738449f},
+  {2248, 2249, 7, 0, 0.0f},
+  {2250, 2251, 7, 0, 10.0f},
+  {2252, 2253, 5, 0, 4.6846848f},
+  {2254, 2255, 5, 0, 6.1160326f},
+  {2256, 2257, 3, 0, 6.1705437f},
+  {2258, 2259, 1, 0, 4.468344f},
+  {2260, 2261, 5, 0, 10.198943f},
+  {2262, 2263, 10, 0, 0.8115165f},
+  {2264, 2265, 1, 0, 5.578811f},
+  {2266, 2267, 1, 0, 6.4866323f},
+  {2268, 2269, 5, 0, 4.89638f},
+  {2270, 2271, 10, 0, 0.8393944f},
+  {2272, 2273, 5, 0, 4.9658318f},
+  {2274, 2275, 1, 0, 3.886703f},
+  {2276, 2277, 10, 0, 0.6204305f},
+  {2278, 2279, 7, 0, 1.0f},
+  {2280, 2281, 5, 0, 15.654464f},
+  {2282, 2283, 7, 0, 14.0f},
+  {2284, 2285, 3, 0, 3.025743f},
+  {2286, 2287, 10, 0, 0.93222106f},
+  {2288, 2289, 7, 0, 0.0f},
+  {2290, 2291, 7, 0, 15.0f},
+  {2292, 2293, 1, 0, 9.390084f},
+  {2294, 2295, 5, 0, 4.460285f},
+  {2296, 2297, 3, 0, 7.109346f},
+  {2298, 2299, 1, 0, 6.1167192f},
+  {2300, 2301, 10, 0, 0.70347583f},
+  {2302, 2303, 8, 0, 1.0f},
+  {2304, 2305, 0, 0, 0.67f},
+  {2306, 2307, 10, 0, 0.8706961f},
+  {2308, 2309, 10, 0, 0.73666394f},
+  {2310, 2311, 10, 0, 0.78809464f},
+  {2312, 2313, 3, 0, 7.178031f},
+  {2314, 2315, 1, 0, 6.9701552f},
+  {2316, 2317, 10, 0, 0.7671752f},
+  {2318, 2319, 5, 0, 5.2412124f},
+  {2320, 2321, 5, 0, 8.143963f},
+  {2322, 2323, 0, 0, 0.33f},
+  {2324, 2325, 1, 0, 3.7838314f},
+  {2326, 2327, 0, 0, 0.33f},
+  {2328, 2329, 1, 0, 3.0097222f},
+  {2330, 2331, 5, 0, 7.282547f},
+  {-1, -1, 0, 0, -0.16356969f},
+  {-1, -1, 0, 0, -0.032509964f},
+  {-1, -1, 0, 0, -0.13171864f},
+  {-1, -1, 0, 0, -0.07536811f},
+  {-1, -1, 0, 0, -0.050697245f},
+  {-1, -1, 0, 0, -0.032813676f},
+  {-1, -1, 0, 0, -0.016005535f},
+  {-1, -1, 0, 0, 0.03405014f},
+  {-1, -1, 0, 0, -0.017866565f},
+  {-1, -1, 0, 0, -0.06547925f},
+  {-1, -1, 0, 0, 0.089934394f},
+  {-1, -1, 0, 0, -0.029701281f},
+  {-1, -1, 0, 0, 0.10315063f},
+  {-1, -1, 0, 0, 0.0011962041f},
+  {-1, -1, 0, 0, -0.02656132f},
+  {-1, -1, 0, 0, 0.03894989f},
+  {-1, -1, 0, 0, -0.014735775f},
+  {-1, -1, 0, 0, 0.07809176f},
+  {-1, -1, 0, 0, -0.07122533f},
+  {-1, -1, 0, 0, -0.007873249f},
+  {-1, -1, 0, 0, 0.066806f},
+  {-1, -1, 0, 0, 0.0047088624f},
+  {-1, -1, 0, 0, 0.0040046214f},
+  {-1, -1, 0, 0, -0.017707014f},
+  {-1, -1, 0, 0, 0.014778032f},
+  {-1, -1, 0, 0, 0.11851751f},
+  {-1, -1, 0, 0, -0.011177297f},
+  {-1, -1, 0, 0, 0.06271853f},
+  {-1, -1, 0, 0, 0.009567245f},
+  {-1, -1, 0, 0, -0.046551213f},
+  {-1, -1, 0, 0, 0.054936834f},
+  {-1, -1, 0, 0, -0.010803177f},
+  {-1, -1, 0, 0, 0.07935751f},
+  {-1, -1, 0, 0, 0.021990357f},
+  {-1, -1, 0, 0, 0.07380334f},
+  {-1, -1, 0, 0, 0.15643421f},
+  {-1, -1, 0, 0, -0.018680153f},
+  {-1, -1, 0, 0, -0.12754829f},
+  {-1, -1, 0, 0, 0.083684385f},
+  {-1, -1, 0, 0, 0.021018693f},
+  {-1, -1, 0, 0, 0.12109865f},
+  {-1, -1, 0, 0, 0.042119708f},
+  {-1, -1, 0, 0, 0.27584687f},
+  {-1, -1, 0, 0, 0.06981754f},
+  {-1, -1, 0, 0, 0.045829527f},
+  {-1, -1, 0, 0, 0.16922629f},
+  {-1, -1, 0, 0, -0.0009195328f},
+  {-1, -1, 0, 0, -0.08705673f},
+  {-1, -1, 0, 0, 0.053632956f},
+  {-1, -1, 0, 0, 0.14756344f},
+  {-1, -1, 0, 0, 0.03028307f},
+  {-1, -1, 0, 0, -0.032026734f},
+  {-1, -1, 0, 0, 0.14881937f},
+  {-1, -1, 0, 0, -0.032091714f},
+  {-1, -1, 0, 0, 0.28628862f},
+  {-1, -1, 0, 0, 0.09977498f},
+  {2333, 2334, 9, 0, 2.0f},
+  {2335, 2336, 0, 0, 0.67f},
+  {2337, 2338, 0, 0, 1.0f},
+  {2339, 2340, 6, 0, 1.0f},
+  {2341, 2342, 7, 0, 20.0f},
+  {2343, 2344, 7, 0, 21.0f},
+  {2345, 2346, 7, 0, 34.0f},
+  {2347, 2348, 7, 0, 3.0f},
+  {2349, 2350, 0, 0, 0.33f},
+  {2351, 2352, 1, 0, 6.1167192f},
+  {-1, -1, 0, 0, 0.075954705f},
+  {2353, 2354, 8, 0, 0.0f},
+  {2355, 2356, 0, 0, 0.33f},
+  {2357, 2358, 3, 0, 3.1746154f},
+  {2359, 2360, 3, 0, 8.26907f},
+  {2361, 2362, 7, 0, 0.0f},
+  {2363, 2364, 7, 0, 8.0f},
+  {2365, 2366, 1, 0, 4.2443423f},
+  {2367, 2368, 5, 0, 8.632957f},
+  {2369, 2370, 9, 0, 1.0f},
+  {2371, 2372, 5, 0, 5.7609286f},
+  {2373, 2374, 3, 0, 7.6527576f},
+  {2375, 2376, 5, 0, 8.34942f},
+  {2377, 2378, 8, 0, 0.0f},
+  {2379, 2380, 9, 0, 3.0f},
+  {2381, 2382, 5, 0, 4.201236f},
+  {2383, 2384, 3, 0, 5.2599554f},
+  {-1, -1, 0, 0, 0.16456203f},
+  {-1, -1, 0, 0, 0.01879921f},
+  {2385, 2386, 3, 0, 39.509468f},
+  {2387, 2388, 9, 0, 1.0f},
+  {2389, 2390, 10, 0, 0.7283525f},
+  {2391, 2392, 8, 0, 1.0f},
+  {2393, 2394, 3, 0, 31.656399f},
+  {2395, 2396, 3, 0, 7.319384f},
+  {2397, 2398, 10, 0, 0.7554628f},
+  {2399, 2400, 3, 0, 7.0185437f},
+  {2401, 2402, 10, 0, 0.6406073f},
+  {2403, 2404, 7, 0, 13.0f},
+  {2405, 2406, 5, 0, 5.6741195f},
+  {2407, 2408, 3, 0, 23.190714f},
+  {2409, 2410, 7, 0, 12.0f},
+  {2411, 2412, 1, 0, 6.197865f},
+  {2413, 2414, 10, 0, 0.6030454f},
+  {2415, 2416, 1, 0, 5.781907f},
+  {-1, -1, 0, 0, -0.014363194f},
+  {2417, 2418, 5, 0, 6.8829618f},
+  {2419, 2420, 1, 0, 8.012148f},
+  {2421, 2422, 1, 0, 5.7235174f},
+  {2423, 2424, 1, 0, 5.2430787f},
+  {2425, 2426, 3, 0, 3.025743f},
+  {2427, 2428, 5, 0, 7.042338f},
+  {2429, 2430, 3, 0, 5.8848395f},
+  {-1, -1, 0, 0, -0.051594466f},
+  {-1, -1, 0, 0, 0.04140116f},
+  {-1, -1, 0, 0, -0.085520566f},
+  {-1, -1, 0, 0, -0.17280476f},
+  {-1, -1, 0, 0, -0.028199617f},
+  {-1, -1, 0, 0, -0.05027907f},
+  {-1, -1, 0, 0, -0.015812045f},
+  {-1, -1, 0, 0, -0.03644086f},
+  {-1, -1, 0, 0, 0.11256824f},
+  {-1, -1, 0, 0, -0.033449795f},
+  {-1, -1, 0, 0, 0.028327808f},
+  {-1, -1, 0, 0, -0.042567097f},
+  {-1, -1, 0, 0, -0.027167728f},
+  {-1, -1, 0, 0, -0.0024002434f},
+  {-1, -1, 0, 0, 0.014741421f},
+  {-1, -1, 0, 0, 0.09747233f},
+  {-1, -1, 0, 0, -0.012414455f},
+  {-1, -1, 0, 0, 0.087129116f},
+  {-1, -1, 0, 0, -0.018432822f},
+  {-1, -1, 0, 0, 0.014705116f},
+  {-1, -1, 0, 0, 0.032590467f},
+  {-1, -1, 0, 0, 0.25583544f},
+  {-1, -1, 0, 0, 0.015349052f},
+  {-1, -1, 0, 0, -0.03575806f},
+  {-1, -1, 0, 0, -0.19119194f},
+  {-1, -1, 0, 0, 0.001377731f},
+  {-1, -1, 0, 0, 0.11957594f},
+  {-1, -1, 0, 0, 0.026301814f},
+  {-1, -1, 0, 0, -0.028586615f},
+  {-1, -1, 0, 0, 0.049034905f},
+  {-1, -1, 0, 0, 0.044115912f},
+  {-1, -1, 0, 0, -0.074176244f},
+  {-1, -1, 0, 0, 0.12680587f},
+  {-1, -1, 0, 0, 0.059241265f},
+  {-1, -1, 0, 0, 0.048514914f},
+  {-1, -1, 0, 0, 0.114299774f},
+  {-1, -1, 0, 0, -0.03191274f},
+  {-1, -1, 0, 0, -0.0037347793f},
+  {-1, -1, 0, 0, -0.033839446f},
+  {-1, -1, 0, 0, 0.05318108f},
+  {-1, -1, 0, 0, 0.12455561f},
+  {-1, -1, 0, 0, -0.040906716f},
+  {-1, -1, 0, 0, 0.17589022f},
+  {-1, -1, 0, 0, 0.04724867f},
+  {-1, -1, 0, 0, -0.005254062f},
+  {-1, -1, 0, 0, 0.09915263f},
+  {2432, 2433, 9, 0, 2.0f},
+  {2434, 2435, 4, 0, 1.0f},
+  {2436, 2437, 7, 0, 21.0f},
+  {2438, 2439, 6, 0, 1.0f},
+  {2440, 2441, 3, 0, 9.686388f},
+  {2442, 2443, 7, 0, 0.0f},
+  {2444, 2445, 7, 0, 28.0f},
+  {2446, 2447, 7, 0, 3.0f},
+  {2448, 2449, 1, 0, 3.0097222f},
+  {2450, 2451, 10, 0, 0.6714846f},
+  {2452, 2453, 10, 0, 0.8762444f},
+  {2454, 2455, 5, 0, 8.143963f},
+  {2456, 2457, 7, 0, 14.0f},
+  {2458, 2459, 10, 0, 0.6658525f},
+  {2460, 2461, 1, 0, 6.748502f},
+  {2462, 2463, 7, 0, 0.0f},
+  {2464, 2465, 7, 0, 10.0f},
+  {2466, 2467, 5, 0, 4.6846848f},
+  {2468, 2469, 1, 0, 3.6201508f},
+  {2470, 2471, 1, 0, 5.2430787f},
+  {2472, 2473, 10, 0, 0.75259924f},
+  {2474, 2475, 7, 0, 11.0f},
+  {-1, -1, 0, 0, 0.053995658f},
+  {2476, 2477, 1, 0, 4.027883f},
+  {2478, 2479, 1, 0, 4.1625104f},
+  {2480, 2481, 1, 0, 5.3783803f},
+  {2482, 2483, 10, 0, 0.9338815f},
+  {2484, 2485, 9, 0, 3.0f},
+  {2486, 2487, 5, 0, 7.906511f},
+  {2488, 2489, 3, 0, 5.9865937f},
+  {2490, 2491, 5, 0, 3.2517974f},
+  {2492, 2493, 10, 0, 0.6204305f},
+  {2494, 2495, 7, 0, 1.0f},
+  {2496, 2497, 10, 0, 0.64474505f},
+  {2498, 2499, 7, 0, 14.0f},
+  {2500, 2501, 3, 0, 3.025743f},
+  {2502, 2503, 10, 0, 0.93222106f},
+  {2504, 2505, 1, 0, 3.0952337f},
+  {2506, 2507, 3, 0, 31.656399f},
+  {2508, 2509, 3, 0, 7.109346f},
+  {2510, 2511, 1, 0, 9.390084f},
+  {2512, 2513, 10, 0, 0.73666394f},
+  {2514, 2515, 1, 0, 5.527408f},
+  {2516, 2517, 0, 0, 0.67f},
+  {2518, 2519, 1, 0, 3.0097222f},
+  {2520, 2521, 5, 0, 3.0662608f},
+  {2522, 2523, 10, 0, 0.8518978f},
+  {-1, -1, 0, 0, 0.05882899f},
+  {2524, 2525, 0, 0, 0.33f},
+  {2526, 2527, 0, 0, 0.33f},
+  {2528, 2529, 1, 0, 8.273704f},
+  {2530, 2531, 10, 0, 0.9148954f},
+  {2532, 2533, 5, 0, 4.410779f},
+  {2534, 2535, 7, 0, 22.0f},
+  {2536, 2537, 5, 0, 6.1160326f},
+  {2538, 2539, 10, 0, 0.7162703f},
+  {2540, 2541, 3, 0, 7.6527576f},
+  {2542, 2543, 7, 0, 34.0f},
+  {2544, 2545, 5, 0, 3.8692317f},
+  {2546, 2547, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, 0.18037874f},
+  {-1, -1, 0, 0, -0.14384632f},
+  {-1, -1, 0, 0, -0.026146961f},
+  {-1, -1, 0, 0, -0.10990178f},
+  {-1, -1, 0, 0, -0.066992484f},
+  {-1, -1, 0, 0, -0.019401051f},
+  {-1, -1, 0, 0, -0.037719164f},
+  {-1, -1, 0, 0, -0.0127997985f},
+  {-1, -1, 0, 0, 0.03029315f},
+  {-1, -1, 0, 0, -0.016051626f},
+  {-1, -1, 0, 0, -0.060989697f},
+  {-1, -1, 0, 0, 0.07826813f},
+  {-1, -1, 0, 0, -0.028096199f},
+  {-1, -1, 0, 0, -0.011793709f},
+  {-1, -1, 0, 0, -0.063725285f},
+  {-1, -1, 0, 0, 0.013431385f},
+  {-1, -1, 0, 0, -0.022566399f},
+  {-1, -1, 0, 0, 0.02680606f},
+  {-1, -1, 0, 0, -0.026604667f},
+  {-1, -1, 0, 0, -0.033944786f},
+  {-1, -1, 0, 0, 0.004875787f},
+  {-1, -1, 0, 0, 0.035785217f},
+  {-1, -1, 0, 0, 0.10714952f},
+  {-1, -1, 0, 0, -0.012620734f},
+  {-1, -1, 0, 0, 0.029407386f},
+  {-1, -1, 0, 0, -0.04227699f},
+  {-1, -1, 0, 0, 0.0054065227f},
+  {-1, -1, 0, 0, -0.021104574f},
+  {-1, -1, 0, 0, -0.10715654f},
+  {-1, -1, 0, 0, 0.14811236f},
+  {-1, -1, 0, 0, -0.03676039f},
+  {-1, -1, 0, 0, 0.072143674f},
+  {-1, -1, 0, 0, 0.13960092f},
+  {-1, -1, 0, 0, -0.01100626f},
+  {-1, -1, 0, 0, -0.09313293f},
+  {-1, -1, 0, 0, -0.0395504f},
+  {-1, -1, 0, 0, 0.034012865f},
+  {-1, -1, 0, 0, -0.24103217f},
+  {-1, -1, 0, 0, -0.028777886f},
+  {-1, -1, 0, 0, 0.026918713f},
+  {-1, -1, 0, 0, -0.057632703f},
+  {-1, -1, 0, 0, 0.012869835f},
+  {-1, -1, 0, 0, 0.15966485f},
+  {-1, -1, 0, 0, 0.00060443877f},
+  {-1, -1, 0, 0, 0.06476432f},
+  {-1, -1, 0, 0, 0.18789221f},
+  {-1, -1, 0, 0, 0.043353196f},
+  {-1, -1, 0, 0, -0.01308548f},
+  {-1, -1, 0, 0, 0.061904248f},
+  {-1, -1, 0, 0, 0.1507126f},
+  {-1, -1, 0, 0, -0.013781548f},
+  {-1, -1, 0, 0, 0.036482476f},
+  {-1, -1, 0, 0, 0.14506954f},
+  {-1, -1, 0, 0, 0.0379385f},
+  {-1, -1, 0, 0, 0.17747693f},
+  {-1, -1, 0, 0, 0.008124161f},
+  {-1, -1, 0, 0, 0.100699805f},
+  {2549, 2550, 9, 0, 2.0f},
+  {2551, 2552, 4, 0, 1.0f},
+  {2553, 2554, 7, 0, 23.0f},
+  {2555, 2556, 6, 0, 1.0f},
+  {2557, 2558, 7, 0, 0.0f},
+  {2559, 2560, 7, 0, 0.0f},
+  {2561, 2562, 5, 0, 8.217814f},
+  {2563, 2564, 7, 0, 3.0f},
+  {2565, 2566, 1, 0, 3.0097222f},
+  {2567, 2568, 3, 0, 3.471103f},
+  {2569, 2570, 7, 0, 17.0f},
+  {2571, 2572, 3, 0, 3.025743f},
+  {2573, 2574, 7, 0, 14.0f},
+  {2575, 2576, 5, 0, 7.1836843f},
+  {2577, 2578, 7, 0, 25.0f},
+  {2579, 2580, 5, 0, 43.96941f},
+  {2581, 2582, 7, 0, 10.0f},
+  {2583, 2584, 5, 0, 4.6846848f},
+  {2585, 2586, 5, 0, 6.1160326f},
+  {-1, -1, 0, 0, -0.104115546f},
+  {2587, 2588, 3, 0, 5.203249f},
+  {2589, 2590, 3, 0, 3.5048244f},
+  {2591, 2592, 5, 0, 3.9921005f},
+  {2593, 2594, 8, 0, 0.0f},
+  {2595, 2596, 3, 0, 3.5048244f},
+  {2597, 2598, 1, 0, 5.3783803f},
+  {2599, 2600, 10, 0, 0.9338815f},
+  {2601, 2602, 7, 0, 35.0f},
+  {2603, 2604, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.07348972f},
+  {-1, -1, 0, 0, 0.20847802f},
+  {2605, 2606, 2, 0, 1.0f},
+  {2607, 2608, 5, 0, 45.070286f},
+  {2609, 2610, 1, 0, 45.07999f},
+  {2611, 2612, 7, 0, 14.0f},
+  {2613, 2614, 3, 0, 3.025743f},
+  {2615, 2616, 10, 0, 0.93222106f},
+  {2617, 2618, 7, 0, 0.0f},
+  {2619, 2620, 7, 0, 15.0f},
+  {2621, 2622, 0, 0, 0.67f},
+  {2623, 2624, 5, 0, 3.5704215f},
+  {2625, 2626, 3, 0, 3.025743f},
+  {2627, 2628, 10, 0, 0.8381581f},
+  {2629, 2630, 3, 0, 5.331168f},
+  {2631, 2632, 5, 0, 4.7319894f},
+  {2633, 2634, 1, 0, 3.0952337f},
+  {2635, 2636, 5, 0, 7.1284347f},
+  {-1, -1, 0, 0, 0.1625569f},
+  {2637, 2638, 9, 0, 3.0f},
+  {2639, 2640, 6, 0, 1.0f},
+  {2641, 2642, 1, 0, 8.273704f},
+  {2643, 2644, 5, 0, 6.0687356f},
+  {2645, 2646, 5, 0, 4.410779f},
+  {2647, 2648, 10, 0, 0.63544995f},
+  {2649, 2650, 3, 0, 8.26907f},
+  {2651, 2652, 8, 0, 1.0f},
+  {2653, 2654, 7, 0, 32.0f},
+  {-1, -1, 0, 0, -0.07051102f},
+  {-1, -1, 0, 0, -0.015455486f},
+  {-1, -1, 0, 0, 0.09285114f},
+  {-1, -1, 0, 0, -0.03910483f},
+  {-1, -1, 0, 0, -0.02842306f},
+  {-1, -1, 0, 0, -0.056580808f},
+  {-1, -1, 0, 0, -0.011547012f},
+  {-1, -1, 0, 0, 0.027566737f},
+  {-1, -1, 0, 0, -0.015249061f},
+  {-1, -1, 0, 0, -0.056923743f},
+  {-1, -1, 0, 0, 0.07109357f},
+  {-1, -1, 0, 0, -0.02669139f},
+  {-1, -1, 0, 0, 0.09587271f},
+  {-1, -1, 0, 0, 0.000675813f},
+  {-1, -1, 0, 0, -0.022635886f},
+  {-1, -1, 0, 0, 0.0330087f},
+  {-1, -1, 0, 0, 0.03542582f},
+  {-1, -1, 0, 0, 0.18084265f},
+  {-1, -1, 0, 0, 0.07441684f},
+  {-1, -1, 0, 0, -0.01527641f},
+  {-1, -1, 0, 0, -0.051590253f},
+  {-1, -1, 0, 0, 0.06374442f},
+  {-1, -1, 0, 0, -0.015808595f},
+  {-1, -1, 0, 0, 0.011319856f},
+  {-1, -1, 0, 0, 0.034312367f},
+  {-1, -1, 0, 0, 0.0014889718f},
+  {-1, -1, 0, 0, 0.095129855f},
+  {-1, -1, 0, 0, 0.019728947f},
+  {-1, -1, 0, 0, -0.02293625f},
+  {-1, -1, 0, 0, -0.2165722f},
+  {-1, -1, 0, 0, 0.063736014f},
+  {-1, -1, 0, 0, -0.06976681f},
+  {-1, -1, 0, 0, 0.039540734f},
+  {-1, -1, 0, 0, 0.10545881f},
+  {-1, -1, 0, 0, 0.02548067f},
+  {-1, -1, 0, 0, -0.049297366f},
+  {-1, -1, 0, 0, -0.22174954f},
+  {-1, -1, 0, 0, -0.026859347f},
+  {-1, -1, 0, 0, 0.0127855195f},
+  {-1, -1, 0, 0, 0.046916824f},
+  {-1, -1, 0, 0, 0.027089406f},
+  {-1, -1, 0, 0, 0.15154533f},
+  {-1, -1, 0, 0, 0.119208254f},
+  {-1, -1, 0, 0, 0.070440285f},
+  {-1, -1, 0, 0, 0.15995869f},
+  {-1, -1, 0, 0, 0.0628844f},
+  {-1, -1, 0, 0, 0.030485917f},
+  {-1, -1, 0, 0, 0.14912453f},
+  {-1, -1, 0, 0, -0.027869472f},
+  {-1, -1, 0, 0, 0.03928299f},
+  {2656, 2657, 9, 0, 2.0f},
+  {2658, 2659, 4, 0, 1.0f},
+  {2660, 2661, 7, 0, 21.0f},
+  {2662, 2663, 6, 0, 1.0f},
+  {2664, 2665, 3, 0, 9.686388f},
+  {2666, 2667, 7, 0, 0.0f},
+  {2668, 2669, 7, 0, 28.0f},
+  {2670, 2671, 7, 0, 4.0f},
+  {2672, 2673, 0, 0, 0.33f},
+  {2674, 2675, 10, 0, 0.8706961f},
+  {2676, 2677, 10, 0, 0.8762444f},
+  {2678, 2679, 5, 0, 3.8258243f},
+  {2680, 2681, 7, 0, 13.0f},
+  {2682, 2683, 10, 0, 0.6658525f},
+  {2684, 2685, 5, 0, 3.9406066f},
+  {2686, 2687, 5, 0, 43.96941f},
+  {2688, 2689, 7, 0, 14.0f},
+  {2690, 2691, 5, 0, 6.425559f},
+  {2692, 2693, 8, 0, 0.0f},
+  {2694, 2695, 10, 0, 0.8381581f},
+  {2696, 2697, 10, 0, 0.8952225f},
+  {2698, 2699, 7, 0, 11.0f},
+  {-1, -1, 0, 0, 0.05072985f},
+  {2700, 2701, 1, 0, 3.0097222f},
+  {2702, 2703, 5, 0, 6.179205f},
+  {2704, 2705, 0, 0, 0.67f},
+  {2706, 2707, 10, 0, 0.6030454f},
+  {2708, 2709, 9, 0, 3.0f},
+  {2710, 2711, 10, 0, 0.7314549f},
+  {2712, 2713, 7, 0, 29.0f},
+  {2714, 2715, 8, 0, 1.0f},
+  {2716, 2717, 3, 0, 39.509468f},
+  {2718, 2719, 5, 0, 45.070286f},
+  {2720, 2721, 5, 0, 13.62889f},
+  {2722, 2723, 10, 0, 0.75866807f},
+  {2724, 2725, 1, 0, 4.2443423f},
+  {-1, -1, 0, 0, -0.053560615f},
+  {2726, 2727, 1, 0, 6.042851f},
+  {2728, 2729, 1, 0, 6.2872834f},
+  {2730, 2731, 7, 0, 0.0f},
+  {2732, 2733, 1, 0, 3.8621292f},
+  {2734, 2735, 1, 0, 5.527408f},
+  {2736, 2737, 1, 0, 3.0097222f},
+  {2738, 2739, 0, 0, 0.67f},
+  {2740, 2741, 1, 0, 3.0097222f},
+  {2742, 2743, 10, 0, 0.7865555f},
+  {2744, 2745, 1, 0, 3.7838314f},
+  {2746, 2747, 3, 0, 7.704718f},
+  {2748, 2749, 10, 0, 0.8561354f},
+  {2750, 2751, 1, 0, 8.273704f},
+  {2752, 2753, 1, 0, 4.777555f},
+  {2754, 2755, 5, 0, 3.6240613f},
+  {2756, 2757, 5, 0, 6.0687356f},
+  {2758, 2759, 3, 0, 7.517859f},
+  {2760, 2761, 5, 0, 6.1160326f},
+  {2762, 2763, 1, 0, 3.3990655f},
+  {2764, 2765, 7, 0, 27.0f},
+  {-1, -1, 0, 0, -0.048843514f},
+  {2766, 2767, 3, 0, 3.025743f},
+  {2768, 2769, 5, 0, 7.1284347f},
+  {2770, 2771, 5, 0, 7.785548f},
+  {-1, -1, 0, 0, -0.06435044f},
+  {-1, -1, 0, 0, -0.021748802f},
+  {-1, -1, 0, 0, 0.084726684f},
+  {-1, -1, 0, 0, -0.035252374f},
+  {-1, -1, 0, 0, -0.03529927f},
+  {-1, -1, 0, 0, -0.017163059f},
+  {-1, -1, 0, 0, -0.0055111614f},
+  {-1, -1, 0, 0, 0.072358824f},
+  {-1, -1, 0, 0, 0.1354029f},
+  {-1, -1, 0, 0, 0.03548263f},
+  {-1, -1, 0, 0, -0.059425384f},
+  {-1, -1, 0, 0, 0.01740834f},
+  {-1, -1, 0, 0, 0.015446747f},
+  {-1, -1, 0, 0, -0.010374165f},
+  {-1, -1, 0, 0, 0.03741898f},
+  {-1, -1, 0, 0, 0.0008055835f},
+  {-1, -1, 0, 0, 0.16532226f},
+  {-1, -1, 0, 0, 0.052822143f},
+  {-1, -1, 0, 0, -0.1062894f},
+  {-1, -1, 0, 0, 0.014397755f},
+  {-1, -1, 0, 0, 0.05745061f},
+  {-1, -1, 0, 0, -0.011264552f},
+  {-1, -1, 0, 0, -0.03842233f},
+  {-1, -1, 0, 0, 0.005926657f},
+  {-1, -1, 0, 0, -0.019258881f},
+  {-1, -1, 0, 0, -0.09861233f},
+  {-1, -1, 0, 0, 0.22593601f},
+  {-1, -1, 0, 0, 0.05209837f},
+  {-1, -1, 0, 0, -0.05130126f},
+  {-1, -1, 0, 0, 0.08756041f},
+  {-1, -1, 0, 0, -0.03640175f},
+  {-1, -1, 0, 0, 0.09637723f},
+  {-1, -1, 0, 0, 0.033392325f},
+  {-1, -1, 0, 0, 0.16239212f},
+  {-1, -1, 0, 0, -0.17513297f},
+  {-1, -1, 0, 0, -0.02439909f},
+  {-1, -1, 0, 0, 0.007403612f},
+  {-1, -1, 0, 0, -0.013204003f},
+  {-1, -1, 0, 0, 0.079506114f},
+  {-1, -1, 0, 0, -0.06646448f},
+  {-1, -1, 0, 0, 0.009321886f},
+  {-1, -1, 0, 0, 0.05251054f},
+  {-1, -1, 0, 0, 0.028820006f},
+  {-1, -1, 0, 0, 0.0783358f},
+  {-1, -1, 0, 0, 0.16200458f},
+  {-1, -1, 0, 0, 0.035380285f},
+  {-1, -1, 0, 0, 0.05798586f},
+  {-1, -1, 0, 0, -0.036700074f},
+  {-1, -1, 0, 0, 0.07244725f},
+  {-1, -1, 0, 0, -0.01698096f},
+  {-1, -1, 0, 0, 0.028214598f},
+  {-1, -1, 0, 0, 0.099013366f},
+  {-1, -1, 0, 0, 0.16451314f},
+  {-1, -1, 0, 0, 0.057944156f},
+  {-1, -1, 0, 0, 0.0018864496f},
+  {-1, -1, 0, 0, 0.12944113f},
+  {2773, 2774, 9, 0, 2.0f},
+  {2775, 2776, 0, 0, 0.67f},
+  {2777, 2778, 0, 0, 1.0f},
+  {2779, 2780, 6, 0, 1.0f},
+  {2781, 2782, 1, 0, 6.0881815f},
+  {2783, 2784, 7, 0, 16.0f},
+  {2785, 2786, 10, 0, 0.60579807f},
+  {2787, 2788, 7, 0, 3.0f},
+  {2789, 2790, 0, 0, 0.33f},
+  {2791, 2792, 7, 0, 14.0f},
+  {2793, 2794, 3, 0, 5.203249f},
+  {2795, 2796, 7, 0, 0.0f},
+  {2797, 2798, 10, 0, 0.9338815f},
+  {2799, 2800, 5, 0, 3.7302792f},
+  {2801, 2802, 3, 0, 5.203249f},
+  {2803, 2804, 7, 0, 0.0f},
+  {2805, 2806, 1, 0, 45.07999f},
+  {2807, 2808, 1, 0, 4.2443423f},
+  {2809, 2810, 5, 0, 8.632957f},
+  {2811, 2812, 10, 0, 0.77679545f},
+  {2813, 2814, 8, 0, 0.0f},
+  {2815, 2816, 3, 0, 5.1185427f},
+  {2817, 2818, 5, 0, 3.1583395f},
+  {2819, 2820, 0, 0, 0.33f},
+  {2821, 2822, 10, 0, 0.8141858f},
+  {2823, 2824, 3, 0, 7.384106f},
+  {2825, 2826, 5, 0, 4.410779f},
+  {2827, 2828, 3, 0, 3.025743f},
+  {2829, 2830, 5, 0, 4.07375f},
+  {2831, 2832, 3, 0, 3.2109072f},
+  {2833, 2834, 3, 0, 5.8848395f},
+  {2835, 2836, 3, 0, 39.509468f},
+  {2837, 2838, 1, 0, 3.0097222f},
+  {2839, 2840, 3, 0, 47.27214f},
+  {2841, 2842, 9, 0, 1.0f},
+  {2843, 2844, 3, 0, 31.656399f},
+  {2845, 2846, 3, 0, 7.319384f},
+  {2847, 2848, 3, 0, 47.034836f},
+  {2849, 2850, 3, 0, 7.0185437f},
+  {2851, 2852, 10, 0, 0.64474505f},
+  {2853, 2854, 10, 0, 0.82528365f},
+  {-1, -1, 0, 0, -0.071797974f},
+  {2855, 2856, 1, 0, 4.6648245f},
+  {2857, 2858, 3, 0, 4.8399205f},
+  {-1, -1, 0, 0, 0.2306602f},
+  {2859, 2860, 1, 0, 8.791496f},
+  {2861, 2862, 1, 0, 8.687594f},
+  {2863, 2864, 5, 0, 5.738449f},
+  {2865, 2866, 5, 0, 4.460285f},
+  {2867, 2868, 1, 0, 4.63365f},
+  {2869, 2870, 1, 0, 8.273704f},
+  {2871, 2872, 8, 0, 1.0f},
+  {2873, 2874, 3, 0, 8.727181f},
+  {-1, -1, 0, 0, 0.051091958f},
+  {2875, 2876, 1, 0, 7.5773983f},
+  {-1, -1, 0, 0, 0.020269109f},
+  {-1, -1, 0, 0, 0.16117857f},
+  {2877, 2878, 1, 0, 3.7434688f},
+  {2879, 2880, 3, 0, 3.025743f},
+  {2881, 2882, 5, 0, 6.515449f},
+  {2883, 2884, 5, 0, 7.042338f},
+  {2885, 2886, 9, 0, 3.0f},
+  {2887, 2888, 7, 0, 28.0f},
+  {-1, -1, 0, 0, -0.035142887f},
+  {-1, -1, 0, 0, 0.04745043f},
+  {-1, -1, 0, 0, -0.10178818f},
+  {-1, -1, 0, 0, -0.05185107f},
+  {-1, -1, 0, 0, -0.018759085f},
+  {-1, -1, 0, 0, -0.049294773f},
+  {-1, -1, 0, 0, -0.055611577f},
+  {-1, -1, 0, 0, 0.0074413456f},
+  {-1, -1, 0, 0, 0.09212833f},
+  {-1, -1, 0, 0, -0.026839161f},
+  {-1, -1, 0, 0, 0.023875833f},
+  {-1, -1, 0, 0, -0.04140412f},
+  {-1, -1, 0, 0, -0.018179333f},
+  {-1, -1, 0, 0, 0.023652585f},
+  {-1, -1, 0, 0, 0.015385533f},
+  {-1, -1, 0, 0, 0.08435831f},
+  {-1, -1, 0, 0, -0.024600608f},
+  {-1, -1, 0, 0, 0.026597677f},
+  {-1, -1, 0, 0, -0.09172883f},
+  {-1, -1, 0, 0, -0.009139612f},
+  {-1, -1, 0, 0, 0.042339504f},
+  {-1, -1, 0, 0, -0.026040478f},
+  {-1, -1, 0, 0, 0.034635164f},
+  {-1, -1, 0, 0, -0.015325909f},
+  {-1, -1, 0, 0, -0.0028092521f},
+  {-1, -1, 0, 0, 0.102201425f},
+  {-1, -1, 0, 0, 0.0084435595f},
+  {-1, -1, 0, 0, -0.03961685f},
+  {-1, -1, 0, 0, 0.024108086f},
+  {-1, -1, 0, 0, 0.1614761f},
+  {-1, -1, 0, 0, 0.05852073f},
+  {-1, -1, 0, 0, -0.0061007817f},
+  {-1, -1, 0, 0, 0.06364181f},
+  {-1, -1, 0, 0, -0.034107573f},
+  {-1, -1, 0, 0, -0.14208667f},
+  {-1, -1, 0, 0, -0.00513773f},
+  {-1, -1, 0, 0, 0.033127073f},
+  {-1, -1, 0, 0, 0.09741019f},
+  {-1, -1, 0, 0, -0.02073829f},
+  {-1, -1, 0, 0, 0.06348934f},
+  {-1, -1, 0, 0, 0.15603393f},
+  {-1, -1, 0, 0, 0.04351597f},
+  {-1, -1, 0, 0, -0.045100402f},
+  {-1, -1, 0, 0, 0.01147906f},
+  {-1, -1, 0, 0, 0.17145392f},
+  {-1, -1, 0, 0, 0.063549235f},
+  {-1, -1, 0, 0, 0.021285009f},
+  {-1, -1, 0, 0, 0.09093846f},
+  {-1, -1, 0, 0, 0.14542636f},
+  {-1, -1, 0, 0, 0.019767437f},
+  {-1, -1, 0, 0, 0.03636116f},
+  {-1, -1, 0, 0, -0.076772064f},
+  {-1, -1, 0, 0, 0.039724637f},
+  {-1, -1, 0, 0, 0.1063615f},
+  {2890, 2891, 9, 0, 2.0f},
+  {2892, 2893, 4, 0, 1.0f},
+  {2894, 2895, 7, 0, 21.0f},
+  {2896, 2897, 6, 0, 1.0f},
+  {2898, 2899, 3, 0, 9.686388f},
+  {2900, 2901, 7, 0, 0.0f},
+  {2902, 2903, 5, 0, 8.217814f},
+  {2904, 2905, 7, 0, 4.0f},
+  {2906, 2907, 0, 0, 0.33f},
+  {2908, 2909, 10, 0, 0.6714846f},
+  {2910, 2911, 10, 0, 0.8762444f},
+  {2912, 2913, 5, 0, 8.143963f},
+  {2914, 2915, 7, 0, 13.0f},
+  {2916, 2917, 7, 0, 34.0f},
+  {2918, 2919, 7, 0, 25.0f},
+  {2920, 2921, 5, 0, 43.96941f},
+  {2922, 2923, 7, 0, 10.0f},
+  {2924, 2925, 5, 0, 6.425559f},
+  {2926, 2927, 5, 0, 8.632957f},
+  {2928, 2929, 10, 0, 0.65742403f},
+  {2930, 2931, 10, 0, 0.75259924f},
+  {2932, 2933, 7, 0, 11.0f},
+  {-1, -1, 0, 0, 0.047771167f},
+  {2934, 2935, 5, 0, 6.5850716f},
+  {2936, 2937, 1, 0, 4.1625104f},
+  {2938, 2939, 0, 0, 0.67f},
+  {2940, 2941, 10, 0, 0.6030454f},
+  {2942, 2943, 5, 0, 7.1836843f},
+  {2944, 2945, 1, 0, 6.9175615f},
+  {2946, 2947, 3, 0, 8.619322f},
+  {-1, -1, 0, 0, 0.18016194f},
+  {2948, 2949, 3, 0, 39.509468f},
+  {2950, 2951, 3, 0, 27.815134f},
+  {2952, 2953, 3, 0, 47.27214f},
+  {2954, 2955, 10, 0, 0.9294512f},
+  {2956, 2957, 7, 0, 11.0f},
+  {-1, -1, 0, 0, -0.050066423f},
+  {2958, 2959, 7, 0, 15.0f},
+  {2960, 2961, 1, 0, 3.0097222f},
+  {2962, 2963, 7, 0, 11.0f},
+  {2964, 2965, 0, 0, 0.33f},
+  {2966, 2967, 5, 0, 30.373415f},
+  {2968, 2969, 1, 0, 5.527408f},
+  {2970, 2971, 0, 0, 0.67f},
+  {2972, 2973, 1, 0, 3.0097222f},
+  {2974, 2975, 5, 0, 3.8258243f},
+  {2976, 2977, 10, 0, 0.8928462f},
+  {-1, -1, 0, 0, 0.046726864f},
+  {2978, 2979, 0, 0, 0.33f},
+  {2980, 2981, 1, 0, 8.273704f},
+  {2982, 2983, 1, 0, 4.777555f},
+  {2984, 2985, 5, 0, 3.6240613f},
+  {2986, 2987, 10, 0, 0.6094279f},
+  {2988, 2989, 10, 0, 0.63544995f},
+  {2990, 2991, 1, 0, 3.0097222f},
+  {2992, 2993, 5, 0, 7.042338f},
+  {-1, -1, 0, 0, 0.0732631f},
+  {2994, 2995, 0, 0, 0.33f},
+  {-1, -1, 0, 0, -0.016777802f},
+  {-1, -1, 0, 0, -0.05356278f},
+  {-1, -1, 0, 0, -0.017031575f},
+  {-1, -1, 0, 0, 0.03910201f},
+  {-1, -1, 0, 0, -0.07329929f},
+  {-1, -1, 0, 0, -0.02004349f},
+  {-1, -1, 0, 0, -0.053386893f},
+  {-1, -1, 0, 0, -0.0053090765f},
+  {-1, -1, 0, 0, 0.05869341f},
+  {-1, -1, 0, 0, 0.13282888f},
+  {-1, -1, 0, 0, 0.042360425f},
+  {-1, -1, 0, 0, -0.0071200803f},
+  {-1, -1, 0, 0, 0.026402121f},
+  {-1, -1, 0, 0, 0.07063882f},
+  {-1, -1, 0, 0, -0.005742598f},
+  {-1, -1, 0, 0, -0.02591142f},
+  {-1, -1, 0, 0, 0.0114182f},
+  {-1, -1, 0, 0, -0.009850884f},
+  {-1, -1, 0, 0, -0.05293053f},
+  {-1, -1, 0, 0, 0.06741545f},
+  {-1, -1, 0, 0, 0.0014457357f},
+  {-1, -1, 0, 0, -0.012224815f},
+  {-1, -1, 0, 0, 0.022929303f},
+  {-1, -1, 0, 0, -0.034064103f},
+  {-1, -1, 0, 0, 0.0076111318f},
+  {-1, -1, 0, 0, -0.020412922f},
+  {-1, -1, 0, 0, -0.09036682f},
+  {-1, -1, 0, 0, 0.07967703f},
+  {-1, -1, 0, 0, 0.007345573f},
+  {-1, -1, 0, 0, 0.05785933f},
+  {-1, -1, 0, 0, 0.20067449f},
+  {-1, -1, 0, 0, -0.022176458f},
+  {-1, -1, 0, 0, -0.09407866f},
+  {-1, -1, 0, 0, -0.15191498f},
+  {-1, -1, 0, 0, -0.022922277f},
+  {-1, -1, 0, 0, 0.008738804f},
+  {-1, -1, 0, 0, -0.012286854f},
+  {-1, -1, 0, 0, 0.06883729f},
+  {-1, -1, 0, 0, -0.062230617f},
+  {-1, -1, 0, 0, 0.12671764f},
+  {-1, -1, 0, 0, 0.017514488f},
+  {-1, -1, 0, 0, 0.090375714f},
+  {-1, -1, 0, 0, 0.04834527f},
+  {-1, -1, 0, 0, 0.07507973f},
+  {-1, -1, 0, 0, -0.01764365f},
+  {-1, -1, 0, 0, 0.13399938f},
+  {-1, -1, 0, 0, 0.03685713f},
+  {-1, -1, 0, 0, 0.022197152f},
+  {-1, -1, 0, 0, 0.08090992f},
+  {2997, 2998, 9, 0, 2.0f},
+  {2999, 3000, 0, 0, 0.67f},
+  {3001, 3002, 7, 0, 21.0f},
+  {3003, 3004, 6, 0, 1.0f},
+  {3005, 3006, 7, 0, 0.0f},
+  {3007, 3008, 7, 0, 0.0f},
+  {3009, 3010, 7, 0, 28.0f},
+  {3011, 3012, 10, 0, 0.6204305f},
+  {3013, 3014, 0, 0, 0.33f},
+  {3015, 3016, 3, 0, 19.831232f},
+  {3017, 3018, 7, 0, 11.0f},
+  {3019, 3020, 3, 0, 3.025743f},
+  {3021, 3022, 7, 0, 14.0f},
+  {3023, 3024, 10, 0, 0.6658525f},
+  {3025, 3026, 5, 0, 3.9406066f},
+  {3027, 3028, 2, 0, 0.0f},
+  {3029, 3030, 8, 0, 1.0f},
+  {3031, 3032, 1, 0, 4.2443423f},
+  {3033, 3034, 5, 0, 8.632957f},
+  {3035, 3036, 1, 0, 5.527408f},
+  {3037, 3038, 5, 0, 8.165996f},
+  {3039, 3040, 3, 0, 21.078184f},
+  {3041, 3042, 10, 0, 0.6094279f},
+  {3043, 3044, 8, 0, 0.0f},
+  {3045, 3046, 3, 0, 3.5048244f},
+  {3047, 3048, 1, 0, 5.3783803f},
+  {3049, 3050, 10, 0, 0.9338815f},
+  {3051, 3052, 9, 0, 3.0f},
+  {3053, 3054, 10, 0, 0.7314549f},
+  {3055, 3056, 7, 0, 30.0f},
+  {3057, 3058, 10, 0, 0.6795604f},
+  {3059, 3060, 7, 0, 1.0f},
+  {3061, 3062, 1, 0, 15.640303f},
+  {3063, 3064, 10, 0, 0.629555f},
+  {3065, 3066, 7, 0, 0.0f},
+  {3067, 3068, 3, 0, 31.656399f},
+  {3069, 3070, 3, 0, 7.319384f},
+  {3071, 3072, 10, 0, 0.7554628f},
+  {3073, 3074, 3, 0, 7.0185437f},
+  {3075, 3076, 10, 0, 0.72977334f},
+  {3077, 3078, 8, 0, 0.0f},
+  {-1, -1, 0, 0, -0.07216513f},
+  {-1, -1, 0, 0, -0.026413227f},
+  {3079, 3080, 10, 0, 0.87957454f},
+  {3081, 3082, 3, 0, 25.580477f},
+  {3083, 3084, 3, 0, 4.8399205f},
+  {3085, 3086, 10, 0, 0.75259924f},
+  {3087, 3088, 1, 0, 3.0952337f},
+  {3089, 3090, 5, 0, 7.1284347f},
+  {3091, 3092, 1, 0, 3.0097222f},
+  {3093, 3094, 9, 0, 3.0f},
+  {3095, 3096, 0, 0, 0.33f},
+  {3097, 3098, 1, 0, 8.273704f},
+  {3099, 3100, 8, 0, 1.0f},
+  {3101, 3102, 5, 0, 4.410779f},
+  {3103, 3104, 10, 0, 0.64695257f},
+  {3105, 3106, 3, 0, 6.7532005f},
+  {3107, 3108, 1, 0, 3.0097222f},
+  {3109, 3110, 10, 0, 0.7671752f},
+  {3111, 3112, 1, 0, 4.84522f},
+  {3113, 3114, 1, 0, 8.214931f},
+  {3115, 3116, 10, 0, 0.6149299f},
+  {3117, 3118, 5, 0, 6.5850716f},
+  {-1, -1, 0, 0, -0.26237127f},
+  {-1, -1, 0, 0, 0.0010776699f},
+  {-1, -1, 0, 0, -0.0048430213f},
+  {-1, -1, 0, 0, -0.052948486f},
+  {-1, -1, 0, 0, 0.039446663f},
+  {-1, -1, 0, 0, -0.028324485f},
+  {-1, -1, 0, 0, 0.042510554f},
+  {-1, -1, 0, 0, -0.016527707f},
+  {-1, -1, 0, 0, 0.07942607f},
+  {-1, -1, 0, 0, -0.022993898f},
+  {-1, -1, 0, 0, 0.020299204f},
+  {-1, -1, 0, 0, -0.04165535f},
+  {-1, -1, 0, 0, -0.021478783f},
+  {-1, -1, 0, 0, -0.00017044545f},
+  {-1, -1, 0, 0, 0.015227509f},
+  {-1, -1, 0, 0, 0.07660847f},
+  {-1, -1, 0, 0, 0.055877566f},
+  {-1, -1, 0, 0, -0.022450408f},
+  {-1, -1, 0, 0, -0.0013253022f},
+  {-1, -1, 0, 0, 0.107395016f},
+  {-1, -1, 0, 0, -0.04634986f},
+  {-1, -1, 0, 0, 0.0035335065f},
+  {-1, -1, 0, 0, 0.057562303f},
+  {-1, -1, 0, 0, -0.0070023946f},
+  {-1, -1, 0, 0, 0.022395706f},
+  {-1, -1, 0, 0, -0.03930689f},
+  {-1, -1, 0, 0, 0.029829254f},
+  {-1, -1, 0, 0, -0.0011040365f},
+  {-1, -1, 0, 0, -0.03249693f},
+  {-1, -1, 0, 0, -0.20398569f},
+  {-1, -1, 0, 0, 0.043330226f},
+  {-1, -1, 0, 0, -0.06896242f},
+  {-1, -1, 0, 0, 0.18266678f},
+  {-1, -1, 0, 0, 0.088589095f},
+  {-1, -1, 0, 0, 0.02564975f},
+  {-1, -1, 0, 0, 0.07628518f},
+  {-1, -1, 0, 0, -0.02967701f},
+  {-1, -1, 0, 0, 0.033677578f},
+  {-1, -1, 0, 0, -0.1726055f},
+  {-1, -1, 0, 0, -0.0222991f},
+  {-1, -1, 0, 0, 0.0026816241f},
+  {-1, -1, 0, 0, 0.04007201f},
+  {-1, -1, 0, 0, 0.011449877f},
+  {-1, -1, 0, 0, 0.119797446f},
+  {-1, -1, 0, 0, 0.020483099f},
+  {-1, -1, 0, 0, 0.08096657f},
+  {-1, -1, 0, 0, 0.13128766f},
+  {-1, -1, 0, 0, 0.02198944f},
+  {-1, -1, 0, 0, 0.05228727f},
+  {-1, -1, 0, 0, -0.034993123f},
+  {-1, -1, 0, 0, 0.12165598f},
+  {-1, -1, 0, 0, 0.034580972f},
+  {-1, -1, 0, 0, -0.09613012f},
+  {-1, -1, 0, 0, 0.03520321f},
+  {-1, -1, 0, 0, 0.049183894f},
+  {-1, -1, 0, 0, 0.11162903f},
+  {-1, -1, 0, 0, 0.07969502f},
+  {-1, -1, 0, 0, 0.005025346f},
+  {-1, -1, 0, 0, 0.15082283f},
+  {-1, -1, 0, 0, 0.065767065f},
+  {3120, 3121, 9, 0, 2.0f},
+  {3122, 3123, 1, 0, 11.328481f},
+  {3124, 3125, 7, 0, 21.0f},
+  {3126, 3127, 5, 0, 10.198943f},
+  {3128, 3129, 7, 0, 2.0f},
+  {3130, 3131, 7, 0, 0.0f},
+  {3132, 3133, 5, 0, 8.217814f},
+  {3134, 3135, 7, 0, 0.0f},
+  {3136, 3137, 5, 0, 15.654464f},
+  {3138, 3139, 3, 0, 13.377259f},
+  {3140, 3141, 3, 0, 3.025743f},
+  {3142, 3143, 3, 0, 3.025743f},
+  {3144, 3145, 7, 0, 15.0f},
+  {3146, 3147, 7, 0, 34.0f},
+  {3148, 3149, 7, 0, 25.0f},
+  {3150, 3151, 10, 0, 0.8706961f},
+  {3152, 3153, 7, 0, 12.0f},
+  {3154, 3155, 7, 0, 1.0f},
+  {3156, 3157, 5, 0, 29.886265f},
+  {3158, 3159, 10, 0, 0.82660705f},
+  {3160, 3161, 1, 0, 24.49413f},
+  {3162, 3163, 5, 0, 35.795372f},
+  {3164, 3165, 1, 0, 45.07999f},
+  {3166, 3167, 8, 0, 0.0f},
+  {3168, 3169, 3, 0, 3.5048244f},
+  {3170, 3171, 1, 0, 5.3783803f},
+  {3172, 3173, 10, 0, 0.9338815f},
+  {3174, 3175, 5, 0, 7.1836843f},
+  {3176, 3177, 1, 0, 6.9175615f},
+  {3178, 3179, 3, 0, 8.619322f},
+  {-1, -1, 0, 0, 0.16110234f},
+  {3180, 3181, 10, 0, 0.82731265f},
+  {3182, 3183, 1, 0, 5.527408f},
+  {3184, 3185, 5, 0, 5.011349f},
+  {3186, 3187, 5, 0, 8.961955f},
+  {3188, 3189, 3, 0, 9.935952f},
+  {3190, 3191, 7, 0, 8.0f},
+  {3192, 3193, 5, 0, 20.05952f},
+  {3194, 3195, 7, 0, 0.0f},
+  {3196, 3197, 10, 0, 0.6306323f},
+  {3198, 3199, 7, 0, 0.0f},
+  {3200, 3201, 10, 0, 0.905279f},
+  {3202, 3203, 3, 0, 27.815134f},
+  {3204, 3205, 8, 0, 0.0f},
+  {3206, 3207, 1, 0, 35.515816f},
+  {3208, 3209, 5, 0, 12.030727f},
+  {3210, 3211, 3, 0, 11.716022f},
+  {3212, 3213, 1, 0, 3.0952337f},
+  {3214, 3215, 5, 0, 7.1284347f},
+  {3216, 3217, 1, 0, 3.0097222f},
+  {3218, 3219, 3, 0, 8.127335f},
+  {3220, 3221, 10, 0, 0.68713456f},
+  {3222, 3223, 1, 0, 8.273704f},
+  {3224, 3225, 10, 0, 0.9148954f},
+  {3226, 3227, 5, 0, 4.410779f},
+  {3228, 3229, 1, 0, 8.989843f},
+  {3230, 3231, 1, 0, 3.0097222f},
+  {3232, 3233, 5, 0, 7.042338f},
+  {3234, 3235, 1, 0, 8.214931f},
+  {3236, 3237, 0, 0, 0.33f},
+  {-1, -1, 0, 0, -0.014189339f},
+  {-1, -1, 0, 0, 0.023639891f},
+  {-1, -1, 0, 0, 0.122369945f},
+  {-1, -1, 0, 0, -0.053279202f},
+  {-1, -1, 0, 0, 0.032630887f},
+  {-1, -1, 0, 0, -0.025326982f},
+  {-1, -1, 0, 0, -0.0004629135f},
+  {-1, -1, 0, 0, 0.011126275f},
+  {-1, -1, 0, 0, 0.09289389f},
+  {-1, -1, 0, 0, -0.028423596f},
+  {-1, -1, 0, 0, -0.1834148f},
+  {-1, -1, 0, 0, -0.059206545f},
+  {-1, -1, 0, 0, -0.007531799f},
+  {-1, -1, 0, 0, 0.015613245f},
+  {-1, -1, 0, 0, -0.03434334f},
+  {-1, -1, 0, 0, 0.04966442f},
+  {-1, -1, 0, 0, -0.013649299f},
+  {-1, -1, 0, 0, -0.072616026f},
+  {-1, -1, 0, 0, 0.07516052f},
+  {-1, -1, 0, 0, -0.15914588f},
+  {-1, -1, 0, 0, -0.0611915f},
+  {-1, -1, 0, 0, -0.09070232f},
+  {-1, -1, 0, 0, 0.022721231f},
+  {-1, -1, 0, 0, -0.004079205f},
+  {-1, -1, 0, 0, -0.052114516f},
+  {-1, -1, 0, 0, -0.012408085f},
+  {-1, -1, 0, 0, -0.0630828f},
+  {-1, -1, 0, 0, 0.033560142f},
+  {-1, -1, 0, 0, -0.036716733f},
+  {-1, -1, 0, 0, 0.015585846f},
+  {-1, -1, 0, 0, -0.016168531f},
+  {-1, -1, 0, 0, 0.016242577f},
+  {-1, -1, 0, 0, -0.044358034f},
+  {-1, -1, 0, 0, -0.03087206f},
+  {-1, -1, 0, 0, -0.19378643f},
+  {-1, -1, 0, 0, 0.039358202f},
+  {-1, -1, 0, 0, -0.06436494f},
+  {-1, -1, 0, 0, 0.170489f},
+  {-1, -1, 0, 0, 0.08099578f},
+  {-1, -1, 0, 0, 0.02378439f},
+  {-1, -1, 0, 0, 0.0759583f},
+  {-1, -1, 0, 0, 0.052988596f},
+  {-1, -1, 0, 0, -0.025991483f},
+  {-1, -1, 0, 0, -0.11053701f},
+  {-1, -1, 0, 0, -0.020812511f},
+  {-1, -1, 0, 0, 0.017108036f},
+  {-1, -1, 0, 0, -0.05771577f},
+  {-1, -1, 0, 0, 0.010686557f},
+  {-1, -1, 0, 0, 0.1102137f},
+  {-1, -1, 0, 0, 0.042543527f},
+  {-1, -1, 0, 0, 0.101706915f},
+  {-1, -1, 0, 0, 0.060782272f},
+  {-1, -1, 0, 0, -0.01892521f},
+  {-1, -1, 0, 0, 0.11504846f},
+  {-1, -1, 0, 0, 0.031725883f},
+  {-1, -1, 0, 0, 0.034588546f},
+  {-1, -1, 0, 0, 0.07140301f},
+  {-1, -1, 0, 0, 0.019358253f},
+  {-1, -1, 0, 0, 0.07004433f},
+  {3239, 3240, 9, 0, 2.0f},
+  {3241, 3242, 4, 0, 1.0f},
+  {3243, 3244, 0, 0, 1.0f},
+  {3245, 3246, 7, 0, 7.0f},
+  {3247, 3248, 3, 0, 5.5074186f},
+  {3249, 3250, 3, 0, 8.727181f},
+  {3251, 3252, 10, 0, 0.60579807f},
+  {3253, 3254, 8, 0, 1.0f},
+  {3255, 3256, 7, 0, 13.0f},
+  {3257, 3258, 7, 0, 0.0f},
+  {3259, 3260, 3, 0, 5.9865937f},
+  {3261, 3262, 3, 0, 7.1573887f},
+  {3263, 3264, 3, 0, 8.892979f},
+  {3265, 3266, 5, 0, 3.7302792f},
+  {3267, 3268, 1, 0, 7.600024f},
+  {3269, 3270, 2, 0, 1.0f},
+  {3271, 3272, 5, 0, 5.516025f},
+  {3273, 3274, 5, 0, 13.62889f},
+  {3275, 3276, 5, 0, 8.494484f},
+  {3277, 3278, 3, 0, 3.471103f},
+  {3279, 3280, 7, 0, 17.0f},
+  {3281, 3282, 10, 0, 0.6226886f},
+  {3283, 3284, 5, 0, 11.359684f},
+  {3285, 3286, 8, 0, 1.0f},
+  {3287, 3288, 3, 0, 7.209053f},
+  {-1, -1, 0, 0, 0.14517829f},
+  {3289, 3290, 5, 0, 3.5118535f},
+  {3291, 3292, 3, 0, 3.025743f},
+  {3293, 3294, 5, 0, 4.07375f},
+  {3295, 3296, 8, 0, 1.0f},
+  {3297, 3298, 10, 0, 0.7680681f},
+  {3299, 3300, 5, 0, 43.96941f},
+  {3301, 3302, 1, 0, 7.99194f},
+  {3303, 3304, 7, 0, 0.0f},
+  {3305, 3306, 5, 0, 28.933933f},
+  {3307, 3308, 1, 0, 18.48521f},
+  {3309, 3310, 1, 0, 27.188059f},
+  {3311, 3312, 1, 0, 5.465052f},
+  {3313, 3314, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, -0.0903218f},
+  {3315, 3316, 0, 0, 0.67f},
+  {3317, 3318, 3, 0, 3.892201f},
+  {3319, 3320, 5, 0, 3.9921005f},
+  {3321, 3322, 1, 0, 3.0097222f},
+  {3323, 3324, 5, 0, 5.165702f},
+  {3325, 3326, 3, 0, 9.686388f},
+  {3327, 3328, 10, 0, 0.74845964f},
+  {3329, 3330, 1, 0, 3.6501784f},
+  {3331, 3332, 5, 0, 5.2813516f},
+  {3333, 3334, 7, 0, 0.0f},
+  {3335, 3336, 3, 0, 8.26907f},
+  {3337, 3338, 10, 0, 0.82528365f},
+  {3339, 3340, 3, 0, 9.366262f},
+  {-1, -1, 0, 0, 0.010150433f},
+  {-1, -1, 0, 0, 0.126532f},
+  {3341, 3342, 1, 0, 6.4487634f},
+  {3343, 3344, 3, 0, 3.025743f},
+  {3345, 3346, 3, 0, 5.1185427f},
+  {3347, 3348, 1, 0, 3.886703f},
+  {3349, 3350, 10, 0, 0.7211154f},
+  {3351, 3352, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.038241092f},
+  {-1, -1, 0, 0, 0.0058667297f},
+  {-1, -1, 0, 0, -0.011913744f},
+  {-1, -1, 0, 0, 0.03461207f},
+  {-1, -1, 0, 0, 0.116691865f},
+  {-1, -1, 0, 0, 0.0059834295f},
+  {-1, -1, 0, 0, -0.046439797f},
+  {-1, -1, 0, 0, 0.033039697f},
+  {-1, -1, 0, 0, -0.019066656f},
+  {-1, -1, 0, 0, 0.0330026f},
+  {-1, -1, 0, 0, 0.0018903296f},
+  {-1, -1, 0, 0, -0.038992926f},
+  {-1, -1, 0, 0, -0.0024879575f},
+  {-1, -1, 0, 0, 0.04070404f},
+  {-1, -1, 0, 0, 0.045155715f},
+  {-1, -1, 0, 0, -0.032419097f},
+  {-1, -1, 0, 0, 0.030166987f},
+  {-1, -1, 0, 0, 0.14707193f},
+  {-1, -1, 0, 0, 0.023437455f},
+  {-1, -1, 0, 0, -0.018938761f},
+  {-1, -1, 0, 0, 0.02095673f},
+  {-1, -1, 0, 0, 0.08592005f},
+  {-1, -1, 0, 0, 0.061202195f},
+  {-1, -1, 0, 0, 0.0021734715f},
+  {-1, -1, 0, 0, -0.09133772f},
+  {-1, -1, 0, 0, -0.021539053f},
+  {-1, -1, 0, 0, 0.014828523f},
+  {-1, -1, 0, 0, -0.037784837f},
+  {-1, -1, 0, 0, -0.003630499f},
+  {-1, -1, 0, 0, -0.03440694f},
+  {-1, -1, 0, 0, 0.043780833f},
+  {-1, -1, 0, 0, -0.0024323475f},
+  {-1, -1, 0, 0, 0.04127995f},
+  {-1, -1, 0, 0, 0.11431314f},
+  {-1, -1, 0, 0, -0.033675577f},
+  {-1, -1, 0, 0, -0.17942448f},
+  {-1, -1, 0, 0, 0.010167903f},
+  {-1, -1, 0, 0, -0.04665416f},
+  {-1, -1, 0, 0, 0.09684417f},
+  {-1, -1, 0, 0, 0.0009733772f},
+  {-1, -1, 0, 0, 0.038551982f},
+  {-1, -1, 0, 0, -0.009964604f},
+  {-1, -1, 0, 0, -0.03361225f},
+  {-1, -1, 0, 0, 0.0060298922f},
+  {-1, -1, 0, 0, 0.13718478f},
+  {-1, -1, 0, 0, 0.04293944f},
+  {-1, -1, 0, 0, 0.09434085f},
+  {-1, -1, 0, 0, 0.03836625f},
+  {-1, -1, 0, 0, -0.012398519f},
+  {-1, -1, 0, 0, 0.07067312f},
+  {-1, -1, 0, 0, 0.015724838f},
+  {-1, -1, 0, 0, -0.06623314f},
+  {-1, -1, 0, 0, 0.025545428f},
+  {-1, -1, 0, 0, 0.12738208f},
+  {3354, 3355, 9, 0, 2.0f},
+  {3356, 3357, 4, 0, 1.0f},
+  {3358, 3359, 7, 0, 23.0f},
+  {3360, 3361, 7, 0, 5.0f},
+  {3362, 3363, 3, 0, 5.5074186f},
+  {3364, 3365, 4, 0, 1.0f},
+  {3366, 3367, 5, 0, 8.217814f},
+  {3368, 3369, 7, 0, 0.0f},
+  {3370, 3371, 7, 0, 13.0f},
+  {3372, 3373, 3, 0, 5.1185427f},
+  {3374, 3375, 3, 0, 5.9865937f},
+  {3376, 3377, 7, 0, 20.0f},
+  {3378, 3379, 3, 0, 3.5048244f},
+  {3380, 3381, 5, 0, 6.1160326f},
+  {3382, 3383, 7, 0, 25.0f},
+  {3384, 3385, 3, 0, 39.509468f},
+  {3386, 3387, 7, 0, 2.0f},
+  {3388, 3389, 3, 0, 48.39794f},
+  {3390, 3391, 10, 0, 0.86989284f},
+  {3392, 3393, 10, 0, 0.91605806f},
+  {3394, 3395, 10, 0, 0.70494336f},
+  {3396, 3397, 10, 0, 0.6226886f},
+  {3398, 3399, 5, 0, 11.359684f},
+  {3400, 3401, 5, 0, 4.6846848f},
+  {3402, 3403, 1, 0, 6.514522f},
+  {3404, 3405, 10, 0, 0.61236143f},
+  {3406, 3407, 3, 0, 8.727181f},
+  {3408, 3409, 1, 0, 7.600024f},
+  {3410, 3411, 7, 0, 28.0f},
+  {-1, -1, 0, 0, 0.042312097f},
+  {-1, -1, 0, 0, 0.14261296f},
+  {3412, 3413, 3, 0, 37.69973f},
+  {3414, 3415, 1, 0, 3.0097222f},
+  {3416, 3417, 1, 0, 3.0097222f},
+  {3418, 3419, 9, 0, 1.0f},
+  {3420, 3421, 5, 0, 19.704956f},
+  {3422, 3423, 2, 0, 1.0f},
+  {3424, 3425, 1, 0, 5.7235174f},
+  {3426, 3427, 10, 0, 0.8840814f},
+  {3428, 3429, 10, 0, 0.8381581f},
+  {3430, 3431, 1, 0, 3.0097222f},
+  {3432, 3433, 1, 0, 4.059885f},
+  {-1, -1, 0, 0, 0.18810244f},
+  {3434, 3435, 1, 0, 3.0097222f},
+  {3436, 3437, 5, 0, 5.165702f},
+  {3438, 3439, 10, 0, 0.68187946f},
+  {3440, 3441, 1, 0, 5.937119f},
+  {3442, 3443, 1, 0, 3.0518892f},
+  {3444, 3445, 5, 0, 5.8729773f},
+  {3446, 3447, 5, 0, 3.5704215f},
+  {3448, 3449, 8, 0, 0.0f},
+  {3450, 3451, 0, 0, 0.33f},
+  {3452, 3453, 10, 0, 0.7968596f},
+  {3454, 3455, 3, 0, 7.0890985f},
+  {3456, 3457, 1, 0, 6.9549685f},
+  {3458, 3459, 8, 0, 1.0f},
+  {3460, 3461, 1, 0, 8.214931f},
+  {3462, 3463, 3, 0, 3.2920585f},
+  {3464, 3465, 9, 0, 3.0f},
+  {-1, -1, 0, 0, -0.012338911f},
+  {-1, -1, 0, 0, -0.14341208f},
+  {-1, -1, 0, 0, 0.16701968f},
+  {-1, -1, 0, 0, -0.017773917f},
+  {-1, -1, 0, 0, -0.09898857f},
+  {-1, -1, 0, 0, -0.0414594f},
+  {-1, -1, 0, 0, -0.012313771f},
+  {-1, -1, 0, 0, -0.059877783f},
+  {-1, -1, 0, 0, -0.014804469f},
+  {-1, -1, 0, 0, -0.0016675374f},
+  {-1, -1, 0, 0, -0.082300395f},
+  {-1, -1, 0, 0, -0.004365031f},
+  {-1, -1, 0, 0, -0.01985511f},
+  {-1, -1, 0, 0, 0.015193025f},
+  {-1, -1, 0, 0, 0.07940855f},
+  {-1, -1, 0, 0, 0.0046620606f},
+  {-1, -1, 0, 0, 0.008441598f},
+  {-1, -1, 0, 0, 0.049478795f},
+  {-1, -1, 0, 0, 0.04200661f},
+  {-1, -1, 0, 0, -0.0442317f},
+  {-1, -1, 0, 0, 0.017187214f},
+  {-1, -1, 0, 0, -0.02674048f},
+  {-1, -1, 0, 0, 0.058142092f},
+  {-1, -1, 0, 0, 0.0020648004f},
+  {-1, -1, 0, 0, -0.084030665f},
+  {-1, -1, 0, 0, -0.020103138f},
+  {-1, -1, 0, 0, -0.014986667f},
+  {-1, -1, 0, 0, 0.017163469f},
+  {-1, -1, 0, 0, -0.03491468f},
+  {-1, -1, 0, 0, -0.005490625f},
+  {-1, -1, 0, 0, -0.096223645f},
+  {-1, -1, 0, 0, 0.043447476f},
+  {-1, -1, 0, 0, -0.12780929f},
+  {-1, -1, 0, 0, -0.013949038f},
+  {-1, -1, 0, 0, 0.020834161f},
+  {-1, -1, 0, 0, 0.12039639f},
+  {-1, -1, 0, 0, -0.0155238155f},
+  {-1, -1, 0, 0, -0.07329426f},
+  {-1, -1, 0, 0, 0.04145355f},
+  {-1, -1, 0, 0, -0.086846925f},
+  {-1, -1, 0, 0, 0.1257373f},
+  {-1, -1, 0, 0, 0.022413103f},
+  {-1, -1, 0, 0, 0.025771523f},
+  {-1, -1, 0, 0, -0.015144085f},
+  {-1, -1, 0, 0, 0.08052581f},
+  {-1, -1, 0, 0, 0.0023172887f},
+  {-1, -1, 0, 0, 0.08063665f},
+  {-1, -1, 0, 0, 0.017126217f},
+  {-1, -1, 0, 0, -0.025851956f},
+  {-1, -1, 0, 0, 0.04739361f},
+  {-1, -1, 0, 0, 0.016499547f},
+  {-1, -1, 0, 0, -0.045674898f},
+  {-1, -1, 0, 0, 0.12133489f},
+  {-1, -1, 0, 0, 0.030283382f},
+  {3467, 3468, 9, 0, 2.0f},
+  {3469, 3470, 6, 0, 1.0f},
+  {3471, 3472, 7, 0, 21.0f},
+  {3473, 3474, 10, 0, 0.6204305f},
+  {3475, 3476, 7, 0, 0.0f},
+  {3477, 3478, 3, 0, 3.0865963f},
+  {3479, 3480, 5, 0, 3.309619f},
+  {3481, 3482, 7, 0, 1.0f},
+  {3483, 3484, 9, 0, 1.0f},
+  {3485, 3486, 3, 0, 5.203249f},
+  {3487, 3488, 7, 0, 17.0f},
+  {3489, 3490, 10, 0, 0.8840814f},
+  {3491, 3492, 3, 0, 3.5048244f},
+  {3493, 3494, 4, 0, 1.0f},
+  {3495, 3496, 7, 0, 28.0f},
+  {3497, 3498, 2, 0, 0.0f},
+  {3499, 3500, 1, 0, 4.777555f},
+  {3501, 3502, 8, 0, 0.0f},
+  {3503, 3504, 7, 0, 0.0f},
+  {3505, 3506, 3, 0, 4.8157487f},
+  {3507, 3508, 10, 0, 0.7439139f},
+  {3509, 3510, 3, 0, 5.9865937f},
+  {3511, 3512, 3, 0, 7.8076744f},
+  {3513, 3514, 10, 0, 0.8617883f},
+  {3515, 3516, 10, 0, 0.9413066f},
+  {3517, 3518, 10, 0, 0.76512724f},
+  {3519, 3520, 9, 0, 3.0f},
+  {3521, 3522, 7, 0, 31.0f},
+  {3523, 3524, 3, 0, 5.0814815f},
+  {3525, 3526, 7, 0, 27.0f},
+  {3527, 3528, 3, 0, 5.9865937f},
+  {-1, -1, 0, 0, -0.22537442f},
+  {3529, 3530, 1, 0, 15.640303f},
+  {3531, 3532, 7, 0, 3.0f},
+  {3533, 3534, 0, 0, 0.33f},
+  {3535, 3536, 1, 0, 3.0097222f},
+  {3537, 3538, 7, 0, 2.0f},
+  {3539, 3540, 1, 0, 3.0097222f},
+  {3541, 3542, 7, 0, 7.0f},
+  {3543, 3544, 1, 0, 4.2443423f},
+  {-1, -1, 0, 0, 0.16997239f},
+  {3545, 3546, 1, 0, 5.9098606f},
+  {3547, 3548, 3, 0, 7.5852423f},
+  {3549, 3550, 1, 0, 8.214931f},
+  {3551, 3552, 5, 0, 4.510741f},
+  {3553, 3554, 10, 0, 0.70494336f},
+  {3555, 3556, 3, 0, 15.336419f},
+  {3557, 3558, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.15833984f},
+  {3559, 3560, 1, 0, 3.0952337f},
+  {3561, 3562, 1, 0, 5.315942f},
+  {3563, 3564, 10, 0, 0.6882078f},
+  {3565, 3566, 5, 0, 7.6044974f},
+  {3567, 3568, 3, 0, 8.727181f},
+  {3569, 3570, 10, 0, 0.8872101f},
+  {3571, 3572, 1, 0, 5.2430787f},
+  {3573, 3574, 1, 0, 3.0097222f},
+  {3575, 3576, 3, 0, 3.571177f},
+  {3577, 3578, 10, 0, 0.68442553f},
+  {3579, 3580, 1, 0, 3.0097222f},
+  {3581, 3582, 5, 0, 5.3280272f},
+  {3583, 3584, 3, 0, 5.203249f},
+  {3585, 3586, 10, 0, 0.6795604f},
+  {-1, -1, 0, 0, 0.011315451f},
+  {-1, -1, 0, 0, -0.064053975f},
+  {-1, -1, 0, 0, -0.019434167f},
+  {-1, -1, 0, 0, 0.02950999f},
+  {-1, -1, 0, 0, -0.06769952f},
+  {-1, -1, 0, 0, -0.018188344f},
+  {-1, -1, 0, 0, 0.050530057f},
+  {-1, -1, 0, 0, -0.0044922954f},
+  {-1, -1, 0, 0, -0.033366743f},
+  {-1, -1, 0, 0, -0.013743608f},
+  {-1, -1, 0, 0, 0.07998784f},
+  {-1, -1, 0, 0, 0.0019336947f},
+  {-1, -1, 0, 0, -0.060212653f},
+  {-1, -1, 0, 0, 0.0031863635f},
+  {-1, -1, 0, 0, 0.09310742f},
+  {-1, -1, 0, 0, 0.0027588299f},
+  {-1, -1, 0, 0, 0.059875228f},
+  {-1, -1, 0, 0, -0.047382705f},
+  {-1, -1, 0, 0, -0.10664975f},
+  {-1, -1, 0, 0, 0.0028741455f},
+  {-1, -1, 0, 0, -0.028051103f},
+  {-1, -1, 0, 0, 0.008373392f},
+  {-1, -1, 0, 0, -0.025825962f},
+  {-1, -1, 0, 0, 0.01871859f},
+  {-1, -1, 0, 0, 0.020680714f},
+  {-1, -1, 0, 0, 0.05782442f},
+  {-1, -1, 0, 0, -0.015263557f},
+  {-1, -1, 0, 0, 0.0130808195f},
+  {-1, -1, 0, 0, -0.037234645f},
+  {-1, -1, 0, 0, 0.033165846f},
+  {-1, -1, 0, 0, 0.009297289f},
+  {-1, -1, 0, 0, 0.092953876f},
+  {-1, -1, 0, 0, 0.029234825f},
+  {-1, -1, 0, 0, -0.099654704f},
+  {-1, -1, 0, 0, 0.047333576f},
+  {-1, -1, 0, 0, 0.16281624f},
+  {-1, -1, 0, 0, 0.042566795f},
+  {-1, -1, 0, 0, -0.0035054206f},
+  {-1, -1, 0, 0, -0.0027708951f},
+  {-1, -1, 0, 0, 0.0341781f},
+  {-1, -1, 0, 0, 0.008305376f},
+  {-1, -1, 0, 0, 0.18278359f},
+  {-1, -1, 0, 0, -0.06851997f},
+  {-1, -1, 0, 0, -0.019396171f},
+  {-1, -1, 0, 0, 0.0056110383f},
+  {-1, -1, 0, 0, 0.054394055f},
+  {-1, -1, 0, 0, -0.0033959963f},
+  {-1, -1, 0, 0, 0.10676201f},
+  {-1, -1, 0, 0, 0.06307864f},
+  {-1, -1, 0, 0, -0.040331583f},
+  {-1, -1, 0, 0, 0.067950234f},
+  {-1, -1, 0, 0, 0.027389323f},
+  {-1, -1, 0, 0, -0.019269308f},
+  {-1, -1, 0, 0, -0.064548425f},
+  {-1, -1, 0, 0, 0.060912192f},
+  {-1, -1, 0, 0, -0.05061531f},
+  {-1, -1, 0, 0, 0.03866716f},
+  {-1, -1, 0, 0, 0.12586902f},
+  {3588, 3589, 9, 0, 2.0f},
+  {3590, 3591, 6, 0, 1.0f},
+  {3592, 3593, 0, 0, 1.0f},
+  {3594, 3595, 10, 0, 0.6204305f},
+  {3596, 3597, 5, 0, 8.961955f},
+  {3598, 3599, 1, 0, 8.533123f},
+  {3600, 3601, 10, 0, 0.60579807f},
+  {3602, 3603, 7, 0, 1.0f},
+  {3604, 3605, 9, 0, 1.0f},
+  {3606, 3607, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.082670785f},
+  {3608, 3609, 1, 0, 6.9701552f},
+  {3610, 3611, 5, 0, 6.3587155f},
+  {3612, 3613, 5, 0, 3.7302792f},
+  {3614, 3615, 10, 0, 0.6139097f},
+  {3616, 3617, 2, 0, 0.0f},
+  {3618, 3619, 1, 0, 4.777555f},
+  {3620, 3621, 8, 0, 0.0f},
+  {3622, 3623, 10, 0, 0.718495f},
+  {3624, 3625, 3, 0, 5.203249f},
+  {3626, 3627, 7, 0, 17.0f},
+  {3628, 3629, 1, 0, 6.72941f},
+  {3630, 3631, 1, 0, 7.230137f},
+  {3632, 3633, 5, 0, 5.516025f},
+  {3634, 3635, 1, 0, 9.724324f},
+  {3636, 3637, 3, 0, 3.025743f},
+  {3638, 3639, 5, 0, 4.07375f},
+  {-1, -1, 0, 0, -0.06702461f},
+  {3640, 3641, 1, 0, 7.600024f},
+  {-1, -1, 0, 0, -0.2060566f},
+  {3642, 3643, 1, 0, 15.640303f},
+  {3644, 3645, 7, 0, 3.0f},
+  {3646, 3647, 0, 0, 0.33f},
+  {3648, 3649, 1, 0, 3.0097222f},
+  {3650, 3651, 10, 0, 0.7595118f},
+  {3652, 3653, 10, 0, 0.7169874f},
+  {3654, 3655, 3, 0, 30.312311f},
+  {3656, 3657, 5, 0, 6.425559f},
+  {3658, 3659, 10, 0, 0.7439139f},
+  {3660, 3661, 3, 0, 21.993366f},
+  {3662, 3663, 3, 0, 7.8076744f},
+  {3664, 3665, 1, 0, 6.197865f},
+  {3666, 3667, 7, 0, 21.0f},
+  {3668, 3669, 10, 0, 0.7266901f},
+  {3670, 3671, 1, 0, 8.249838f},
+  {3672, 3673, 7, 0, 19.0f},
+  {3674, 3675, 1, 0, 9.264399f},
+  {3676, 3677, 1, 0, 8.791496f},
+  {3678, 3679, 1, 0, 9.928482f},
+  {-1, -1, 0, 0, 0.005330467f},
+  {-1, -1, 0, 0, 0.107441776f},
+  {3680, 3681, 1, 0, 6.4487634f},
+  {3682, 3683, 3, 0, 3.025743f},
+  {3684, 3685, 1, 0, 5.8820796f},
+  {3686, 3687, 10, 0, 0.72917897f},
+  {-1, -1, 0, 0, 0.010297068f},
+  {-1, -1, 0, 0, -0.058141302f},
+  {-1, -1, 0, 0, -0.01787943f},
+  {-1, -1, 0, 0, 0.026886905f},
+  {-1, -1, 0, 0, -0.06205791f},
+  {-1, -1, 0, 0, -0.01641614f},
+  {-1, -1, 0, 0, 0.04603851f},
+  {-1, -1, 0, 0, -0.0040558944f},
+  {-1, -1, 0, 0, -0.010041355f},
+  {-1, -1, 0, 0, -0.02844341f},
+  {-1, -1, 0, 0, 0.013897075f},
+  {-1, -1, 0, 0, 0.13593528f},
+  {-1, -1, 0, 0, 0.0015340904f},
+  {-1, -1, 0, 0, -0.036772396f},
+  {-1, -1, 0, 0, 0.1061626f},
+  {-1, -1, 0, 0, 0.009569741f},
+  {-1, -1, 0, 0, 0.03257318f},
+  {-1, -1, 0, 0, -0.057335284f},
+  {-1, -1, 0, 0, -0.010202429f},
+  {-1, -1, 0, 0, 0.016970873f},
+  {-1, -1, 0, 0, 0.036077183f},
+  {-1, -1, 0, 0, -0.0012223244f},
+  {-1, -1, 0, 0, 0.01888696f},
+  {-1, -1, 0, 0, -0.023124482f},
+  {-1, -1, 0, 0, 0.140536f},
+  {-1, -1, 0, 0, 0.018070793f},
+  {-1, -1, 0, 0, -0.02693293f},
+  {-1, -1, 0, 0, -0.13369958f},
+  {-1, -1, 0, 0, 0.019194074f},
+  {-1, -1, 0, 0, -0.05459374f},
+  {-1, -1, 0, 0, 0.07124041f},
+  {-1, -1, 0, 0, 0.008325837f},
+  {-1, -1, 0, 0, -0.017781384f},
+  {-1, -1, 0, 0, -0.08599265f},
+  {-1, -1, 0, 0, -0.0024033866f},
+  {-1, -1, 0, 0, 0.14439431f},
+  {-1, -1, 0, 0, -0.079249196f},
+  {-1, -1, 0, 0, 0.052040577f},
+  {-1, -1, 0, 0, -0.034367118f},
+  {-1, -1, 0, 0, 0.0018264771f},
+  {-1, -1, 0, 0, 0.11630211f},
+  {-1, -1, 0, 0, 0.032400917f},
+  {-1, -1, 0, 0, 0.028949592f},
+  {-1, -1, 0, 0, 0.07037173f},
+  {-1, -1, 0, 0, -0.010376825f},
+  {-1, -1, 0, 0, 0.03677108f},
+  {3689, 3690, 7, 0, 16.0f},
+  {3691, 3692, 4, 0, 1.0f},
+  {3693, 3694, 7, 0, 28.0f},
+  {3695, 3696, 8, 0, 1.0f},
+  {3697, 3698, 7, 0, 0.0f},
+  {3699, 3700, 3, 0, 7.384106f},
+  {3701, 3702, 5, 0, 3.9406066f},
+  {3703, 3704, 7, 0, 2.0f},
+  {3705, 3706, 10, 0, 0.64337784f},
+  {3707, 3708, 0, 0, 0.33f},
+  {3709, 3710, 3, 0, 3.5048244f},
+  {3711, 3712, 1, 0, 5.315942f},
+  {3713, 3714, 1, 0, 3.7434688f},
+  {3715, 3716, 7, 0, 30.0f},
+  {3717, 3718, 8, 0, 1.0f},
+  {3719, 3720, 5, 0, 43.30592f},
+  {3721, 3722, 3, 0, 14.556309f},
+  {3723, 3724, 10, 0, 0.6375711f},
+  {3725, 3726, 10, 0, 0.6455678f},
+  {3727, 3728, 10, 0, 0.67481405f},
+  {3729, 3730, 3, 0, 5.203249f},
+  {3731, 3732, 3, 0, 3.025743f},
+  {3733, 3734, 9, 0, 2.0f},
+  {3735, 3736, 10, 0, 0.7760194f},
+  {3737, 3738, 1, 0, 5.578811f},
+  {3739, 3740, 10, 0, 0.8412273f},
+  {3741, 3742, 3, 0, 8.780311f},
+  {3743, 3744, 1, 0, 4.84522f},
+  {3745, 3746, 10, 0, 0.74279755f},
+  {3747, 3748, 5, 0, 7.475979f},
+  {3749, 3750, 5, 0, 7.785548f},
+  {3751, 3752, 5, 0, 36.359806f},
+  {3753, 3754, 3, 0, 27.815134f},
+  {3755, 3756, 7, 0, 15.0f},
+  {3757, 3758, 3, 0, 18.57498f},
+  {3759, 3760, 0, 0, 0.33f},
+  {-1, -1, 0, 0, -0.101638965f},
+  {-1, -1, 0, 0, 0.21040861f},
+  {3761, 3762, 1, 0, 26.383698f},
+  {3763, 3764, 3, 0, 3.5048244f},
+  {3765, 3766, 5, 0, 5.738449f},
+  {3767, 3768, 3, 0, 5.1185427f},
+  {3769, 3770, 10, 0, 0.86513317f},
+  {3771, 3772, 2, 0, 1.0f},
+  {3773, 3774, 10, 0, 0.6672107f},
+  {3775, 3776, 10, 0, 0.83648086f},
+  {3777, 3778, 3, 0, 8.28214f},
+  {3779, 3780, 10, 0, 0.7196187f},
+  {3781, 3782, 5, 0, 3.5704215f},
+  {-1, -1, 0, 0, -0.093702145f},
+  {3783, 3784, 3, 0, 3.1390157f},
+  {3785, 3786, 1, 0, 3.305006f},
+  {3787, 3788, 3, 0, 7.9278097f},
+  {3789, 3790, 7, 0, 17.0f},
+  {3791, 3792, 1, 0, 6.9549685f},
+  {-1, -1, 0, 0, -0.10065867f},
+  {3793, 3794, 0, 0, 0.33f},
+  {3795, 3796, 3, 0, 9.227634f},
+  {3797, 3798, 7, 0, 33.0f},
+  {3799, 3800, 3, 0, 5.2599554f},
+  {3801, 3802, 3, 0, 4.0969954f},
+  {3803, 3804, 10, 0, 0.64888704f},
+  {3805, 3806, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, -0.02452739f},
+  {-1, -1, 0, 0, -0.070729f},
+  {-1, -1, 0, 0, 0.0703983f},
+  {-1, -1, 0, 0, -0.078079216f},
+  {-1, -1, 0, 0, -0.021377241f},
+  {-1, -1, 0, 0, -0.1285655f},
+  {-1, -1, 0, 0, 0.022013662f},
+  {-1, -1, 0, 0, -0.0071004997f},
+  {-1, -1, 0, 0, -0.08248519f},
+  {-1, -1, 0, 0, -0.015290572f},
+  {-1, -1, 0, 0, -0.0029741952f},
+  {-1, -1, 0, 0, 0.05417608f},
+  {-1, -1, 0, 0, 0.03606987f},
+  {-1, -1, 0, 0, -0.041599974f},
+  {-1, -1, 0, 0, 0.05014162f},
+  {-1, -1, 0, 0, 0.14028007f},
+  {-1, -1, 0, 0, 0.037633944f},
+  {-1, -1, 0, 0, 0.18086357f},
+  {-1, -1, 0, 0, 0.020190468f},
+  {-1, -1, 0, 0, -0.06882835f},
+  {-1, -1, 0, 0, -0.008381399f},
+  {-1, -1, 0, 0, -0.05325861f},
+  {-1, -1, 0, 0, -0.027497172f},
+  {-1, -1, 0, 0, 0.08321689f},
+  {-1, -1, 0, 0, -0.011767592f},
+  {-1, -1, 0, 0, 0.0068673156f},
+  {-1, -1, 0, 0, -0.07843592f},
+  {-1, -1, 0, 0, 0.03283466f},
+  {-1, -1, 0, 0, 0.040042553f},
+  {-1, -1, 0, 0, 0.09452306f},
+  {-1, -1, 0, 0, -0.04965587f},
+  {-1, -1, 0, 0, 0.039666116f},
+  {-1, -1, 0, 0, -0.008363327f},
+  {-1, -1, 0, 0, 0.034430258f},
+  {-1, -1, 0, 0, -0.03581622f},
+  {-1, -1, 0, 0, -0.112798385f},
+  {-1, -1, 0, 0, -0.053875666f},
+  {-1, -1, 0, 0, 0.067782976f},
+  {-1, -1, 0, 0, -0.10338079f},
+  {-1, -1, 0, 0, 0.012667942f},
+  {-1, -1, 0, 0, 0.08640113f},
+  {-1, -1, 0, 0, 0.01627399f},
+  {-1, -1, 0, 0, -0.03481684f},
+  {-1, -1, 0, 0, 0.036463596f},
+  {-1, -1, 0, 0, 0.063798174f},
+  {-1, -1, 0, 0, -0.009085846f},
+  {-1, -1, 0, 0, -0.029623756f},
+  {-1, -1, 0, 0, 0.05527377f},
+  {-1, -1, 0, 0, 0.061192628f},
+  {-1, -1, 0, 0, 0.11592889f},
+  {-1, -1, 0, 0, 0.05438557f},
+  {-1, -1, 0, 0, -0.009561463f},
+  {-1, -1, 0, 0, 0.00389754f},
+  {-1, -1, 0, 0, -0.03433601f},
+  {-1, -1, 0, 0, 0.10996889f},
+  {-1, -1, 0, 0, -0.00899744f},
+  {3808, 3809, 9, 0, 2.0f},
+  {3810, 3811, 6, 0, 1.0f},
+  {3812, 3813, 7, 0, 28.0f},
+  {3814, 3815, 10, 0, 0.6204305f},
+  {3816, 3817, 1, 0, 8.383127f},
+  {3818, 3819, 9, 0, 3.0f},
+  {3820, 3821, 5, 0, 4.859941f},
+  {3822, 3823, 7, 0, 1.0f},
+  {3824, 3825, 9, 0, 1.0f},
+  {3826, 3827, 5, 0, 3.4628122f},
+  {3828, 3829, 1, 0, 8.577419f},
+  {3830, 3831, 10, 0, 0.83648086f},
+  {3832, 3833, 10, 0, 0.8561354f},
+  {3834, 3835, 1, 0, 4.84522f},
+  {3836, 3837, 5, 0, 7.1284347f},
+  {3838, 3839, 2, 0, 0.0f},
+  {3840, 3841, 1, 0, 4.777555f},
+  {3842, 3843, 8, 0, 0.0f},
+  {3844, 3845, 10, 0, 0.7211154f},
+  {3846, 3847, 1, 0, 7.2925344f},
+  {3848, 3849, 0, 0, 0.33f},
+  {3850, 3851, 0, 0, 0.67f},
+  {3852, 3853, 5, 0, 3.1583395f},
+  {3854, 3855, 10, 0, 0.7924982f},
+  {3856, 3857, 7, 0, 16.0f},
+  {3858, 3859, 10, 0, 0.66068304f},
+  {3860, 3861, 3, 0, 5.1185427f},
+  {3862, 3863, 7, 0, 34.0f},
+  {3864, 3865, 8, 0, 1.0f},
+  {3866, 3867, 8, 0, 1.0f},
+  {3868, 3869, 5, 0, 7.785548f},
+  {3870, 3871, 9, 0, 1.0f},
+  {3872, 3873, 3, 0, 17.801981f},
+  {3874, 3875, 7, 0, 3.0f},
+  {3876, 3877, 0, 0, 0.33f},
+  {3878, 3879, 7, 0, 0.0f},
+  {3880, 3881, 10, 0, 0.7595118f},
+  {3882, 3883, 5, 0, 42.43611f},
+  {3884, 3885, 3, 0, 30.312311f},
+  {3886, 3887, 7, 0, 12.0f},
+  {-1, -1, 0, 0, -0.010104561f},
+  {3888, 3889, 3, 0, 31.656399f},
+  {3890, 3891, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.021778917f},
+  {-1, -1, 0, 0, -0.099500686f},
+  {-1, -1, 0, 0, 0.06773291f},
+  {3892, 3893, 7, 0, 13.0f},
+  {3894, 3895, 10, 0, 0.7665948f},
+  {3896, 3897, 7, 0, 23.0f},
+  {3898, 3899, 7, 0, 0.0f},
+  {3900, 3901, 10, 0, 0.8739182f},
+  {3902, 3903, 3, 0, 4.3745303f},
+  {3904, 3905, 3, 0, 5.331168f},
+  {3906, 3907, 3, 0, 3.025743f},
+  {3908, 3909, 5, 0, 5.738449f},
+  {3910, 3911, 3, 0, 7.694672f},
+  {-1, -1, 0, 0, 0.054392435f},
+  {3912, 3913, 3, 0, 3.025743f},
+  {3914, 3915, 0, 0, 0.33f},
+  {3916, 3917, 5, 0, 6.5850716f},
+  {-1, -1, 0, 0, 0.01219616f},
+  {3918, 3919, 1, 0, 5.2587895f},
+  {3920, 3921, 3, 0, 4.0969954f},
+  {-1, -1, 0, 0, -0.11313119f},
+  {-1, -1, 0, 0, -0.242658f},
+  {-1, -1, 0, 0, -0.05641929f},
+  {-1, -1, 0, 0, 0.011709827f},
+  {-1, -1, 0, 0, -0.015532486f},
+  {-1, -1, 0, 0, 0.02549137f},
+  {-1, -1, 0, 0, -0.055818826f},
+  {-1, -1, 0, 0, -0.013884671f},
+  {-1, -1, 0, 0, 0.041564945f},
+  {-1, -1, 0, 0, -0.00477324f},
+  {-1, -1, 0, 0, -0.0077525005f},
+  {-1, -1, 0, 0, -0.02422461f},
+  {-1, -1, 0, 0, 0.009231091f},
+  {-1, -1, 0, 0, 0.08805456f},
+  {-1, -1, 0, 0, 0.0011674295f},
+  {-1, -1, 0, 0, -0.03219794f},
+  {-1, -1, 0, 0, -0.022588126f},
+  {-1, -1, 0, 0, -0.059180677f},
+  {-1, -1, 0, 0, 0.04400346f},
+  {-1, -1, 0, 0, -0.02155695f},
+  {-1, -1, 0, 0, 0.001640662f},
+  {-1, -1, 0, 0, 0.027934147f},
+  {-1, -1, 0, 0, 0.0007453108f},
+  {-1, -1, 0, 0, -0.04330759f},
+  {-1, -1, 0, 0, 0.016682914f},
+  {-1, -1, 0, 0, -0.031910628f},
+  {-1, -1, 0, 0, 0.07217298f},
+  {-1, -1, 0, 0, -0.014415614f},
+  {-1, -1, 0, 0, -0.011336828f},
+  {-1, -1, 0, 0, -0.08871942f},
+  {-1, -1, 0, 0, -0.02846982f},
+  {-1, -1, 0, 0, 0.033788484f},
+  {-1, -1, 0, 0, 0.11215003f},
+  {-1, -1, 0, 0, 0.011471717f},
+  {-1, -1, 0, 0, -0.028235817f},
+  {-1, -1, 0, 0, 0.015714312f},
+  {-1, -1, 0, 0, 0.020141697f},
+  {-1, -1, 0, 0, 0.13269f},
+  {-1, -1, 0, 0, -0.026725436f},
+  {-1, -1, 0, 0, 0.070485614f},
+  {-1, -1, 0, 0, -0.07087727f},
+  {-1, -1, 0, 0, 0.018973859f},
+  {-1, -1, 0, 0, 0.020491822f},
+  {-1, -1, 0, 0, 0.063628815f},
+  {-1, -1, 0, 0, 0.030057907f},
+  {-1, -1, 0, 0, -0.01517086f},
+  {-1, -1, 0, 0, 0.118859485f},
+  {-1, -1, 0, 0, 0.052786257f},
+  {-1, -1, 0, 0, -0.035305064f},
+  {-1, -1, 0, 0, 0.027902318f},
+  {-1, -1, 0, 0, 0.092038505f},
+  {-1, -1, 0, 0, 0.0026563646f},
+  {3923, 3924, 9, 0, 2.0f},
+  {3925, 3926, 6, 0, 1.0f},
+  {3927, 3928, 7, 0, 28.0f},
+  {3929, 3930, 10, 0, 0.67224056f},
+  {3931, 3932, 5, 0, 8.961955f},
+  {3933, 3934, 1, 0, 3.0097222f},
+  {3935, 3936, 5, 0, 4.859941f},
+  {3937, 3938, 10, 0, 0.6714846f},
+  {3939, 3940, 10, 0, 0.7266901f},
+  {3941, 3942, 1, 0, 8.383127f},
+  {-1, -1, 0, 0, 0.070733f},
+  {3943, 3944, 8, 0, 1.0f},
+  {3945, 3946, 8, 0, 1.0f},
+  {3947, 3948, 1, 0, 4.84522f},
+  {3949, 3950, 5, 0, 7.1284347f},
+  {3951, 3952, 7, 0, 1.0f},
+  {-1, -1, 0, 0, -0.1284856f},
+  {3953, 3954, 10, 0, 0.70130366f},
+  {3955, 3956, 2, 0, 1.0f},
+  {3957, 3958, 5, 0, 3.4628122f},
+  {3959, 3960, 1, 0, 8.577419f},
+  {3961, 3962, 3, 0, 3.471103f},
+  {3963, 3964, 5, 0, 6.0687356f},
+  {3965, 3966, 3, 0, 3.1390157f},
+  {3967, 3968, 1, 0, 3.7838314f},
+  {3969, 3970, 7, 0, 30.0f},
+  {3971, 3972, 8, 0, 1.0f},
+  {3973, 3974, 8, 0, 1.0f},
+  {3975, 3976, 5, 0, 7.785548f},
+  {3977, 3978, 5, 0, 31.169077f},
+  {3979, 3980, 1, 0, 3.4432666f},
+  {3981, 3982, 3, 0, 6.3485274f},
+  {3983, 3984, 1, 0, 40.404446f},
+  {3985, 3986, 0, 0, 0.33f},
+  {3987, 3988, 5, 0, 47.54019f},
+  {3989, 3990, 1, 0, 7.2925344f},
+  {3991, 3992, 1, 0, 7.1016955f},
+  {3993, 3994, 0, 0, 0.67f},
+  {3995, 3996, 5, 0, 3.1583395f},
+  {3997, 3998, 10, 0, 0.72274965f},
+  {3999, 4000, 10, 0, 0.8666873f},
+  {4001, 4002, 7, 0, 24.0f},
+  {-1, -1, 0, 0, 0.05757739f},
+  {4003, 4004, 5, 0, 4.381139f},
+  {4005, 4006, 3, 0, 4.8157487f},
+  {4007, 4008, 1, 0, 3.6501784f},
+  {4009, 4010, 1, 0, 7.557411f},
+  {-1, -1, 0, 0, -0.089222975f},
+  {4011, 4012, 7, 0, 34.0f},
+  {4013, 4014, 3, 0, 3.025743f},
+  {4015, 4016, 1, 0, 6.4487634f},
+  {4017, 4018, 3, 0, 5.2599554f},
+  {4019, 4020, 1, 0, 3.0097222f},
+  {4021, 4022, 5, 0, 7.475979f},
+  {4023, 4024, 3, 0, 4.0969954f},
+  {-1, -1, 0, 0, -0.060879927f},
+  {-1, -1, 0, 0, 0.012456642f},
+  {-1, -1, 0, 0, 0.017899837f},
+  {-1, -1, 0, 0, -0.017358867f},
+  {-1, -1, 0, 0, 0.039607067f},
+  {-1, -1, 0, 0, -0.023757247f},
+  {-1, -1, 0, 0, 0.058608312f},
+  {-1, -1, 0, 0, -0.057475835f},
+  {-1, -1, 0, 0, -0.05368771f},
+  {-1, -1, 0, 0, -0.012396081f},
+  {-1, -1, 0, 0, 0.0015966416f},
+  {-1, -1, 0, 0, -0.05991545f},
+  {-1, -1, 0, 0, -0.047925446f},
+  {-1, -1, 0, 0, -0.009599352f},
+  {-1, -1, 0, 0, 0.0057652905f},
+  {-1, -1, 0, 0, 0.030617451f},
+  {-1, -1, 0, 0, -0.020689964f},
+  {-1, -1, 0, 0, -0.09286731f},
+  {-1, -1, 0, 0, 0.06434627f},
+  {-1, -1, 0, 0, -0.008988104f},
+  {-1, -1, 0, 0, 0.123002104f},
+  {-1, -1, 0, 0, 0.0374736f},
+  {-1, -1, 0, 0, 0.019765656f},
+  {-1, -1, 0, 0, 0.09113362f},
+  {-1, -1, 0, 0, -0.09258732f},
+  {-1, -1, 0, 0, 0.009470129f},
+  {-1, -1, 0, 0, 0.009955534f},
+  {-1, -1, 0, 0, -0.05260244f},
+  {-1, -1, 0, 0, 0.04049975f},
+  {-1, -1, 0, 0, -0.0036672712f},
+  {-1, -1, 0, 0, -0.001969502f},
+  {-1, -1, 0, 0, -0.0842453f},
+  {-1, -1, 0, 0, 0.07555389f},
+  {-1, -1, 0, 0, 0.008869375f},
+  {-1, -1, 0, 0, -0.011504904f},
+  {-1, -1, 0, 0, 0.050313044f},
+  {-1, -1, 0, 0, 0.018784111f},
+  {-1, -1, 0, 0, 0.05772039f},
+  {-1, -1, 0, 0, -0.018595887f},
+  {-1, -1, 0, 0, 0.02056923f},
+  {-1, -1, 0, 0, 0.051992606f},
+  {-1, -1, 0, 0, 0.11343572f},
+  {-1, -1, 0, 0, 0.0033065795f},
+  {-1, -1, 0, 0, 0.013768101f},
+  {-1, -1, 0, 0, 0.015185865f},
+  {-1, -1, 0, 0, -0.03873663f},
+  {-1, -1, 0, 0, 0.08467537f},
+  {-1, -1, 0, 0, 0.0024570941f},
+  {4026, 4027, 7, 0, 16.0f},
+  {4028, 4029, 7, 0, 0.0f},
+  {4030, 4031, 10, 0, 0.9338815f},
+  {4032, 4033, 1, 0, 11.328481f},
+  {4034, 4035, 7, 0, 2.0f},
+  {4036, 4037, 7, 0, 23.0f},
+  {4038, 4039, 5, 0, 4.410779f},
+  {4040, 4041, 0, 0, 0.33f},
+  {4042, 4043, 10, 0, 0.82660705f},
+  {4044, 4045, 9, 0, 1.0f},
+  {4046, 4047, 9, 0, 2.0f},
+  {4048, 4049, 1, 0, 8.416812f},
+  {4050, 4051, 5, 0, 8.217814f},
+  {4052, 4053, 9, 0, 3.0f},
+  {4054, 4055, 10, 0, 0.9348987f},
+  {4056, 4057, 10, 0, 0.67481405f},
+  {4058, 4059, 5, 0, 5.7609286f},
+  {4060, 4061, 3, 0, 12.934116f},
+  {4062, 4063, 1, 0, 19.314367f},
+  {4064, 4065, 1, 0, 20.52895f},
+  {4066, 4067, 3, 0, 16.29652f},
+  {4068, 4069, 7, 0, 11.0f},
+  {4070, 4071, 10, 0, 0.8141858f},
+  {4072, 4073, 1, 0, 6.9701552f},
+  {4074, 4075, 5, 0, 3.6240613f},
+  {4076, 4077, 5, 0, 5.2412124f},
+  {4078, 4079, 3, 0, 7.2400966f},
+  {4080, 4081, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 0.02993579f},
+  {4082, 4083, 0, 0, 1.0f},
+  {4084, 4085, 1, 0, 7.5773983f},
+  {4086, 4087, 3, 0, 3.5048244f},
+  {4088, 4089, 10, 0, 0.718495f},
+  {4090, 4091, 5, 0, 5.63685f},
+  {4092, 4093, 5, 0, 27.841745f},
+  {4094, 4095, 1, 0, 41.093555f},
+  {4096, 4097, 1, 0, 38.15698f},
+  {4098, 4099, 1, 0, 14.203641f},
+  {4100, 4101, 1, 0, 35.515816f},
+  {4102, 4103, 10, 0, 0.905279f},
+  {4104, 4105, 3, 0, 43.67558f},
+  {-1, -1, 0, 0, -0.00961082f},
+  {-1, -1, 0, 0, -0.15831469f},
+  {4106, 4107, 3, 0, 6.2768598f},
+  {4108, 4109, 10, 0, 0.6094279f},
+  {4110, 4111, 1, 0, 4.63365f},
+  {4112, 4113, 1, 0, 8.273704f},
+  {4114, 4115, 5, 0, 5.234737f},
+  {4116, 4117, 5, 0, 6.795224f},
+  {4118, 4119, 10, 0, 0.8782648f},
+  {4120, 4121, 1, 0, 9.145805f},
+  {4122, 4123, 5, 0, 4.89638f},
+  {4124, 4125, 1, 0, 6.697984f},
+  {-1, -1, 0, 0, 0.1001366f},
+  {-1, -1, 0, 0, 0.01623783f},
+  {-1, -1, 0, 0, -0.001326561f},
+  {-1, -1, 0, 0, -0.025790691f},
+  {-1, -1, 0, 0, 0.06681614f},
+  {-1, -1, 0, 0, -0.033542346f},
+  {4126, 4127, 9, 0, 2.0f},
+  {-1, -1, 0, 0, 0.01527977f},
+  {-1, -1, 0, 0, 0.011184088f},
+  {-1, -1, 0, 0, -0.071357444f},
+  {-1, -1, 0, 0, 0.21113744f},
+  {-1, -1, 0, 0, 0.054553878f},
+  {-1, -1, 0, 0, 0.022788418f},
+  {-1, -1, 0, 0, 0.15256576f},
+  {-1, -1, 0, 0, -0.023580246f},
+  {-1, -1, 0, 0, 0.025678117f},
+  {-1, -1, 0, 0, 0.11551465f},
+  {-1, -1, 0, 0, -0.09969915f},
+  {-1, -1, 0, 0, -0.052989252f},
+  {-1, -1, 0, 0, 0.053465843f},
+  {-1, -1, 0, 0, -0.080804f},
+  {-1, -1, 0, 0, -0.1949567f},
+  {-1, -1, 0, 0, -0.038879316f},
+  {-1, -1, 0, 0, 0.051668495f},
+  {-1, -1, 0, 0, -0.054037537f},
+  {-1, -1, 0, 0, 0.014865425f},
+  {-1, -1, 0, 0, -0.013480953f},
+  {-1, -1, 0, 0, -0.046969663f},
+  {-1, -1, 0, 0, -0.016837502f},
+  {-1, -1, 0, 0, -0.005025959f},
+  {-1, -1, 0, 0, -0.019326f},
+  {-1, -1, 0, 0, 0.006603516f},
+  {-1, -1, 0, 0, 0.047295716f},
+  {-1, -1, 0, 0, -0.03110013f},
+  {-1, -1, 0, 0, -0.10106993f},
+  {-1, -1, 0, 0, 0.0027680874f},
+  {-1, -1, 0, 0, -0.0060084104f},
+  {-1, -1, 0, 0, 0.02452843f},
+  {-1, -1, 0, 0, -0.05950549f},
+  {-1, -1, 0, 0, 0.009812877f},
+  {-1, -1, 0, 0, 0.08209123f},
+  {-1, -1, 0, 0, -0.02932148f},
+  {-1, -1, 0, 0, 0.06605077f},
+  {-1, -1, 0, 0, -0.03040414f},
+  {-1, -1, 0, 0, 0.0252201f},
+  {-1, -1, 0, 0, 0.11329855f},
+  {-1, -1, 0, 0, -0.0117629655f},
+  {-1, -1, 0, 0, 0.04505803f},
+  {-1, -1, 0, 0, 0.020623922f},
+  {-1, -1, 0, 0, 0.09870777f},
+  {4129, 4130, 9, 0, 2.0f},
+  {4131, 4132, 6, 0, 1.0f},
+  {4133, 4134, 0, 0, 1.0f},
+  {4135, 4136, 10, 0, 0.6204305f},
+  {4137, 4138, 5, 0, 8.632957f},
+  {4139, 4140, 8, 0, 0.0f},
+  {4141, 4142, 10, 0, 0.60579807f},
+  {4143, 4144, 2, 0, 0.0f},
+  {4145, 4146, 10, 0, 0.6260406f},
+  {4147, 4148, 0, 0, 0.33f},
+  {4149, 4150, 1, 0, 3.0097222f},
+  {4151, 4152, 3, 0, 7.694672f},
+  {4153, 4154, 1, 0, 8.533123f},
+  {4155, 4156, 5, 0, 3.7302792f},
+  {4157, 4158, 3, 0, 5.203249f},
+  {4159, 4160, 7, 0, 1.0f},
+  {4161, 4162, 3, 0, 18.418673f},
+  {4163, 4164, 2, 0, 1.0f},
+  {4165, 4166, 7, 0, 14.0f},
+  {4167, 4168, 1, 0, 4.2443423f},
+  {4169, 4170, 1, 0, 3.6201508f},
+  {4171, 4172, 3, 0, 7.0185437f},
+  {4173, 4174, 0, 0, 0.33f},
+  {4175, 4176, 7, 0, 17.0f},
+  {4177, 4178, 3, 0, 8.966423f},
+  {4179, 4180, 1, 0, 4.63365f},
+  {4181, 4182, 10, 0, 0.69451755f},
+  {4183, 4184, 7, 0, 25.0f},
+  {4185, 4186, 5, 0, 4.07375f},
+  {4187, 4188, 3, 0, 3.6904523f},
+  {4189, 4190, 3, 0, 5.8848395f},
+  {4191, 4192, 9, 0, 1.0f},
+  {4193, 4194, 5, 0, 28.383476f},
+  {4195, 4196, 3, 0, 4.4160886f},
+  {4197, 4198, 7, 0, 0.0f},
+  {4199, 4200, 3, 0, 5.791435f},
+  {4201, 4202, 1, 0, 6.4145293f},
+  {4203, 4204, 7, 0, 0.0f},
+  {4205, 4206, 7, 0, 15.0f},
+  {4207, 4208, 5, 0, 6.6156325f},
+  {4209, 4210, 5, 0, 4.0964518f},
+  {4211, 4212, 7, 0, 17.0f},
+  {4213, 4214, 1, 0, 4.468344f},
+  {-1, -1, 0, 0, 0.011618567f},
+  {4215, 4216, 3, 0, 42.91487f},
+  {-1, -1, 0, 0, 0.01868043f},
+  {-1, -1, 0, 0, -0.017230289f},
+  {4217, 4218, 1, 0, 3.0952337f},
+  {4219, 4220, 7, 0, 20.0f},
+  {-1, -1, 0, 0, 0.07675286f},
+  {4221, 4222, 1, 0, 5.1072073f},
+  {4223, 4224, 3, 0, 6.417849f},
+  {4225, 4226, 8, 0, 1.0f},
+  {-1, -1, 0, 0, 0.10480267f},
+  {4227, 4228, 7, 0, 20.0f},
+  {-1, -1, 0, 0, 0.11027823f},
+  {4229, 4230, 1, 0, 5.970496f},
+  {4231, 4232, 1, 0, 3.7434688f},
+  {4233, 4234, 5, 0, 7.042338f},
+  {4235, 4236, 3, 0, 3.471103f},
+  {4237, 4238, 5, 0, 7.042338f},
+  {4239, 4240, 9, 0, 3.0f},
+  {4241, 4242, 3, 0, 6.576387f},
+  {-1, -1, 0, 0, -0.09821108f},
+  {-1, -1, 0, 0, -0.21635897f},
+  {-1, -1, 0, 0, -0.008603076f},
+  {-1, -1, 0, 0, 0.04468612f},
+  {-1, -1, 0, 0, -0.009794616f},
+  {-1, -1, 0, 0, -0.04674646f},
+  {-1, -1, 0, 0, 0.070737086f},
+  {-1, -1, 0, 0, -0.011943991f},
+  {-1, -1, 0, 0, 0.087640926f},
+  {-1, -1, 0, 0, 0.02991631f},
+  {-1, -1, 0, 0, -0.0012759686f},
+  {-1, -1, 0, 0, -0.017833997f},
+  {-1, -1, 0, 0, 0.004220584f},
+  {-1, -1, 0, 0, -0.011450461f},
+  {-1, -1, 0, 0, 0.08692688f},
+  {-1, -1, 0, 0, 0.0046190633f},
+  {-1, -1, 0, 0, 0.06979436f},
+  {-1, -1, 0, 0, 4.615784e-05f},
+  {-1, -1, 0, 0, 0.05510583f},
+  {-1, -1, 0, 0, -0.009611503f},
+  {-1, -1, 0, 0, -0.023697697f},
+  {-1, -1, 0, 0, 0.028587643f},
+  {-1, -1, 0, 0, 0.032484747f},
+  {-1, -1, 0, 0, -0.0012913826f},
+  {-1, -1, 0, 0, 0.09232744f},
+  {-1, -1, 0, 0, 0.019801809f},
+  {-1, -1, 0, 0, -0.0023080192f},
+  {-1, -1, 0, 0, -0.13715614f},
+  {-1, -1, 0, 0, 0.059169263f},
+  {-1, -1, 0, 0, -0.010259014f},
+  {-1, -1, 0, 0, -0.031244183f},
+  {-1, -1, 0, 0, 0.0069482806f},
+  {-1, -1, 0, 0, 0.041006643f},
+  {-1, -1, 0, 0, 0.0024780626f},
+  {-1, -1, 0, 0, -0.016597036f},
+  {-1, -1, 0, 0, 0.033691566f},
+  {-1, -1, 0, 0, 0.036252495f},
+  {-1, -1, 0, 0, -0.01839664f},
+  {-1, -1, 0, 0, 0.001122284f},
+  {-1, -1, 0, 0, 0.05813236f},
+  {-1, -1, 0, 0, -0.043328475f},
+  {-1, -1, 0, 0, -0.005463219f},
+  {-1, -1, 0, 0, 0.07063835f},
+  {-1, -1, 0, 0, 0.013370841f},
+  {-1, -1, 0, 0, 0.024694582f},
+  {-1, -1, 0, 0, -0.082957506f},
+  {-1, -1, 0, 0, 0.08346653f},
+  {-1, -1, 0, 0, -0.009419227f},
+  {-1, -1, 0, 0, 0.014550209f},
+  {-1, -1, 0, 0, -0.09014468f},
+  {-1, -1, 0, 0, 0.073039964f},
+  {-1, -1, 0, 0, 0.010555613f},
+  {4244, 4245, 4, 0, 1.0f},
+  {4246, 4247, 7, 0, 20.0f},
+  {4248, 4249, 3, 0, 5.2599554f},
+  {4250, 4251, 10, 0, 0.9030895f},
+  {4252, 4253, 5, 0, 4.2617974f},
+  {4254, 4255, 7, 0, 0.0f},
+  {4256, 4257, 7, 0, 28.0f},
+  {4258, 4259, 10, 0, 0.8538424f},
+  {4260, 4261, 0, 0, 1.0f},
+  {4262, 4263, 1, 0, 6.5448546f},
+  {4264, 4265, 5, 0, 5.165702f},
+  {4266, 4267, 3, 0, 5.1185427f},
+  {4268, 4269, 7, 0, 23.0f},
+  {4270, 4271, 3, 0, 8.780311f},
+  {4272, 4273, 3, 0, 5.9865937f},
+  {4274, 4275, 5, 0, 16.600807f},
+  {4276, 4277, 10, 0, 0.8561354f},
+  {4278, 4279, 10, 0, 0.9362309f},
+  {-1, -1, 0, 0, 0.08580201f},
+  {4280, 4281, 1, 0, 5.982256f},
+  {4282, 4283, 7, 0, 29.0f},
+  {4284, 4285, 1, 0, 3.0097222f},
+  {4286, 4287, 5, 0, 6.515449f},
+  {4288, 4289, 1, 0, 6.697984f},
+  {-1, -1, 0, 0, 0.16132908f},
+  {4290, 4291, 3, 0, 3.5048244f},
+  {4292, 4293, 3, 0, 3.6904523f},
+  {4294, 4295, 10, 0, 0.85929304f},
+  {4296, 4297, 3, 0, 8.966423f},
+  {-1, -1, 0, 0, -0.041632414f},
+  {4298, 4299, 5, 0, 3.8692317f},
+  {4300, 4301, 5, 0, 12.204893f},
+  {4302, 4303, 1, 0, 41.283264f},
+  {-1, -1, 0, 0, -0.14592215f},
+  {4304, 4305, 1, 0, 3.0952337f},
+  {4306, 4307, 1, 0, 7.1110544f},
+  {4308, 4309, 1, 0, 5.315942f},
+  {4310, 4311, 10, 0, 0.7314549f},
+  {-1, -1, 0, 0, 0.06670329f},
+  {-1, -1, 0, 0, -0.070320085f},
+  {4312, 4313, 1, 0, 6.748502f},
+  {-1, -1, 0, 0, 0.15340924f},
+  {-1, -1, 0, 0, 0.011004067f},
+  {4314, 4315, 10, 0, 0.8141858f},
+  {4316, 4317, 1, 0, 3.886703f},
+  {4318, 4319, 0, 0, 1.0f},
+  {4320, 4321, 1, 0, 8.885168f},
+  {4322, 4323, 10, 0, 0.6672107f},
+  {4324, 4325, 1, 0, 5.742777f},
+  {4326, 4327, 8, 0, 1.0f},
+  {4328, 4329, 7, 0, 27.0f},
+  {4330, 4331, 10, 0, 0.8561354f},
+  {4332, 4333, 5, 0, 3.59563f},
+  {4334, 4335, 5, 0, 6.694863f},
+  {4336, 4337, 1, 0, 3.9524088f},
+  {4338, 4339, 1, 0, 3.0097222f},
+  {4340, 4341, 0, 0, 0.33f},
+  {-1, -1, 0, 0, -0.0067458646f},
+  {-1, -1, 0, 0, -0.041965347f},
+  {-1, -1, 0, 0, 0.0017775273f},
+  {-1, -1, 0, 0, -0.032598842f},
+  {-1, -1, 0, 0, -0.06300121f},
+  {-1, -1, 0, 0, -0.018314637f},
+  {-1, -1, 0, 0, -0.004291052f},
+  {-1, -1, 0, 0, 0.023403363f},
+  {-1, -1, 0, 0, 0.016171342f},
+  {-1, -1, 0, 0, -0.034009095f},
+  {-1, -1, 0, 0, -0.044715285f},
+  {-1, -1, 0, 0, 0.020900372f},
+  {-1, -1, 0, 0, 0.00028247834f},
+  {-1, -1, 0, 0, -0.009114551f},
+  {-1, -1, 0, 0, -0.031943895f},
+  {-1, -1, 0, 0, 0.045647908f},
+  {-1, -1, 0, 0, 0.016280802f},
+  {-1, -1, 0, 0, 0.06827126f},
+  {-1, -1, 0, 0, 0.035622787f},
+  {-1, -1, 0, 0, 0.153857f},
+  {-1, -1, 0, 0, -0.021481879f},
+  {-1, -1, 0, 0, 0.04792482f},
+  {-1, -1, 0, 0, -0.039548922f},
+  {-1, -1, 0, 0, 0.055871624f},
+  {-1, -1, 0, 0, -0.020167239f},
+  {-1, -1, 0, 0, 0.01557565f},
+  {-1, -1, 0, 0, -0.05288033f},
+  {-1, -1, 0, 0, 0.0573102f},
+  {-1, -1, 0, 0, 0.08896547f},
+  {-1, -1, 0, 0, 0.024184546f},
+  {-1, -1, 0, 0, 0.0006199022f},
+  {-1, -1, 0, 0, 0.15279034f},
+  {-1, -1, 0, 0, -0.05884068f},
+  {-1, -1, 0, 0, 0.0013451356f},
+  {-1, -1, 0, 0, 0.101988114f},
+  {-1, -1, 0, 0, 0.0067841173f},
+  {-1, -1, 0, 0, -0.030793939f},
+  {-1, -1, 0, 0, 0.017448567f},
+  {-1, -1, 0, 0, -0.048614215f},
+  {-1, -1, 0, 0, 0.02729109f},
+  {-1, -1, 0, 0, -0.0118110655f},
+  {-1, -1, 0, 0, 0.07665574f},
+  {4343, 4344, 4, 0, 1.0f},
+  {4345, 4346, 7, 0, 20.0f},
+  {4347, 4348, 3, 0, 5.2599554f},
+  {4349, 4350, 8, 0, 1.0f},
+  {4351, 4352, 5, 0, 4.2617974f},
+  {4353, 4354, 7, 0, 0.0f},
+  {4355, 4356, 3, 0, 5.8848395f},
+  {4357, 4358, 3, 0, 39.509468f},
+  {4359, 4360, 10, 0, 0.64337784f},
+  {4361, 4362, 7, 0, 33.0f},
+  {4363, 4364, 5, 0, 5.165702f},
+  {4365, 4366, 3, 0, 5.1185427f},
+  {4367, 4368, 10, 0, 0.61589104f},
+  {4369, 4370, 1, 0, 3.166155f},
+  {4371, 4372, 9, 0, 3.0f},
+  {4373, 4374, 7, 0, 2.0f},
+  {4375, 4376, 3, 0, 40.47511f},
+  {4377, 4378, 10, 0, 0.6375711f},
+  {4379, 4380, 10, 0, 0.6455678f},
+  {4381, 4382, 9, 0, 3.0f},
+  {4383, 4384, 7, 0, 34.0f},
+  {4385, 4386, 1, 0, 3.0097222f},
+  {4387, 4388, 5, 0, 6.515449f},
+  {4389, 4390, 1, 0, 4.3037343f},
+  {-1, -1, 0, 0, 0.15326262f},
+  {4391, 4392, 3, 0, 3.1746154f},
+  {4393, 4394, 10, 0, 0.7743301f},
+  {4395, 4396, 0, 0, 1.0f},
+  {4397, 4398, 1, 0, 4.84522f},
+  {4399, 4400, 1, 0, 8.577419f},
+  {4401, 4402, 3, 0, 6.7532005f},
+  {4403, 4404, 1, 0, 3.8284404f},
+  {4405, 4406, 7, 0, 19.0f},
+  {4407, 4408, 2, 0, 1.0f},
+  {4409, 4410, 7, 0, 0.0f},
+  {4411, 4412, 10, 0, 0.6320151f},
+  {-1, -1, 0, 0, -0.08822384f},
+  {-1, -1, 0, 0, 0.19242784f},
+  {4413, 4414, 1, 0, 26.383698f},
+  {4415, 4416, 10, 0, 0.62730575f},
+  {4417, 4418, 7, 0, 22.0f},
+  {-1, -1, 0, 0, 0.0069117546f},
+  {-1, -1, 0, 0, 0.03845482f},
+  {-1, -1, 0, 0, 0.1419035f},
+  {-1, -1, 0, 0, 0.010453892f},
+  {4419, 4420, 10, 0, 0.8141858f},
+  {4421, 4422, 8, 0, 0.0f},
+  {4423, 4424, 9, 0, 2.0f},
+  {4425, 4426, 1, 0, 5.0574846f},
+  {-1, -1, 0, 0, -0.07973964f},
+  {4427, 4428, 1, 0, 6.2512836f},
+  {4429, 4430, 10, 0, 0.7320588f},
+  {4431, 4432, 10, 0, 0.8381581f},
+  {4433, 4434, 9, 0, 2.0f},
+  {-1, -1, 0, 0, -0.058146097f},
+  {4435, 4436, 1, 0, 4.1957583f},
+  {4437, 4438, 1, 0, 6.72941f},
+  {4439, 4440, 1, 0, 7.834018f},
+  {4441, 4442, 1, 0, 8.842302f},
+  {4443, 4444, 8, 0, 1.0f},
+  {4445, 4446, 1, 0, 4.027883f},
+  {-1, -1, 0, 0, -0.05712254f},
+  {-1, -1, 0, 0, -0.011326323f},
+  {-1, -1, 0, 0, -0.006956529f},
+  {-1, -1, 0, 0, -0.10252138f},
+  {-1, -1, 0, 0, 0.08464769f},
+  {-1, -1, 0, 0, 0.03084208f},
+  {-1, -1, 0, 0, 0.030927584f},
+  {-1, -1, 0, 0, -0.008985612f},
+  {-1, -1, 0, 0, -0.025016213f},
+  {-1, -1, 0, 0, 0.02126956f},
+  {-1, -1, 0, 0, -0.0009568763f},
+  {-1, -1, 0, 0, 0.051215746f},
+  {-1, -1, 0, 0, 0.051775616f},
+  {-1, -1, 0, 0, -0.009751549f},
+  {-1, -1, 0, 0, 0.009068298f},
+  {-1, -1, 0, 0, -0.04879534f},
+  {-1, -1, 0, 0, -0.029388351f},
+  {-1, -1, 0, 0, 0.04336548f},
+  {-1, -1, 0, 0, 0.11577149f},
+  {-1, -1, 0, 0, 0.038931496f},
+  {-1, -1, 0, 0, 0.010120273f},
+  {-1, -1, 0, 0, 0.122457735f},
+  {-1, -1, 0, 0, -0.07174816f},
+  {-1, -1, 0, 0, 0.028695157f},
+  {-1, -1, 0, 0, -0.021363778f},
+  {-1, -1, 0, 0, 0.04214417f},
+  {-1, -1, 0, 0, 0.020146249f},
+  {-1, -1, 0, 0, 0.09831384f},
+  {-1, -1, 0, 0, -0.023392461f},
+  {-1, -1, 0, 0, 0.025836835f},
+  {-1, -1, 0, 0, 0.071060725f},
+  {-1, -1, 0, 0, 0.018392278f},
+  {-1, -1, 0, 0, -0.018791562f},
+  {-1, -1, 0, 0, -0.090327226f},
+  {-1, -1, 0, 0, 0.0017730332f},
+  {-1, -1, 0, 0, -0.033341654f},
+  {-1, -1, 0, 0, 0.0034983014f},
+  {-1, -1, 0, 0, -0.04227079f},
+  {-1, -1, 0, 0, 0.0831591f},
+  {-1, -1, 0, 0, 0.013068578f},
+  {-1, -1, 0, 0, 0.11594267f},
+  {-1, -1, 0, 0, -0.00038639706f},
+  {-1, -1, 0, 0, -0.015516624f},
+  {-1, -1, 0, 0, 0.028823217f},
+  {4448, 4449, 7, 0, 16.0f},
+  {4450, 4451, 7, 0, 0.0f},
+  {4452, 4453, 10, 0, 0.9338815f},
+  {4454, 4455, 1, 0, 11.328481f},
+  {4456, 4457, 7, 0, 1.0f},
+  {4458, 4459, 10, 0, 0.91605806f},
+  {4460, 4461, 5, 0, 4.410779f},
+  {4462, 4463, 0, 0, 0.33f},
+  {4464, 4465, 10, 0, 0.82660705f},
+  {4466, 4467, 1, 0, 3.0097222f},
+  {4468, 4469, 9, 0, 2.0f},
+  {4470, 4471, 1, 0, 8.533123f},
+  {4472, 4473, 10, 0, 0.9294512f},
+  {4474, 4475, 9, 0, 3.0f},
+  {4476, 4477, 10, 0, 0.9348987f},
+  {4478, 4479, 10, 0, 0.67481405f},
+  {4480, 4481, 1, 0, 5.184029f},
+  {4482, 4483, 3, 0, 12.934116f},
+  {4484, 4485, 1, 0, 19.314367f},
+  {4486, 4487, 5, 0, 12.751901f},
+  {4488, 4489, 5, 0, 27.219303f},
+  {4490, 4491, 7, 0, 4.0f},
+  {4492, 4493, 1, 0, 5.3783803f},
+  {4494, 4495, 1, 0, 8.1919365f},
+  {4496, 4497, 8, 0, 0.0f},
+  {-1, -1, 0, 0, -0.051925577f},
+  {4498, 4499, 5, 0, 3.0662608f},
+  {4500, 4501, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 0.024010135f},
+  {4502, 4503, 0, 0, 1.0f},
+  {4504, 4505, 1, 0, 7.5773983f},
+  {4506, 4507, 3, 0, 3.5048244f},
+  {4508, 4509, 10, 0, 0.718495f},
+  {4510, 4511, 8, 0, 0.0f},
+  {4512, 4513, 3, 0, 36.098396f},
+  {4514, 4515, 1, 0, 21.343382f},
+  {4516, 4517, 1, 0, 38.15698f},
+  {4518, 4519, 1, 0, 14.203641f},
+  {4520, 4521, 1, 0, 35.515816f},
+  {-1, -1, 0, 0, -0.13685367f},
+  {4522, 4523, 3, 0, 3.025743f},
+  {4524, 4525, 5, 0, 21.461452f},
+  {4526, 4527, 10, 0, 0.88222176f},
+  {4528, 4529, 8, 0, 1.0f},
+  {4530, 4531, 3, 0, 3.025743f},
+  {4532, 4533, 10, 0, 0.72457737f},
+  {4534, 4535, 1, 0, 8.273704f},
+  {4536, 4537, 7, 0, 20.0f},
+  {4538, 4539, 6, 0, 1.0f},
+  {4540, 4541, 3, 0, 5.6337295f},
+  {4542, 4543, 1, 0, 9.662527f},
+  {-1, -1, 0, 0, -0.014544296f},
+  {4544, 4545, 3, 0, 5.0814815f},
+  {-1, -1, 0, 0, -0.0037054063f},
+  {-1, -1, 0, 0, -0.030059243f},
+  {-1, -1, 0, 0, 0.061548617f},
+  {-1, -1, 0, 0, -0.029859066f},
+  {4546, 4547, 9, 0, 2.0f},
+  {-1, -1, 0, 0, 0.010632515f},
+  {-1, -1, 0, 0, 0.0042639733f},
+  {-1, -1, 0, 0, -0.062262416f},
+  {-1, -1, 0, 0, 0.19391818f},
+  {-1, -1, 0, 0, 0.047785312f},
+  {-1, -1, 0, 0, -0.11878299f},
+  {-1, -1, 0, 0, 0.0029186425f},
+  {-1, -1, 0, 0, 0.02632376f},
+  {-1, -1, 0, 0, -0.060594477f},
+  {-1, -1, 0, 0, 0.1961509f},
+  {-1, -1, 0, 0, 0.008774708f},
+  {-1, -1, 0, 0, -0.048095178f},
+  {-1, -1, 0, 0, 0.049049016f},
+  {-1, -1, 0, 0, -0.074130975f},
+  {-1, -1, 0, 0, -0.17601131f},
+  {-1, -1, 0, 0, -0.036320057f},
+  {-1, -1, 0, 0, 0.045328896f},
+  {-1, -1, 0, 0, -0.007001417f},
+  {-1, -1, 0, 0, -0.03049623f},
+  {-1, -1, 0, 0, -0.021171272f},
+  {-1, -1, 0, 0, 0.021133503f},
+  {-1, -1, 0, 0, -0.051031884f},
+  {-1, -1, 0, 0, -0.015620529f},
+  {-1, -1, 0, 0, -0.009603335f},
+  {-1, -1, 0, 0, -0.04946857f},
+  {-1, -1, 0, 0, -0.010208825f},
+  {-1, -1, 0, 0, 0.00013667125f},
+  {-1, -1, 0, 0, 0.041324507f},
+  {-1, -1, 0, 0, -0.03254175f},
+  {-1, -1, 0, 0, -0.078163825f},
+  {-1, -1, 0, 0, 0.029840985f},
+  {-1, -1, 0, 0, 0.00084145827f},
+  {-1, -1, 0, 0, 0.01777607f},
+  {-1, -1, 0, 0, 0.019731289f},
+  {-1, -1, 0, 0, -0.0625048f},
+  {-1, -1, 0, 0, 0.01839072f},
+  {-1, -1, 0, 0, -0.06596244f},
+  {-1, -1, 0, 0, 0.05442458f},
+  {-1, -1, 0, 0, -0.011198648f},
+  {-1, -1, 0, 0, 0.0037952424f},
+  {-1, -1, 0, 0, -0.0059645656f},
+  {-1, -1, 0, 0, 0.020535469f},
+  {-1, -1, 0, 0, 0.08494451f},
+  {4549, 4550, 7, 0, 16.0f},
+  {4551, 4552, 7, 0, 0.0f},
+  {4553, 4554, 10, 0, 0.9338815f},
+  {4555, 4556, 3, 0, 39.509468f},
+  {4557, 4558, 7, 0, 1.0f},
+  {4559, 4560, 10, 0, 0.91605806f},
+  {4561, 4562, 5, 0, 4.410779f},
+  {4563, 4564, 3, 0, 37.69973f},
+  {4565, 4566, 1, 0, 3.0097222f},
+  {4567, 4568, 1, 0, 3.0097222f},
+  {4569, 4570, 9, 0, 2.0f},
+  {4571, 4572, 1, 0, 8.533123f},
+  {4573, 4574, 10, 0, 0.9294512f},
+  {4575, 4576, 9, 0, 3.0f},
+  {4577, 4578, 0, 0, 1.0f},
+  {4579, 4580, 1, 0, 3.8284404f},
+  {4581, 4582, 1, 0, 27.268505f},
+  {4583, 4584, 2, 0, 0.0f},
+  {4585, 4586, 8, 0, 0.0f},
+  {4587, 4588, 5, 0, 12.751901f},
+  {4589, 4590, 5, 0, 27.219303f},
+  {4591, 4592, 7, 0, 11.0f},
+  {4593, 4594, 10, 0, 0.8583438f},
+  {4595, 4596, 1, 0, 8.1919365f},
+  {4597, 4598, 5, 0, 3.7302792f},
+  {4599, 4600, 3, 0, 7.694672f},
+  {4601, 4602, 5, 0, 3.0662608f},
+  {4603, 4604, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 0.022209406f},
+  {4605, 4606, 1, 0, 7.5773983f},
+  {4607, 4608, 10, 0, 0.9348987f},
+  {4609, 4610, 8, 0, 0.0f},
+  {4611, 4612, 1, 0, 41.283264f},
+  {4613, 4614, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.03980961f},
+  {-1, -1, 0, 0, 0.14477353f},
+  {-1, -1, 0, 0, 0.034656383f},
+  {-1, -1, 0, 0, 0.08821149f},
+  {4615, 4616, 5, 0, 3.0662608f},
+  {-1, -1, 0, 0, -0.12658964f},
+  {4617, 4618, 3, 0, 3.025743f},
+  {4619, 4620, 5, 0, 21.461452f},
+  {4621, 4622, 5, 0, 43.30592f},
+  {4623, 4624, 10, 0, 0.91605806f},
+  {4625, 4626, 10, 0, 0.9362309f},
+  {4627, 4628, 1, 0, 4.63365f},
+  {4629, 4630, 1, 0, 8.273704f},
+  {4631, 4632, 7, 0, 20.0f},
+  {4633, 4634, 5, 0, 3.0662608f},
+  {4635, 4636, 10, 0, 0.87471986f},
+  {4637, 4638, 1, 0, 9.145805f},
+  {-1, -1, 0, 0, -0.050608512f},
+  {-1, -1, 0, 0, -0.0143363f},
+  {-1, -1, 0, 0, -0.013817119f},
+  {4639, 4640, 3, 0, 5.0814815f},
+  {-1, -1, 0, 0, -0.0035201074f},
+  {-1, -1, 0, 0, -0.028556252f},
+  {4641, 4642, 3, 0, 7.437969f},
+  {-1, -1, 0, 0, 0.010100937f},
+  {-1, -1, 0, 0, -0.028366089f},
+  {-1, -1, 0, 0, 0.05108533f},
+  {-1, -1, 0, 0, -0.09854074f},
+  {-1, -1, 0, 0, -0.00077422126f},
+  {-1, -1, 0, 0, 0.015409323f},
+  {-1, -1, 0, 0, -0.06505481f},
+  {-1, -1, 0, 0, -0.14261419f},
+  {-1, -1, 0, 0, -0.033358812f},
+  {-1, -1, 0, 0, -0.08746458f},
+  {-1, -1, 0, 0, -0.0088880425f},
+  {-1, -1, 0, 0, -0.0066513466f},
+  {-1, -1, 0, 0, -0.028209014f},
+  {-1, -1, 0, 0, -0.019150378f},
+  {-1, -1, 0, 0, 0.01954849f},
+  {-1, -1, 0, 0, -0.039620154f},
+  {-1, -1, 0, 0, 0.0118161235f},
+  {-1, -1, 0, 0, -0.007097943f},
+  {-1, -1, 0, 0, 0.008809212f},
+  {-1, -1, 0, 0, 0.004464066f},
+  {-1, -1, 0, 0, -0.037207738f},
+  {-1, -1, 0, 0, 0.03992338f},
+  {-1, -1, 0, 0, -0.024790436f},
+  {-1, -1, 0, 0, -0.09836327f},
+  {-1, -1, 0, 0, -0.0022675754f},
+  {-1, -1, 0, 0, 0.0007583338f},
+  {-1, -1, 0, 0, 0.01601004f},
+  {-1, -1, 0, 0, 0.02260871f},
+  {-1, -1, 0, 0, -0.053442385f},
+  {-1, -1, 0, 0, 0.06743452f},
+  {-1, -1, 0, 0, 0.010434023f},
+  {-1, -1, 0, 0, 0.048769467f},
+  {-1, -1, 0, 0, -0.0087574115f},
+  {-1, -1, 0, 0, 0.003542201f},
+  {-1, -1, 0, 0, -0.0056663514f},
+  {-1, -1, 0, 0, 0.09124928f},
+  {-1, -1, 0, 0, 0.019508695f},
+  {4644, 4645, 5, 0, 10.198943f},
+  {4646, 4647, 1, 0, 18.662224f},
+  {4648, 4649, 5, 0, 13.62889f},
+  {4650, 4651, 1, 0, 18.48521f},
+  {4652, 4653, 7, 0, 1.0f},
+  {4654, 4655, 5, 0, 12.629174f},
+  {4656, 4657, 10, 0, 0.81645775f},
+  {4658, 4659, 7, 0, 28.0f},
+  {-1, -1, 0, 0, 0.107704334f},
+  {4660, 4661, 1, 0, 38.15698f},
+  {4662, 4663, 3, 0, 14.556309f},
+  {4664, 4665, 1, 0, 3.0097222f},
+  {4666, 4667, 7, 0, 8.0f},
+  {4668, 4669, 10, 0, 0.70130366f},
+  {4670, 4671, 10, 0, 0.8232559f},
+  {4672, 4673, 7, 0, 1.0f},
+  {4674, 4675, 9, 0, 3.0f},
+  {4676, 4677, 7, 0, 0.0f},
+  {4678, 4679, 7, 0, 0.0f},
+  {4680, 4681, 10, 0, 0.6030454f},
+  {4682, 4683, 1, 0, 42.25138f},
+  {4684, 4685, 10, 0, 0.83192253f},
+  {4686, 4687, 8, 0, 1.0f},
+  {4688, 4689, 8, 0, 1.0f},
+  {4690, 4691, 1, 0, 8.533123f},
+  {4692, 4693, 10, 0, 0.69451755f},
+  {4694, 4695, 5, 0, 35.795372f},
+  {4696, 4697, 1, 0, 3.0097222f},
+  {4698, 4699, 10, 0, 0.92011446f},
+  {4700, 4701, 2, 0, 0.0f},
+  {4702, 4703, 7, 0, 13.0f},
+  {4704, 4705, 3, 0, 8.127335f},
+  {4706, 4707, 10, 0, 0.65742403f},
+  {4708, 4709, 3, 0, 41.45132f},
+  {-1, -1, 0, 0, -0.04340377f},
+  {-1, -1, 0, 0, 0.08533867f},
+  {4710, 4711, 1, 0, 43.68602f},
+  {4712, 4713, 1, 0, 42.674526f},
+  {4714, 4715, 4, 0, 1.0f},
+  {4716, 4717, 7, 0, 7.0f},
+  {4718, 4719, 8, 0, 0.0f},
+  {4720, 4721, 10, 0, 0.6030454f},
+  {-1, -1, 0, 0, 0.022017075f},
+  {4722, 4723, 1, 0, 15.106018f},
+  {4724, 4725, 5, 0, 12.030727f},
+  {4726, 4727, 3, 0, 23.86014f},
+  {4728, 4729, 1, 0, 13.113845f},
+  {-1, -1, 0, 0, 0.030035147f},
+  {-1, -1, 0, 0, -0.013391733f},
+  {4730, 4731, 5, 0, 16.600807f},
+  {4732, 4733, 1, 0, 3.0097222f},
+  {4734, 4735, 7, 0, 0.0f},
+  {4736, 4737, 1, 0, 39.8811f},
+  {-1, -1, 0, 0, -0.14465976f},
+  {4738, 4739, 1, 0, 28.756657f},
+  {4740, 4741, 5, 0, 43.96941f},
+  {4742, 4743, 1, 0, 21.909319f},
+  {-1, -1, 0, 0, 0.03851524f},
+  {-1, -1, 0, 0, 0.009187712f},
+  {-1, -1, 0, 0, -0.0076420926f},
+  {-1, -1, 0, 0, 0.0063233413f},
+  {-1, -1, 0, 0, 0.07760944f},
+  {-1, -1, 0, 0, -0.000699234f},
+  {-1, -1, 0, 0, -0.0029929413f},
+  {-1, -1, 0, 0, 0.027039647f},
+  {-1, -1, 0, 0, -0.13682537f},
+  {-1, -1, 0, 0, -0.032962274f},
+  {-1, -1, 0, 0, -0.029980375f},
+  {-1, -1, 0, 0, 0.0011973918f},
+  {-1, -1, 0, 0, 0.009944606f},
+  {-1, -1, 0, 0, -0.0081047295f},
+  {-1, -1, 0, 0, -0.041054107f},
+  {-1, -1, 0, 0, -0.00714221f},
+  {-1, -1, 0, 0, 0.02140015f},
+  {-1, -1, 0, 0, 0.077527486f},
+  {-1, -1, 0, 0, 0.025593162f},
+  {-1, -1, 0, 0, -0.034020666f},
+  {-1, -1, 0, 0, -0.013645447f},
+  {-1, -1, 0, 0, -0.06520539f},
+  {-1, -1, 0, 0, -0.018794015f},
+  {-1, -1, 0, 0, 0.032638382f},
+  {-1, -1, 0, 0, 0.0045496463f},
+  {-1, -1, 0, 0, -0.0647998f},
+  {-1, -1, 0, 0, -0.072146654f},
+  {-1, -1, 0, 0, -0.17831665f},
+  {-1, -1, 0, 0, -0.018115569f},
+  {-1, -1, 0, 0, 0.017625501f},
+  {-1, -1, 0, 0, -0.040206537f},
+  {-1, -1, 0, 0, -0.00359862f},
+  {-1, -1, 0, 0, -0.16224335f},
+  {-1, -1, 0, 0, -0.029342676f},
+  {-1, -1, 0, 0, 0.118713155f},
+  {-1, -1, 0, 0, 0.016088894f},
+  {-1, -1, 0, 0, -0.00032493653f},
+  {-1, -1, 0, 0, -0.044388685f},
+  {-1, -1, 0, 0, -0.051199015f},
+  {-1, -1, 0, 0, 0.02317897f},
+  {-1, -1, 0, 0, -0.025259165f},
+  {-1, -1, 0, 0, 0.009577285f},
+  {-1, -1, 0, 0, 0.022900065f},
+  {-1, -1, 0, 0, -0.0132929f},
+  {4745, 4746, 4, 0, 1.0f},
+  {4747, 4748, 7, 0, 20.0f},
+  {4749, 4750, 3, 0, 5.2599554f},
+  {4751, 4752, 10, 0, 0.9030895f},
+  {4753, 4754, 5, 0, 4.2617974f},
+  {4755, 4756, 7, 0, 0.0f},
+  {4757, 4758, 3, 0, 8.780311f},
+  {4759, 4760, 10, 0, 0.847138f},
+  {4761, 4762, 0, 0, 1.0f},
+  {4763, 4764, 7, 0, 31.0f},
+  {4765, 4766, 5, 0, 5.165702f},
+  {4767, 4768, 3, 0, 5.1185427f},
+  {4769, 4770, 3, 0, 3.413912f},
+  {4771, 4772, 10, 0, 0.86107147f},
+  {4773, 4774, 3, 0, 9.227634f},
+  {4775, 4776, 5, 0, 48.616074f},
+  {4777, 4778, 5, 0, 43.96941f},
+  {4779, 4780, 10, 0, 0.9413066f},
+  {-1, -1, 0, 0, 0.077096626f},
+  {4781, 4782, 9, 0, 3.0f},
+  {4783, 4784, 7, 0, 34.0f},
+  {4785, 4786, 1, 0, 3.0097222f},
+  {4787, 4788, 5, 0, 5.5836062f},
+  {4789, 4790, 1, 0, 6.697984f},
+  {-1, -1, 0, 0, 0.14305344f},
+  {4791, 4792, 10, 0, 0.6672107f},
+  {4793, 4794, 3, 0, 3.6904523f},
+  {4795, 4796, 10, 0, 0.8561354f},
+  {4797, 4798, 10, 0, 0.8739182f},
+  {4799, 4800, 1, 0, 6.9549685f},
+  {4801, 4802, 1, 0, 3.9524088f},
+  {4803, 4804, 5, 0, 16.600807f},
+  {4805, 4806, 10, 0, 0.6139097f},
+  {4807, 4808, 5, 0, 35.795372f},
+  {4809, 4810, 1, 0, 18.662224f},
+  {4811, 4812, 9, 0, 2.0f},
+  {4813, 4814, 3, 0, 34.650505f},
+  {4815, 4816, 10, 0, 0.60579807f},
+  {4817, 4818, 7, 0, 22.0f},
+  {4819, 4820, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.03142166f},
+  {-1, -1, 0, 0, 0.12825255f},
+  {-1, -1, 0, 0, 0.0062957765f},
+  {-1, -1, 0, 0, -0.050267793f},
+  {4821, 4822, 10, 0, 0.8928462f},
+  {4823, 4824, 0, 0, 1.0f},
+  {4825, 4826, 1, 0, 8.885168f},
+  {4827, 4828, 7, 0, 26.0f},
+  {4829, 4830, 10, 0, 0.8565808f},
+  {4831, 4832, 9, 0, 3.0f},
+  {4833, 4834, 7, 0, 23.0f},
+  {4835, 4836, 3, 0, 5.4294014f},
+  {4837, 4838, 1, 0, 3.3297658f},
+  {4839, 4840, 3, 0, 7.1573887f},
+  {4841, 4842, 7, 0, 17.0f},
+  {4843, 4844, 1, 0, 6.197865f},
+  {4845, 4846, 5, 0, 3.0662608f},
+  {4847, 4848, 3, 0, 9.5558405f},
+  {4849, 4850, 5, 0, 8.028728f},
+  {-1, -1, 0, 0, -0.008610252f},
+  {-1, -1, 0, 0, 0.0017523895f},
+  {-1, -1, 0, 0, 0.009317922f},
+  {-1, -1, 0, 0, -0.06613514f},
+  {-1, -1, 0, 0, -0.022023264f},
+  {-1, -1, 0, 0, -0.092516035f},
+  {-1, -1, 0, 0, 0.04707725f},
+  {-1, -1, 0, 0, -0.031146064f},
+  {-1, -1, 0, 0, 0.0055826707f},
+  {-1, -1, 0, 0, 0.043754898f},
+  {-1, -1, 0, 0, -0.03346109f},
+  {-1, -1, 0, 0, 0.030436302f},
+  {-1, -1, 0, 0, 0.060305502f},
+  {-1, -1, 0, 0, -0.0065312707f},
+  {-1, -1, 0, 0, 0.005987835f},
+  {-1, -1, 0, 0, -0.053081688f},
+  {-1, -1, 0, 0, 0.005026436f},
+  {-1, -1, 0, 0, 0.0011684418f},
+  {-1, -1, 0, 0, 0.03968871f},
+  {-1, -1, 0, 0, -0.011695671f},
+  {-1, -1, 0, 0, 0.025693068f},
+  {-1, -1, 0, 0, 0.13250013f},
+  {-1, -1, 0, 0, -0.026731564f},
+  {-1, -1, 0, 0, 0.03888505f},
+  {-1, -1, 0, 0, -0.042257827f},
+  {-1, -1, 0, 0, 0.032241758f},
+  {-1, -1, 0, 0, 0.06704728f},
+  {-1, -1, 0, 0, -0.03176117f},
+  {-1, -1, 0, 0, 0.0049870494f},
+  {-1, -1, 0, 0, -0.08136517f},
+  {-1, -1, 0, 0, -0.005021933f},
+  {-1, -1, 0, 0, 0.038828712f},
+  {-1, -1, 0, 0, -0.049053885f},
+  {-1, -1, 0, 0, 0.0029656782f},
+  {-1, -1, 0, 0, 0.13885143f},
+  {-1, -1, 0, 0, -0.0048825582f},
+  {-1, -1, 0, 0, -0.0044890675f},
+  {-1, -1, 0, 0, -0.113644235f},
+  {-1, -1, 0, 0, -0.023977777f},
+  {-1, -1, 0, 0, 0.01845466f},
+  {-1, -1, 0, 0, 0.04654788f},
+  {-1, -1, 0, 0, 0.14141165f},
+  {-1, -1, 0, 0, 0.039614078f},
+  {-1, -1, 0, 0, -0.03196655f},
+  {-1, -1, 0, 0, -0.106187776f},
+  {-1, -1, 0, 0, -0.0030661148f},
+  {-1, -1, 0, 0, 0.02863278f},
+  {-1, -1, 0, 0, -0.041770704f},
+  {4852, 4853, 5, 0, 10.198943f},
+  {4854, 4855, 1, 0, 18.662224f},
+  {4856, 4857, 5, 0, 13.62889f},
+  {4858, 4859, 1, 0, 18.48521f},
+  {4860, 4861, 7, 0, 1.0f},
+  {4862, 4863, 5, 0, 12.629174f},
+  {4864, 4865, 10, 0, 0.81645775f},
+  {4866, 4867, 10, 0, 0.7280631f},
+  {-1, -1, 0, 0, 0.10274962f},
+  {4868, 4869, 1, 0, 38.15698f},
+  {4870, 4871, 3, 0, 14.556309f},
+  {4872, 4873, 1, 0, 3.0097222f},
+  {4874, 4875, 7, 0, 8.0f},
+  {4876, 4877, 10, 0, 0.70130366f},
+  {4878, 4879, 10, 0, 0.8232559f},
+  {4880, 4881, 10, 0, 0.6984106f},
+  {4882, 4883, 10, 0, 0.7314549f},
+  {4884, 4885, 7, 0, 0.0f},
+  {4886, 4887, 7, 0, 0.0f},
+  {4888, 4889, 5, 0, 3.0662608f},
+  {4890, 4891, 1, 0, 42.25138f},
+  {4892, 4893, 10, 0, 0.83192253f},
+  {4894, 4895, 8, 0, 1.0f},
+  {4896, 4897, 8, 0, 1.0f},
+  {4898, 4899, 1, 0, 8.533123f},
+  {4900, 4901, 10, 0, 0.69451755f},
+  {4902, 4903, 5, 0, 35.795372f},
+  {4904, 4905, 1, 0, 3.0097222f},
+  {4906, 4907, 10, 0, 0.92011446f},
+  {4908, 4909, 8, 0, 0.0f},
+  {4910, 4911, 1, 0, 3.0097222f},
+  {4912, 4913, 7, 0, 0.0f},
+  {4914, 4915, 5, 0, 6.6156325f},
+  {4916, 4917, 3, 0, 15.336419f},
+  {-1, -1, 0, 0, -0.039502718f},
+  {-1, -1, 0, 0, 0.07958404f},
+  {4918, 4919, 1, 0, 43.68602f},
+  {4920, 4921, 10, 0, 0.6030454f},
+  {-1, -1, 0, 0, 0.009877897f},
+  {4922, 4923, 7, 0, 7.0f},
+  {4924, 4925, 8, 0, 0.0f},
+  {4926, 4927, 4, 0, 1.0f},
+  {-1, -1, 0, 0, 0.020637084f},
+  {4928, 4929, 1, 0, 15.106018f},
+  {4930, 4931, 5, 0, 12.030727f},
+  {4932, 4933, 3, 0, 23.86014f},
+  {4934, 4935, 1, 0, 13.113845f},
+  {-1, -1, 0, 0, 0.02860686f},
+  {-1, -1, 0, 0, -0.012291622f},
+  {4936, 4937, 1, 0, 15.640303f},
+  {4938, 4939, 1, 0, 3.0097222f},
+  {4940, 4941, 7, 0, 0.0f},
+  {4942, 4943, 1, 0, 39.8811f},
+  {-1, -1, 0, 0, -0.1351326f},
+  {4944, 4945, 1, 0, 28.756657f},
+  {4946, 4947, 7, 0, 2.0f},
+  {4948, 4949, 3, 0, 33.626774f},
+  {-1, -1, 0, 0, -0.02356577f},
+  {-1, -1, 0, 0, 0.00793667f},
+  {-1, -1, 0, 0, 0.0788576f},
+  {-1, -1, 0, 0, 0.020855842f},
+  {-1, -1, 0, 0, 0.055980157f},
+  {-1, -1, 0, 0, -0.094354615f},
+  {-1, -1, 0, 0, -0.000991859f},
+  {-1, -1, 0, 0, 0.016424602f},
+  {-1, -1, 0, 0, -0.029393649f},
+  {-1, -1, 0, 0, -0.12543896f},
+  {-1, -1, 0, 0, -0.027380193f},
+  {-1, -1, 0, 0, 0.0016915819f},
+  {-1, -1, 0, 0, -0.0072689774f},
+  {-1, -1, 0, 0, -0.03498679f},
+  {-1, -1, 0, 0, 0.020311274f},
+  {-1, -1, 0, 0, 0.072003864f},
+  {-1, -1, 0, 0, 0.024460964f},
+  {-1, -1, 0, 0, -0.030053897f},
+  {-1, -1, 0, 0, -0.06280928f},
+  {-1, -1, 0, 0, -0.020689996f},
+  {-1, -1, 0, 0, -0.01644766f},
+  {-1, -1, 0, 0, 0.030949647f},
+  {-1, -1, 0, 0, 0.004715395f},
+  {-1, -1, 0, 0, -0.058926977f},
+  {-1, -1, 0, 0, -0.0661094f},
+  {-1, -1, 0, 0, -0.16429712f},
+  {-1, -1, 0, 0, -0.016108632f},
+  {-1, -1, 0, 0, 0.01717474f},
+  {-1, -1, 0, 0, 0.0026009819f},
+  {-1, -1, 0, 0, -0.017813515f},
+  {-1, -1, 0, 0, -0.1542188f},
+  {-1, -1, 0, 0, -0.026917184f},
+  {-1, -1, 0, 0, 0.10749542f},
+  {-1, -1, 0, 0, 0.014620905f},
+  {-1, -1, 0, 0, -0.0001874176f},
+  {-1, -1, 0, 0, -0.040551413f},
+  {-1, -1, 0, 0, -0.04522163f},
+  {-1, -1, 0, 0, 0.022450536f},
+  {-1, -1, 0, 0, -0.030291572f},
+  {-1, -1, 0, 0, -0.0053070495f},
+  {-1, -1, 0, 0, -0.00043921522f},
+  {-1, -1, 0, 0, 0.03491957f},
+  {4951, 4952, 5, 0, 10.198943f},
+  {4953, 4954, 7, 0, 21.0f},
+  {4955, 4956, 5, 0, 13.62889f},
+  {4957, 4958, 3, 0, 3.025743f},
+  {4959, 4960, 5, 0, 8.217814f},
+  {4961, 4962, 5, 0, 12.629174f},
+  {4963, 4964, 10, 0, 0.81645775f},
+  {4965, 4966, 8, 0, 1.0f},
+  {4967, 4968, 3, 0, 3.413912f},
+  {4969, 4970, 5, 0, 7.1836843f},
+  {4971, 4972, 7, 0, 25.0f},
+  {4973, 4974, 1, 0, 3.0097222f},
+  {4975, 4976, 7, 0, 8.0f},
+  {4977, 4978, 10, 0, 0.70130366f},
+  {4979, 4980, 10, 0, 0.8232559f},
+  {4981, 4982, 5, 0, 5.042116f},
+  {4983, 4984, 1, 0, 3.0097222f},
+  {4985, 4986, 5, 0, 5.63685f},
+  {4987, 4988, 7, 0, 19.0f},
+  {4989, 4990, 5, 0, 6.8829618f},
+  {4991, 4992, 1, 0, 3.0097222f},
+  {4993, 4994, 3, 0, 8.619322f},
+  {-1, -1, 0, 0, 0.08340618f},
+  {4995, 4996, 10, 0, 0.83192253f},
+  {4997, 4998, 8, 0, 1.0f},
+  {4999, 5000, 8, 0, 1.0f},
+  {5001, 5002, 1, 0, 8.533123f},
+  {5003, 5004, 10, 0, 0.69451755f},
+  {5005, 5006, 5, 0, 35.795372f},
+  {5007, 5008, 7, 0, 0.0f},
+  {5009, 5010, 10, 0, 0.92011446f},
+  {5011, 5012, 7, 0, 18.0f},
+  {5013, 5014, 5, 0, 5.234737f},
+  {5015, 5016, 10, 0, 0.8617883f},
+  {5017, 5018, 1, 0, 8.584065f},
+  {5019, 5020, 10, 0, 0.68654907f},
+  {5021, 5022, 7, 0, 20.0f},
+  {5023, 5024, 7, 0, 17.0f},
+  {5025, 5026, 5, 0, 6.0687356f},
+  {5027, 5028, 5, 0, 6.1160326f},
+  {5029, 5030, 10, 0, 0.8334282f},
+  {5031, 5032, 8, 0, 1.0f},
+  {5033, 5034, 5, 0, 7.6044974f},
+  {5035, 5036, 0, 0, 0.33f},
+  {-1, -1, 0, 0, -0.018007373f},
+  {5037, 5038, 10, 0, 0.6030454f},
+  {-1, -1, 0, 0, 0.019605232f},
+  {5039, 5040, 1, 0, 15.106018f},
+  {5041, 5042, 1, 0, 18.108318f},
+  {5043, 5044, 3, 0, 23.86014f},
+  {5045, 5046, 1, 0, 13.113845f},
+  {-1, -1, 0, 0, 0.026699767f},
+  {-1, -1, 0, 0, -0.011677027f},
+  {5047, 5048, 5, 0, 15.899349f},
+  {5049, 5050, 1, 0, 3.0097222f},
+  {5051, 5052, 7, 0, 0.0f},
+  {5053, 5054, 1, 0, 39.8811f},
+  {-1, -1, 0, 0, -0.12895809f},
+  {5055, 5056, 1, 0, 28.756657f},
+  {5057, 5058, 7, 0, 2.0f},
+  {5059, 5060, 1, 0, 21.909319f},
+  {-1, -1, 0, 0, -0.0062003876f},
+  {-1, -1, 0, 0, 0.059690524f},
+  {-1, -1, 0, 0, -0.1460278f},
+  {-1, -1, 0, 0, -0.02388465f},
+  {-1, -1, 0, 0, 0.030637478f},
+  {-1, -1, 0, 0, -0.090904f},
+  {-1, -1, 0, 0, 0.04735151f},
+  {-1, -1, 0, 0, -0.019262083f},
+  {-1, -1, 0, 0, -0.045074057f},
+  {-1, -1, 0, 0, 0.038768735f},
+  {-1, -1, 0, 0, 0.10722484f},
+  {-1, -1, 0, 0, -0.01804552f},
+  {-1, -1, 0, 0, 0.0018059731f},
+  {-1, -1, 0, 0, 0.02994875f},
+  {-1, -1, 0, 0, -0.03405343f},
+  {-1, -1, 0, 0, 0.02233228f},
+  {-1, -1, 0, 0, 0.012311059f},
+  {-1, -1, 0, 0, -0.016937483f},
+  {-1, -1, 0, 0, 0.093740694f},
+  {-1, -1, 0, 0, 0.024602795f},
+  {-1, -1, 0, 0, -0.017438348f},
+  {-1, -1, 0, 0, 0.077349596f},
+  {-1, -1, 0, 0, 0.0014194489f},
+  {-1, -1, 0, 0, -0.04046852f},
+  {-1, -1, 0, 0, 0.00026397707f},
+  {-1, -1, 0, 0, 0.02147421f},
+  {-1, -1, 0, 0, -0.009392202f},
+  {-1, -1, 0, 0, -0.054942656f},
+  {-1, -1, 0, 0, -0.014952414f},
+  {-1, -1, 0, 0, 0.02819857f},
+  {-1, -1, 0, 0, -0.0060262857f},
+  {-1, -1, 0, 0, -0.08517621f},
+  {-1, -1, 0, 0, -0.061151203f},
+  {-1, -1, 0, 0, -0.15197484f},
+  {-1, -1, 0, 0, -0.015303207f},
+  {-1, -1, 0, 0, 0.016316002f},
+  {-1, -1, 0, 0, -0.041684795f},
+  {-1, -1, 0, 0, -0.003276956f},
+  {-1, -1, 0, 0, -0.14650786f},
+  {-1, -1, 0, 0, -0.024524538f},
+  {-1, -1, 0, 0, 0.097513705f},
+  {-1, -1, 0, 0, 0.013184029f},
+  {-1, -1, 0, 0, -0.00016900987f},
+  {-1, -1, 0, 0, -0.036901794f},
+  {-1, -1, 0, 0, -0.040035997f},
+  {-1, -1, 0, 0, 0.021328008f},
+  {-1, -1, 0, 0, -0.027342131f},
+  {-1, -1, 0, 0, -0.00478581f},
+  {-1, -1, 0, 0, 0.019372735f},
+  {-1, -1, 0, 0, -0.0124850515f},
+  {5062, 5063, 7, 0, 16.0f},
+  {5064, 5065, 0, 0, 1.0f},
+  {5066, 5067, 10, 0, 0.9338815f},
+  {5068, 5069, 9, 0, 3.0f},
+  {5070, 5071, 5, 0, 7.042338f},
+  {5072, 5073, 10, 0, 0.91605806f},
+  {5074, 5075, 5, 0, 4.410779f},
+  {5076, 5077, 10, 0, 0.86295253f},
+  {5078, 5079, 5, 0, 5.738449f},
+  {5080, 5081, 5, 0, 6.374478f},
+  {5082, 5083, 1, 0, 4.1625104f},
+  {5084, 5085, 1, 0, 8.533123f},
+  {5086, 5087, 10, 0, 0.9294512f},
+  {5088, 5089, 9, 0, 3.0f},
+  {5090, 5091, 0, 0, 1.0f},
+  {5092, 5093, 10, 0, 0.8565808f},
+  {5094, 5095, 3, 0, 7.257188f},
+  {5096, 5097, 1, 0, 4.9454913f},
+  {-1, -1, 0, 0, 0.106508695f},
+  {5098, 5099, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.1158001f},
+  {-1, -1, 0, 0, 0.018988896f},
+  {-1, -1, 0, 0, -0.091753915f},
+  {5100, 5101, 1, 0, 6.9701552f},
+  {5102, 5103, 5, 0, 3.7302792f},
+  {5104, 5105, 3, 0, 7.694672f},
+  {5106, 5107, 1, 0, 3.886703f},
+  {5108, 5109, 0, 0, 1.0f},
+  {5110, 5111, 7, 0, 22.0f},
+  {5112, 5113, 1, 0, 7.5773983f},
+  {5114, 5115, 10, 0, 0.9348987f},
+  {5116, 5117, 10, 0, 0.8538424f},
+  {5118, 5119, 1, 0, 3.8621292f},
+  {5120, 5121, 5, 0, 31.987387f},
+  {5122, 5123, 10, 0, 0.905279f},
+  {-1, -1, 0, 0, 0.002258873f},
+  {-1, -1, 0, 0, -0.017262746f},
+  {-1, -1, 0, 0, 0.13825655f},
+  {5124, 5125, 10, 0, 0.9100054f},
+  {5126, 5127, 1, 0, 6.697984f},
+  {5128, 5129, 10, 0, 0.6115686f},
+  {5130, 5131, 10, 0, 0.8782648f},
+  {5132, 5133, 1, 0, 8.842302f},
+  {-1, -1, 0, 0, -0.048464235f},
+  {-1, -1, 0, 0, -0.013106155f},
+  {-1, -1, 0, 0, 0.00025081635f},
+  {5134, 5135, 0, 0, 0.33f},
+  {-1, -1, 0, 0, -0.0043051722f},
+  {-1, -1, 0, 0, -0.029442215f},
+  {-1, -1, 0, 0, 0.005122471f},
+  {-1, -1, 0, 0, 0.018969027f},
+  {5136, 5137, 3, 0, 7.437969f},
+  {-1, -1, 0, 0, 0.007212162f},
+  {-1, -1, 0, 0, -0.03021555f},
+  {-1, -1, 0, 0, 0.043913364f},
+  {-1, -1, 0, 0, -0.001964403f},
+  {-1, -1, 0, 0, -0.061285246f},
+  {-1, -1, 0, 0, 0.132385f},
+  {-1, -1, 0, 0, 0.01091112f},
+  {-1, -1, 0, 0, -0.03166466f},
+  {-1, -1, 0, 0, 0.019723786f},
+  {-1, -1, 0, 0, -0.015351431f},
+  {-1, -1, 0, 0, 0.01241808f},
+  {-1, -1, 0, 0, -0.0039613843f},
+  {-1, -1, 0, 0, 0.06720243f},
+  {-1, -1, 0, 0, 0.0061300783f},
+  {-1, -1, 0, 0, 0.04395579f},
+  {-1, -1, 0, 0, 0.038801257f},
+  {-1, -1, 0, 0, -0.019275194f},
+  {-1, -1, 0, 0, 0.055066127f},
+  {-1, -1, 0, 0, -0.0032457353f},
+  {-1, -1, 0, 0, 0.060793307f},
+  {-1, -1, 0, 0, -0.0044103125f},
+  {-1, -1, 0, 0, -0.016352337f},
+  {-1, -1, 0, 0, -0.000551033f},
+  {-1, -1, 0, 0, 0.079556085f},
+  {-1, -1, 0, 0, 0.018504476f},
+  {5139, 5140, 5, 0, 10.198943f},
+  {5141, 5142, 1, 0, 18.662224f},
+  {5143, 5144, 5, 0, 13.62889f},
+  {5145, 5146, 1, 0, 18.48521f},
+  {5147, 5148, 7, 0, 2.0f},
+  {5149, 5150, 7, 0, 1.0f},
+  {5151, 5152, 10, 0, 0.6204305f},
+  {5153, 5154, 7, 0, 34.0f},
+  {-1, -1, 0, 0, 0.09762006f},
+  {5155, 5156, 1, 0, 38.15698f},
+  {5157, 5158, 3, 0, 14.556309f},
+  {5159, 5160, 3, 0, 21.078184f},
+  {5161, 5162, 7, 0, 6.0f},
+  {5163, 5164, 7, 0, 0.0f},
+  {5165, 5166, 10, 0, 0.81645775f},
+  {5167, 5168, 7, 0, 1.0f},
+  {5169, 5170, 1, 0, 5.184029f},
+  {5171, 5172, 7, 0, 0.0f},
+  {5173, 5174, 7, 0, 0.0f},
+  {5175, 5176, 5, 0, 3.0662608f},
+  {5177, 5178, 1, 0, 45.07999f},
+  {5179, 5180, 3, 0, 15.631362f},
+  {5181, 5182, 3, 0, 32.131393f},
+  {5183, 5184, 1, 0, 13.113845f},
+  {5185, 5186, 10, 0, 0.6714846f},
+  {5187, 5188, 2, 0, 1.0f},
+  {5189, 5190, 1, 0, 4.777555f},
+  {5191, 5192, 7, 0, 0.0f},
+  {5193, 5194, 10, 0, 0.8232559f},
+  {5195, 5196, 0, 0, 0.33f},
+  {5197, 5198, 5, 0, 8.143963f},
+  {5199, 5200, 5, 0, 7.042338f},
+  {5201, 5202, 1, 0, 8.214931f},
+  {5203, 5204, 3, 0, 41.45132f},
+  {5205, 5206, 1, 0, 31.168713f},
+  {-1, -1, 0, 0, 0.07362714f},
+  {5207, 5208, 10, 0, 0.75866807f},
+  {5209, 5210, 10, 0, 0.6030454f},
+  {-1, -1, 0, 0, 0.009792256f},
+  {5211, 5212, 7, 0, 7.0f},
+  {-1, -1, 0, 0, -0.02281257f},
+  {-1, -1, 0, 0, -0.048545275f},
+  {-1, -1, 0, 0, 0.041482188f},
+  {5213, 5214, 3, 0, 25.255108f},
+  {5215, 5216, 1, 0, 15.106018f},
+  {-1, -1, 0, 0, -0.015063231f},
+  {5217, 5218, 0, 0, 0.33f},
+  {5219, 5220, 4, 0, 1.0f},
+  {5221, 5222, 5, 0, 12.629174f},
+  {5223, 5224, 1, 0, 21.909319f},
+  {5225, 5226, 4, 0, 1.0f},
+  {5227, 5228, 5, 0, 16.100279f},
+  {5229, 5230, 7, 0, 3.0f},
+  {5231, 5232, 1, 0, 41.093555f},
+  {5233, 5234, 7, 0, 4.0f},
+  {5235, 5236, 1, 0, 3.0097222f},
+  {5237, 5238, 10, 0, 0.92011446f},
+  {-1, -1, 0, 0, 0.039980482f},
+  {-1, -1, 0, 0, 0.007304971f},
+  {-1, -1, 0, 0, -0.0002810233f},
+  {-1, -1, 0, 0, 0.01810184f},
+  {-1, -1, 0, 0, 0.050617736f},
+  {-1, -1, 0, 0, 0.0040298463f},
+  {-1, -1, 0, 0, -0.0049503013f},
+  {-1, -1, 0, 0, 0.028677864f},
+  {-1, -1, 0, 0, -0.115840055f},
+  {-1, -1, 0, 0, -0.026032543f},
+  {-1, -1, 0, 0, -0.04045911f},
+  {-1, -1, 0, 0, 0.01977086f},
+  {-1, -1, 0, 0, 0.0021347606f},
+  {-1, -1, 0, 0, -0.032703504f},
+  {-1, -1, 0, 0, -0.0068975925f},
+  {-1, -1, 0, 0, -0.030015891f},
+  {-1, -1, 0, 0, 0.023844466f},
+  {-1, -1, 0, 0, 0.06625592f},
+  {-1, -1, 0, 0, -0.036971714f},
+  {-1, -1, 0, 0, -0.15571408f},
+  {-1, -1, 0, 0, -0.04220095f},
+  {-1, -1, 0, 0, 0.015598423f},
+  {-1, -1, 0, 0, -0.018227208f},
+  {-1, -1, 0, 0, 0.03184339f},
+  {-1, -1, 0, 0, 0.021344392f},
+  {-1, -1, 0, 0, -0.026063776f},
+  {-1, -1, 0, 0, -0.016950332f},
+  {-1, -1, 0, 0, -0.056227576f},
+  {-1, -1, 0, 0, -0.117267154f},
+  {-1, -1, 0, 0, 0.041209947f},
+  {-1, -1, 0, 0, 0.0678686f},
+  {-1, -1, 0, 0, -0.020869447f},
+  {-1, -1, 0, 0, -0.020950545f},
+  {-1, -1, 0, 0, 0.021753041f},
+  {-1, -1, 0, 0, 0.00034942746f},
+  {-1, -1, 0, 0, -0.023916502f},
+  {-1, -1, 0, 0, 0.042115275f},
+  {-1, -1, 0, 0, -0.13252066f},
+  {-1, -1, 0, 0, -0.020477654f},
+  {-1, -1, 0, 0, 0.00860482f},
+  {-1, -1, 0, 0, -0.12035965f},
+  {-1, -1, 0, 0, -0.02544382f},
+  {-1, -1, 0, 0, -0.011910731f},
+  {-1, -1, 0, 0, 0.008158998f},
+  {5240, 5241, 7, 0, 21.0f},
+  {5242, 5243, 10, 0, 0.6030454f},
+  {5244, 5245, 5, 0, 3.2776327f},
+  {5246, 5247, 5, 0, 39.780422f},
+  {5248, 5249, 10, 0, 0.7280631f},
+  {5250, 5251, 10, 0, 0.63544995f},
+  {5252, 5253, 5, 0, 5.2813516f},
+  {5254, 5255, 3, 0, 42.277008f},
+  {5256, 5257, 9, 0, 1.0f},
+  {5258, 5259, 10, 0, 0.70130366f},
+  {5260, 5261, 1, 0, 5.527408f},
+  {5262, 5263, 3, 0, 5.7329454f},
+  {5264, 5265, 3, 0, 5.0814815f},
+  {5266, 5267, 8, 0, 1.0f},
+  {5268, 5269, 5, 0, 5.7151575f},
+  {5270, 5271, 2, 0, 0.0f},
+  {5272, 5273, 1, 0, 15.361816f},
+  {5274, 5275, 1, 0, 19.982603f},
+  {5276, 5277, 0, 0, 0.67f},
+  {5278, 5279, 7, 0, 19.0f},
+  {5280, 5281, 1, 0, 3.0097222f},
+  {5282, 5283, 1, 0, 4.777555f},
+  {5284, 5285, 1, 0, 6.2872834f},
+  {5286, 5287, 3, 0, 4.3074203f},
+  {5288, 5289, 1, 0, 5.6561294f},
+  {5290, 5291, 3, 0, 3.571177f},
+  {5292, 5293, 10, 0, 0.68442553f},
+  {5294, 5295, 5, 0, 4.201236f},
+  {5296, 5297, 3, 0, 8.557891f},
+  {5298, 5299, 3, 0, 6.641508f},
+  {5300, 5301, 10, 0, 0.7924982f},
+  {5302, 5303, 7, 0, 1.0f},
+  {5304, 5305, 7, 0, 19.0f},
+  {5306, 5307, 3, 0, 43.67558f},
+  {-1, -1, 0, 0, -0.02498962f},
+  {-1, -1, 0, 0, 0.06962872f},
+  {5308, 5309, 1, 0, 22.5281f},
+  {-1, -1, 0, 0, -0.021454317f},
+  {-1, -1, 0, 0, -0.0009634018f},
+  {5310, 5311, 10, 0, 0.69761395f},
+  {5312, 5313, 1, 0, 3.305006f},
+  {5314, 5315, 7, 0, 0.0f},
+  {5316, 5317, 5, 0, 35.618786f},
+  {5318, 5319, 5, 0, 5.165702f},
+  {5320, 5321, 10, 0, 0.8840814f},
+  {5322, 5323, 3, 0, 36.098396f},
+  {5324, 5325, 10, 0, 0.73666394f},
+  {-1, -1, 0, 0, 0.06725874f},
+  {5326, 5327, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.09759782f},
+  {5328, 5329, 3, 0, 7.280536f},
+  {5330, 5331, 1, 0, 8.214931f},
+  {5332, 5333, 3, 0, 3.8254256f},
+  {5334, 5335, 1, 0, 5.1072073f},
+  {5336, 5337, 0, 0, 0.33f},
+  {5338, 5339, 5, 0, 3.7302792f},
+  {5340, 5341, 1, 0, 3.4270499f},
+  {5342, 5343, 7, 0, 25.0f},
+  {5344, 5345, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, -0.059091665f},
+  {5346, 5347, 1, 0, 6.9175615f},
+  {5348, 5349, 10, 0, 0.7717356f},
+  {5350, 5351, 10, 0, 0.8105315f},
+  {-1, -1, 0, 0, -0.1217613f},
+  {-1, -1, 0, 0, -0.010646011f},
+  {-1, -1, 0, 0, -0.00940305f},
+  {-1, -1, 0, 0, -0.06513618f},
+  {-1, -1, 0, 0, 0.06842261f},
+  {-1, -1, 0, 0, 0.024159184f},
+  {-1, -1, 0, 0, -0.008590579f},
+  {-1, -1, 0, 0, 0.030178746f},
+  {-1, -1, 0, 0, -0.0030469256f},
+  {-1, -1, 0, 0, -0.039289333f},
+  {-1, -1, 0, 0, -0.028584441f},
+  {-1, -1, 0, 0, 0.069531955f},
+  {-1, -1, 0, 0, 0.1355865f},
+  {-1, -1, 0, 0, 0.04423094f},
+  {-1, -1, 0, 0, 0.028559996f},
+  {-1, -1, 0, 0, -0.015169965f},
+  {-1, -1, 0, 0, -0.019728405f},
+  {-1, -1, 0, 0, 0.0024053522f},
+  {-1, -1, 0, 0, -0.054184735f},
+  {-1, -1, 0, 0, 0.0018660546f},
+  {-1, -1, 0, 0, 0.03606604f},
+  {-1, -1, 0, 0, -0.059127282f},
+  {-1, -1, 0, 0, -0.033961046f},
+  {-1, -1, 0, 0, -0.001824981f},
+  {-1, -1, 0, 0, -0.06457358f},
+  {-1, -1, 0, 0, -0.012439919f},
+  {-1, -1, 0, 0, 0.001968956f},
+  {-1, -1, 0, 0, 0.029167175f},
+  {-1, -1, 0, 0, -0.04175391f},
+  {-1, -1, 0, 0, 0.029608855f},
+  {-1, -1, 0, 0, 0.113045506f},
+  {-1, -1, 0, 0, -0.0002374649f},
+  {-1, -1, 0, 0, -0.02836733f},
+  {-1, -1, 0, 0, 0.035888102f},
+  {-1, -1, 0, 0, -0.008475431f},
+  {-1, -1, 0, 0, -0.051723387f},
+  {-1, -1, 0, 0, 0.025937272f},
+  {-1, -1, 0, 0, -0.016867202f},
+  {-1, -1, 0, 0, 0.097830154f},
+  {-1, -1, 0, 0, 0.02413454f},
+  {-1, -1, 0, 0, 0.034821354f},
+  {-1, -1, 0, 0, -0.0056253434f},
+  {-1, -1, 0, 0, -0.061332893f},
+  {-1, -1, 0, 0, -0.015013027f},
+  {-1, -1, 0, 0, 0.0010205269f},
+  {-1, -1, 0, 0, -0.025611369f},
+  {-1, -1, 0, 0, 0.008115f},
+  {-1, -1, 0, 0, -0.06604157f},
+  {-1, -1, 0, 0, 0.10060187f},
+  {-1, -1, 0, 0, 0.017287826f},
+  {5353, 5354, 0, 0, 1.0f},
+  {5355, 5356, 10, 0, 0.6030454f},
+  {5357, 5358, 10, 0, 0.60579807f},
+  {5359, 5360, 5, 0, 39.780422f},
+  {5361, 5362, 10, 0, 0.6094279f},
+  {5363, 5364, 5, 0, 3.7302792f},
+  {5365, 5366, 10, 0, 0.62730575f},
+  {5367, 5368, 3, 0, 42.277008f},
+  {5369, 5370, 9, 0, 1.0f},
+  {5371, 5372, 5, 0, 8.217814f},
+  {5373, 5374, 7, 0, 28.0f},
+  {5375, 5376, 7, 0, 24.0f},
+  {5377, 5378, 5, 0, 4.07375f},
+  {5379, 5380, 1, 0, 4.3037343f},
+  {5381, 5382, 1, 0, 7.600024f},
+  {5383, 5384, 5, 0, 7.070297f},
+  {5385, 5386, 1, 0, 15.361816f},
+  {5387, 5388, 1, 0, 19.982603f},
+  {5389, 5390, 0, 0, 0.67f},
+  {5391, 5392, 3, 0, 16.209831f},
+  {5393, 5394, 1, 0, 12.552255f},
+  {5395, 5396, 8, 0, 1.0f},
+  {5397, 5398, 1, 0, 4.63365f},
+  {-1, -1, 0, 0, 0.09996376f},
+  {5399, 5400, 1, 0, 5.970496f},
+  {5401, 5402, 1, 0, 6.4487634f},
+  {5403, 5404, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, -0.06709995f},
+  {5405, 5406, 1, 0, 6.2512836f},
+  {5407, 5408, 1, 0, 5.8820796f},
+  {5409, 5410, 10, 0, 0.72917897f},
+  {5411, 5412, 5, 0, 6.795224f},
+  {5413, 5414, 5, 0, 7.4071736f},
+  {5415, 5416, 3, 0, 43.67558f},
+  {-1, -1, 0, 0, -0.023115398f},
+  {-1, -1, 0, 0, 0.06405842f},
+  {5417, 5418, 1, 0, 22.5281f},
+  {-1, -1, 0, 0, -0.020024044f},
+  {-1, -1, 0, 0, -0.00091524125f},
+  {-1, -1, 0, 0, 0.08327995f},
+  {-1, -1, 0, 0, 0.01794076f},
+  {-1, -1, 0, 0, -0.03296725f},
+  {-1, -1, 0, 0, -0.0051852823f},
+  {5419, 5420, 3, 0, 3.025743f},
+  {5421, 5422, 3, 0, 7.0555444f},
+  {-1, -1, 0, 0, -0.0134214405f},
+  {-1, -1, 0, 0, 0.059047163f},
+  {5423, 5424, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.035376072f},
+  {-1, -1, 0, 0, -0.033888053f},
+  {-1, -1, 0, 0, -0.001804924f},
+  {-1, -1, 0, 0, 0.05316315f},
+  {5425, 5426, 3, 0, 3.1746154f},
+  {-1, -1, 0, 0, -0.010438061f},
+  {-1, -1, 0, 0, 0.00555439f},
+  {5427, 5428, 10, 0, 0.64695257f},
+  {5429, 5430, 5, 0, 5.8729773f},
+  {5431, 5432, 10, 0, 0.7211154f},
+  {5433, 5434, 7, 0, 24.0f},
+  {-1, -1, 0, 0, -0.010288884f},
+  {-1, -1, 0, 0, 0.028552977f},
+  {-1, -1, 0, 0, -0.13119368f},
+  {-1, -1, 0, 0, -0.026023805f},
+  {-1, -1, 0, 0, 0.06386112f},
+  {-1, -1, 0, 0, 0.022145912f},
+  {-1, -1, 0, 0, -0.008161045f},
+  {-1, -1, 0, 0, 0.028166829f},
+  {-1, -1, 0, 0, -0.011188771f},
+  {-1, -1, 0, 0, -0.00013482649f},
+  {-1, -1, 0, 0, 0.018988894f},
+  {-1, -1, 0, 0, -0.0036252257f},
+  {-1, -1, 0, 0, 0.0021733285f},
+  {-1, -1, 0, 0, -0.006061077f},
+  {-1, -1, 0, 0, -0.0426939f},
+  {-1, -1, 0, 0, 0.021034146f},
+  {-1, -1, 0, 0, 0.08040962f},
+  {-1, -1, 0, 0, -0.0012664765f},
+  {-1, -1, 0, 0, 0.005334825f},
+  {-1, -1, 0, 0, 0.06563597f},
+  {-1, -1, 0, 0, -0.01068667f},
+  {-1, -1, 0, 0, -0.1124972f},
+  {-1, -1, 0, 0, 0.037756287f},
+  {-1, -1, 0, 0, -0.015566594f},
+  {5436, 5437, 5, 0, 10.198943f},
+  {5438, 5439, 7, 0, 28.0f},
+  {5440, 5441, 5, 0, 13.62889f},
+  {5442, 5443, 2, 0, 0.0f},
+  {5444, 5445, 9, 0, 3.0f},
+  {5446, 5447, 7, 0, 1.0f},
+  {5448, 5449, 10, 0, 0.81645775f},
+  {5450, 5451, 5, 0, 7.282547f},
+  {5452, 5453, 8, 0, 1.0f},
+  {5454, 5455, 3, 0, 8.127335f},
+  {5456, 5457, 3, 0, 5.9865937f},
+  {5458, 5459, 3, 0, 21.078184f},
+  {5460, 5461, 7, 0, 6.0f},
+  {5462, 5463, 10, 0, 0.70130366f},
+  {5464, 5465, 10, 0, 0.8232559f},
+  {5466, 5467, 8, 0, 1.0f},
+  {5468, 5469, 3, 0, 5.9865937f},
+  {5470, 5471, 3, 0, 3.1390157f},
+  {5472, 5473, 1, 0, 3.7838314f},
+  {5474, 5475, 5, 0, 7.042338f},
+  {-1, -1, 0, 0, -0.0036465644f},
+  {5476, 5477, 3, 0, 5.203249f},
+  {5478, 5479, 3, 0, 6.721325f},
+  {5480, 5481, 3, 0, 15.631362f},
+  {5482, 5483, 3, 0, 32.131393f},
+  {5484, 5485, 1, 0, 13.113845f},
+  {5486, 5487, 10, 0, 0.6714846f},
+  {5488, 5489, 10, 0, 0.69451755f},
+  {5490, 5491, 5, 0, 35.795372f},
+  {5492, 5493, 7, 0, 0.0f},
+  {5494, 5495, 7, 0, 8.0f},
+  {5496, 5497, 10, 0, 0.8430468f},
+  {5498, 5499, 10, 0, 0.82660705f},
+  {5500, 5501, 9, 0, 2.0f},
+  {5502, 5503, 5, 0, 8.28008f},
+  {5504, 5505, 5, 0, 5.042116f},
+  {5506, 5507, 3, 0, 4.8399205f},
+  {5508, 5509, 1, 0, 3.6501784f},
+  {5510, 5511, 1, 0, 7.557411f},
+  {-1, -1, 0, 0, 0.07572355f},
+  {-1, -1, 0, 0, 0.0034858703f},
+  {5512, 5513, 10, 0, 0.65128046f},
+  {-1, -1, 0, 0, -0.04430744f},
+  {5514, 5515, 0, 0, 0.33f},
+  {5516, 5517, 2, 0, 0.0f},
+  {-1, -1, 0, 0, -0.045319263f},
+  {5518, 5519, 1, 0, 12.221915f},
+  {5520, 5521, 3, 0, 25.255108f},
+  {5522, 5523, 1, 0, 15.106018f},
+  {-1, -1, 0, 0, -0.012655004f},
+  {5524, 5525, 0, 0, 0.33f},
+  {5526, 5527, 1, 0, 7.200274f},
+  {5528, 5529, 10, 0, 0.7865555f},
+  {5530, 5531, 1, 0, 15.640303f},
+  {5532, 5533, 1, 0, 3.0097222f},
+  {5534, 5535, 7, 0, 0.0f},
+  {5536, 5537, 10, 0, 0.7978636f},
+  {-1, -1, 0, 0, -0.11501169f},
+  {5538, 5539, 1, 0, 28.756657f},
+  {5540, 5541, 10, 0, 0.91206235f},
+  {5542, 5543, 4, 0, 1.0f},
+  {-1, -1, 0, 0, -0.00022731077f},
+  {-1, -1, 0, 0, 0.03161584f},
+  {-1, -1, 0, 0, 0.0034086928f},
+  {-1, -1, 0, 0, -0.077796064f},
+  {-1, -1, 0, 0, -0.0049401284f},
+  {-1, -1, 0, 0, 0.07335263f},
+  {-1, -1, 0, 0, 0.0019269672f},
+  {-1, -1, 0, 0, 0.044705376f},
+  {-1, -1, 0, 0, -0.0043983557f},
+  {-1, -1, 0, 0, -0.03662811f},
+  {-1, -1, 0, 0, 0.025057131f},
+  {-1, -1, 0, 0, -0.0045932415f},
+  {-1, -1, 0, 0, -0.01773966f},
+  {-1, -1, 0, 0, -0.093497895f},
+  {-1, -1, 0, 0, 0.037226282f},
+  {-1, -1, 0, 0, -0.00095783314f},
+  {-1, -1, 0, 0, -0.017645963f},
+  {-1, -1, 0, 0, 0.016159128f},
+  {-1, -1, 0, 0, 0.015399265f},
+  {-1, -1, 0, 0, 0.075537205f},
+  {-1, -1, 0, 0, -0.032893818f},
+  {-1, -1, 0, 0, 0.0219908f},
+  {-1, -1, 0, 0, 0.011954317f},
+  {-1, -1, 0, 0, 0.044503372f},
+  {-1, -1, 0, 0, -0.035236653f},
+  {-1, -1, 0, 0, -0.14012508f},
+  {-1, -1, 0, 0, -0.039397914f},
+  {-1, -1, 0, 0, 0.015152109f},
+  {-1, -1, 0, 0, -0.01666516f},
+  {-1, -1, 0, 0, 0.03033571f},
+  {-1, -1, 0, 0, -0.017209213f},
+  {-1, -1, 0, 0, 0.024383001f},
+  {-1, -1, 0, 0, -0.035632182f},
+  {-1, -1, 0, 0, -0.00486722f},
+  {-1, -1, 0, 0, 0.0038238082f},
+  {-1, -1, 0, 0, -0.013616589f},
+  {-1, -1, 0, 0, -0.1392188f},
+  {-1, -1, 0, 0, -0.019481651f},
+  {-1, -1, 0, 0, 0.08411487f},
+  {-1, -1, 0, 0, 0.011699875f},
+  {-1, -1, 0, 0, -0.009408463f},
+  {-1, -1, 0, 0, 0.032876324f},
+  {-1, -1, 0, 0, -0.032314215f},
+  {-1, -1, 0, 0, 0.021730011f},
+  {-1, -1, 0, 0, -0.019431075f},
+  {-1, -1, 0, 0, 0.0060554957f},
+  {-1, -1, 0, 0, 0.020477336f},
+  {-1, -1, 0, 0, -0.020583019f},
+  {5545, 5546, 0, 0, 1.0f},
+  {5547, 5548, 10, 0, 0.6030454f},
+  {5549, 5550, 10, 0, 0.60579807f},
+  {5551, 5552, 5, 0, 39.780422f},
+  {5553, 5554, 10, 0, 0.7280631f},
+  {5555, 5556, 5, 0, 3.7302792f},
+  {5557, 5558, 3, 0, 5.203249f},
+  {5559, 5560, 3, 0, 42.277008f},
+  {5561, 5562, 9, 0, 1.0f},
+  {5563, 5564, 10, 0, 0.70130366f},
+  {5565, 5566, 10, 0, 0.7314549f},
+  {5567, 5568, 7, 0, 24.0f},
+  {5569, 5570, 5, 0, 4.289015f},
+  {5571, 5572, 8, 0, 0.0f},
+  {5573, 5574, 1, 0, 4.324107f},
+  {5575, 5576, 2, 0, 0.0f},
+  {5577, 5578, 1, 0, 15.361816f},
+  {5579, 5580, 1, 0, 19.982603f},
+  {5581, 5582, 0, 0, 0.67f},
+  {5583, 5584, 7, 0, 19.0f},
+  {5585, 5586, 1, 0, 37.049507f},
+  {5587, 5588, 7, 0, 5.0f},
+  {5589, 5590, 3, 0, 29.96273f},
+  {-1, -1, 0, 0, 0.09346015f},
+  {5591, 5592, 1, 0, 5.970496f},
+  {5593, 5594, 1, 0, 3.7434688f},
+  {5595, 5596, 5, 0, 7.042338f},
+  {5597, 5598, 1, 0, 3.0097222f},
+  {5599, 5600, 1, 0, 4.9454913f},
+  {5601, 5602, 5, 0, 7.9532037f},
+  {5603, 5604, 10, 0, 0.86295253f},
+  {5605, 5606, 7, 0, 1.0f},
+  {5607, 5608, 1, 0, 5.315942f},
+  {5609, 5610, 3, 0, 43.67558f},
+  {-1, -1, 0, 0, -0.020586083f},
+  {-1, -1, 0, 0, 0.05897666f},
+  {5611, 5612, 1, 0, 22.5281f},
+  {-1, -1, 0, 0, -0.01836269f},
+  {-1, -1, 0, 0, -0.0010606766f},
+  {5613, 5614, 10, 0, 0.6455678f},
+  {5615, 5616, 1, 0, 8.687594f},
+  {5617, 5618, 2, 0, 1.0f},
+  {5619, 5620, 3, 0, 3.025743f},
+  {5621, 5622, 5, 0, 16.600807f},
+  {-1, -1, 0, 0, -0.08218625f},
+  {5623, 5624, 10, 0, 0.74845964f},
+  {5625, 5626, 1, 0, 28.0855f},
+  {5627, 5628, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.029349376f},
+  {-1, -1, 0, 0, -0.03612814f},
+  {5629, 5630, 3, 0, 8.355187f},
+  {-1, -1, 0, 0, 0.06271782f},
+  {5631, 5632, 5, 0, 7.5563846f},
+  {-1, -1, 0, 0, 0.010138226f},
+  {-1, -1, 0, 0, 0.108204976f},
+  {5633, 5634, 8, 0, 1.0f},
+  {5635, 5636, 10, 0, 0.88521177f},
+  {5637, 5638, 7, 0, 27.0f},
+  {5639, 5640, 1, 0, 3.0097222f},
+  {5641, 5642, 1, 0, 7.600024f},
+  {5643, 5644, 7, 0, 27.0f},
+  {-1, -1, 0, 0, -0.10756011f},
+  {-1, -1, 0, 0, -0.007903325f},
+  {-1, -1, 0, 0, 0.014491685f},
+  {-1, -1, 0, 0, -0.01788325f},
+  {-1, -1, 0, 0, 0.05826664f},
+  {-1, -1, 0, 0, 0.020402603f},
+  {-1, -1, 0, 0, -0.007072163f},
+  {-1, -1, 0, 0, 0.027196813f},
+  {-1, -1, 0, 0, 0.0049693882f},
+  {-1, -1, 0, 0, -0.011311088f},
+  {-1, -1, 0, 0, 0.014448878f},
+  {-1, -1, 0, 0, 0.10255102f},
+  {-1, -1, 0, 0, 0.05064697f},
+  {-1, -1, 0, 0, 0.016946105f},
+  {-1, -1, 0, 0, -0.09927538f},
+  {-1, -1, 0, 0, 0.010769266f},
+  {-1, -1, 0, 0, 0.046291042f},
+  {-1, -1, 0, 0, -0.020549683f},
+  {-1, -1, 0, 0, 0.023698514f},
+  {-1, -1, 0, 0, -0.0013246087f},
+  {-1, -1, 0, 0, -0.019017057f},
+  {-1, -1, 0, 0, 0.017036138f},
+  {-1, -1, 0, 0, 0.0029470443f},
+  {-1, -1, 0, 0, -0.0055283546f},
+  {-1, -1, 0, 0, -0.000430727f},
+  {-1, -1, 0, 0, -0.013667583f},
+  {-1, -1, 0, 0, -0.02504201f},
+  {-1, -1, 0, 0, 0.03163266f},
+  {-1, -1, 0, 0, 0.058697283f},
+  {-1, -1, 0, 0, -0.021491775f},
+  {-1, -1, 0, 0, -0.022309177f},
+  {-1, -1, 0, 0, 0.057149507f},
+  {-1, -1, 0, 0, -0.052806348f},
+  {-1, -1, 0, 0, -0.00021228791f},
+  {-1, -1, 0, 0, 0.089057826f},
+  {-1, -1, 0, 0, 0.017846871f},
+  {-1, -1, 0, 0, 0.05140848f},
+  {-1, -1, 0, 0, -0.0028784145f},
+  {-1, -1, 0, 0, -0.037407305f},
+  {-1, -1, 0, 0, 0.02016964f},
+  {5646, 5647, 5, 0, 10.198943f},
+  {5648, 5649, 1, 0, 18.662224f},
+  {5650, 5651, 5, 0, 13.62889f},
+  {5652, 5653, 1, 0, 18.48521f},
+  {5654, 5655, 7, 0, 1.0f},
+  {5656, 5657, 5, 0, 12.629174f},
+  {5658, 5659, 5, 0, 24.183792f},
+  {5660, 5661, 7, 0, 1.0f},
+  {-1, -1, 0, 0, 0.09313295f},
+  {5662, 5663, 1, 0, 38.15698f},
+  {5664, 5665, 3, 0, 14.556309f},
+  {5666, 5667, 1, 0, 3.0097222f},
+  {5668, 5669, 7, 0, 8.0f},
+  {5670, 5671, 10, 0, 0.6306323f},
+  {5672, 5673, 5, 0, 29.886265f},
+  {5674, 5675, 0, 0, 0.33f},
+  {5676, 5677, 7, 0, 12.0f},
+  {5678, 5679, 3, 0, 41.45132f},
+  {5680, 5681, 7, 0, 0.0f},
+  {5682, 5683, 10, 0, 0.6030454f},
+  {5684, 5685, 1, 0, 45.07999f},
+  {5686, 5687, 10, 0, 0.83192253f},
+  {5688, 5689, 7, 0, 12.0f},
+  {5690, 5691, 8, 0, 1.0f},
+  {5692, 5693, 1, 0, 8.533123f},
+  {5694, 5695, 7, 0, 0.0f},
+  {5696, 5697, 10, 0, 0.71556145f},
+  {5698, 5699, 1, 0, 3.0097222f},
+  {5700, 5701, 5, 0, 35.795372f},
+  {5702, 5703, 10, 0, 0.67481405f},
+  {5704, 5705, 2, 0, 0.0f},
+  {5706, 5707, 9, 0, 2.0f},
+  {5708, 5709, 5, 0, 8.143963f},
+  {5710, 5711, 3, 0, 15.336419f},
+  {-1, -1, 0, 0, -0.022937965f},
+  {-1, -1, 0, 0, 0.06810651f},
+  {5712, 5713, 1, 0, 43.68602f},
+  {5714, 5715, 1, 0, 42.674526f},
+  {5716, 5717, 4, 0, 1.0f},
+  {5718, 5719, 7, 0, 3.0f},
+  {5720, 5721, 3, 0, 20.063751f},
+  {5722, 5723, 10, 0, 0.6030454f},
+  {-1, -1, 0, 0, 0.019047642f},
+  {5724, 5725, 5, 0, 12.204893f},
+  {5726, 5727, 5, 0, 11.843356f},
+  {5728, 5729, 3, 0, 30.65051f},
+  {5730, 5731, 1, 0, 13.113845f},
+  {-1, -1, 0, 0, 0.022425778f},
+  {-1, -1, 0, 0, -0.006063223f},
+  {-1, -1, 0, 0, -0.067491665f},
+  {5732, 5733, 10, 0, 0.62730575f},
+  {5734, 5735, 7, 0, 0.0f},
+  {5736, 5737, 3, 0, 3.025743f},
+  {5738, 5739, 7, 0, 3.0f},
+  {5740, 5741, 5, 0, 29.2432f},
+  {5742, 5743, 7, 0, 0.0f},
+  {5744, 5745, 5, 0, 40.438595f},
+  {-1, -1, 0, 0, -0.021964908f},
+  {-1, -1, 0, 0, 0.06034116f},
+  {-1, -1, 0, 0, 0.03423217f},
+  {-1, -1, 0, 0, -0.0004982292f},
+  {-1, -1, 0, 0, -0.00458375f},
+  {-1, -1, 0, 0, -0.070360236f},
+  {-1, -1, 0, 0, 0.0021603266f},
+  {-1, -1, 0, 0, 0.01921516f},
+  {-1, -1, 0, 0, -0.021169746f},
+  {-1, -1, 0, 0, -0.10066817f},
+  {-1, -1, 0, 0, -0.021545922f},
+  {-1, -1, 0, 0, 0.0027364949f},
+  {-1, -1, 0, 0, 0.01140132f},
+  {-1, -1, 0, 0, -0.0044442895f},
+  {-1, -1, 0, 0, -0.028424377f},
+  {-1, -1, 0, 0, -0.005542231f},
+  {-1, -1, 0, 0, -0.0022350447f},
+  {-1, -1, 0, 0, 0.03947888f},
+  {-1, -1, 0, 0, 0.016005194f},
+  {-1, -1, 0, 0, -0.026673589f},
+  {-1, -1, 0, 0, -0.005209792f},
+  {-1, -1, 0, 0, -0.044867918f},
+  {-1, -1, 0, 0, 0.009377802f},
+  {-1, -1, 0, 0, -0.022329865f},
+  {-1, -1, 0, 0, -0.041554324f},
+  {-1, -1, 0, 0, -0.0016845384f},
+  {-1, -1, 0, 0, -0.05739016f},
+  {-1, -1, 0, 0, -0.12480595f},
+  {-1, -1, 0, 0, -0.012045813f},
+  {-1, -1, 0, 0, 0.01496006f},
+  {-1, -1, 0, 0, -0.0002026058f},
+  {-1, -1, 0, 0, -0.036477014f},
+  {-1, -1, 0, 0, 0.098695256f},
+  {-1, -1, 0, 0, 0.0059468085f},
+  {-1, -1, 0, 0, -0.053748902f},
+  {-1, -1, 0, 0, 0.011304113f},
+  {-1, -1, 0, 0, -0.08437486f},
+  {-1, -1, 0, 0, 0.0070503713f},
+  {-1, -1, 0, 0, -0.0051928824f},
+  {-1, -1, 0, 0, -0.043403875f},
+  {-1, -1, 0, 0, 0.07344272f},
+  {-1, -1, 0, 0, 0.00032755066f},
+  {-1, -1, 0, 0, -0.024659423f},
+  {-1, -1, 0, 0, 0.0019007361f},
+  {5747, 5748, 0, 0, 1.0f},
+  {5749, 5750, 10, 0, 0.6030454f},
+  {5751, 5752, 10, 0, 0.60579807f},
+  {5753, 5754, 5, 0, 39.780422f},
+  {5755, 5756, 10, 0, 0.6094279f},
+  {5757, 5758, 5, 0, 3.7302792f},
+  {5759, 5760, 3, 0, 5.203249f},
+  {5761, 5762, 3, 0, 42.277008f},
+  {5763, 5764, 9, 0, 1.0f},
+  {5765, 5766, 5, 0, 8.217814f},
+  {5767, 5768, 7, 0, 28.0f},
+  {5769, 5770, 7, 0, 24.0f},
+  {5771, 5772, 5, 0, 4.289015f},
+  {5773, 5774, 8, 0, 0.0f},
+  {5775, 5776, 3, 0, 5.8848395f},
+  {5777, 5778, 1, 0, 21.909319f},
+  {5779, 5780, 1, 0, 15.361816f},
+  {5781, 5782, 1, 0, 19.982603f},
+  {5783, 5784, 0, 0, 0.67f},
+  {5785, 5786, 3, 0, 16.209831f},
+  {5787, 5788, 1, 0, 12.552255f},
+  {5789, 5790, 5, 0, 48.616074f},
+  {5791, 5792, 1, 0, 4.63365f},
+  {-1, -1, 0, 0, 0.087174036f},
+  {5793, 5794, 1, 0, 5.970496f},
+  {5795, 5796, 1, 0, 6.4487634f},
+  {5797, 5798, 5, 0, 7.042338f},
+  {5799, 5800, 1, 0, 3.0097222f},
+  {5801, 5802, 5, 0, 7.042338f},
+  {5803, 5804, 9, 0, 3.0f},
+  {5805, 5806, 3, 0, 6.576387f},
+  {5807, 5808, 2, 0, 1.0f},
+  {5809, 5810, 3, 0, 16.84958f},
+  {5811, 5812, 3, 0, 43.67558f},
+  {-1, -1, 0, 0, -0.018502247f},
+  {-1, -1, 0, 0, 0.05516888f},
+  {5813, 5814, 1, 0, 22.5281f},
+  {-1, -1, 0, 0, -0.017265208f},
+  {-1, -1, 0, 0, -0.0011026859f},
+  {-1, -1, 0, 0, 0.074215576f},
+  {-1, -1, 0, 0, 0.017254068f},
+  {-1, -1, 0, 0, -0.031244189f},
+  {-1, -1, 0, 0, -0.003260684f},
+  {5815, 5816, 10, 0, 0.6204305f},
+  {5817, 5818, 7, 0, 0.0f},
+  {-1, -1, 0, 0, -0.014680386f},
+  {5819, 5820, 1, 0, 9.390084f},
+  {5821, 5822, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.026986027f},
+  {5823, 5824, 5, 0, 4.07375f},
+  {5825, 5826, 1, 0, 6.748502f},
+  {-1, -1, 0, 0, 0.05839259f},
+  {5827, 5828, 5, 0, 7.5563846f},
+  {-1, -1, 0, 0, 0.008670616f},
+  {-1, -1, 0, 0, 0.10093581f},
+  {5829, 5830, 3, 0, 3.2109072f},
+  {5831, 5832, 7, 0, 28.0f},
+  {5833, 5834, 7, 0, 21.0f},
+  {-1, -1, 0, 0, -0.070122145f},
+  {5835, 5836, 1, 0, 3.0097222f},
+  {5837, 5838, 5, 0, 3.2776327f},
+  {-1, -1, 0, 0, -0.047162328f},
+  {-1, -1, 0, 0, -0.010873093f},
+  {-1, -1, 0, 0, -0.0058891564f},
+  {-1, -1, 0, 0, 0.032592762f},
+  {-1, -1, 0, 0, 0.053393908f},
+  {-1, -1, 0, 0, 0.018944545f},
+  {-1, -1, 0, 0, -0.0068135858f},
+  {-1, -1, 0, 0, 0.025256976f},
+  {-1, -1, 0, 0, -0.01726234f},
+  {-1, -1, 0, 0, 0.00012860615f},
+  {-1, -1, 0, 0, -0.06469565f},
+  {-1, -1, 0, 0, 0.010848294f},
+  {-1, -1, 0, 0, 0.054303743f},
+  {-1, -1, 0, 0, 0.014587402f},
+  {-1, -1, 0, 0, 0.0026916505f},
+  {-1, -1, 0, 0, -0.005360031f},
+  {-1, -1, 0, 0, -0.031681314f},
+  {-1, -1, 0, 0, -0.0029219629f},
+  {-1, -1, 0, 0, -0.0009188652f},
+  {-1, -1, 0, 0, 0.0027198792f},
+  {-1, -1, 0, 0, -0.023325969f},
+  {-1, -1, 0, 0, 0.028245403f},
+  {-1, -1, 0, 0, -0.008019424f},
+  {-1, -1, 0, 0, 0.04223958f},
+  {-1, -1, 0, 0, -0.070148185f},
+  {-1, -1, 0, 0, 0.011081581f},
+  {-1, -1, 0, 0, 0.04751091f},
+  {-1, -1, 0, 0, -0.015254212f},
+  {-1, -1, 0, 0, 0.0009436798f},
+  {-1, -1, 0, 0, 0.099446535f},
+  {-1, -1, 0, 0, -0.032056004f},
+  {-1, -1, 0, 0, 0.009778328f},
+  {5840, 5841, 5, 0, 7.5563846f},
+  {5842, 5843, 5, 0, 7.1080623f},
+  {5844, 5845, 5, 0, 7.906511f},
+  {5846, 5847, 5, 0, 7.042338f},
+  {5848, 5849, 10, 0, 0.6290384f},
+  {5850, 5851, 10, 0, 0.6094279f},
+  {5852, 5853, 7, 0, 25.0f},
+  {5854, 5855, 10, 0, 0.85929304f},
+  {5856, 5857, 3, 0, 5.203249f},
+  {5858, 5859, 7, 0, 14.0f},
+  {5860, 5861, 1, 0, 8.842302f},
+  {5862, 5863, 3, 0, 3.892201f},
+  {5864, 5865, 10, 0, 0.9294512f},
+  {5866, 5867, 8, 0, 0.0f},
+  {5868, 5869, 7, 0, 31.0f},
+  {5870, 5871, 10, 0, 0.8561354f},
+  {5872, 5873, 9, 0, 3.0f},
+  {5874, 5875, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, 0.018482335f},
+  {-1, -1, 0, 0, -0.10247292f},
+  {5876, 5877, 1, 0, 6.4487634f},
+  {5878, 5879, 4, 0, 1.0f},
+  {-1, -1, 0, 0, -0.041723777f},
+  {-1, -1, 0, 0, 0.049403287f},
+  {-1, -1, 0, 0, -0.0156146055f},
+  {5880, 5881, 1, 0, 9.928482f},
+  {5882, 5883, 1, 0, 7.5773983f},
+  {5884, 5885, 5, 0, 41.56447f},
+  {5886, 5887, 3, 0, 11.121522f},
+  {5888, 5889, 1, 0, 3.0097222f},
+  {5890, 5891, 3, 0, 3.571177f},
+  {5892, 5893, 1, 0, 18.662224f},
+  {5894, 5895, 4, 0, 1.0f},
+  {5896, 5897, 10, 0, 0.86295253f},
+  {5898, 5899, 7, 0, 0.0f},
+  {5900, 5901, 0, 0, 0.33f},
+  {5902, 5903, 9, 0, 2.0f},
+  {-1, -1, 0, 0, -0.034258462f},
+  {-1, -1, 0, 0, 0.0061233523f},
+  {5904, 5905, 5, 0, 7.1836843f},
+  {5906, 5907, 7, 0, 18.0f},
+  {5908, 5909, 4, 0, 1.0f},
+  {-1, -1, 0, 0, 0.035549354f},
+  {-1, -1, 0, 0, 0.04358956f},
+  {-1, -1, 0, 0, 0.0056625367f},
+  {5910, 5911, 3, 0, 46.052345f},
+  {5912, 5913, 5, 0, 43.30592f},
+  {5914, 5915, 3, 0, 9.778186f},
+  {5916, 5917, 3, 0, 11.716022f},
+  {5918, 5919, 5, 0, 8.34942f},
+  {5920, 5921, 3, 0, 4.2215447f},
+  {-1, -1, 0, 0, -0.001138115f},
+  {-1, -1, 0, 0, -0.013987923f},
+  {-1, -1, 0, 0, 0.0050751925f},
+  {-1, -1, 0, 0, -0.014365765f},
+  {-1, -1, 0, 0, -0.015431373f},
+  {-1, -1, 0, 0, 0.102072775f},
+  {-1, -1, 0, 0, -0.06904774f},
+  {-1, -1, 0, 0, -0.008460148f},
+  {-1, -1, 0, 0, 0.050283354f},
+  {-1, -1, 0, 0, -0.0009016037f},
+  {-1, -1, 0, 0, 0.00632658f},
+  {-1, -1, 0, 0, -0.008034706f},
+  {-1, -1, 0, 0, -0.026261901f},
+  {-1, -1, 0, 0, -0.11458254f},
+  {-1, -1, 0, 0, 0.06895579f},
+  {-1, -1, 0, 0, 0.0024874592f},
+  {-1, -1, 0, 0, 0.102339305f},
+  {-1, -1, 0, 0, 0.026545191f},
+  {-1, -1, 0, 0, -0.020439561f},
+  {-1, -1, 0, 0, -0.06564161f},
+  {-1, -1, 0, 0, 0.021263333f},
+  {-1, -1, 0, 0, -0.051156092f},
+  {-1, -1, 0, 0, -0.08084651f},
+  {-1, -1, 0, 0, -0.0045275874f},
+  {-1, -1, 0, 0, -0.006749842f},
+  {-1, -1, 0, 0, -0.11430309f},
+  {-1, -1, 0, 0, 0.045414235f},
+  {-1, -1, 0, 0, -0.0021157523f},
+  {-1, -1, 0, 0, 0.10423616f},
+  {-1, -1, 0, 0, 0.037560653f},
+  {-1, -1, 0, 0, 0.01919365f},
+  {-1, -1, 0, 0, -0.008580494f},
+  {5923, 5924, 7, 0, 34.0f},
+  {5925, 5926, 4, 0, 1.0f},
+  {5927, 5928, 1, 0, 5.184029f},
+  {5929, 5930, 7, 0, 4.0f},
+  {5931, 5932, 1, 0, 9.498878f},
+  {5933, 5934, 5, 0, 7.042338f},
+  {5935, 5936, 1, 0, 8.214931f},
+  {5937, 5938, 3, 0, 39.509468f},
+  {5939, 5940, 2, 0, 1.0f},
+  {5941, 5942, 3, 0, 8.780311f},
+  {5943, 5944, 10, 0, 0.87471986f},
+  {5945, 5946, 7, 0, 35.0f},
+  {-1, -1, 0, 0, -0.0010811806f},
+  {5947, 5948, 3, 0, 7.280536f},
+  {-1, -1, 0, 0, 0.024156876f},
+  {5949, 5950, 1, 0, 3.8284404f},
+  {5951, 5952, 1, 0, 3.0097222f},
+  {5953, 5954, 7, 0, 20.0f},
+  {5955, 5956, 9, 0, 3.0f},
+  {5957, 5958, 3, 0, 7.0890985f},
+  {5959, 5960, 10, 0, 0.7761602f},
+  {5961, 5962, 0, 0, 0.67f},
+  {5963, 5964, 3, 0, 6.8972244f},
+  {-1, -1, 0, 0, 0.0054707527f},
+  {5965, 5966, 7, 0, 38.0f},
+  {-1, -1, 0, 0, 0.005828142f},
+  {-1, -1, 0, 0, -0.018654125f},
+  {5967, 5968, 5, 0, 33.1996f},
+  {5969, 5970, 1, 0, 8.584065f},
+  {5971, 5972, 7, 0, 0.0f},
+  {5973, 5974, 7, 0, 2.0f},
+  {5975, 5976, 7, 0, 18.0f},
+  {5977, 5978, 10, 0, 0.61697054f},
+  {5979, 5980, 0, 0, 1.0f},
+  {5981, 5982, 1, 0, 6.9175615f},
+  {5983, 5984, 3, 0, 7.0185437f},
+  {5985, 5986, 5, 0, 4.0306463f},
+  {5987, 5988, 10, 0, 0.75259924f},
+  {5989, 5990, 3, 0, 8.966423f},
+  {5991, 5992, 5, 0, 7.6044974f},
+  {5993, 5994, 7, 0, 17.0f},
+  {5995, 5996, 5, 0, 6.3587155f},
+  {-1, -1, 0, 0, -0.052565794f},
+  {-1, -1, 0, 0, 0.046753082f},
+  {-1, -1, 0, 0, 0.008500672f},
+  {-1, -1, 0, 0, -0.0476335f},
+  {-1, -1, 0, 0, 0.011252254f},
+  {-1, -1, 0, 0, 0.03349692f},
+  {-1, -1, 0, 0, -0.009353758f},
+  {-1, -1, 0, 0, 0.10008135f},
+  {-1, -1, 0, 0, -0.005244601f},
+  {-1, -1, 0, 0, -0.014443968f},
+  {-1, -1, 0, 0, 0.018574858f},
+  {-1, -1, 0, 0, 0.0052900747f},
+  {-1, -1, 0, 0, -0.060020562f},
+  {-1, -1, 0, 0, 0.006309929f},
+  {-1, -1, 0, 0, 0.05865946f},
+  {-1, -1, 0, 0, -0.0016609107f},
+  {-1, -1, 0, 0, 0.07969894f},
+  {-1, -1, 0, 0, -0.041135173f},
+  {-1, -1, 0, 0, 0.012789185f},
+  {-1, -1, 0, 0, 0.0038116549f},
+  {-1, -1, 0, 0, 0.060209166f},
+  {-1, -1, 0, 0, -0.031389404f},
+  {-1, -1, 0, 0, -0.004666008f},
+  {-1, -1, 0, 0, 0.0011083003f},
+  {-1, -1, 0, 0, -0.07570564f},
+  {-1, -1, 0, 0, 0.09244937f},
+  {-1, -1, 0, 0, 0.01772213f},
+  {-1, -1, 0, 0, 0.03333934f},
+  {-1, -1, 0, 0, -0.03926251f},
+  {-1, -1, 0, 0, 0.07067167f},
+  {-1, -1, 0, 0, 0.019786509f},
+  {-1, -1, 0, 0, -0.0027844112f},
+  {-1, -1, 0, 0, 0.005379391f},
+  {5998, 5999, 5, 0, 26.082285f},
+  {6000, 6001, 5, 0, 21.740334f},
+  {6002, 6003, 5, 0, 26.373827f},
+  {6004, 6005, 4, 0, 1.0f},
+  {6006, 6007, 1, 0, 14.203641f},
+  {6008, 6009, 1, 0, 3.0097222f},
+  {6010, 6011, 1, 0, 17.898617f},
+  {6012, 6013, 7, 0, 20.0f},
+  {6014, 6015, 3, 0, 3.413912f},
+  {6016, 6017, 5, 0, 22.580956f},
+  {6018, 6019, 1, 0, 28.756657f},
+  {-1, -1, 0, 0, -0.111501f},
+  {-1, -1, 0, 0, -0.027320419f},
+  {6020, 6021, 10, 0, 0.7329612f},
+  {6022, 6023, 1, 0, 19.475634f},
+  {6024, 6025, 7, 0, 19.0f},
+  {6026, 6027, 5, 0, 4.2617974f},
+  {6028, 6029, 10, 0, 0.9181752f},
+  {6030, 6031, 3, 0, 3.6904523f},
+  {6032, 6033, 1, 0, 6.042851f},
+  {6034, 6035, 10, 0, 0.7329612f},
+  {6036, 6037, 0, 0, 0.33f},
+  {6038, 6039, 3, 0, 37.69973f},
+  {6040, 6041, 3, 0, 26.046522f},
+  {6042, 6043, 10, 0, 0.7439139f},
+  {6044, 6045, 7, 0, 0.0f},
+  {6046, 6047, 5, 0, 39.622257f},
+  {6048, 6049, 3, 0, 42.277008f},
+  {6050, 6051, 1, 0, 6.5800433f},
+  {6052, 6053, 7, 0, 31.0f},
+  {6054, 6055, 5, 0, 5.165702f},
+  {6056, 6057, 10, 0, 0.61236143f},
+  {6058, 6059, 1, 0, 3.0097222f},
+  {6060, 6061, 10, 0, 0.72699755f},
+  {6062, 6063, 3, 0, 3.892201f},
+  {6064, 6065, 3, 0, 36.098396f},
+  {6066, 6067, 3, 0, 21.993366f},
+  {6068, 6069, 9, 0, 1.0f},
+  {6070, 6071, 2, 0, 1.0f},
+  {-1, -1, 0, 0, 0.017864168f},
+  {-1, -1, 0, 0, 0.09313138f},
+  {6072, 6073, 3, 0, 3.025743f},
+  {6074, 6075, 1, 0, 35.94086f},
+  {6076, 6077, 1, 0, 6.748502f},
+  {6078, 6079, 1, 0, 3.0097222f},
+  {6080, 6081, 0, 0, 0.33f},
+  {6082, 6083, 3, 0, 4.2215447f},
+  {6084, 6085, 3, 0, 39.509468f},
+  {6086, 6087, 10, 0, 0.60579807f},
+  {6088, 6089, 5, 0, 39.024036f},
+  {6090, 6091, 5, 0, 41.56447f},
+  {-1, -1, 0, 0, -0.004405945f},
+  {-1, -1, 0, 0, 0.008493002f},
+  {-1, -1, 0, 0, -0.06548271f},
+  {-1, -1, 0, 0, 0.04491024f},
+  {-1, -1, 0, 0, -0.024479564f},
+  {-1, -1, 0, 0, 0.014617539f},
+  {-1, -1, 0, 0, 0.07978302f},
+  {-1, -1, 0, 0, 0.01782499f},
+  {-1, -1, 0, 0, -0.036019754f},
+  {-1, -1, 0, 0, 0.040730026f},
+  {-1, -1, 0, 0, 0.0017812729f},
+  {-1, -1, 0, 0, -0.05572011f},
+  {-1, -1, 0, 0, 0.012503738f},
+  {-1, -1, 0, 0, -0.06438491f},
+  {-1, -1, 0, 0, 0.033927586f},
+  {-1, -1, 0, 0, 0.0021341194f},
+  {-1, -1, 0, 0, 0.06916088f},
+  {-1, -1, 0, 0, -0.009675348f},
+  {-1, -1, 0, 0, -0.015005231f},
+  {-1, -1, 0, 0, 0.018563509f},
+  {-1, -1, 0, 0, -0.069541454f},
+  {-1, -1, 0, 0, 0.0018664155f},
+  {-1, -1, 0, 0, 0.034978773f},
+  {-1, -1, 0, 0, -0.024094881f},
+  {-1, -1, 0, 0, 0.008177343f},
+  {-1, -1, 0, 0, 0.03878725f},
+  {-1, -1, 0, 0, -0.0006204128f},
+  {-1, -1, 0, 0, -0.010482836f},
+  {-1, -1, 0, 0, -0.02125439f},
+  {-1, -1, 0, 0, 0.023974536f},
+  {-1, -1, 0, 0, 0.071824245f},
+  {-1, -1, 0, 0, 0.005572465f},
+  {-1, -1, 0, 0, -0.007972479f},
+  {-1, -1, 0, 0, -0.058004316f},
+  {-1, -1, 0, 0, 0.018068627f},
+  {-1, -1, 0, 0, -0.010031127f},
+  {-1, -1, 0, 0, -0.15325855f},
+  {-1, -1, 0, 0, 0.032649186f},
+  {-1, -1, 0, 0, -0.027970165f},
+  {-1, -1, 0, 0, 0.030818183f},
+  {-1, -1, 0, 0, -0.01247718f},
+  {-1, -1, 0, 0, -0.05988135f},
+  {-1, -1, 0, 0, 0.037300255f},
+  {-1, -1, 0, 0, 0.0022036976f},
+  {6093, 6094, 5, 0, 48.616074f},
+  {6095, 6096, 7, 0, 28.0f},
+  {6097, 6098, 7, 0, 0.0f},
+  {6099, 6100, 7, 0, 0.0f},
+  {6101, 6102, 3, 0, 5.9865937f},
+  {-1, -1, 0, 0, -0.060941417f},
+  {6103, 6104, 5, 0, 49.09901f},
+  {6105, 6106, 5, 0, 43.96941f},
+  {6107, 6108, 7, 0, 2.0f},
+  {6109, 6110, 1, 0, 8.533123f},
+  {6111, 6112, 3, 0, 6.721325f},
+  {6113, 6114, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.024013592f},
+  {6115, 6116, 5, 0, 36.359806f},
+  {6117, 6118, 3, 0, 27.815134f},
+  {6119, 6120, 9, 0, 1.0f},
+  {6121, 6122, 7, 0, 27.0f},
+  {6123, 6124, 7, 0, 34.0f},
+  {6125, 6126, 7, 0, 32.0f},
+  {6127, 6128, 0, 0, 0.33f},
+  {6129, 6130, 3, 0, 7.9278097f},
+  {-1, -1, 0, 0, -0.02062199f},
+  {-1, -1, 0, 0, 0.002388668f},
+  {6131, 6132, 5, 0, 28.571396f},
+  {6133, 6134, 1, 0, 15.640303f},
+  {6135, 6136, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.05868956f},
+  {6137, 6138, 1, 0, 28.0855f},
+  {6139, 6140, 3, 0, 16.29652f},
+  {6141, 6142, 10, 0, 0.6419955f},
+  {6143, 6144, 10, 0, 0.63544995f},
+  {6145, 6146, 5, 0, 7.785548f},
+  {6147, 6148, 1, 0, 3.0097222f},
+  {6149, 6150, 3, 0, 4.8157487f},
+  {6151, 6152, 1, 0, 9.290183f},
+  {-1, -1, 0, 0, 0.012588597f},
+  {-1, -1, 0, 0, 0.0648778f},
+  {6153, 6154, 7, 0, 29.0f},
+  {6155, 6156, 7, 0, 31.0f},
+  {-1, -1, 0, 0, 0.002116577f},
+  {-1, -1, 0, 0, 0.062435176f},
+  {-1, -1, 0, 0, -0.007516369f},
+  {-1, -1, 0, 0, -0.09429332f},
+  {-1, -1, 0, 0, 0.120352104f},
+  {-1, -1, 0, 0, -0.0036419034f},
+  {-1, -1, 0, 0, -0.020525567f},
+  {-1, -1, 0, 0, 0.00060795795f},
+  {-1, -1, 0, 0, -0.007423085f},
+  {-1, -1, 0, 0, -0.08036821f},
+  {-1, -1, 0, 0, 0.0043441835f},
+  {-1, -1, 0, 0, -0.0008033964f},
+  {-1, -1, 0, 0, 0.03862324f},
+  {-1, -1, 0, 0, -0.03077585f},
+  {-1, -1, 0, 0, -0.028233444f},
+  {-1, -1, 0, 0, 0.024127802f},
+  {-1, -1, 0, 0, 0.005391455f},
+  {-1, -1, 0, 0, 0.024937756f},
+  {-1, -1, 0, 0, 0.05120015f},
+  {-1, -1, 0, 0, 0.014125252f},
+  {-1, -1, 0, 0, 0.005410004f},
+  {-1, -1, 0, 0, -0.0010771751f},
+  {-1, -1, 0, 0, -0.035323333f},
+  {-1, -1, 0, 0, 0.0123584205f},
+  {-1, -1, 0, 0, 0.042744447f},
+  {-1, -1, 0, 0, 0.011019495f},
+  {6158, 6159, 5, 0, 26.082285f},
+  {6160, 6161, 5, 0, 21.740334f},
+  {6162, 6163, 5, 0, 26.373827f},
+  {6164, 6165, 5, 0, 20.05952f},
+  {6166, 6167, 1, 0, 14.203641f},
+  {6168, 6169, 1, 0, 3.0097222f},
+  {6170, 6171, 1, 0, 17.898617f},
+  {6172, 6173, 5, 0, 19.468435f},
+  {6174, 6175, 10, 0, 0.80318177f},
+  {6176, 6177, 3, 0, 15.786185f},
+  {6178, 6179, 1, 0, 18.108318f},
+  {-1, -1, 0, 0, -0.106031775f},
+  {-1, -1, 0, 0, -0.025445495f},
+  {6180, 6181, 10, 0, 0.7329612f},
+  {6182, 6183, 5, 0, 40.438595f},
+  {6184, 6185, 5, 0, 10.198943f},
+  {6186, 6187, 0, 0, 0.33f},
+  {6188, 6189, 7, 0, 3.0f},
+  {6190, 6191, 3, 0, 3.025743f},
+  {6192, 6193, 3, 0, 6.0927978f},
+  {6194, 6195, 1, 0, 6.042851f},
+  {-1, -1, 0, 0, 0.09943102f},
+  {6196, 6197, 3, 0, 37.69973f},
+  {6198, 6199, 3, 0, 26.046522f},
+  {6200, 6201, 10, 0, 0.7439139f},
+  {6202, 6203, 1, 0, 19.475634f},
+  {6204, 6205, 3, 0, 39.509468f},
+  {6206, 6207, 1, 0, 18.662224f},
+  {6208, 6209, 1, 0, 18.48521f},
+  {-1, -1, 0, 0, 0.08841159f},
+  {6210, 6211, 7, 0, 4.0f},
+  {6212, 6213, 1, 0, 3.0097222f},
+  {6214, 6215, 1, 0, 3.4432666f},
+  {-1, -1, 0, 0, -0.11686639f},
+  {6216, 6217, 0, 0, 0.67f},
+  {6218, 6219, 1, 0, 3.0097222f},
+  {6220, 6221, 10, 0, 0.699889f},
+  {6222, 6223, 3, 0, 40.179165f},
+  {6224, 6225, 1, 0, 7.99194f},
+  {6226, 6227, 3, 0, 3.025743f},
+  {6228, 6229, 0, 0, 0.33f},
+  {6230, 6231, 3, 0, 14.859064f},
+  {6232, 6233, 1, 0, 3.0097222f},
+  {6234, 6235, 0, 0, 0.33f},
+  {6236, 6237, 3, 0, 4.2215447f},
+  {6238, 6239, 7, 0, 0.0f},
+  {6240, 6241, 8, 0, 1.0f},
+  {6242, 6243, 3, 0, 36.738876f},
+  {6244, 6245, 10, 0, 0.6419955f},
+  {-1, -1, 0, 0, 0.0024160098f},
+  {-1, -1, 0, 0, -0.0066241818f},
+  {-1, -1, 0, 0, -0.014063452f},
+  {-1, -1, 0, 0, 0.009995286f},
+  {-1, -1, 0, 0, 0.0262769f},
+  {-1, -1, 0, 0, -0.0022324482f},
+  {-1, -1, 0, 0, -0.032696817f},
+  {-1, -1, 0, 0, -0.009809204f},
+  {-1, -1, 0, 0, 0.050513566f},
+  {-1, -1, 0, 0, 0.012011162f},
+  {-1, -1, 0, 0, -0.039292112f},
+  {-1, -1, 0, 0, -0.007585955f},
+  {-1, -1, 0, 0, 0.035689633f},
+  {-1, -1, 0, 0, -0.017751755f},
+  {-1, -1, 0, 0, -0.091898456f},
+  {-1, -1, 0, 0, -0.01117903f},
+  {-1, -1, 0, 0, 0.06733038f},
+  {-1, -1, 0, 0, -0.0071793473f},
+  {-1, -1, 0, 0, -0.029825797f},
+  {-1, -1, 0, 0, 0.0019345115f},
+  {-1, -1, 0, 0, 0.0077380775f},
+  {-1, -1, 0, 0, 0.04285687f},
+  {-1, -1, 0, 0, 0.016865123f},
+  {-1, -1, 0, 0, -0.0069784964f},
+  {-1, -1, 0, 0, 0.011456377f},
+  {-1, -1, 0, 0, -0.032421384f},
+  {-1, -1, 0, 0, 0.063791096f},
+  {-1, -1, 0, 0, 0.004688805f},
+  {-1, -1, 0, 0, -0.007533693f},
+  {-1, -1, 0, 0, -0.053299695f},
+  {-1, -1, 0, 0, 0.015865458f},
+  {-1, -1, 0, 0, -0.009026099f},
+  {-1, -1, 0, 0, -0.12618472f},
+  {-1, -1, 0, 0, -0.012981772f},
+  {-1, -1, 0, 0, -0.019204883f},
+  {-1, -1, 0, 0, 0.023552837f},
+  {-1, -1, 0, 0, 0.0042882427f},
+  {-1, -1, 0, 0, -0.08608706f},
+  {-1, -1, 0, 0, -0.0127108535f},
+  {-1, -1, 0, 0, 0.051700838f},
+  {6247, 6248, 5, 0, 48.616074f},
+  {6249, 6250, 7, 0, 28.0f},
+  {6251, 6252, 7, 0, 0.0f},
+  {6253, 6254, 7, 0, 0.0f},
+  {6255, 6256, 3, 0, 5.9865937f},
+  {-1, -1, 0, 0, -0.056332435f},
+  {6257, 6258, 5, 0, 49.09901f},
+  {6259, 6260, 5, 0, 43.96941f},
+  {6261, 6262, 7, 0, 2.0f},
+  {6263, 6264, 1, 0, 8.533123f},
+  {6265, 6266, 3, 0, 6.721325f},
+  {6267, 6268, 0, 0, 0.67f},
+  {6269, 6270, 1, 0, 18.662224f},
+  {6271, 6272, 5, 0, 36.127365f},
+  {6273, 6274, 5, 0, 45.070286f},
+  {6275, 6276, 1, 0, 11.328481f},
+  {6277, 6278, 10, 0, 0.6030454f},
+  {6279, 6280, 7, 0, 34.0f},
+  {6281, 6282, 7, 0, 32.0f},
+  {6283, 6284, 0, 0, 0.33f},
+  {6285, 6286, 3, 0, 7.9278097f},
+  {-1, -1, 0, 0, -0.019805312f},
+  {-1, -1, 0, 0, 0.0016963959f},
+  {-1, -1, 0, 0, 0.024902305f},
+  {-1, -1, 0, 0, 0.0060700476f},
+  {6287, 6288, 5, 0, 28.571396f},
+  {6289, 6290, 3, 0, 12.469329f},
+  {6291, 6292, 2, 0, 1.0f},
+  {6293, 6294, 3, 0, 23.265055f},
+  {6295, 6296, 9, 0, 1.0f},
+  {6297, 6298, 3, 0, 44.016357f},
+  {6299, 6300, 1, 0, 5.315942f},
+  {6301, 6302, 10, 0, 0.6419955f},
+  {6303, 6304, 5, 0, 7.785548f},
+  {6305, 6306, 5, 0, 7.475979f},
+  {-1, -1, 0, 0, 0.043062326f},
+  {6307, 6308, 1, 0, 9.290183f},
+  {-1, -1, 0, 0, 0.011838341f},
+  {-1, -1, 0, 0, 0.059830666f},
+  {6309, 6310, 7, 0, 29.0f},
+  {6311, 6312, 7, 0, 31.0f},
+  {-1, -1, 0, 0, 0.0019359291f},
+  {-1, -1, 0, 0, 0.060853433f},
+  {-1, -1, 0, 0, -0.083968125f},
+  {-1, -1, 0, 0, -0.006851765f},
+  {-1, -1, 0, 0, 0.12842111f},
+  {-1, -1, 0, 0, 0.021938039f},
+  {-1, -1, 0, 0, 0.0533189f},
+  {-1, -1, 0, 0, -0.061203487f},
+  {-1, -1, 0, 0, -0.025525494f},
+  {-1, -1, 0, 0, -0.07381003f},
+  {-1, -1, 0, 0, -0.0026075f},
+  {-1, -1, 0, 0, -0.02760624f},
+  {-1, -1, 0, 0, 0.007478052f},
+  {-1, -1, 0, 0, -0.013509533f},
+  {-1, -1, 0, 0, 0.014520513f},
+  {-1, -1, 0, 0, -0.0011302108f},
+  {-1, -1, 0, 0, -0.02579527f},
+  {-1, -1, 0, 0, 0.021915754f},
+  {-1, -1, 0, 0, 0.019907212f},
+  {-1, -1, 0, 0, -0.0020427704f},
+  {-1, -1, 0, 0, 0.005018711f},
+  {-1, -1, 0, 0, -0.0011441231f},
+  {-1, -1, 0, 0, -0.033129502f},
+  {-1, -1, 0, 0, 0.01109205f},
+  {-1, -1, 0, 0, 0.039357424f},
+  {-1, -1, 0, 0, 0.00982524f},
+  {6314, 6315, 5, 0, 26.082285f},
+  {6316, 6317, 5, 0, 21.740334f},
+  {6318, 6319, 5, 0, 27.972656f},
+  {6320, 6321, 10, 0, 0.9371148f},
+  {6322, 6323, 1, 0, 14.203641f},
+  {6324, 6325, 7, 0, 7.0f},
+  {6326, 6327, 1, 0, 3.0097222f},
+  {6328, 6329, 10, 0, 0.8739182f},
+  {6330, 6331, 1, 0, 7.5773983f},
+  {6332, 6333, 3, 0, 15.786185f},
+  {6334, 6335, 1, 0, 17.394213f},
+  {6336, 6337, 1, 0, 3.0097222f},
+  {6338, 6339, 10, 0, 0.7320588f},
+  {6340, 6341, 5, 0, 35.795372f},
+  {6342, 6343, 5, 0, 40.438595f},
+  {6344, 6345, 10, 0, 0.85929304f},
+  {6346, 6347, 5, 0, 6.2497888f},
+  {6348, 6349, 5, 0, 7.968597f},
+  {6350, 6351, 3, 0, 44.016357f},
+  {6352, 6353, 3, 0, 6.0927978f},
+  {6354, 6355, 1, 0, 6.042851f},
+  {-1, -1, 0, 0, 0.10760587f},
+  {6356, 6357, 3, 0, 37.69973f},
+  {6358, 6359, 0, 0, 0.33f},
+  {6360, 6361, 3, 0, 18.418673f},
+  {6362, 6363, 1, 0, 3.4432666f},
+  {6364, 6365, 10, 0, 0.8928462f},
+  {6366, 6367, 7, 0, 0.0f},
+  {6368, 6369, 10, 0, 0.7329612f},
+  {6370, 6371, 5, 0, 40.147594f},
+  {6372, 6373, 1, 0, 4.267824f},
+  {6374, 6375, 10, 0, 0.8561354f},
+  {6376, 6377, 3, 0, 6.928398f},
+  {6378, 6379, 1, 0, 7.3127937f},
+  {6380, 6381, 1, 0, 7.5352225f},
+  {6382, 6383, 5, 0, 5.011349f},
+  {-1, -1, 0, 0, -0.03149103f},
+  {6384, 6385, 5, 0, 5.8729773f},
+  {-1, -1, 0, 0, 0.01813277f},
+  {6386, 6387, 1, 0, 3.0097222f},
+  {6388, 6389, 10, 0, 0.699889f},
+  {6390, 6391, 10, 0, 0.73666394f},
+  {6392, 6393, 3, 0, 17.250961f},
+  {6394, 6395, 3, 0, 3.025743f},
+  {6396, 6397, 0, 0, 0.33f},
+  {-1, -1, 0, 0, -0.015499616f},
+  {-1, -1, 0, 0, -0.13284838f},
+  {6398, 6399, 5, 0, 26.488493f},
+  {6400, 6401, 1, 0, 37.34242f},
+  {-1, -1, 0, 0, 0.046785247f},
+  {6402, 6403, 0, 0, 0.67f},
+  {6404, 6405, 1, 0, 3.0097222f},
+  {6406, 6407, 0, 0, 0.67f},
+  {6408, 6409, 10, 0, 0.8007134f},
+  {6410, 6411, 7, 0, 4.0f},
+  {6412, 6413, 5, 0, 39.35422f},
+  {6414, 6415, 7, 0, 7.0f},
+  {6416, 6417, 5, 0, 39.622257f},
+  {6418, 6419, 1, 0, 6.8556423f},
+  {6420, 6421, 10, 0, 0.7761602f},
+  {6422, 6423, 0, 0, 0.67f},
+  {-1, -1, 0, 0, -0.00015148595f},
+  {-1, -1, 0, 0, 0.04795453f},
+  {-1, -1, 0, 0, -0.0043586814f},
+  {-1, -1, 0, 0, -0.04212982f},
+  {-1, -1, 0, 0, -0.015224178f},
+  {-1, -1, 0, 0, 0.02562744f},
+  {-1, -1, 0, 0, 0.03279298f},
+  {-1, -1, 0, 0, -0.0023198854f},
+  {-1, -1, 0, 0, -0.008167733f},
+  {-1, -1, 0, 0, 0.055716436f},
+  {-1, -1, 0, 0, -0.054591417f},
+  {-1, -1, 0, 0, -0.012612939f},
+  {-1, -1, 0, 0, 0.03269139f},
+  {-1, -1, 0, 0, -0.016044065f},
+  {-1, -1, 0, 0, -0.0850746f},
+  {-1, -1, 0, 0, -0.0103325015f},
+  {-1, -1, 0, 0, 0.07579764f},
+  {-1, -1, 0, 0, 0.010416255f},
+  {-1, -1, 0, 0, 0.021205796f},
+  {-1, -1, 0, 0, -0.01400432f},
+  {-1, -1, 0, 0, 0.0074815513f},
+  {-1, -1, 0, 0, 0.041776534f},
+  {-1, -1, 0, 0, 0.015925074f},
+  {-1, -1, 0, 0, -0.0064379214f},
+  {-1, -1, 0, 0, -0.016845513f},
+  {-1, -1, 0, 0, -0.04385408f},
+  {-1, -1, 0, 0, 0.012554936f},
+  {-1, -1, 0, 0, -0.01981783f},
+  {-1, -1, 0, 0, -0.00049796107f},
+  {-1, -1, 0, 0, 0.011902237f},
+  {-1, -1, 0, 0, -0.0026986122f},
+  {-1, -1, 0, 0, -0.024877606f},
+  {-1, -1, 0, 0, 0.006793165f},
+  {-1, -1, 0, 0, -0.0076810205f},
+  {-1, -1, 0, 0, 0.11460835f},
+  {-1, -1, 0, 0, 0.019520348f},
+  {-1, -1, 0, 0, -0.0053945733f},
+  {-1, -1, 0, 0, 0.037077438f},
+  {-1, -1, 0, 0, 0.07593503f},
+  {-1, -1, 0, 0, -0.0023227097f},
+  {-1, -1, 0, 0, -0.06512654f},
+  {-1, -1, 0, 0, -0.003789727f},
+  {-1, -1, 0, 0, -0.011454883f},
+  {-1, -1, 0, 0, 0.0342645f},
+  {-1, -1, 0, 0, -0.029251972f},
+  {-1, -1, 0, 0, -0.10575836f},
+  {-1, -1, 0, 0, -0.050493058f},
+  {-1, -1, 0, 0, -0.0026016235f},
+  {-1, -1, 0, 0, 0.0055566235f},
+  {-1, -1, 0, 0, 0.034737404f},
+  {6425, 6426, 5, 0, 48.616074f},
+  {6427, 6428, 3, 0, 46.39685f},
+  {6429, 6430, 7, 0, 0.0f},
+  {6431, 6432, 3, 0, 39.509468f},
+  {6433, 6434, 10, 0, 0.85929304f},
+  {-1, -1, 0, 0, -0.051575392f},
+  {6435, 6436, 5, 0, 49.09901f},
+  {6437, 6438, 3, 0, 38.579594f},
+  {6439, 6440, 3, 0, 40.47511f},
+  {6441, 6442, 5, 0, 45.385487f},
+  {6443, 6444, 5, 0, 14.548938f},
+  {6445, 6446, 0, 0, 0.67f},
+  {6447, 6448, 1, 0, 18.662224f},
+  {6449, 6450, 10, 0, 0.6030454f},
+  {6451, 6452, 1, 0, 27.268505f},
+  {6453, 6454, 8, 0, 1.0f},
+  {6455, 6456, 3, 0, 42.277008f},
+  {6457, 6458, 6, 0, 1.0f},
+  {-1, -1, 0, 0, 0.025973145f},
+  {6459, 6460, 1, 0, 18.48521f},
+  {-1, -1, 0, 0, 0.024663595f},
+  {-1, -1, 0, 0, -0.01909287f},
+  {-1, -1, 0, 0, -0.00012531281f},
+  {-1, -1, 0, 0, 0.022871694f},
+  {-1, -1, 0, 0, 0.0054887175f},
+  {6461, 6462, 1, 0, 6.663192f},
+  {6463, 6464, 10, 0, 0.6094279f},
+  {6465, 6466, 5, 0, 43.96941f},
+  {-1, -1, 0, 0, -0.014001386f},
+  {6467, 6468, 5, 0, 3.0662608f},
+  {6469, 6470, 1, 0, 25.188354f},
+  {6471, 6472, 5, 0, 3.0662608f},
+  {6473, 6474, 7, 0, 0.0f},
+  {6475, 6476, 0, 0, 0.33f},
+  {6477, 6478, 10, 0, 0.6030454f},
+  {-1, -1, 0, 0, -0.013940208f},
+  {-1, -1, 0, 0, 0.017226135f},
+  {-1, -1, 0, 0, -0.015855905f},
+  {-1, -1, 0, 0, 0.004310442f},
+  {-1, -1, 0, 0, 0.03619124f},
+  {-1, -1, 0, 0, 0.0006688518f},
+  {-1, -1, 0, 0, -0.061825898f},
+  {-1, -1, 0, 0, -0.014766264f},
+  {-1, -1, 0, 0, 0.037283532f},
+  {-1, -1, 0, 0, 0.073268734f},
+  {-1, -1, 0, 0, -0.034983445f},
+  {-1, -1, 0, 0, 0.008821583f},
+  {-1, -1, 0, 0, -0.06545075f},
+  {-1, -1, 0, 0, 0.0022668706f},
+  {-1, -1, 0, 0, 0.043134876f},
+  {-1, -1, 0, 0, 0.001677085f},
+  {-1, -1, 0, 0, -0.004884043f},
+  {-1, -1, 0, 0, -0.030958248f},
+  {-1, -1, 0, 0, 0.028124047f},
+  {-1, -1, 0, 0, -0.007934523f},
+  {6480, 6481, 5, 0, 7.5563846f},
+  {6482, 6483, 5, 0, 7.1080623f},
+  {6484, 6485, 5, 0, 7.906511f},
+  {6486, 6487, 5, 0, 7.042338f},
+  {6488, 6489, 10, 0, 0.6290384f},
+  {6490, 6491, 10, 0, 0.6094279f},
+  {6492, 6493, 7, 0, 25.0f},
+  {6494, 6495, 10, 0, 0.6115686f},
+  {6496, 6497, 3, 0, 5.203249f},
+  {6498, 6499, 7, 0, 14.0f},
+  {6500, 6501, 9, 0, 2.0f},
+  {6502, 6503, 3, 0, 3.892201f},
+  {6504, 6505, 10, 0, 0.9294512f},
+  {6506, 6507, 10, 0, 0.6204305f},
+  {6508, 6509, 7, 0, 31.0f},
+  {6510, 6511, 10, 0, 0.6035007f},
+  {6512, 6513, 5, 0, 6.6156325f},
+  {6514, 6515, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, 0.01727937f},
+  {-1, -1, 0, 0, -0.09608479f},
+  {6516, 6517, 1, 0, 6.4487634f},
+  {6518, 6519, 7, 0, 10.0f},
+  {6520, 6521, 7, 0, 21.0f},
+  {-1, -1, 0, 0, 0.044005156f},
+  {-1, -1, 0, 0, -0.015042687f},
+  {6522, 6523, 1, 0, 9.928482f},
+  {6524, 6525, 1, 0, 7.5773983f},
+  {6526, 6527, 7, 0, 1.0f},
+  {6528, 6529, 10, 0, 0.629555f},
+  {6530, 6531, 1, 0, 3.0097222f},
+  {6532, 6533, 3, 0, 3.571177f},
+  {6534, 6535, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.083646245f},
+  {6536, 6537, 5, 0, 5.8571157f},
+  {6538, 6539, 5, 0, 6.694863f},
+  {6540, 6541, 0, 0, 0.33f},
+  {6542, 6543, 9, 0, 2.0f},
+  {6544, 6545, 5, 0, 7.475979f},
+  {-1, -1, 0, 0, 0.0057845116f},
+  {6546, 6547, 10, 0, 0.699889f},
+  {6548, 6549, 3, 0, 7.694672f},
+  {6550, 6551, 3, 0, 7.280536f},
+  {6552, 6553, 5, 0, 7.1836843f},
+  {6554, 6555, 4, 0, 1.0f},
+  {-1, -1, 0, 0, 0.030018425f},
+  {-1, -1, 0, 0, 0.034898724f},
+  {-1, -1, 0, 0, 0.0055768015f},
+  {6556, 6557, 9, 0, 1.0f},
+  {6558, 6559, 7, 0, 11.0f},
+  {6560, 6561, 4, 0, 1.0f},
+  {6562, 6563, 10, 0, 0.67224056f},
+  {6564, 6565, 5, 0, 8.34942f},
+  {6566, 6567, 3, 0, 4.2215447f},
+  {-1, -1, 0, 0, -0.001966572f},
+  {-1, -1, 0, 0, -0.016034698f},
+  {-1, -1, 0, 0, 0.03447632f},
+  {-1, -1, 0, 0, 0.0009909403f},
+  {-1, -1, 0, 0, 0.001032299f},
+  {-1, -1, 0, 0, -0.016398398f},
+  {-1, -1, 0, 0, 0.05197711f},
+  {-1, -1, 0, 0, -0.004451791f},
+  {-1, -1, 0, 0, 0.004616356f},
+  {-1, -1, 0, 0, -0.005380249f},
+  {-1, -1, 0, 0, -0.025296068f},
+  {-1, -1, 0, 0, -0.10606565f},
+  {-1, -1, 0, 0, -0.035827257f},
+  {-1, -1, 0, 0, -0.0062422752f},
+  {-1, -1, 0, 0, 0.007465792f},
+  {-1, -1, 0, 0, -0.034672022f},
+  {-1, -1, 0, 0, 0.0030330182f},
+  {-1, -1, 0, 0, 0.036328245f},
+  {-1, -1, 0, 0, 0.096105956f},
+  {-1, -1, 0, 0, 0.011985207f},
+  {-1, -1, 0, 0, 0.045625076f},
+  {-1, -1, 0, 0, -0.001433318f},
+  {-1, -1, 0, 0, -0.020148627f},
+  {-1, -1, 0, 0, -0.059122086f},
+  {-1, -1, 0, 0, -0.0068147765f},
+  {-1, -1, 0, 0, -0.065390065f},
+  {-1, -1, 0, 0, 0.004958315f},
+  {-1, -1, 0, 0, -0.016854858f},
+  {-1, -1, 0, 0, 0.01991944f},
+  {-1, -1, 0, 0, 0.07990122f},
+  {-1, -1, 0, 0, -0.009850514f},
+  {-1, -1, 0, 0, 0.0003065958f},
+  {-1, -1, 0, 0, 0.09177532f},
+  {-1, -1, 0, 0, 0.032178625f},
+  {-1, -1, 0, 0, 0.010603396f},
+  {-1, -1, 0, 0, -0.010897636f},
+  {6569, 6570, 10, 0, 0.7280631f},
+  {6571, 6572, 10, 0, 0.70130366f},
+  {6573, 6574, 10, 0, 0.7314549f},
+  {6575, 6576, 10, 0, 0.69761395f},
+  {6577, 6578, 1, 0, 3.0097222f},
+  {6579, 6580, 7, 0, 5.0f},
+  {6581, 6582, 1, 0, 5.527408f},
+  {6583, 6584, 1, 0, 15.640303f},
+  {6585, 6586, 1, 0, 3.0097222f},
+  {6587, 6588, 3, 0, 3.471103f},
+  {6589, 6590, 10, 0, 0.7023779f},
+  {6591, 6592, 5, 0, 16.600807f},
+  {6593, 6594, 10, 0, 0.72977334f},
+  {6595, 6596, 10, 0, 0.7425185f},
+  {6597, 6598, 1, 0, 6.2872834f},
+  {6599, 6600, 3, 0, 31.141062f},
+  {6601, 6602, 1, 0, 24.49413f},
+  {-1, -1, 0, 0, -0.10722991f},
+  {6603, 6604, 5, 0, 31.987387f},
+  {6605, 6606, 0, 0, 0.67f},
+  {6607, 6608, 3, 0, 20.722658f},
+  {6609, 6610, 0, 0, 0.67f},
+  {6611, 6612, 3, 0, 5.831505f},
+  {-1, -1, 0, 0, 0.0425704f},
+  {6613, 6614, 1, 0, 26.947685f},
+  {-1, -1, 0, 0, -0.08938016f},
+  {-1, -1, 0, 0, -0.033418823f},
+  {6615, 6616, 5, 0, 39.35422f},
+  {6617, 6618, 5, 0, 35.795372f},
+  {6619, 6620, 8, 0, 0.0f},
+  {6621, 6622, 1, 0, 7.1489305f},
+  {6623, 6624, 3, 0, 30.890335f},
+  {6625, 6626, 3, 0, 33.053555f},
+  {6627, 6628, 7, 0, 0.0f},
+  {6629, 6630, 10, 0, 0.66322905f},
+  {6631, 6632, 3, 0, 32.58397f},
+  {-1, -1, 0, 0, 0.02848339f},
+  {-1, -1, 0, 0, 0.0028995753f},
+  {-1, -1, 0, 0, 0.13137805f},
+  {6633, 6634, 3, 0, 4.169726f},
+  {6635, 6636, 3, 0, 46.39685f},
+  {-1, -1, 0, 0, 0.086686686f},
+  {-1, -1, 0, 0, 0.01768732f},
+  {6637, 6638, 10, 0, 0.70494336f},
+  {6639, 6640, 3, 0, 6.3485274f},
+  {6641, 6642, 5, 0, 38.121628f},
+  {-1, -1, 0, 0, -0.036460392f},
+  {6643, 6644, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, -0.02609296f},
+  {6645, 6646, 5, 0, 27.841745f},
+  {6647, 6648, 3, 0, 35.582645f},
+  {-1, -1, 0, 0, 0.088913344f},
+  {6649, 6650, 3, 0, 8.127335f},
+  {6651, 6652, 3, 0, 8.400394f},
+  {6653, 6654, 1, 0, 7.600024f},
+  {-1, -1, 0, 0, -0.0004671088f},
+  {-1, -1, 0, 0, -0.08145292f},
+  {-1, -1, 0, 0, 0.10523017f},
+  {-1, -1, 0, 0, 0.011502283f},
+  {-1, -1, 0, 0, -0.09227684f},
+  {-1, -1, 0, 0, -0.006421048f},
+  {-1, -1, 0, 0, -0.008111065f},
+  {-1, -1, 0, 0, 0.017856145f},
+  {-1, -1, 0, 0, -0.023767604f},
+  {-1, -1, 0, 0, 0.029891146f},
+  {-1, -1, 0, 0, -0.043526523f},
+  {-1, -1, 0, 0, 0.008467293f},
+  {-1, -1, 0, 0, 0.07590866f},
+  {-1, -1, 0, 0, -0.007876599f},
+  {-1, -1, 0, 0, 0.03920277f},
+  {-1, -1, 0, 0, -0.022818735f},
+  {-1, -1, 0, 0, 0.081037395f},
+  {-1, -1, 0, 0, 0.014999448f},
+  {-1, -1, 0, 0, 0.00984637f},
+  {-1, -1, 0, 0, -0.021177834f},
+  {-1, -1, 0, 0, 0.049509574f},
+  {-1, -1, 0, 0, 0.007394552f},
+  {-1, -1, 0, 0, -0.0071675377f},
+  {-1, -1, 0, 0, 0.029952437f},
+  {-1, -1, 0, 0, -0.013614555f},
+  {-1, -1, 0, 0, -0.057326037f},
+  {-1, -1, 0, 0, 0.002880134f},
+  {-1, -1, 0, 0, 0.044877023f},
+  {-1, -1, 0, 0, -0.04276487f},
+  {-1, -1, 0, 0, 0.020486116f},
+  {-1, -1, 0, 0, 0.033835188f},
+  {-1, -1, 0, 0, -0.001508172f},
+  {6656, 6657, 7, 0, 35.0f},
+  {6658, 6659, 10, 0, 0.6807112f},
+  {6660, 6661, 1, 0, 5.184029f},
+  {6662, 6663, 10, 0, 0.6625042f},
+  {6664, 6665, 10, 0, 0.7266901f},
+  {6666, 6667, 5, 0, 7.042338f},
+  {6668, 6669, 0, 0, 0.33f},
+  {6670, 6671, 1, 0, 4.777555f},
+  {6672, 6673, 1, 0, 28.756657f},
+  {6674, 6675, 5, 0, 24.183792f},
+  {6676, 6677, 10, 0, 0.7314549f},
+  {6678, 6679, 7, 0, 38.0f},
+  {-1, -1, 0, 0, -0.001844883f},
+  {-1, -1, 0, 0, 0.021026738f},
+  {6680, 6681, 3, 0, 7.280536f},
+  {6682, 6683, 1, 0, 4.324107f},
+  {6684, 6685, 1, 0, 5.0574846f},
+  {6686, 6687, 1, 0, 3.680515f},
+  {6688, 6689, 7, 0, 0.0f},
+  {6690, 6691, 5, 0, 17.832275f},
+  {6692, 6693, 9, 0, 1.0f},
+  {6694, 6695, 5, 0, 4.289015f},
+  {6696, 6697, 1, 0, 5.527408f},
+  {-1, -1, 0, 0, 0.041183624f},
+  {-1, -1, 0, 0, 0.006082249f},
+  {6698, 6699, 1, 0, 7.923471f},
+  {6700, 6701, 1, 0, 6.9175615f},
+  {6702, 6703, 10, 0, 0.6204305f},
+  {6704, 6705, 0, 0, 0.33f},
+  {6706, 6707, 8, 0, 1.0f},
+  {6708, 6709, 7, 0, 20.0f},
+  {6710, 6711, 3, 0, 27.330963f},
+  {6712, 6713, 7, 0, 15.0f},
+  {-1, -1, 0, 0, 0.097584516f},
+  {6714, 6715, 3, 0, 13.972971f},
+  {6716, 6717, 5, 0, 3.7302792f},
+  {6718, 6719, 7, 0, 0.0f},
+  {6720, 6721, 0, 0, 0.33f},
+  {6722, 6723, 3, 0, 27.815134f},
+  {6724, 6725, 10, 0, 0.72977334f},
+  {6726, 6727, 3, 0, 25.255108f},
+  {6728, 6729, 10, 0, 0.7425185f},
+  {6730, 6731, 1, 0, 6.2872834f},
+  {-1, -1, 0, 0, 0.00013256073f},
+  {-1, -1, 0, 0, 0.0042339326f},
+  {-1, -1, 0, 0, -0.0051617622f},
+  {-1, -1, 0, 0, -0.021486951f},
+  {-1, -1, 0, 0, -0.011290307f},
+  {-1, -1, 0, 0, 0.020674841f},
+  {-1, -1, 0, 0, -0.004282379f},
+  {-1, -1, 0, 0, 0.09389763f},
+  {-1, -1, 0, 0, -0.10226088f},
+  {-1, -1, 0, 0, -0.014267206f},
+  {-1, -1, 0, 0, -0.005508565f},
+  {-1, -1, 0, 0, 0.015917744f},
+  {-1, -1, 0, 0, -0.072243765f},
+  {-1, -1, 0, 0, 0.011708498f},
+  {-1, -1, 0, 0, -0.029446183f},
+  {-1, -1, 0, 0, 0.001456048f},
+  {-1, -1, 0, 0, -0.0198553f},
+  {-1, -1, 0, 0, 0.02768377f},
+  {-1, -1, 0, 0, 0.026026523f},
+  {-1, -1, 0, 0, 0.006164532f},
+  {-1, -1, 0, 0, 0.1382373f},
+  {-1, -1, 0, 0, 0.015661044f},
+  {-1, -1, 0, 0, 0.01919054f},
+  {-1, -1, 0, 0, -0.033465844f},
+  {-1, -1, 0, 0, 0.048479717f},
+  {-1, -1, 0, 0, -0.00952088f},
+  {-1, -1, 0, 0, -0.086676344f},
+  {-1, -1, 0, 0, -0.026822567f},
+  {-1, -1, 0, 0, 0.015533047f},
+  {-1, -1, 0, 0, -0.026993906f},
+  {-1, -1, 0, 0, 0.029520128f},
+  {-1, -1, 0, 0, -0.0066756345f},
+  {-1, -1, 0, 0, 0.024097575f},
+  {-1, -1, 0, 0, -0.0006451772f},
+  {6733, 6734, 5, 0, 7.5563846f},
+  {6735, 6736, 5, 0, 7.1080623f},
+  {6737, 6738, 5, 0, 7.906511f},
+  {6739, 6740, 5, 0, 7.042338f},
+  {6741, 6742, 10, 0, 0.6290384f},
+  {6743, 6744, 10, 0, 0.6094279f},
+  {6745, 6746, 7, 0, 25.0f},
+  {6747, 6748, 10, 0, 0.6115686f},
+  {6749, 6750, 3, 0, 5.203249f},
+  {6751, 6752, 7, 0, 14.0f},
+  {6753, 6754, 9, 0, 2.0f},
+  {6755, 6756, 3, 0, 3.892201f},
+  {6757, 6758, 10, 0, 0.9294512f},
+  {6759, 6760, 8, 0, 0.0f},
+  {6761, 6762, 7, 0, 31.0f},
+  {6763, 6764, 10, 0, 0.6035007f},
+  {6765, 6766, 10, 0, 0.9371148f},
+  {6767, 6768, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, 0.0167881f},
+  {-1, -1, 0, 0, -0.090981774f},
+  {6769, 6770, 1, 0, 6.4487634f},
+  {6771, 6772, 7, 0, 10.0f},
+  {6773, 6774, 7, 0, 18.0f},
+  {-1, -1, 0, 0, 0.041442063f},
+  {-1, -1, 0, 0, -0.013553858f},
+  {6775, 6776, 1, 0, 9.928482f},
+  {6777, 6778, 1, 0, 7.5773983f},
+  {6779, 6780, 5, 0, 41.56447f},
+  {6781, 6782, 3, 0, 11.121522f},
+  {6783, 6784, 1, 0, 3.0097222f},
+  {6785, 6786, 3, 0, 3.571177f},
+  {6787, 6788, 5, 0, 6.795224f},
+  {-1, -1, 0, 0, 0.076930456f},
+  {6789, 6790, 10, 0, 0.9338815f},
+  {6791, 6792, 1, 0, 7.2925344f},
+  {6793, 6794, 0, 0, 0.33f},
+  {6795, 6796, 9, 0, 2.0f},
+  {6797, 6798, 5, 0, 7.475979f},
+  {-1, -1, 0, 0, 0.0057940483f},
+  {6799, 6800, 10, 0, 0.699889f},
+  {6801, 6802, 3, 0, 7.694672f},
+  {6803, 6804, 8, 0, 0.0f},
+  {6805, 6806, 7, 0, 23.0f},
+  {6807, 6808, 8, 0, 0.0f},
+  {-1, -1, 0, 0, 0.028625203f},
+  {-1, -1, 0, 0, 0.03192727f},
+  {-1, -1, 0, 0, 0.005405617f},
+  {6809, 6810, 10, 0, 0.9192665f},
+  {6811, 6812, 5, 0, 43.30592f},
+  {6813, 6814, 3, 0, 9.366262f},
+  {6815, 6816, 3, 0, 30.312311f},
+  {6817, 6818, 5, 0, 8.34942f},
+  {6819, 6820, 3, 0, 4.2215447f},
+  {-1, -1, 0, 0, -0.0017526627f},
+  {-1, -1, 0, 0, -0.013364888f},
+  {-1, -1, 0, 0, 0.0009939325f},
+  {-1, -1, 0, 0, 0.03621839f},
+  {-1, -1, 0, 0, 6.9947986e-05f},
+  {-1, -1, 0, 0, 0.03236567f},
+  {-1, -1, 0, 0, 0.003894024f},
+  {-1, -1, 0, 0, -0.041280385f},
+  {-1, -1, 0, 0, 0.0050777434f},
+  {-1, -1, 0, 0, -0.006121588f},
+  {-1, -1, 0, 0, -0.02431612f},
+  {-1, -1, 0, 0, -0.09653001f},
+  {-1, -1, 0, 0, -0.032847658f},
+  {-1, -1, 0, 0, -0.006702614f},
+  {-1, -1, 0, 0, 0.00797267f},
+  {-1, -1, 0, 0, -0.03199188f},
+  {-1, -1, 0, 0, 0.0035735609f},
+  {-1, -1, 0, 0, 0.03405738f},
+  {-1, -1, 0, 0, -0.00868311f},
+  {-1, -1, 0, 0, 0.096991375f},
+  {-1, -1, 0, 0, 0.03584987f},
+  {-1, -1, 0, 0, 0.0033403398f},
+  {-1, -1, 0, 0, 0.0066613196f},
+  {-1, -1, 0, 0, -0.04811643f},
+  {-1, -1, 0, 0, 0.018802911f},
+  {-1, -1, 0, 0, -0.031353213f},
+  {-1, -1, 0, 0, -0.06956854f},
+  {-1, -1, 0, 0, -0.0036734913f},
+  {-1, -1, 0, 0, -0.004284023f},
+  {-1, -1, 0, 0, -0.05911584f},
+  {-1, -1, 0, 0, 0.006589185f},
+  {-1, -1, 0, 0, -0.0057058446f},
+  {-1, -1, 0, 0, 0.08592847f},
+  {-1, -1, 0, 0, 0.030956268f},
+  {-1, -1, 0, 0, 0.009843f},
+  {-1, -1, 0, 0, -0.011125184f},
+  {6822, 6823, 5, 0, 48.616074f},
+  {6824, 6825, 0, 0, 1.0f},
+  {6826, 6827, 7, 0, 0.0f},
+  {6828, 6829, 8, 0, 1.0f},
+  {6830, 6831, 3, 0, 5.203249f},
+  {-1, -1, 0, 0, -0.045289245f},
+  {6832, 6833, 5, 0, 49.09901f},
+  {6834, 6835, 3, 0, 7.704718f},
+  {6836, 6837, 3, 0, 7.0555444f},
+  {6838, 6839, 8, 0, 0.0f},
+  {6840, 6841, 3, 0, 5.8848395f},
+  {6842, 6843, 0, 0, 0.67f},
+  {6844, 6845, 1, 0, 18.662224f},
+  {6846, 6847, 3, 0, 7.517859f},
+  {6848, 6849, 3, 0, 8.006827f},
+  {6850, 6851, 7, 0, 6.0f},
+  {6852, 6853, 1, 0, 6.748502f},
+  {6854, 6855, 1, 0, 3.0097222f},
+  {6856, 6857, 1, 0, 6.891087f},
+  {6858, 6859, 1, 0, 6.514522f},
+  {6860, 6861, 3, 0, 6.7532005f},
+  {-1, -1, 0, 0, -0.01837535f},
+  {-1, -1, 0, 0, 0.0012366772f},
+  {-1, -1, 0, 0, 0.020591578f},
+  {-1, -1, 0, 0, 0.0053178906f},
+  {6862, 6863, 3, 0, 7.209053f},
+  {6864, 6865, 5, 0, 6.374478f},
+  {6866, 6867, 9, 0, 2.0f},
+  {6868, 6869, 3, 0, 8.306931f},
+  {6870, 6871, 1, 0, 7.4555297f},
+  {6872, 6873, 7, 0, 17.0f},
+  {6874, 6875, 3, 0, 9.420506f},
+  {6876, 6877, 3, 0, 8.127335f},
+  {-1, -1, 0, 0, 0.0067736628f},
+  {-1, -1, 0, 0, 0.077333f},
+  {6878, 6879, 10, 0, 0.7717356f},
+  {6880, 6881, 3, 0, 4.4160886f},
+  {6882, 6883, 10, 0, 0.6030454f},
+  {6884, 6885, 1, 0, 7.557411f},
+  {6886, 6887, 10, 0, 0.6375711f},
+  {6888, 6889, 1, 0, 6.4487634f},
+  {-1, -1, 0, 0, -0.0051444285f},
+  {-1, -1, 0, 0, 0.027952105f},
+  {-1, -1, 0, 0, -0.08055761f},
+  {-1, -1, 0, 0, -0.012824841f},
+  {-1, -1, 0, 0, 0.0062095164f},
+  {-1, -1, 0, 0, 0.07225537f},
+  {-1, -1, 0, 0, -0.03598195f},
+  {-1, -1, 0, 0, 0.0014843638f},
+  {-1, -1, 0, 0, 0.057452586f},
+  {-1, -1, 0, 0, -0.017307453f},
+  {-1, -1, 0, 0, -0.0022451773f},
+  {-1, -1, 0, 0, 0.031804774f},
+  {-1, -1, 0, 0, -0.050968774f},
+  {-1, -1, 0, 0, 0.0033345583f},
+  {-1, -1, 0, 0, 0.054558016f},
+  {-1, -1, 0, 0, 0.00026656996f},
+  {-1, -1, 0, 0, 0.03344774f},
+  {-1, -1, 0, 0, -0.00516588f},
+  {-1, -1, 0, 0, -0.03320198f},
+  {-1, -1, 0, 0, 0.03136904f},
+  {-1, -1, 0, 0, -0.0078297295f},
+  {-1, -1, 0, 0, -0.05558722f},
+  {-1, -1, 0, 0, 0.037749227f},
+  {-1, -1, 0, 0, -0.013807106f},
+  {-1, -1, 0, 0, 0.08392334f},
+  {-1, -1, 0, 0, 0.010504933f},
+  {-1, -1, 0, 0, -0.015064696f},
+  {-1, -1, 0, 0, 0.016004868f},
+  {6891, 6892, 5, 0, 10.198943f},
+  {6893, 6894, 10, 0, 0.78809464f},
+  {6895, 6896, 5, 0, 13.62889f},
+  {6897, 6898, 8, 0, 0.0f},
+  {6899, 6900, 10, 0, 0.7907391f},
+  {6901, 6902, 5, 0, 12.204893f},
+  {6903, 6904, 10, 0, 0.81645775f},
+  {6905, 6906, 5, 0, 5.165702f},
+  {6907, 6908, 10, 0, 0.7826082f},
+  {-1, -1, 0, 0, 0.07260262f},
+  {6909, 6910, 3, 0, 8.306931f},
+  {6911, 6912, 1, 0, 18.108318f},
+  {6913, 6914, 7, 0, 0.0f},
+  {6915, 6916, 10, 0, 0.8105315f},
+  {6917, 6918, 10, 0, 0.8232559f},
+  {6919, 6920, 5, 0, 4.5710354f},
+  {6921, 6922, 1, 0, 9.0107f},
+  {6923, 6924, 5, 0, 5.8571157f},
+  {6925, 6926, 3, 0, 7.209053f},
+  {6927, 6928, 3, 0, 7.437969f},
+  {6929, 6930, 3, 0, 8.926386f},
+  {6931, 6932, 10, 0, 0.83192253f},
+  {6933, 6934, 0, 0, 0.33f},
+  {6935, 6936, 1, 0, 3.0097222f},
+  {6937, 6938, 1, 0, 3.0097222f},
+  {6939, 6940, 5, 0, 15.899349f},
+  {6941, 6942, 2, 0, 1.0f},
+  {6943, 6944, 1, 0, 3.0097222f},
+  {6945, 6946, 5, 0, 14.283194f},
+  {6947, 6948, 9, 0, 1.0f},
+  {-1, -1, 0, 0, -0.1270668f},
+  {6949, 6950, 10, 0, 0.6455678f},
+  {-1, -1, 0, 0, -0.062486123f},
+  {6951, 6952, 5, 0, 5.7151575f},
+  {6953, 6954, 5, 0, 6.0687356f},
+  {6955, 6956, 0, 0, 0.33f},
+  {6957, 6958, 5, 0, 4.9658318f},
+  {6959, 6960, 10, 0, 0.7943989f},
+  {6961, 6962, 3, 0, 7.5852423f},
+  {6963, 6964, 0, 0, 0.67f},
+  {6965, 6966, 7, 0, 14.0f},
+  {6967, 6968, 10, 0, 0.75259924f},
+  {6969, 6970, 3, 0, 18.184193f},
+  {-1, -1, 0, 0, -0.01497227f},
+  {6971, 6972, 3, 0, 21.078184f},
+  {-1, -1, 0, 0, -0.020300914f},
+  {-1, -1, 0, 0, -0.102334134f},
+  {-1, -1, 0, 0, -0.058103796f},
+  {6973, 6974, 7, 0, 3.0f},
+  {6975, 6976, 7, 0, 0.0f},
+  {6977, 6978, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.052640345f},
+  {-1, -1, 0, 0, 0.016975535f},
+  {6979, 6980, 3, 0, 3.025743f},
+  {6981, 6982, 1, 0, 28.756657f},
+  {-1, -1, 0, 0, 0.043279555f},
+  {6983, 6984, 10, 0, 0.8278154f},
+  {-1, -1, 0, 0, -0.00077623356f},
+  {-1, -1, 0, 0, -0.048253424f},
+  {-1, -1, 0, 0, -0.008158862f},
+  {-1, -1, 0, 0, 0.03650469f},
+  {-1, -1, 0, 0, 0.0049141436f},
+  {-1, -1, 0, 0, 0.051877655f},
+  {-1, -1, 0, 0, -0.05675335f},
+  {-1, -1, 0, 0, -0.0015663166f},
+  {-1, -1, 0, 0, 0.0069261077f},
+  {-1, -1, 0, 0, -0.112377f},
+  {-1, -1, 0, 0, 0.047006354f},
+  {-1, -1, 0, 0, -0.025613094f},
+  {-1, -1, 0, 0, -0.055799454f},
+  {-1, -1, 0, 0, 0.0052386546f},
+  {-1, -1, 0, 0, -0.10013729f},
+  {-1, -1, 0, 0, -0.0109991515f},
+  {-1, -1, 0, 0, 0.018442784f},
+  {-1, -1, 0, 0, 0.096209474f},
+  {-1, -1, 0, 0, -0.0015642822f},
+  {-1, -1, 0, 0, 0.028379101f},
+  {-1, -1, 0, 0, -0.003002722f},
+  {-1, -1, 0, 0, -0.040175285f},
+  {-1, -1, 0, 0, -0.008927743f},
+  {-1, -1, 0, 0, 0.022618426f},
+  {-1, -1, 0, 0, 0.03926195f},
+  {-1, -1, 0, 0, 0.010325802f},
+  {-1, -1, 0, 0, 0.028939605f},
+  {-1, -1, 0, 0, -0.015401035f},
+  {-1, -1, 0, 0, -0.077707335f},
+  {-1, -1, 0, 0, 0.001862987f},
+  {-1, -1, 0, 0, 0.017432751f},
+  {-1, -1, 0, 0, -0.0020885244f},
+  {-1, -1, 0, 0, -0.11596209f},
+  {-1, -1, 0, 0, -0.026872588f},
+  {-1, -1, 0, 0, -0.02505118f},
+  {-1, -1, 0, 0, 0.020194871f},
+  {-1, -1, 0, 0, 0.020219503f},
+  {-1, -1, 0, 0, -0.00584061f},
+  {6986, 6987, 5, 0, 26.082285f},
+  {6988, 6989, 5, 0, 21.461452f},
+  {6990, 6991, 5, 0, 27.972656f},
+  {6992, 6993, 5, 0, 20.05952f},
+  {6994, 6995, 10, 0, 0.70130366f},
+  {6996, 6997, 7, 0, 7.0f},
+  {6998, 6999, 1, 0, 17.898617f},
+  {7000, 7001, 5, 0, 19.468435f},
+  {7002, 7003, 10, 0, 0.72699755f},
+  {7004, 7005, 3, 0, 31.513811f},
+  {7006, 7007, 10, 0, 0.7146721f},
+  {7008, 7009, 1, 0, 3.0097222f},
+  {7010, 7011, 10, 0, 0.7320588f},
+  {7012, 7013, 5, 0, 48.053078f},
+  {7014, 7015, 1, 0, 19.475634f},
+  {7016, 7017, 10, 0, 0.8007134f},
+  {7018, 7019, 1, 0, 3.0097222f},
+  {7020, 7021, 10, 0, 0.6361834f},
+  {7022, 7023, 3, 0, 3.025743f},
+  {7024, 7025, 7, 0, 3.0f},
+  {7026, 7027, 7, 0, 0.0f},
+  {7028, 7029, 8, 0, 1.0f},
+  {7030, 7031, 5, 0, 21.931599f},
+  {7032, 7033, 0, 0, 0.33f},
+  {7034, 7035, 3, 0, 18.418673f},
+  {7036, 7037, 1, 0, 3.4432666f},
+  {7038, 7039, 10, 0, 0.8928462f},
+  {7040, 7041, 7, 0, 0.0f},
+  {7042, 7043, 1, 0, 9.572734f},
+  {7044, 7045, 7, 0, 0.0f},
+  {7046, 7047, 5, 0, 39.780422f},
+  {7048, 7049, 10, 0, 0.7968596f},
+  {7050, 7051, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.089477375f},
+  {7052, 7053, 10, 0, 0.8920985f},
+  {7054, 7055, 1, 0, 36.65513f},
+  {7056, 7057, 10, 0, 0.7067397f},
+  {-1, -1, 0, 0, -0.10389718f},
+  {7058, 7059, 5, 0, 21.19731f},
+  {7060, 7061, 3, 0, 14.450272f},
+  {7062, 7063, 1, 0, 3.4432666f},
+  {-1, -1, 0, 0, 0.045580644f},
+  {7064, 7065, 3, 0, 37.69973f},
+  {7066, 7067, 0, 0, 0.33f},
+  {-1, -1, 0, 0, -0.0005824685f},
+  {7068, 7069, 1, 0, 6.042851f},
+  {7070, 7071, 1, 0, 11.328481f},
+  {-1, -1, 0, 0, -0.013578153f},
+  {-1, -1, 0, 0, -0.11833513f},
+  {7072, 7073, 5, 0, 26.488493f},
+  {7074, 7075, 1, 0, 37.34242f},
+  {-1, -1, 0, 0, 0.04156368f},
+  {7076, 7077, 0, 0, 0.67f},
+  {7078, 7079, 1, 0, 3.0097222f},
+  {7080, 7081, 0, 0, 0.67f},
+  {7082, 7083, 10, 0, 0.80199486f},
+  {7084, 7085, 3, 0, 3.8254256f},
+  {7086, 7087, 7, 0, 11.0f},
+  {7088, 7089, 5, 0, 48.616074f},
+  {7090, 7091, 3, 0, 39.509468f},
+  {7092, 7093, 10, 0, 0.60579807f},
+  {7094, 7095, 5, 0, 33.43385f},
+  {7096, 7097, 5, 0, 41.56447f},
+  {-1, -1, 0, 0, -0.00075854524f},
+  {-1, -1, 0, 0, -0.056630462f},
+  {-1, -1, 0, 0, 0.016258096f},
+  {-1, -1, 0, 0, 0.00044512525f},
+  {-1, -1, 0, 0, 0.020779012f},
+  {-1, -1, 0, 0, -0.010572943f},
+  {-1, -1, 0, 0, 0.043576352f},
+  {-1, -1, 0, 0, -0.006240064f},
+  {-1, -1, 0, 0, -0.023448056f},
+  {-1, -1, 0, 0, 0.009762558f},
+  {-1, -1, 0, 0, -0.032334466f},
+  {-1, -1, 0, 0, -0.0066638826f},
+  {-1, -1, 0, 0, -0.0836274f},
+  {-1, -1, 0, 0, -0.010950106f},
+  {-1, -1, 0, 0, 0.02275092f},
+  {-1, -1, 0, 0, -0.013964255f},
+  {-1, -1, 0, 0, 0.019613886f},
+  {-1, -1, 0, 0, -0.010733382f},
+  {-1, -1, 0, 0, 0.008696961f},
+  {-1, -1, 0, 0, 0.102807656f},
+  {-1, -1, 0, 0, 0.061888255f},
+  {-1, -1, 0, 0, 0.004749966f},
+  {-1, -1, 0, 0, -0.0062513226f},
+  {-1, -1, 0, 0, 0.029603884f},
+  {-1, -1, 0, 0, -0.013841772f},
+  {-1, -1, 0, 0, -0.039988853f},
+  {-1, -1, 0, 0, 0.012126519f},
+  {-1, -1, 0, 0, -0.01687119f},
+  {-1, -1, 0, 0, 0.0023262023f},
+  {-1, -1, 0, 0, 0.010174751f},
+  {-1, -1, 0, 0, -0.0014172078f},
+  {-1, -1, 0, 0, -0.021629067f},
+  {-1, -1, 0, 0, 0.005865431f},
+  {-1, -1, 0, 0, -0.007853699f},
+  {-1, -1, 0, 0, 0.038134463f},
+  {-1, -1, 0, 0, -0.01162043f},
+  {-1, -1, 0, 0, 0.017645916f},
+  {-1, -1, 0, 0, -0.0048493906f},
+  {-1, -1, 0, 0, -0.05015701f},
+  {-1, -1, 0, 0, 0.010874367f},
+  {-1, -1, 0, 0, 0.035264555f},
+  {-1, -1, 0, 0, -0.0167789f},
+  {-1, -1, 0, 0, -0.1154226f},
+  {-1, -1, 0, 0, 0.03154819f},
+  {-1, -1, 0, 0, -0.023521317f},
+  {-1, -1, 0, 0, 0.026424298f},
+  {-1, -1, 0, 0, 0.0019965803f},
+  {-1, -1, 0, 0, -0.02240443f},
+  {-1, -1, 0, 0, 0.035995807f},
+  {-1, -1, 0, 0, 0.0004272894f},
+  {7099, 7100, 10, 0, 0.6807112f},
+  {7101, 7102, 10, 0, 0.6625042f},
+  {7103, 7104, 10, 0, 0.7266901f},
+  {7105, 7106, 1, 0, 4.777555f},
+  {7107, 7108, 1, 0, 28.756657f},
+  {7109, 7110, 1, 0, 34.839024f},
+  {7111, 7112, 10, 0, 0.7314549f},
+  {7113, 7114, 1, 0, 4.324107f},
+  {7115, 7116, 1, 0, 5.0574846f},
+  {7117, 7118, 1, 0, 3.680515f},
+  {7119, 7120, 7, 0, 0.0f},
+  {7121, 7122, 10, 0, 0.70130366f},
+  {7123, 7124, 3, 0, 3.025743f},
+  {7125, 7126, 5, 0, 4.289015f},
+  {7127, 7128, 9, 0, 3.0f},
+  {7129, 7130, 10, 0, 0.6204305f},
+  {7131, 7132, 0, 0, 0.33f},
+  {7133, 7134, 8, 0, 1.0f},
+  {7135, 7136, 7, 0, 20.0f},
+  {7137, 7138, 3, 0, 27.330963f},
+  {7139, 7140, 1, 0, 6.1812973f},
+  {-1, -1, 0, 0, 0.09086989f},
+  {7141, 7142, 3, 0, 13.972971f},
+  {7143, 7144, 3, 0, 39.192276f},
+  {7145, 7146, 2, 0, 1.0f},
+  {7147, 7148, 5, 0, 39.35422f},
+  {7149, 7150, 5, 0, 28.571396f},
+  {7151, 7152, 10, 0, 0.72977334f},
+  {7153, 7154, 5, 0, 16.600807f},
+  {7155, 7156, 1, 0, 5.527408f},
+  {7157, 7158, 4, 0, 0.0f},
+  {7159, 7160, 10, 0, 0.6115686f},
+  {7161, 7162, 3, 0, 31.012392f},
+  {-1, -1, 0, 0, -0.0009049416f},
+  {-1, -1, 0, 0, 0.083879024f},
+  {-1, -1, 0, 0, -0.09401536f},
+  {-1, -1, 0, 0, -0.012647725f},
+  {7163, 7164, 1, 0, 6.663192f},
+  {7165, 7166, 10, 0, 0.64695257f},
+  {7167, 7168, 6, 0, 1.0f},
+  {-1, -1, 0, 0, 0.010973788f},
+  {7169, 7170, 10, 0, 0.6658525f},
+  {7171, 7172, 5, 0, 11.843356f},
+  {7173, 7174, 1, 0, 44.662483f},
+  {-1, -1, 0, 0, 0.024887169f},
+  {7175, 7176, 3, 0, 8.006827f},
+  {7177, 7178, 7, 0, 4.0f},
+  {7179, 7180, 3, 0, 3.471103f},
+  {7181, 7182, 3, 0, 5.831505f},
+  {-1, -1, 0, 0, -0.10154857f},
+  {-1, -1, 0, 0, 0.008784748f},
+  {-1, -1, 0, 0, 0.026588723f},
+  {7183, 7184, 7, 0, 4.0f},
+  {-1, -1, 0, 0, -0.07885978f},
+  {-1, -1, 0, 0, -0.026480451f},
+  {7185, 7186, 1, 0, 3.1848156f},
+  {7187, 7188, 3, 0, 25.255108f},
+  {7189, 7190, 10, 0, 0.7425185f},
+  {7191, 7192, 1, 0, 6.2872834f},
+  {7193, 7194, 10, 0, 0.8561354f},
+  {7195, 7196, 3, 0, 4.0969954f},
+  {-1, -1, 0, 0, 0.00025770997f},
+  {-1, -1, 0, 0, -0.077072605f},
+  {-1, -1, 0, 0, 0.010428611f},
+  {-1, -1, 0, 0, 0.0742443f},
+  {-1, -1, 0, 0, -0.017016076f},
+  {-1, -1, 0, 0, -0.0016812381f},
+  {-1, -1, 0, 0, 0.0041563096f},
+  {-1, -1, 0, 0, 0.068947755f},
+  {-1, -1, 0, 0, -0.07512075f},
+  {-1, -1, 0, 0, -0.028485108f},
+  {-1, -1, 0, 0, 0.05942273f},
+  {-1, -1, 0, 0, -0.02485994f},
+  {-1, -1, 0, 0, -0.036257766f},
+  {-1, -1, 0, 0, -0.0027161431f},
+  {-1, -1, 0, 0, -0.030450081f},
+  {-1, -1, 0, 0, 0.016902972f},
+  {-1, -1, 0, 0, 0.014748952f},
+  {-1, -1, 0, 0, -0.019767955f},
+  {-1, -1, 0, 0, 0.06671982f},
+  {-1, -1, 0, 0, 0.0059250672f},
+  {-1, -1, 0, 0, 0.11008298f},
+  {-1, -1, 0, 0, 0.019253777f},
+  {-1, -1, 0, 0, -0.012512925f},
+  {-1, -1, 0, 0, 0.022576457f},
+  {-1, -1, 0, 0, -0.02932078f},
+  {-1, -1, 0, 0, -0.0006008029f},
+  {-1, -1, 0, 0, -0.021501733f},
+  {-1, -1, 0, 0, 0.03154847f},
+  {-1, -1, 0, 0, 0.0021346053f},
+  {-1, -1, 0, 0, -0.032044414f},
+  {-1, -1, 0, 0, 0.026796205f},
+  {-1, -1, 0, 0, -0.007822211f},
+  {-1, -1, 0, 0, 0.02215277f},
+  {-1, -1, 0, 0, -0.0013921483f},
+  {-1, -1, 0, 0, -0.027574673f},
+  {-1, -1, 0, 0, 0.006775131f},
+  {-1, -1, 0, 0, 0.04621552f},
+  {-1, -1, 0, 0, 0.0076767355f},
+  {7198, 7199, 5, 0, 48.616074f},
+  {7200, 7201, 1, 0, 49.252625f},
+  {7202, 7203, 7, 0, 0.0f},
+  {7204, 7205, 5, 0, 40.878075f},
+  {7206, 7207, 3, 0, 14.556309f},
+  {-1, -1, 0, 0, -0.039685734f},
+  {7208, 7209, 5, 0, 49.09901f},
+  {7210, 7211, 5, 0, 35.795372f},
+  {7212, 7213, 1, 0, 4.267824f},
+  {-1, -1, 0, 0, -0.003487611f},
+  {-1, -1, 0, 0, -0.024181752f},
+  {7214, 7215, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.015759805f},
+  {7216, 7217, 5, 0, 34.90521f},
+  {7218, 7219, 3, 0, 36.098396f},
+  {7220, 7221, 8, 0, 0.0f},
+  {7222, 7223, 0, 0, 0.67f},
+  {-1, -1, 0, 0, -0.016155768f},
+  {-1, -1, 0, 0, 0.00081958773f},
+  {7224, 7225, 5, 0, 33.43385f},
+  {7226, 7227, 1, 0, 29.692577f},
+  {7228, 7229, 7, 0, 4.0f},
+  {7230, 7231, 3, 0, 38.03864f},
+  {7232, 7233, 5, 0, 45.070286f},
+  {7234, 7235, 1, 0, 3.534487f},
+  {7236, 7237, 3, 0, 39.509468f},
+  {7238, 7239, 1, 0, 8.584065f},
+  {-1, -1, 0, 0, 0.0006226039f},
+  {-1, -1, 0, 0, -0.018578652f},
+  {-1, -1, 0, 0, 0.038178045f},
+  {-1, -1, 0, 0, -0.024951458f},
+  {-1, -1, 0, 0, -0.017625041f},
+  {-1, -1, 0, 0, 0.017357415f},
+  {-1, -1, 0, 0, -0.07598141f},
+  {-1, -1, 0, 0, -0.025655014f},
+  {-1, -1, 0, 0, -0.06254485f},
+  {-1, -1, 0, 0, -0.010577806f},
+  {-1, -1, 0, 0, 0.011098055f},
+  {-1, -1, 0, 0, -0.04714365f},
+  {-1, -1, 0, 0, 0.001990748f},
+  {-1, -1, 0, 0, 0.020230196f},
+  {-1, -1, 0, 0, 0.07243283f},
+  {-1, -1, 0, 0, -0.009436671f},
+  {7241, 7242, 7, 0, 34.0f},
+  {7243, 7244, 10, 0, 0.6807112f},
+  {7245, 7246, 1, 0, 5.184029f},
+  {7247, 7248, 10, 0, 0.66068304f},
+  {7249, 7250, 10, 0, 0.7266901f},
+  {7251, 7252, 5, 0, 7.042338f},
+  {7253, 7254, 1, 0, 8.214931f},
+  {7255, 7256, 1, 0, 15.640303f},
+  {7257, 7258, 1, 0, 28.756657f},
+  {7259, 7260, 5, 0, 24.183792f},
+  {7261, 7262, 10, 0, 0.7314549f},
+  {7263, 7264, 7, 0, 38.0f},
+  {-1, -1, 0, 0, -0.0039896965f},
+  {7265, 7266, 1, 0, 8.1919365f},
+  {7267, 7268, 1, 0, 8.533123f},
+  {7269, 7270, 1, 0, 9.470373f},
+  {7271, 7272, 10, 0, 0.6385671f},
+  {7273, 7274, 0, 0, 0.67f},
+  {7275, 7276, 7, 0, 0.0f},
+  {7277, 7278, 5, 0, 17.832275f},
+  {7279, 7280, 5, 0, 24.380795f},
+  {7281, 7282, 5, 0, 4.289015f},
+  {7283, 7284, 3, 0, 3.025743f},
+  {7285, 7286, 7, 0, 35.0f},
+  {-1, -1, 0, 0, 0.002900696f},
+  {7287, 7288, 1, 0, 7.923471f},
+  {-1, -1, 0, 0, -0.020466805f},
+  {-1, -1, 0, 0, 0.020651754f},
+  {-1, -1, 0, 0, 0.004490725f},
+  {7289, 7290, 10, 0, 0.6204305f},
+  {7291, 7292, 8, 0, 0.0f},
+  {7293, 7294, 1, 0, 21.909319f},
+  {7295, 7296, 7, 0, 7.0f},
+  {7297, 7298, 3, 0, 27.330963f},
+  {7299, 7300, 10, 0, 0.6658525f},
+  {-1, -1, 0, 0, 0.08472478f},
+  {7301, 7302, 3, 0, 13.972971f},
+  {7303, 7304, 5, 0, 12.030727f},
+  {7305, 7306, 7, 0, 0.0f},
+  {-1, -1, 0, 0, -0.09312546f},
+  {7307, 7308, 1, 0, 19.314367f},
+  {7309, 7310, 10, 0, 0.72977334f},
+  {7311, 7312, 5, 0, 6.694863f},
+  {7313, 7314, 8, 0, 1.0f},
+  {7315, 7316, 3, 0, 3.2485092f},
+  {-1, -1, 0, 0, 0.003505516f},
+  {-1, -1, 0, 0, 0.03650673f},
+  {7317, 7318, 1, 0, 7.834018f},
+  {-1, -1, 0, 0, 0.0017511368f},
+  {-1, -1, 0, 0, -0.0067549213f},
+  {-1, -1, 0, 0, 0.010446348f},
+  {-1, -1, 0, 0, -0.032032218f},
+  {-1, -1, 0, 0, 0.04185358f},
+  {-1, -1, 0, 0, -0.022230264f},
+  {-1, -1, 0, 0, 0.008668867f},
+  {-1, -1, 0, 0, -0.03912943f},
+  {-1, -1, 0, 0, 0.0070343018f},
+  {-1, -1, 0, 0, -0.058751144f},
+  {-1, -1, 0, 0, -0.007542738f},
+  {-1, -1, 0, 0, 0.016658625f},
+  {-1, -1, 0, 0, -0.022243045f},
+  {-1, -1, 0, 0, -0.015675632f},
+  {-1, -1, 0, 0, 0.022483742f},
+  {-1, -1, 0, 0, 0.013157315f},
+  {-1, -1, 0, 0, -0.023677325f},
+  {-1, -1, 0, 0, 0.114465594f},
+  {-1, -1, 0, 0, 0.010848639f},
+  {-1, -1, 0, 0, 0.015455051f},
+  {-1, -1, 0, 0, -0.018439556f},
+  {-1, -1, 0, 0, -0.07234f},
+  {-1, -1, 0, 0, -0.024756592f},
+  {-1, -1, 0, 0, 0.03048338f},
+  {-1, -1, 0, 0, -0.012221213f},
+  {-1, -1, 0, 0, -0.012266595f},
+  {-1, -1, 0, 0, 0.01149214f},
+  {-1, -1, 0, 0, 0.05133095f},
+  {-1, -1, 0, 0, 0.00027809865f},
+  {-1, -1, 0, 0, -0.005218697f},
+  {-1, -1, 0, 0, -0.0011244774f},
+  {7320, 7321, 1, 0, 49.252625f},
+  {7322, 7323, 1, 0, 38.58884f},
+  {7324, 7325, 3, 0, 14.556309f},
+  {7326, 7327, 3, 0, 7.0890985f},
+  {7328, 7329, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, -0.0033271313f},
+  {-1, -1, 0, 0, -0.022437261f},
+  {7330, 7331, 3, 0, 7.0185437f},
+  {7332, 7333, 3, 0, 7.209053f},
+  {7334, 7335, 8, 0, 1.0f},
+  {7336, 7337, 7, 0, 0.0f},
+  {7338, 7339, 10, 0, 0.7671752f},
+  {7340, 7341, 2, 0, 0.0f},
+  {7342, 7343, 5, 0, 3.2776327f},
+  {7344, 7345, 10, 0, 0.905279f},
+  {7346, 7347, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.042847086f},
+  {7348, 7349, 3, 0, 12.934116f},
+  {7350, 7351, 10, 0, 0.87471986f},
+  {7352, 7353, 10, 0, 0.7665948f},
+  {7354, 7355, 10, 0, 0.7698832f},
+  {-1, -1, 0, 0, 0.13635115f},
+  {7356, 7357, 7, 0, 11.0f},
+  {7358, 7359, 7, 0, 22.0f},
+  {7360, 7361, 7, 0, 13.0f},
+  {7362, 7363, 3, 0, 7.384106f},
+  {7364, 7365, 7, 0, 0.0f},
+  {7366, 7367, 1, 0, 39.8811f},
+  {7368, 7369, 1, 0, 46.55334f},
+  {-1, -1, 0, 0, 0.020564282f},
+  {-1, -1, 0, 0, 0.06560727f},
+  {7370, 7371, 3, 0, 45.69609f},
+  {7372, 7373, 3, 0, 46.052345f},
+  {-1, -1, 0, 0, 0.004202042f},
+  {-1, -1, 0, 0, 0.079457454f},
+  {-1, -1, 0, 0, -0.08344749f},
+  {-1, -1, 0, 0, -0.0013046296f},
+  {-1, -1, 0, 0, -0.010157904f},
+  {-1, -1, 0, 0, 0.03370234f},
+  {-1, -1, 0, 0, -0.08240577f},
+  {-1, -1, 0, 0, 0.011967373f},
+  {-1, -1, 0, 0, -0.026299724f},
+  {-1, -1, 0, 0, 0.0062871934f},
+  {-1, -1, 0, 0, 0.028764872f},
+  {-1, -1, 0, 0, -0.003256912f},
+  {-1, -1, 0, 0, -0.021159975f},
+  {-1, -1, 0, 0, 0.018955613f},
+  {-1, -1, 0, 0, -0.003995109f},
+  {-1, -1, 0, 0, -0.11154751f},
+  {-1, -1, 0, 0, -0.018361434f},
+  {-1, -1, 0, 0, 0.019338729f},
+  {-1, -1, 0, 0, 0.017857948f},
+  {-1, -1, 0, 0, -0.021992067f},
+  {-1, -1, 0, 0, -0.02058377f},
+  {-1, -1, 0, 0, 0.015336469f},
+  {7375, 7376, 5, 0, 48.616074f},
+  {7377, 7378, 7, 0, 0.0f},
+  {7379, 7380, 7, 0, 0.0f},
+  {7381, 7382, 5, 0, 43.96941f},
+  {7383, 7384, 7, 0, 2.0f},
+  {7385, 7386, 1, 0, 3.166155f},
+  {7387, 7388, 5, 0, 49.09901f},
+  {7389, 7390, 5, 0, 36.127365f},
+  {7391, 7392, 3, 0, 27.815134f},
+  {7393, 7394, 1, 0, 11.328481f},
+  {7395, 7396, 1, 0, 8.989843f},
+  {-1, -1, 0, 0, -0.044735767f},
+  {-1, -1, 0, 0, -0.014089823f},
+  {7397, 7398, 0, 0, 0.67f},
+  {7399, 7400, 1, 0, 18.662224f},
+  {7401, 7402, 5, 0, 28.383476f},
+  {7403, 7404, 3, 0, 12.469329f},
+  {7405, 7406, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.0512594f},
+  {7407, 7408, 9, 0, 1.0f},
+  {7409, 7410, 3, 0, 43.67558f},
+  {7411, 7412, 7, 0, 5.0f},
+  {7413, 7414, 5, 0, 4.201236f},
+  {-1, -1, 0, 0, -0.015199042f},
+  {-1, -1, 0, 0, 0.0009062767f},
+  {-1, -1, 0, 0, 0.0161757f},
+  {-1, -1, 0, 0, 0.0041605295f},
+  {7415, 7416, 1, 0, 38.15698f},
+  {7417, 7418, 10, 0, 0.6795604f},
+  {7419, 7420, 10, 0, 0.7067397f},
+  {7421, 7422, 3, 0, 16.209831f},
+  {7423, 7424, 1, 0, 38.15698f},
+  {7425, 7426, 3, 0, 11.516407f},
+  {7427, 7428, 10, 0, 0.9030895f},
+  {-1, -1, 0, 0, -0.057801735f},
+  {7429, 7430, 8, 0, 0.0f},
+  {7431, 7432, 10, 0, 0.6030454f},
+  {7433, 7434, 9, 0, 1.0f},
+  {7435, 7436, 5, 0, 4.6127315f},
+  {7437, 7438, 7, 0, 9.0f},
+  {7439, 7440, 1, 0, 9.145805f},
+  {-1, -1, 0, 0, -0.00040864857f},
+  {-1, -1, 0, 0, 0.049497556f},
+  {-1, -1, 0, 0, 0.09181712f},
+  {-1, -1, 0, 0, 0.025758678f},
+  {-1, -1, 0, 0, -0.029923124f},
+  {-1, -1, 0, 0, -0.09061175f},
+  {-1, -1, 0, 0, 0.07732309f},
+  {-1, -1, 0, 0, -0.020825146f},
+  {-1, -1, 0, 0, 0.10653347f},
+  {-1, -1, 0, 0, -0.0037953616f},
+  {-1, -1, 0, 0, 0.012080511f},
+  {-1, -1, 0, 0, -0.02088294f},
+  {-1, -1, 0, 0, -0.0219487f},
+  {-1, -1, 0, 0, 0.008867824f},
+  {-1, -1, 0, 0, 0.01997607f},
+  {-1, -1, 0, 0, -0.0030801464f},
+  {-1, -1, 0, 0, 0.008251035f},
+  {-1, -1, 0, 0, -0.024925334f},
+  {-1, -1, 0, 0, 0.0020993275f},
+  {-1, -1, 0, 0, -0.093415625f},
+  {-1, -1, 0, 0, -0.0052323784f},
+  {-1, -1, 0, 0, 0.0021435185f},
+  {-1, -1, 0, 0, 0.0044526826f},
+  {-1, -1, 0, 0, 0.034772374f},
+  {-1, -1, 0, 0, 0.03970633f},
+  {-1, -1, 0, 0, -0.0021315543f},
+  {7442, 7443, 10, 0, 0.6807112f},
+  {7444, 7445, 10, 0, 0.6658525f},
+  {7446, 7447, 10, 0, 0.7266901f},
+  {7448, 7449, 1, 0, 4.777555f},
+  {7450, 7451, 1, 0, 28.756657f},
+  {7452, 7453, 5, 0, 23.136189f},
+  {7454, 7455, 10, 0, 0.7314549f},
+  {7456, 7457, 1, 0, 4.324107f},
+  {7458, 7459, 1, 0, 5.0574846f},
+  {7460, 7461, 1, 0, 4.324107f},
+  {7462, 7463, 7, 0, 0.0f},
+  {7464, 7465, 5, 0, 17.832275f},
+  {7466, 7467, 3, 0, 12.934116f},
+  {7468, 7469, 5, 0, 4.289015f},
+  {7470, 7471, 9, 0, 3.0f},
+  {7472, 7473, 10, 0, 0.6204305f},
+  {7474, 7475, 0, 0, 0.33f},
+  {7476, 7477, 8, 0, 1.0f},
+  {7478, 7479, 7, 0, 20.0f},
+  {7480, 7481, 3, 0, 27.330963f},
+  {7482, 7483, 1, 0, 20.669693f},
+  {-1, -1, 0, 0, 0.07089647f},
+  {7484, 7485, 10, 0, 0.6714846f},
+  {7486, 7487, 3, 0, 25.695927f},
+  {7488, 7489, 7, 0, 0.0f},
+  {7490, 7491, 0, 0, 0.33f},
+  {7492, 7493, 3, 0, 27.815134f},
+  {7494, 7495, 3, 0, 3.025743f},
+  {7496, 7497, 5, 0, 6.694863f},
+  {7498, 7499, 3, 0, 8.306931f},
+  {7500, 7501, 3, 0, 3.025743f},
+  {7502, 7503, 10, 0, 0.6115686f},
+  {7504, 7505, 3, 0, 31.012392f},
+  {-1, -1, 0, 0, -0.00135746f},
+  {-1, -1, 0, 0, 0.076835f},
+  {-1, -1, 0, 0, -0.08740554f},
+  {-1, -1, 0, 0, -0.012026024f},
+  {7506, 7507, 10, 0, 0.6375711f},
+  {7508, 7509, 10, 0, 0.64695257f},
+  {7510, 7511, 7, 0, 25.0f},
+  {7512, 7513, 1, 0, 3.0097222f},
+  {7514, 7515, 1, 0, 8.214931f},
+  {-1, -1, 0, 0, -0.050626904f},
+  {-1, -1, 0, 0, 0.02429012f},
+  {7516, 7517, 3, 0, 13.972971f},
+  {7518, 7519, 3, 0, 9.227634f},
+  {7520, 7521, 3, 0, 46.39685f},
+  {-1, -1, 0, 0, 0.117194235f},
+  {7522, 7523, 10, 0, 0.71037996f},
+  {7524, 7525, 1, 0, 31.168713f},
+  {7526, 7527, 7, 0, 2.0f},
+  {7528, 7529, 7, 0, 0.0f},
+  {7530, 7531, 3, 0, 39.192276f},
+  {-1, -1, 0, 0, -0.021477127f},
+  {-1, -1, 0, 0, -0.06663304f},
+  {7532, 7533, 0, 0, 1.0f},
+  {7534, 7535, 9, 0, 1.0f},
+  {7536, 7537, 3, 0, 7.0890985f},
+  {7538, 7539, 3, 0, 8.966423f},
+  {7540, 7541, 1, 0, 3.0097222f},
+  {7542, 7543, 3, 0, 3.8254256f},
+  {-1, -1, 0, 0, 0.00085965235f},
+  {-1, -1, 0, 0, -0.06869363f},
+  {-1, -1, 0, 0, 0.0075238603f},
+  {-1, -1, 0, 0, 0.066754416f},
+  {-1, -1, 0, 0, -0.0008267347f},
+  {-1, -1, 0, 0, -0.015050979f},
+  {-1, -1, 0, 0, 0.0032609508f},
+  {-1, -1, 0, 0, 0.051726807f},
+  {-1, -1, 0, 0, -0.062425673f},
+  {-1, -1, 0, 0, -0.0093482975f},
+  {-1, -1, 0, 0, 0.010302973f},
+  {-1, -1, 0, 0, -0.0033010484f},
+  {-1, -1, 0, 0, -0.018638853f},
+  {-1, -1, 0, 0, 0.0068396144f},
+  {-1, -1, 0, 0, -0.019904502f},
+  {-1, -1, 0, 0, 0.0076615335f},
+  {-1, -1, 0, 0, 0.011222124f},
+  {-1, -1, 0, 0, -0.021690238f},
+  {-1, -1, 0, 0, 0.03349331f},
+  {-1, -1, 0, 0, -0.009460974f},
+  {-1, -1, 0, 0, -0.000947504f},
+  {-1, -1, 0, 0, 0.044915374f},
+  {-1, -1, 0, 0, 0.021345068f},
+  {-1, -1, 0, 0, 0.004320431f},
+  {-1, -1, 0, 0, -0.0817061f},
+  {-1, -1, 0, 0, 0.0012684155f},
+  {-1, -1, 0, 0, 0.08735535f},
+  {-1, -1, 0, 0, 0.009211845f},
+  {-1, -1, 0, 0, -0.025078297f},
+  {-1, -1, 0, 0, 0.016797705f},
+  {-1, -1, 0, 0, 0.058119774f},
+  {-1, -1, 0, 0, -0.011642328f},
+  {-1, -1, 0, 0, 0.0024183905f},
+  {-1, -1, 0, 0, -0.036913007f},
+  {-1, -1, 0, 0, -0.0011178302f},
+  {-1, -1, 0, 0, -0.019212296f},
+  {-1, -1, 0, 0, 0.03397105f},
+  {-1, -1, 0, 0, -0.00012096904f},
+  {-1, -1, 0, 0, 0.01236545f},
+  {-1, -1, 0, 0, -0.018947165f},
+  {-1, -1, 0, 0, 0.054517396f},
+  {-1, -1, 0, 0, 0.008586768f},
+  {7545, 7546, 7, 0, 36.0f},
+  {7547, 7548, 10, 0, 0.6807112f},
+  {7549, 7550, 1, 0, 5.184029f},
+  {7551, 7552, 10, 0, 0.66068304f},
+  {7553, 7554, 10, 0, 0.7266901f},
+  {7555, 7556, 7, 0, 38.0f},
+  {7557, 7558, 0, 0, 0.33f},
+  {7559, 7560, 1, 0, 15.640303f},
+  {7561, 7562, 1, 0, 28.756657f},
+  {7563, 7564, 1, 0, 34.839024f},
+  {7565, 7566, 10, 0, 0.78809464f},
+  {-1, -1, 0, 0, 0.034811687f},
+  {-1, -1, 0, 0, 0.0022459985f},
+  {-1, -1, 0, 0, 0.019191742f},
+  {7567, 7568, 1, 0, 8.1919365f},
+  {7569, 7570, 1, 0, 9.470373f},
+  {7571, 7572, 10, 0, 0.6385671f},
+  {7573, 7574, 7, 0, 15.0f},
+  {7575, 7576, 7, 0, 0.0f},
+  {7577, 7578, 10, 0, 0.70130366f},
+  {7579, 7580, 3, 0, 3.025743f},
+  {7581, 7582, 1, 0, 37.049507f},
+  {7583, 7584, 10, 0, 0.7907391f},
+  {7585, 7586, 1, 0, 6.9175615f},
+  {-1, -1, 0, 0, -0.019580174f},
+  {7587, 7588, 10, 0, 0.6204305f},
+  {7589, 7590, 8, 0, 0.0f},
+  {7591, 7592, 7, 0, 0.0f},
+  {7593, 7594, 7, 0, 7.0f},
+  {7595, 7596, 3, 0, 27.330963f},
+  {7597, 7598, 10, 0, 0.6658525f},
+  {-1, -1, 0, 0, 0.06617003f},
+  {7599, 7600, 3, 0, 13.972971f},
+  {7601, 7602, 3, 0, 39.192276f},
+  {7603, 7604, 2, 0, 1.0f},
+  {7605, 7606, 5, 0, 39.35422f},
+  {7607, 7608, 5, 0, 28.571396f},
+  {7609, 7610, 3, 0, 29.96273f},
+  {7611, 7612, 1, 0, 41.283264f},
+  {7613, 7614, 0, 0, 0.67f},
+  {7615, 7616, 1, 0, 5.742777f},
+  {-1, -1, 0, 0, -0.003863907f},
+  {-1, -1, 0, 0, 0.0011922837f},
+  {-1, -1, 0, 0, -0.005941885f},
+  {-1, -1, 0, 0, 0.008809165f},
+  {-1, -1, 0, 0, -0.029227743f},
+  {-1, -1, 0, 0, 0.03755792f},
+  {-1, -1, 0, 0, -0.031779867f},
+  {-1, -1, 0, 0, 0.004440184f},
+  {-1, -1, 0, 0, -0.033809092f},
+  {-1, -1, 0, 0, 0.007375336f},
+  {-1, -1, 0, 0, -0.036169548f},
+  {-1, -1, 0, 0, -0.0063369134f},
+  {-1, -1, 0, 0, 0.026631653f},
+  {-1, -1, 0, 0, -0.020313501f},
+  {-1, -1, 0, 0, -0.013226843f},
+  {-1, -1, 0, 0, 0.018739795f},
+  {-1, -1, 0, 0, -0.0019895053f},
+  {-1, -1, 0, 0, 0.039983805f},
+  {-1, -1, 0, 0, 0.037762355f},
+  {-1, -1, 0, 0, 0.005164646f},
+  {-1, -1, 0, 0, -0.08448412f},
+  {-1, -1, 0, 0, 0.009360862f},
+  {-1, -1, 0, 0, 0.020569492f},
+  {-1, -1, 0, 0, -0.013965075f},
+  {-1, -1, 0, 0, -0.0037325446f},
+  {-1, -1, 0, 0, -0.029643169f},
+  {-1, -1, 0, 0, 0.053429365f},
+  {-1, -1, 0, 0, 0.0024794852f},
+  {-1, -1, 0, 0, 0.06704347f},
+  {-1, -1, 0, 0, -0.009704733f},
+  {-1, -1, 0, 0, -0.003847712f},
+  {-1, -1, 0, 0, 0.0040469314f},
+  {7618, 7619, 1, 0, 49.252625f},
+  {7620, 7621, 5, 0, 48.616074f},
+  {7622, 7623, 3, 0, 14.556309f},
+  {7624, 7625, 5, 0, 40.878075f},
+  {7626, 7627, 1, 0, 3.166155f},
+  {-1, -1, 0, 0, -0.003579688f},
+  {-1, -1, 0, 0, -0.020682355f},
+  {7628, 7629, 5, 0, 35.795372f},
+  {7630, 7631, 1, 0, 4.267824f},
+  {-1, -1, 0, 0, -0.042169347f},
+  {7632, 7633, 5, 0, 49.09901f},
+  {7634, 7635, 5, 0, 34.90521f},
+  {7636, 7637, 3, 0, 36.098396f},
+  {7638, 7639, 8, 0, 0.0f},
+  {7640, 7641, 0, 0, 0.67f},
+  {7642, 7643, 0, 0, 0.67f},
+  {7644, 7645, 0, 0, 0.67f},
+  {7646, 7647, 5, 0, 33.43385f},
+  {7648, 7649, 1, 0, 29.692577f},
+  {7650, 7651, 7, 0, 4.0f},
+  {7652, 7653, 3, 0, 38.03864f},
+  {7654, 7655, 5, 0, 45.070286f},
+  {7656, 7657, 10, 0, 0.718495f},
+  {7658, 7659, 3, 0, 39.509468f},
+  {7660, 7661, 1, 0, 8.584065f},
+  {-1, -1, 0, 0, -0.015455897f},
+  {-1, -1, 0, 0, 0.0011994363f},
+  {7662, 7663, 1, 0, 18.662224f},
+  {-1, -1, 0, 0, -0.009219504f},
+  {-1, -1, 0, 0, 0.00043127788f},
+  {-1, -1, 0, 0, -0.016117949f},
+  {-1, -1, 0, 0, 0.032447845f},
+  {-1, -1, 0, 0, -0.020360978f},
+  {-1, -1, 0, 0, -0.012918348f},
+  {-1, -1, 0, 0, 0.015345352f},
+  {-1, -1, 0, 0, -0.06660276f},
+  {-1, -1, 0, 0, -0.021234429f},
+  {-1, -1, 0, 0, -0.056901842f},
+  {-1, -1, 0, 0, -0.01068875f},
+  {-1, -1, 0, 0, 0.024988651f},
+  {-1, -1, 0, 0, -0.016442282f},
+  {-1, -1, 0, 0, 0.0020578136f},
+  {-1, -1, 0, 0, 0.018673098f},
+  {-1, -1, 0, 0, 0.06357491f},
+  {-1, -1, 0, 0, -0.0077529587f},
+  {-1, -1, 0, 0, 0.014082789f},
+  {-1, -1, 0, 0, 0.0037718297f},
+  {7665, 7666, 3, 0, 46.39685f},
+  {7667, 7668, 3, 0, 39.509468f},
+  {7669, 7670, 10, 0, 0.85929304f},
+  {7671, 7672, 3, 0, 38.579594f},
+  {7673, 7674, 3, 0, 40.47511f},
+  {7675, 7676, 5, 0, 45.385487f},
+  {7677, 7678, 0, 0, 0.33f},
+  {7679, 7680, 10, 0, 0.6030454f},
+  {7681, 7682, 10, 0, 0.86107147f},
+  {7683, 7684, 8, 0, 1.0f},
+  {7685, 7686, 3, 0, 41.45132f},
+  {7687, 7688, 10, 0, 0.61589104f},
+  {-1, -1, 0, 0, 0.020350536f},
+  {-1, -1, 0, 0, -0.01431332f},
+  {7689, 7690, 1, 0, 3.7838314f},
+  {7691, 7692, 1, 0, 6.663192f},
+  {7693, 7694, 10, 0, 0.6094279f},
+  {7695, 7696, 1, 0, 37.049507f},
+  {-1, -1, 0, 0, -0.071399f},
+  {7697, 7698, 10, 0, 0.7420888f},
+  {7699, 7700, 1, 0, 25.188354f},
+  {7701, 7702, 10, 0, 0.72699755f},
+  {7703, 7704, 3, 0, 43.67558f},
+  {7705, 7706, 1, 0, 5.9098606f},
+  {7707, 7708, 1, 0, 4.1625104f},
+  {-1, -1, 0, 0, -0.0033889771f},
+  {7709, 7710, 1, 0, 8.48394f},
+  {7711, 7712, 1, 0, 5.970496f},
+  {7713, 7714, 1, 0, 8.45157f},
+  {7715, 7716, 5, 0, 8.217814f},
+  {7717, 7718, 10, 0, 0.6204305f},
+  {-1, -1, 0, 0, -0.02807642f},
+  {-1, -1, 0, 0, -0.0028209449f},
+  {7719, 7720, 10, 0, 0.69451755f},
+  {7721, 7722, 9, 0, 1.0f},
+  {-1, -1, 0, 0, -0.03274181f},
+  {-1, -1, 0, 0, 0.008778191f},
+  {7723, 7724, 8, 0, 1.0f},
+  {7725, 7726, 5, 0, 42.43611f},
+  {7727, 7728, 7, 0, 5.0f},
+  {7729, 7730, 10, 0, 0.91605806f},
+  {-1, -1, 0, 0, 0.028027534f},
+  {7731, 7732, 1, 0, 19.129274f},
+  {7733, 7734, 3, 0, 48.997368f},
+  {7735, 7736, 3, 0, 47.900154f},
+  {7737, 7738, 1, 0, 7.700921f},
+  {-1, -1, 0, 0, 0.025795272f},
+  {-1, -1, 0, 0, -0.0044545797f},
+  {-1, -1, 0, 0, -0.039669376f},
+  {-1, -1, 0, 0, 0.019463299f},
+  {-1, -1, 0, 0, -0.002628494f},
+  {-1, -1, 0, 0, 0.056023885f},
+  {-1, -1, 0, 0, -0.02247034f},
+  {-1, -1, 0, 0, -0.014433838f},
+  {-1, -1, 0, 0, 0.00063647534f},
+  {-1, -1, 0, 0, 0.038753383f},
+  {-1, -1, 0, 0, 0.0018319607f},
+  {-1, -1, 0, 0, 0.061781444f},
+  {-1, -1, 0, 0, 0.013048494f},
+  {-1, -1, 0, 0, -0.056873698f},
+  {-1, -1, 0, 0, -0.010651341f},
+  {-1, -1, 0, 0, 0.012991549f},
+  {-1, -1, 0, 0, -0.040947106f},
+  {-1, -1, 0, 0, 0.027440934f},
+  {-1, -1, 0, 0, -0.0043897717f},
+  {-1, -1, 0, 0, -0.005008585f},
+  {-1, -1, 0, 0, 0.029963909f},
+  {-1, -1, 0, 0, 0.0009737015f},
+  {-1, -1, 0, 0, -0.005802611f},
+  {-1, -1, 0, 0, 0.014006066f},
+  {-1, -1, 0, 0, -0.016351571f},
+  {-1, -1, 0, 0, -0.015939092f},
+  {-1, -1, 0, 0, -0.030671943f},
+  {-1, -1, 0, 0, 0.015776427f},
+  {-1, -1, 0, 0, -0.0026196719f},
+  {7740, 7741, 10, 0, 0.9485392f},
+  {7742, 7743, 10, 0, 0.9438652f},
+  {7744, 7745, 7, 0, 12.0f},
+  {7746, 7747, 10, 0, 0.9413066f},
+  {7748, 7749, 3, 0, 4.2215447f},
+  {-1, -1, 0, 0, -0.028474003f},
+  {7750, 7751, 0, 0, 1.0f},
+  {7752, 7753, 3, 0, 46.39685f},
+  {7754, 7755, 3, 0, 3.025743f},
+  {7756, 7757, 1, 0, 4.468344f},
+  {7758, 7759, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.012833404f},
+  {-1, -1, 0, 0, 0.0031777383f},
+  {7760, 7761, 3, 0, 39.509468f},
+  {7762, 7763, 5, 0, 45.385487f},
+  {7764, 7765, 1, 0, 5.315942f},
+  {7766, 7767, 5, 0, 21.931599f},
+  {7768, 7769, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 0.014777439f},
+  {-1, -1, 0, 0, 0.008779908f},
+  {-1, -1, 0, 0, 0.04086083f},
+  {7770, 7771, 3, 0, 38.579594f},
+  {7772, 7773, 3, 0, 40.47511f},
+  {7774, 7775, 10, 0, 0.61589104f},
+  {-1, -1, 0, 0, 0.018993838f},
+  {-1, -1, 0, 0, -0.0053700446f},
+  {-1, -1, 0, 0, -0.054553486f},
+  {7776, 7777, 1, 0, 36.454453f},
+  {-1, -1, 0, 0, -0.018109918f},
+  {-1, -1, 0, 0, -0.009388829f},
+  {-1, -1, 0, 0, -0.0013782502f},
+  {-1, -1, 0, 0, 0.00017081681f},
+  {-1, -1, 0, 0, -0.03563411f},
+  {-1, -1, 0, 0, 0.03142457f},
+  {-1, -1, 0, 0, 0.0023977773f},
+  {-1, -1, 0, 0, 0.008990744f},
+  {-1, -1, 0, 0, -0.01416562f},
+  {-1, -1, 0, 0, 0.030810896f},
+  {-1, -1, 0, 0, -0.006173182f},
+  {7779, 7780, 5, 0, 23.965422f},
+  {7781, 7782, 5, 0, 21.461452f},
+  {7783, 7784, 5, 0, 29.886265f},
+  {7785, 7786, 5, 0, 20.05952f},
+  {7787, 7788, 10, 0, 0.70130366f},
+  {7789, 7790, 3, 0, 18.014326f},
+  {7791, 7792, 5, 0, 33.43385f},
+  {7793, 7794, 5, 0, 19.468435f},
+  {7795, 7796, 10, 0, 0.7595118f},
+  {7797, 7798, 7, 0, 4.0f},
+  {7799, 7800, 10, 0, 0.7146721f},
+  {7801, 7802, 10, 0, 0.70130366f},
+  {7803, 7804, 10, 0, 0.71985596f},
+  {7805, 7806, 1, 0, 4.2443423f},
+  {7807, 7808, 3, 0, 30.312311f},
+  {7809, 7810, 10, 0, 0.8007134f},
+  {7811, 7812, 3, 0, 38.03864f},
+  {7813, 7814, 10, 0, 0.6361834f},
+  {7815, 7816, 3, 0, 3.025743f},
+  {7817, 7818, 3, 0, 14.450272f},
+  {7819, 7820, 3, 0, 3.025743f},
+  {7821, 7822, 8, 0, 1.0f},
+  {7823, 7824, 3, 0, 14.450272f},
+  {7825, 7826, 1, 0, 3.0097222f},
+  {7827, 7828, 10, 0, 0.83648086f},
+  {7829, 7830, 5, 0, 28.077417f},
+  {7831, 7832, 10, 0, 0.8518978f},
+  {7833, 7834, 3, 0, 33.053555f},
+  {7835, 7836, 3, 0, 3.025743f},
+  {7837, 7838, 3, 0, 26.85417f},
+  {7839, 7840, 10, 0, 0.905279f},
+  {7841, 7842, 10, 0, 0.7968596f},
+  {7843, 7844, 7, 0, 0.0f},
+  {7845, 7846, 7, 0, 8.0f},
+  {-1, -1, 0, 0, 0.057603598f},
+  {7847, 7848, 1, 0, 36.65513f},
+  {7849, 7850, 8, 0, 0.0f},
+  {-1, -1, 0, 0, -0.095787756f},
+  {7851, 7852, 0, 0, 0.67f},
+  {-1, -1, 0, 0, -0.036453582f},
+  {-1, -1, 0, 0, -0.012742269f},
+  {-1, -1, 0, 0, -0.021036005f},
+  {7853, 7854, 3, 0, 21.570833f},
+  {-1, -1, 0, 0, 0.07933092f},
+  {-1, -1, 0, 0, -0.008848786f},
+  {7855, 7856, 7, 0, 0.0f},
+  {7857, 7858, 3, 0, 36.098396f},
+  {-1, -1, 0, 0, -0.124849774f},
+  {7859, 7860, 1, 0, 39.437035f},
+  {7861, 7862, 7, 0, 5.0f},
+  {7863, 7864, 1, 0, 5.184029f},
+  {7865, 7866, 3, 0, 40.179165f},
+  {7867, 7868, 1, 0, 19.475634f},
+  {7869, 7870, 1, 0, 36.454453f},
+  {7871, 7872, 0, 0, 0.33f},
+  {7873, 7874, 3, 0, 3.8254256f},
+  {-1, -1, 0, 0, -0.028834868f},
+  {-1, -1, 0, 0, 0.037342172f},
+  {7875, 7876, 7, 0, 10.0f},
+  {7877, 7878, 5, 0, 43.30592f},
+  {7879, 7880, 1, 0, 5.781907f},
+  {7881, 7882, 10, 0, 0.84521717f},
+  {7883, 7884, 5, 0, 40.438595f},
+  {-1, -1, 0, 0, -0.00082449906f},
+  {-1, -1, 0, 0, -0.05097666f},
+  {-1, -1, 0, 0, 0.014828886f},
+  {-1, -1, 0, 0, 0.00022587033f},
+  {-1, -1, 0, 0, 0.0010733282f},
+  {-1, -1, 0, 0, 0.027947474f},
+  {-1, -1, 0, 0, 0.03709067f},
+  {-1, -1, 0, 0, -0.0053158584f},
+  {-1, -1, 0, 0, 0.006117129f},
+  {-1, -1, 0, 0, -0.0154482545f},
+  {-1, -1, 0, 0, -0.03020795f},
+  {-1, -1, 0, 0, -0.0070192814f},
+  {-1, -1, 0, 0, 0.02313049f},
+  {-1, -1, 0, 0, -0.0031832792f},
+  {-1, -1, 0, 0, 0.020644223f},
+  {-1, -1, 0, 0, -0.016791081f},
+  {-1, -1, 0, 0, 0.044297572f},
+  {-1, -1, 0, 0, -0.0012871122f},
+  {-1, -1, 0, 0, -0.018311294f},
+  {-1, -1, 0, 0, 0.029198622f},
+  {-1, -1, 0, 0, 0.034155052f},
+  {-1, -1, 0, 0, -0.01842413f},
+  {-1, -1, 0, 0, -0.009565902f},
+  {-1, -1, 0, 0, -0.03348754f},
+  {-1, -1, 0, 0, 0.036785513f},
+  {-1, -1, 0, 0, -0.00086584094f},
+  {-1, -1, 0, 0, -0.02290448f},
+  {-1, -1, 0, 0, 0.017633086f},
+  {-1, -1, 0, 0, -0.030925367f},
+  {-1, -1, 0, 0, -0.0059543075f},
+  {-1, -1, 0, 0, -0.016630584f},
+  {-1, -1, 0, 0, 0.014520116f},
+  {-1, -1, 0, 0, 0.014017335f},
+  {-1, -1, 0, 0, 0.08348152f},
+  {-1, -1, 0, 0, 0.0050491905f},
+  {-1, -1, 0, 0, -0.020886516f},
+  {-1, -1, 0, 0, -0.0069872f},
+  {-1, -1, 0, 0, 0.008863947f},
+  {-1, -1, 0, 0, 0.06278794f},
+  {-1, -1, 0, 0, -0.01372239f},
+  {-1, -1, 0, 0, -0.0054326802f},
+  {-1, -1, 0, 0, -0.036506683f},
+  {-1, -1, 0, 0, -0.0097504975f},
+  {-1, -1, 0, 0, 0.03737839f},
+  {7886, 7887, 7, 0, 36.0f},
+  {7888, 7889, 1, 0, 5.8026752f},
+  {7890, 7891, 1, 0, 5.184029f},
+  {7892, 7893, 1, 0, 4.8713284f},
+  {7894, 7895, 1, 0, 6.2872834f},
+  {7896, 7897, 7, 0, 38.0f},
+  {7898, 7899, 0, 0, 0.33f},
+  {7900, 7901, 5, 0, 48.053078f},
+  {7902, 7903, 3, 0, 7.704718f},
+  {7904, 7905, 10, 0, 0.72457737f},
+  {7906, 7907, 1, 0, 6.4866323f},
+  {-1, -1, 0, 0, 0.032244492f},
+  {-1, -1, 0, 0, 0.0021128654f},
+  {-1, -1, 0, 0, 0.017270088f},
+  {7908, 7909, 1, 0, 8.1919365f},
+  {7910, 7911, 10, 0, 0.64811784f},
+  {-1, -1, 0, 0, -0.04075175f},
+  {7912, 7913, 8, 0, 1.0f},
+  {7914, 7915, 5, 0, 6.374478f},
+  {7916, 7917, 3, 0, 4.269622f},
+  {7918, 7919, 10, 0, 0.89589566f},
+  {7920, 7921, 5, 0, 7.9532037f},
+  {7922, 7923, 10, 0, 0.9362309f},
+  {7924, 7925, 1, 0, 6.9175615f},
+  {-1, -1, 0, 0, -0.018621922f},
+  {7926, 7927, 10, 0, 0.629555f},
+  {7928, 7929, 10, 0, 0.6807112f},
+  {7930, 7931, 9, 0, 1.0f},
+  {7932, 7933, 0, 0, 0.67f},
+  {7934, 7935, 1, 0, 5.2587895f},
+  {7936, 7937, 10, 0, 0.8353793f},
+  {7938, 7939, 7, 0, 16.0f},
+  {7940, 7941, 8, 0, 0.0f},
+  {7942, 7943, 3, 0, 36.098396f},
+  {7944, 7945, 10, 0, 0.9348987f},
+  {7946, 7947, 3, 0, 25.580477f},
+  {7948, 7949, 7, 0, 0.0f},
+  {7950, 7951, 10, 0, 0.9192665f},
+  {7952, 7953, 5, 0, 5.8729773f},
+  {-1, -1, 0, 0, -0.0037439347f},
+  {-1, -1, 0, 0, 0.0010594368f},
+  {-1, -1, 0, 0, -0.00075041817f},
+  {-1, -1, 0, 0, 0.047354262f},
+  {-1, -1, 0, 0, -0.022795936f},
+  {-1, -1, 0, 0, 0.0014457973f},
+  {-1, -1, 0, 0, 0.0072633745f},
+  {-1, -1, 0, 0, -0.048533857f},
+  {-1, -1, 0, 0, -0.013162737f},
+  {-1, -1, 0, 0, 0.008094358f},
+  {-1, -1, 0, 0, -0.0041495897f},
+  {-1, -1, 0, 0, 0.03938904f},
+  {-1, -1, 0, 0, -0.037354518f},
+  {-1, -1, 0, 0, 0.017092276f},
+  {-1, -1, 0, 0, 0.023825238f},
+  {-1, -1, 0, 0, -0.012412644f},
+  {-1, -1, 0, 0, 0.017461633f},
+  {-1, -1, 0, 0, -0.02330933f},
+  {-1, -1, 0, 0, 0.052998718f},
+  {-1, -1, 0, 0, -0.056279946f},
+  {-1, -1, 0, 0, -0.045225255f},
+  {-1, -1, 0, 0, 0.041675057f},
+  {-1, -1, 0, 0, -0.057538744f},
+  {-1, -1, 0, 0, -0.007221937f},
+  {-1, -1, 0, 0, -0.031159593f},
+  {-1, -1, 0, 0, 0.010345483f},
+  {-1, -1, 0, 0, 0.00029583866f},
+  {-1, -1, 0, 0, 0.024038255f},
+  {-1, -1, 0, 0, -0.035825104f},
+  {-1, -1, 0, 0, -0.003301032f},
+  {7955, 7956, 1, 0, 49.252625f},
+  {7957, 7958, 1, 0, 38.58884f},
+  {7959, 7960, 5, 0, 29.886265f},
+  {7961, 7962, 3, 0, 7.0890985f},
+  {7963, 7964, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, -0.009766512f},
+  {-1, -1, 0, 0, -0.024684846f},
+  {7965, 7966, 3, 0, 7.0185437f},
+  {7967, 7968, 3, 0, 7.704718f},
+  {7969, 7970, 5, 0, 39.024036f},
+  {7971, 7972, 7, 0, 0.0f},
+  {7973, 7974, 10, 0, 0.7671752f},
+  {7975, 7976, 2, 0, 0.0f},
+  {7977, 7978, 5, 0, 3.9921005f},
+  {7979, 7980, 3, 0, 8.006827f},
+  {7981, 7982, 5, 0, 35.795372f},
+  {7983, 7984, 5, 0, 39.35422f},
+  {7985, 7986, 3, 0, 12.934116f},
+  {7987, 7988, 10, 0, 0.87471986f},
+  {7989, 7990, 10, 0, 0.75866807f},
+  {7991, 7992, 10, 0, 0.7698832f},
+  {-1, -1, 0, 0, 0.12892666f},
+  {7993, 7994, 7, 0, 11.0f},
+  {7995, 7996, 10, 0, 0.67703915f},
+  {7997, 7998, 3, 0, 7.517859f},
+  {7999, 8000, 3, 0, 7.9278097f},
+  {8001, 8002, 3, 0, 8.306931f},
+  {8003, 8004, 10, 0, 0.6795604f},
+  {-1, -1, 0, 0, 0.034274425f},
+  {-1, -1, 0, 0, -0.09218993f},
+  {8005, 8006, 5, 0, 39.780422f},
+  {8007, 8008, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 0.055014502f},
+  {8009, 8010, 1, 0, 47.38606f},
+  {8011, 8012, 3, 0, 46.052345f},
+  {-1, -1, 0, 0, 0.002992479f},
+  {-1, -1, 0, 0, 0.043086212f},
+  {-1, -1, 0, 0, -0.07725006f},
+  {-1, -1, 0, 0, -0.0015215804f},
+  {-1, -1, 0, 0, -0.01014754f},
+  {-1, -1, 0, 0, 0.028181443f},
+  {-1, -1, 0, 0, -0.005123764f},
+  {-1, -1, 0, 0, -0.055588603f},
+  {-1, -1, 0, 0, 0.009735453f},
+  {-1, -1, 0, 0, -0.031891197f},
+  {-1, -1, 0, 0, 0.0095397355f},
+  {-1, -1, 0, 0, 0.08208188f},
+  {-1, -1, 0, 0, -0.021358682f},
+  {-1, -1, 0, 0, -9.7438526e-05f},
+  {-1, -1, 0, 0, 0.009144532f},
+  {-1, -1, 0, 0, -0.02332042f},
+  {-1, -1, 0, 0, 0.0068810857f},
+  {-1, -1, 0, 0, -0.020870287f},
+  {-1, -1, 0, 0, 0.0012914896f},
+  {-1, -1, 0, 0, 0.01763916f},
+  {-1, -1, 0, 0, 0.018439634f},
+  {-1, -1, 0, 0, -0.00447932f},
+  {-1, -1, 0, 0, -0.017443022f},
+  {-1, -1, 0, 0, 0.014749321f},
+  {8014, 8015, 7, 0, 36.0f},
+  {8016, 8017, 8, 0, 1.0f},
+  {8018, 8019, 1, 0, 5.184029f},
+  {8020, 8021, 3, 0, 3.025743f},
+  {8022, 8023, 1, 0, 3.7838314f},
+  {8024, 8025, 7, 0, 38.0f},
+  {8026, 8027, 0, 0, 0.33f},
+  {8028, 8029, 10, 0, 0.7554628f},
+  {8030, 8031, 3, 0, 4.3074203f},
+  {8032, 8033, 3, 0, 27.330963f},
+  {8034, 8035, 5, 0, 5.7609286f},
+  {-1, -1, 0, 0, 0.030436277f},
+  {-1, -1, 0, 0, 0.0018575669f},
+  {-1, -1, 0, 0, 0.016411496f},
+  {8036, 8037, 1, 0, 8.1919365f},
+  {8038, 8039, 10, 0, 0.7139662f},
+  {8040, 8041, 10, 0, 0.7698832f},
+  {8042, 8043, 6, 0, 1.0f},
+  {8044, 8045, 3, 0, 4.6423893f},
+  {8046, 8047, 7, 0, 3.0f},
+  {8048, 8049, 0, 0, 0.33f},
+  {8050, 8051, 5, 0, 5.498171f},
+  {8052, 8053, 7, 0, 17.0f},
+  {8054, 8055, 1, 0, 6.9175615f},
+  {-1, -1, 0, 0, -0.017685985f},
+  {8056, 8057, 10, 0, 0.7067397f},
+  {8058, 8059, 1, 0, 7.4555297f},
+  {8060, 8061, 9, 0, 2.0f},
+  {8062, 8063, 1, 0, 4.5874133f},
+  {8064, 8065, 3, 0, 3.6501553f},
+  {8066, 8067, 3, 0, 4.269622f},
+  {8068, 8069, 3, 0, 4.3745303f},
+  {8070, 8071, 3, 0, 5.1185427f},
+  {8072, 8073, 5, 0, 39.780422f},
+  {8074, 8075, 5, 0, 6.0687356f},
+  {-1, -1, 0, 0, -0.015980147f},
+  {8076, 8077, 7, 0, 0.0f},
+  {8078, 8079, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.14488725f},
+  {8080, 8081, 5, 0, 6.179205f},
+  {8082, 8083, 7, 0, 22.0f},
+  {-1, -1, 0, 0, -0.0024888038f},
+  {-1, -1, 0, 0, 0.0010826112f},
+  {-1, -1, 0, 0, -0.00077105226f},
+  {-1, -1, 0, 0, -0.054882903f},
+  {-1, -1, 0, 0, -0.00021374226f},
+  {-1, -1, 0, 0, 0.0485271f},
+  {-1, -1, 0, 0, -0.013658221f},
+  {-1, -1, 0, 0, -0.106108025f},
+  {-1, -1, 0, 0, 0.0057246033f},
+  {-1, -1, 0, 0, -0.017378919f},
+  {-1, -1, 0, 0, 0.0008367832f},
+  {-1, -1, 0, 0, 0.06137082f},
+  {-1, -1, 0, 0, -0.002529864f},
+  {-1, -1, 0, 0, 0.04891148f},
+  {-1, -1, 0, 0, -0.002312231f},
+  {-1, -1, 0, 0, -0.0568373f},
+  {-1, -1, 0, 0, 0.02137457f},
+  {-1, -1, 0, 0, -0.00079044374f},
+  {-1, -1, 0, 0, -0.07618614f},
+  {-1, -1, 0, 0, -0.011643839f},
+  {-1, -1, 0, 0, -0.021877365f},
+  {-1, -1, 0, 0, 0.022106841f},
+  {-1, -1, 0, 0, 0.09529535f},
+  {-1, -1, 0, 0, 0.015022135f},
+  {-1, -1, 0, 0, 0.03850411f},
+  {-1, -1, 0, 0, 0.0073949457f},
+  {-1, -1, 0, 0, -0.06175623f},
+  {-1, -1, 0, 0, -0.004723409f},
+  {-1, -1, 0, 0, 0.0658785f},
+  {-1, -1, 0, 0, -0.01762108f},
+  {8085, 8086, 0, 0, 1.0f},
+  {8087, 8088, 8, 0, 1.0f},
+  {8089, 8090, 10, 0, 0.60579807f},
+  {8091, 8092, 3, 0, 7.704718f},
+  {8093, 8094, 3, 0, 7.0555444f},
+  {8095, 8096, 10, 0, 0.6035007f},
+  {8097, 8098, 1, 0, 7.600024f},
+  {8099, 8100, 3, 0, 7.384106f},
+  {8101, 8102, 3, 0, 8.006827f},
+  {8103, 8104, 1, 0, 7.557411f},
+  {8105, 8106, 1, 0, 6.748502f},
+  {8107, 8108, 1, 0, 7.249671f},
+  {-1, -1, 0, 0, 0.05227795f},
+  {8109, 8110, 1, 0, 5.937119f},
+  {8111, 8112, 10, 0, 0.72917897f},
+  {8113, 8114, 3, 0, 7.2400966f},
+  {8115, 8116, 10, 0, 0.80923235f},
+  {8117, 8118, 9, 0, 2.0f},
+  {8119, 8120, 3, 0, 8.306931f},
+  {8121, 8122, 7, 0, 0.0f},
+  {8123, 8124, 3, 0, 6.4946146f},
+  {8125, 8126, 3, 0, 9.420506f},
+  {8127, 8128, 3, 0, 8.127335f},
+  {8129, 8130, 7, 0, 21.0f},
+  {8131, 8132, 5, 0, 3.5118535f},
+  {8133, 8134, 10, 0, 0.7671752f},
+  {8135, 8136, 3, 0, 8.26907f},
+  {8137, 8138, 10, 0, 0.7211154f},
+  {8139, 8140, 7, 0, 0.0f},
+  {8141, 8142, 3, 0, 7.1573887f},
+  {8143, 8144, 5, 0, 7.548191f},
+  {8145, 8146, 1, 0, 7.8212028f},
+  {8147, 8148, 0, 0, 0.33f},
+  {8149, 8150, 9, 0, 1.0f},
+  {8151, 8152, 7, 0, 20.0f},
+  {8153, 8154, 3, 0, 8.26907f},
+  {8155, 8156, 3, 0, 9.686388f},
+  {8157, 8158, 5, 0, 7.282547f},
+  {8159, 8160, 7, 0, 15.0f},
+  {8161, 8162, 1, 0, 9.868206f},
+  {8163, 8164, 7, 0, 19.0f},
+  {8165, 8166, 1, 0, 3.715711f},
+  {8167, 8168, 3, 0, 9.852974f},
+  {8169, 8170, 7, 0, 21.0f},
+  {8171, 8172, 1, 0, 7.5773983f},
+  {-1, -1, 0, 0, -0.031137085f},
+  {8173, 8174, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, 0.034352556f},
+  {-1, -1, 0, 0, 0.013206673f},
+  {8175, 8176, 10, 0, 0.7023779f},
+  {8177, 8178, 5, 0, 3.5704215f},
+  {8179, 8180, 5, 0, 5.8729773f},
+  {-1, -1, 0, 0, 0.08189946f},
+  {8181, 8182, 5, 0, 5.63685f},
+  {-1, -1, 0, 0, -0.08841718f},
+  {8183, 8184, 3, 0, 3.2920585f},
+  {8185, 8186, 3, 0, 4.6423893f},
+  {-1, -1, 0, 0, -0.002903953f},
+  {-1, -1, 0, 0, -0.034238853f},
+  {-1, -1, 0, 0, 0.070593275f},
+  {-1, -1, 0, 0, -0.030546475f},
+  {-1, -1, 0, 0, -0.015302293f},
+  {-1, -1, 0, 0, -0.058753468f},
+  {-1, -1, 0, 0, -0.01675272f},
+  {-1, -1, 0, 0, -0.11568578f},
+  {-1, -1, 0, 0, -0.0067097344f},
+  {-1, -1, 0, 0, 0.012743211f},
+  {-1, -1, 0, 0, 0.08862866f},
+  {-1, -1, 0, 0, 0.013858176f},
+  {-1, -1, 0, 0, 0.008108783f},
+  {-1, -1, 0, 0, -0.06793366f},
+  {-1, -1, 0, 0, 0.016434526f},
+  {-1, -1, 0, 0, -0.0010924911f},
+  {-1, -1, 0, 0, 0.082544126f},
+  {-1, -1, 0, 0, -0.0017032782f},
+  {-1, -1, 0, 0, -0.0021692284f},
+  {-1, -1, 0, 0, 0.026653184f},
+  {-1, -1, 0, 0, -0.021427477f},
+  {-1, -1, 0, 0, 0.023965323f},
+  {-1, -1, 0, 0, 0.048867892f},
+  {-1, -1, 0, 0, -0.020401478f},
+  {-1, -1, 0, 0, -0.055932503f},
+  {-1, -1, 0, 0, -0.012260854f},
+  {-1, -1, 0, 0, 0.060179688f},
+  {-1, -1, 0, 0, -0.0022178343f},
+  {-1, -1, 0, 0, 0.062558405f},
+  {-1, -1, 0, 0, -0.028580952f},
+  {-1, -1, 0, 0, 0.026121138f},
+  {-1, -1, 0, 0, -0.0066368f},
+  {-1, -1, 0, 0, 0.018670972f},
+  {-1, -1, 0, 0, -0.00034097035f},
+  {-1, -1, 0, 0, -0.011668465f},
+  {-1, -1, 0, 0, 0.04603006f},
+  {-1, -1, 0, 0, -0.039074592f},
+  {-1, -1, 0, 0, 0.001022346f},
+  {-1, -1, 0, 0, -0.011513016f},
+  {-1, -1, 0, 0, 0.03428893f},
+  {-1, -1, 0, 0, 0.0010537339f},
+  {-1, -1, 0, 0, -0.022451075f},
+  {-1, -1, 0, 0, 0.0002773285f},
+  {-1, -1, 0, 0, 0.048657943f},
+  {-1, -1, 0, 0, 0.014185219f},
+  {-1, -1, 0, 0, -0.019894324f},
+  {8188, 8189, 5, 0, 48.616074f},
+  {8190, 8191, 5, 0, 40.878075f},
+  {8192, 8193, 7, 0, 0.0f},
+  {8194, 8195, 5, 0, 40.147594f},
+  {8196, 8197, 1, 0, 4.267824f},
+  {8198, 8199, 1, 0, 3.0097222f},
+  {8200, 8201, 5, 0, 49.09901f},
+  {8202, 8203, 5, 0, 39.780422f},
+  {8204, 8205, 7, 0, 2.0f},
+  {8206, 8207, 8, 0, 0.0f},
+  {8208, 8209, 0, 0, 0.67f},
+  {-1, -1, 0, 0, -0.041904997f},
+  {-1, -1, 0, 0, -0.015222013f},
+  {8210, 8211, 0, 0, 0.67f},
+  {8212, 8213, 1, 0, 18.662224f},
+  {8214, 8215, 5, 0, 35.795372f},
+  {8216, 8217, 0, 0, 0.33f},
+  {8218, 8219, 2, 0, 1.0f},
+  {8220, 8221, 10, 0, 0.7280631f},
+  {8222, 8223, 3, 0, 23.265055f},
+  {8224, 8225, 3, 0, 34.905163f},
+  {8226, 8227, 1, 0, 41.093555f},
+  {8228, 8229, 1, 0, 8.584065f},
+  {-1, -1, 0, 0, -0.0142619135f},
+  {-1, -1, 0, 0, 0.0014287472f},
+  {-1, -1, 0, 0, 0.013539608f},
+  {-1, -1, 0, 0, 0.0033471466f},
+  {8230, 8231, 5, 0, 34.90521f},
+  {8232, 8233, 7, 0, 0.0f},
+  {-1, -1, 0, 0, -0.032521393f},
+  {-1, -1, 0, 0, 0.052761592f},
+  {-1, -1, 0, 0, -0.07047679f},
+  {8234, 8235, 1, 0, 4.1957583f},
+  {8236, 8237, 3, 0, 3.025743f},
+  {8238, 8239, 1, 0, 4.777555f},
+  {-1, -1, 0, 0, -0.046913408f},
+  {-1, -1, 0, 0, 0.00059165957f},
+  {8240, 8241, 10, 0, 0.9100054f},
+  {8242, 8243, 5, 0, 42.43611f},
+  {8244, 8245, 1, 0, 37.049507f},
+  {8246, 8247, 3, 0, 29.96273f},
+  {-1, -1, 0, 0, 0.059035588f},
+  {8248, 8249, 1, 0, 8.989843f},
+  {-1, -1, 0, 0, 2.3737286e-05f},
+  {-1, -1, 0, 0, 0.019873943f},
+  {-1, -1, 0, 0, -0.03455168f},
+  {-1, -1, 0, 0, 0.00035403762f},
+  {-1, -1, 0, 0, -0.004122162f},
+  {-1, -1, 0, 0, -0.02378912f},
+  {-1, -1, 0, 0, 0.00089569093f},
+  {-1, -1, 0, 0, -0.013995552f},
+  {-1, -1, 0, 0, 0.006932974f},
+  {-1, -1, 0, 0, 0.03232142f},
+  {-1, -1, 0, 0, 0.017926479f},
+  {-1, -1, 0, 0, -0.029367242f},
+  {-1, -1, 0, 0, 0.0140028f},
+  {-1, -1, 0, 0, -0.050807454f},
+  {-1, -1, 0, 0, 0.0035491062f},
+  {-1, -1, 0, 0, 0.046122056f},
+  {-1, -1, 0, 0, -0.022917306f},
+  {-1, -1, 0, 0, 0.016776187f},
+  {-1, -1, 0, 0, 0.00092406274f},
+  {-1, -1, 0, 0, -0.0068102838f},
+  {8251, 8252, 7, 0, 36.0f},
+  {8253, 8254, 10, 0, 0.6807112f},
+  {8255, 8256, 1, 0, 5.184029f},
+  {8257, 8258, 10, 0, 0.66068304f},
+  {8259, 8260, 10, 0, 0.7266901f},
+  {8261, 8262, 7, 0, 38.0f},
+  {8263, 8264, 0, 0, 0.33f},
+  {8265, 8266, 1, 0, 15.640303f},
+  {8267, 8268, 1, 0, 28.756657f},
+  {8269, 8270, 5, 0, 23.136189f},
+  {8271, 8272, 10, 0, 0.7314549f},
+  {-1, -1, 0, 0, 0.028734589f},
+  {-1, -1, 0, 0, 0.0023469925f},
+  {-1, -1, 0, 0, 0.014768124f},
+  {8273, 8274, 1, 0, 8.1919365f},
+  {8275, 8276, 1, 0, 9.470373f},
+  {8277, 8278, 10, 0, 0.6385671f},
+  {8279, 8280, 0, 0, 0.67f},
+  {8281, 8282, 7, 0, 0.0f},
+  {8283, 8284, 5, 0, 17.832275f},
+  {8285, 8286, 9, 0, 1.0f},
+  {8287, 8288, 5, 0, 4.289015f},
+  {8289, 8290, 3, 0, 29.96273f},
+  {8291, 8292, 1, 0, 6.9175615f},
+  {-1, -1, 0, 0, -0.016855432f},
+  {8293, 8294, 3, 0, 31.141062f},
+  {8295, 8296, 8, 0, 0.0f},
+  {8297, 8298, 1, 0, 21.909319f},
+  {8299, 8300, 1, 0, 46.55334f},
+  {8301, 8302, 3, 0, 27.330963f},
+  {8303, 8304, 5, 0, 3.125053f},
+  {-1, -1, 0, 0, 0.05787177f},
+  {8305, 8306, 5, 0, 15.899349f},
+  {8307, 8308, 5, 0, 3.6632886f},
+  {8309, 8310, 7, 0, 0.0f},
+  {8311, 8312, 7, 0, 0.0f},
+  {8313, 8314, 7, 0, 12.0f},
+  {8315, 8316, 10, 0, 0.72977334f},
+  {8317, 8318, 3, 0, 25.255108f},
+  {8319, 8320, 3, 0, 29.040953f},
+  {8321, 8322, 3, 0, 34.650505f},
+  {-1, -1, 0, 0, -0.001789856f},
+  {-1, -1, 0, 0, 0.00031805038f},
+  {-1, -1, 0, 0, -0.002133898f},
+  {-1, -1, 0, 0, 0.019164994f},
+  {-1, -1, 0, 0, -0.024293406f},
+  {-1, -1, 0, 0, 0.03327593f},
+  {-1, -1, 0, 0, -0.018731635f},
+  {-1, -1, 0, 0, 0.0070449524f},
+  {-1, -1, 0, 0, -0.03184839f},
+  {-1, -1, 0, 0, -0.004022825f},
+  {-1, -1, 0, 0, -0.0444428f},
+  {-1, -1, 0, 0, -0.0053471415f},
+  {-1, -1, 0, 0, 0.023479108f},
+  {-1, -1, 0, 0, -0.014019526f},
+  {-1, -1, 0, 0, 0.022998445f},
+  {-1, -1, 0, 0, -0.011173574f},
+  {-1, -1, 0, 0, 0.017569808f},
+  {-1, -1, 0, 0, 0.0021573137f},
+  {-1, -1, 0, 0, 0.10009401f},
+  {-1, -1, 0, 0, 0.014797187f},
+  {-1, -1, 0, 0, -0.04433297f},
+  {-1, -1, 0, 0, -0.0001859513f},
+  {-1, -1, 0, 0, 0.026728824f},
+  {-1, -1, 0, 0, -0.018851375f},
+  {-1, -1, 0, 0, -0.06038917f},
+  {-1, -1, 0, 0, -0.02255432f},
+  {-1, -1, 0, 0, 0.011539769f},
+  {-1, -1, 0, 0, -0.01565553f},
+  {-1, -1, 0, 0, 0.000671671f},
+  {-1, -1, 0, 0, 0.05246165f},
+  {-1, -1, 0, 0, -0.022404978f},
+  {-1, -1, 0, 0, 0.0008308347f},
+  {8324, 8325, 10, 0, 0.8872101f},
+  {8326, 8327, 10, 0, 0.86107147f},
+  {8328, 8329, 5, 0, 3.1583395f},
+  {8330, 8331, 10, 0, 0.8561354f},
+  {8332, 8333, 9, 0, 3.0f},
+  {8334, 8335, 1, 0, 5.8820796f},
+  {8336, 8337, 3, 0, 32.131393f},
+  {8338, 8339, 10, 0, 0.8538424f},
+  {8340, 8341, 4, 0, 1.0f},
+  {8342, 8343, 3, 0, 8.780311f},
+  {8344, 8345, 5, 0, 5.738449f},
+  {8346, 8347, 10, 0, 0.89589566f},
+  {8348, 8349, 10, 0, 0.906403f},
+  {8350, 8351, 10, 0, 0.9148954f},
+  {8352, 8353, 5, 0, 40.438595f},
+  {8354, 8355, 3, 0, 3.413912f},
+  {8356, 8357, 3, 0, 3.025743f},
+  {8358, 8359, 5, 0, 5.066704f},
+  {8360, 8361, 1, 0, 3.3297658f},
+  {8362, 8363, 3, 0, 7.1573887f},
+  {8364, 8365, 5, 0, 8.494484f},
+  {8366, 8367, 3, 0, 5.0662103f},
+  {8368, 8369, 5, 0, 7.9532037f},
+  {8370, 8371, 3, 0, 11.716022f},
+  {8372, 8373, 1, 0, 4.22857f},
+  {8374, 8375, 1, 0, 27.268505f},
+  {8376, 8377, 3, 0, 43.336628f},
+  {8378, 8379, 1, 0, 5.99366f},
+  {8380, 8381, 1, 0, 7.2925344f},
+  {8382, 8383, 5, 0, 35.291286f},
+  {8384, 8385, 1, 0, 19.475634f},
+  {8386, 8387, 3, 0, 3.1390157f},
+  {8388, 8389, 3, 0, 3.6904523f},
+  {-1, -1, 0, 0, -0.08089282f},
+  {8390, 8391, 1, 0, 3.9524088f},
+  {8392, 8393, 1, 0, 3.0097222f},
+  {8394, 8395, 3, 0, 19.831232f},
+  {8396, 8397, 0, 0, 1.0f},
+  {8398, 8399, 6, 0, 1.0f},
+  {8400, 8401, 3, 0, 3.025743f},
+  {8402, 8403, 10, 0, 0.8739182f},
+  {8404, 8405, 1, 0, 6.9549685f},
+  {8406, 8407, 7, 0, 0.0f},
+  {8408, 8409, 8, 0, 1.0f},
+  {8410, 8411, 3, 0, 9.305268f},
+  {-1, -1, 0, 0, 0.06273866f},
+  {-1, -1, 0, 0, 0.0035402298f},
+  {-1, -1, 0, 0, -0.082838774f},
+  {-1, -1, 0, 0, -0.003468609f},
+  {8412, 8413, 10, 0, 0.92328537f},
+  {8414, 8415, 7, 0, 16.0f},
+  {8416, 8417, 0, 0, 1.0f},
+  {-1, -1, 0, 0, -0.016587293f},
+  {8418, 8419, 1, 0, 6.72941f},
+  {-1, -1, 0, 0, 0.041287113f},
+  {8420, 8421, 3, 0, 7.6527576f},
+  {8422, 8423, 10, 0, 0.8909237f},
+  {8424, 8425, 10, 0, 0.9348987f},
+  {8426, 8427, 1, 0, 7.600024f},
+  {8428, 8429, 3, 0, 34.650505f},
+  {8430, 8431, 5, 0, 36.127365f},
+  {-1, -1, 0, 0, 0.03131066f},
+  {-1, -1, 0, 0, -0.014892697f},
+  {-1, -1, 0, 0, 0.0015096533f},
+  {-1, -1, 0, 0, 0.028529137f},
+  {-1, -1, 0, 0, -0.032212805f},
+  {-1, -1, 0, 0, -0.00042367718f},
+  {-1, -1, 0, 0, 0.020781517f},
+  {-1, -1, 0, 0, -0.0015128612f},
+  {-1, -1, 0, 0, -0.06832256f},
+  {-1, -1, 0, 0, -0.007146716f},
+  {-1, -1, 0, 0, 0.027999526f},
+  {-1, -1, 0, 0, -0.0026560307f},
+  {-1, -1, 0, 0, 0.14454556f},
+  {-1, -1, 0, 0, 0.017032623f},
+  {-1, -1, 0, 0, 0.03386259f},
+  {-1, -1, 0, 0, 0.007674742f},
+  {-1, -1, 0, 0, -0.037033465f},
+  {-1, -1, 0, 0, 0.011516537f},
+  {-1, -1, 0, 0, -0.086498015f},
+  {-1, -1, 0, 0, -0.017913247f},
+  {-1, -1, 0, 0, 0.07493913f},
+  {-1, -1, 0, 0, 0.0077995583f},
+  {-1, -1, 0, 0, -0.0643568f},
+  {-1, -1, 0, 0, -0.009633558f},
+  {-1, -1, 0, 0, 0.031519257f},
+  {-1, -1, 0, 0, -0.018602371f},
+  {-1, -1, 0, 0, -0.03331337f},
+  {-1, -1, 0, 0, 0.008795643f},
+  {-1, -1, 0, 0, 0.006029557f},
+  {-1, -1, 0, 0, -0.01941899f},
+  {-1, -1, 0, 0, -0.05145092f},
+  {-1, -1, 0, 0, -0.002014065f},
+  {-1, -1, 0, 0, 0.059078496f},
+  {-1, -1, 0, 0, -0.00562706f},
+  {-1, -1, 0, 0, 0.018026257f},
+  {-1, -1, 0, 0, -0.029592201f},
+  {-1, -1, 0, 0, 0.026611254f},
+  {-1, -1, 0, 0, 0.06877934f},
+  {-1, -1, 0, 0, 0.05079425f},
+  {-1, -1, 0, 0, -0.0013671153f},
+  {-1, -1, 0, 0, -0.023385169f},
+  {-1, -1, 0, 0, 0.016804947f},
+  {-1, -1, 0, 0, 0.054214634f},
+  {-1, -1, 0, 0, 0.003864043f},
+  {-1, -1, 0, 0, -0.026076749f},
+  {-1, -1, 0, 0, 0.0056459615f},
+  {-1, -1, 0, 0, -0.07005634f},
+  {-1, -1, 0, 0, -0.017925357f},
+  {8433, 8434, 10, 0, 0.8007134f},
+  {8435, 8436, 10, 0, 0.75346303f},
+  {8437, 8438, 10, 0, 0.81645775f},
+  {8439, 8440, 10, 0, 0.70130366f},
+  {8441, 8442, 10, 0, 0.75866807f},
+  {8443, 8444, 7, 0, 0.0f},
+  {8445, 8446, 10, 0, 0.82047516f},
+  {8447, 8448, 10, 0, 0.69761395f},
+  {8449, 8450, 1, 0, 6.9701552f},
+  {8451, 8452, 0, 0, 0.67f},
+  {8453, 8454, 4, 0, 0.0f},
+  {8455, 8456, 5, 0, 4.460285f},
+  {8457, 8458, 5, 0, 5.738449f},
+  {8459, 8460, 1, 0, 3.4432666f},
+  {8461, 8462, 10, 0, 0.83648086f},
+  {8463, 8464, 3, 0, 8.127335f},
+  {8465, 8466, 1, 0, 5.937119f},
+  {8467, 8468, 1, 0, 6.8116555f},
+  {8469, 8470, 7, 0, 19.0f},
+  {8471, 8472, 5, 0, 47.33434f},
+  {8473, 8474, 5, 0, 7.070297f},
+  {8475, 8476, 9, 0, 2.0f},
+  {8477, 8478, 10, 0, 0.7671752f},
+  {8479, 8480, 1, 0, 3.0097222f},
+  {8481, 8482, 5, 0, 6.425559f},
+  {8483, 8484, 0, 0, 0.67f},
+  {8485, 8486, 8, 0, 1.0f},
+  {8487, 8488, 5, 0, 3.0662608f},
+  {8489, 8490, 3, 0, 7.1573887f},
+  {8491, 8492, 3, 0, 17.801981f},
+  {8493, 8494, 10, 0, 0.8381581f},
+  {8495, 8496, 3, 0, 7.9278097f},
+  {8497, 8498, 3, 0, 31.141062f},
+  {8499, 8500, 1, 0, 3.0097222f},
+  {8501, 8502, 1, 0, 19.314367f},
+  {8503, 8504, 5, 0, 5.516025f},
+  {-1, -1, 0, 0, 0.077259f},
+  {8505, 8506, 3, 0, 20.722658f},
+  {8507, 8508, 10, 0, 0.7376514f},
+  {8509, 8510, 5, 0, 5.042116f},
+  {-1, -1, 0, 0, 0.030700255f},
+  {8511, 8512, 10, 0, 0.7565905f},
+  {-1, -1, 0, 0, 0.0021294595f},
+  {8513, 8514, 5, 0, 35.618786f},
+  {8515, 8516, 10, 0, 0.7698832f},
+  {8517, 8518, 3, 0, 7.280536f},
+  {8519, 8520, 3, 0, 7.209053f},
+  {-1, -1, 0, 0, -0.0025684596f},
+  {-1, -1, 0, 0, -0.011494256f},
+  {-1, -1, 0, 0, 0.119913355f},
+  {-1, -1, 0, 0, 0.04315092f},
+  {8521, 8522, 1, 0, 3.0097222f},
+  {8523, 8524, 10, 0, 0.8055525f},
+  {8525, 8526, 5, 0, 7.1836843f},
+  {8527, 8528, 1, 0, 3.5859556f},
+  {-1, -1, 0, 0, -0.0205513f},
+  {-1, -1, 0, 0, -0.092596225f},
+  {8529, 8530, 7, 0, 9.0f},
+  {8531, 8532, 3, 0, 18.418673f},
+  {8533, 8534, 5, 0, 5.2412124f},
+  {8535, 8536, 1, 0, 8.658766f},
+  {8537, 8538, 8, 0, 1.0f},
+  {8539, 8540, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, 0.0018305961f},
+  {-1, -1, 0, 0, 0.053990413f},
+  {-1, -1, 0, 0, -0.009225133f},
+  {-1, -1, 0, 0, 0.0058386894f},
+  {-1, -1, 0, 0, -0.07983938f},
+  {-1, -1, 0, 0, -0.026860094f},
+  {-1, -1, 0, 0, 0.012448355f},
+  {-1, -1, 0, 0, -0.024788618f},
+  {-1, -1, 0, 0, 0.02685203f},
+  {-1, -1, 0, 0, 0.0018584349f},
+  {-1, -1, 0, 0, 0.014787368f},
+  {-1, -1, 0, 0, -0.013234724f},
+  {-1, -1, 0, 0, -0.05365282f},
+  {-1, -1, 0, 0, 0.027852694f},
+  {-1, -1, 0, 0, 0.010227033f},
+  {-1, -1, 0, 0, -0.014409996f},
+  {-1, -1, 0, 0, -0.07942816f},
+  {-1, -1, 0, 0, -0.027836515f},
+  {-1, -1, 0, 0, 0.022229632f},
+  {-1, -1, 0, 0, -0.030461252f},
+  {-1, -1, 0, 0, -0.097882174f},
+  {-1, -1, 0, 0, -0.023061221f},
+  {-1, -1, 0, 0, 0.06858834f},
+  {-1, -1, 0, 0, -0.015355341f},
+  {-1, -1, 0, 0, -0.022004308f},
+  {-1, -1, 0, 0, 0.0026067744f},
+  {-1, -1, 0, 0, 0.030477537f},
+  {-1, -1, 0, 0, -0.0047839405f},
+  {-1, -1, 0, 0, -0.044145014f},
+  {-1, -1, 0, 0, -0.018106429f},
+  {-1, -1, 0, 0, 0.057987977f},
+  {-1, -1, 0, 0, 0.016839987f},
+  {-1, -1, 0, 0, 0.025249496f},
+  {-1, -1, 0, 0, -0.02482729f},
+  {-1, -1, 0, 0, -0.025759315f},
+  {-1, -1, 0, 0, -0.0070072175f},
+  {-1, -1, 0, 0, 0.012011475f},
+  {-1, -1, 0, 0, -0.009838295f},
+  {-1, -1, 0, 0, 0.06153783f},
+  {-1, -1, 0, 0, 0.011949326f},
+  {-1, -1, 0, 0, -0.03126955f},
+  {-1, -1, 0, 0, 0.024828518f},
+  {-1, -1, 0, 0, -0.052420318f},
+  {-1, -1, 0, 0, 0.040675353f},
+  {-1, -1, 0, 0, -0.007580255f},
+  {-1, -1, 0, 0, 0.002257041f},
+  {8542, 8543, 5, 0, 3.2517974f},
+  {8544, 8545, 10, 0, 0.9279815f},
+  {8546, 8547, 5, 0, 3.2776327f},
+  {8548, 8549, 5, 0, 3.0662608f},
+  {8550, 8551, 1, 0, 28.0855f},
+  {-1, -1, 0, 0, -0.061846185f},
+  {8552, 8553, 10, 0, 0.8872101f},
+  {8554, 8555, 3, 0, 4.3745303f},
+  {8556, 8557, 10, 0, 0.61236143f},
+  {8558, 8559, 1, 0, 3.4778516f},
+  {8560, 8561, 1, 0, 36.454453f},
+  {8562, 8563, 10, 0, 0.8583438f},
+  {8564, 8565, 3, 0, 32.131393f},
+  {8566, 8567, 3, 0, 3.6904523f},
+  {8568, 8569, 3, 0, 6.024863f},
+  {8570, 8571, 1, 0, 4.63365f},
+  {8572, 8573, 7, 0, 19.0f},
+  {8574, 8575, 7, 0, 0.0f},
+  {8576, 8577, 0, 0, 1.0f},
+  {-1, -1, 0, 0, 0.013931644f},
+  {8578, 8579, 1, 0, 42.674526f},
+  {8580, 8581, 10, 0, 0.8561354f},
+  {8582, 8583, 3, 0, 3.025743f},
+  {8584, 8585, 10, 0, 0.9148954f},
+  {8586, 8587, 5, 0, 40.438595f},
+  {8588, 8589, 1, 0, 5.982256f},
+  {8590, 8591, 8, 0, 1.0f},
+  {8592, 8593, 8, 0, 1.0f},
+  {8594, 8595, 3, 0, 7.0555444f},
+  {8596, 8597, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, -0.05093473f},
+  {8598, 8599, 8, 0, 0.0f},
+  {8600, 8601, 1, 0, 6.4145293f},
+  {-1, -1, 0, 0, -0.03129177f},
+  {8602, 8603, 10, 0, 0.9294512f},
+  {-1, -1, 0, 0, -0.054844975f},
+  {-1, -1, 0, 0, -0.016349094f},
+  {-1, -1, 0, 0, -0.008543539f},
+  {-1, -1, 0, 0, -0.0017862797f},
+  {8604, 8605, 10, 0, 0.8538424f},
+  {8606, 8607, 1, 0, 6.8116555f},
+  {8608, 8609, 8, 0, 1.0f},
+  {8610, 8611, 3, 0, 7.0890985f},
+  {8612, 8613, 0, 0, 1.0f},
+  {8614, 8615, 5, 0, 36.74928f},
+  {8616, 8617, 5, 0, 35.291286f},
+  {8618, 8619, 1, 0, 19.475634f},
+  {-1, -1, 0, 0, -0.009752254f},
+  {-1, -1, 0, 0, 0.012524187f},
+  {-1, -1, 0, 0, 0.081971966f},
+  {-1, -1, 0, 0, -0.003181095f},
+  {-1, -1, 0, 0, -0.026848394f},
+  {-1, -1, 0, 0, 0.01837452f},
+  {-1, -1, 0, 0, 0.042233597f},
+  {-1, -1, 0, 0, -0.0010209718f},
+  {-1, -1, 0, 0, -0.0021330833f},
+  {-1, -1, 0, 0, 0.021915246f},
+  {-1, -1, 0, 0, -0.0077238563f},
+  {-1, -1, 0, 0, 0.06705612f},
+  {-1, -1, 0, 0, -0.0203619f},
+  {-1, -1, 0, 0, 0.020451738f},
+  {-1, -1, 0, 0, -0.0133461645f},
+  {-1, -1, 0, 0, 0.0034151077f},
+  {-1, -1, 0, 0, -0.00041170287f},
+  {-1, -1, 0, 0, -0.037764996f},
+  {-1, -1, 0, 0, 0.027736772f},
+  {-1, -1, 0, 0, -0.005831367f},
+  {-1, -1, 0, 0, -0.054644655f},
+  {-1, -1, 0, 0, 0.0070270128f},
+  {-1, -1, 0, 0, 0.023067176f},
+  {-1, -1, 0, 0, -0.019152537f},
+  {-1, -1, 0, 0, 0.02783961f},
+  {-1, -1, 0, 0, -0.006223733f},
+  {-1, -1, 0, 0, -0.0019412161f},
+  {-1, -1, 0, 0, 0.021488285f},
+  {-1, -1, 0, 0, -0.0038035566f},
+  {-1, -1, 0, 0, -0.04006673f},
+  {-1, -1, 0, 0, 0.02862526f},
+  {-1, -1, 0, 0, -0.014260912f},
+  {8621, 8622, 10, 0, 0.7978636f},
+  {8623, 8624, 10, 0, 0.7968596f},
+  {8625, 8626, 10, 0, 0.81645775f},
+  {8627, 8628, 8, 0, 0.0f},
+  {8629, 8630, 1, 0, 7.7754765f},
+  {8631, 8632, 5, 0, 5.738449f},
+  {8633, 8634, 10, 0, 0.82047516f},
+  {8635, 8636, 5, 0, 5.165702f},
+  {8637, 8638, 1, 0, 4.1957583f},
+  {8639, 8640, 5, 0, 43.749844f},
+  {-1, -1, 0, 0, -0.07800402f},
+  {8641, 8642, 7, 0, 10.0f},
+  {8643, 8644, 5, 0, 6.425559f},
+  {8645, 8646, 1, 0, 3.4432666f},
+  {8647, 8648, 10, 0, 0.83648086f},
+  {8649, 8650, 5, 0, 4.5710354f},
+  {8651, 8652, 5, 0, 36.359806f},
+  {8653, 8654, 0, 0, 0.33f},
+  {8655, 8656, 1, 0, 4.324107f},
+  {-1, -1, 0, 0, -0.025036756f},
+  {-1, -1, 0, 0, 6.556511e-05f},
+  {8657, 8658, 10, 0, 0.8055525f},
+  {8659, 8660, 1, 0, 7.0130405f},
+  {8661, 8662, 0, 0, 1.0f},
+  {8663, 8664, 3, 0, 3.8254256f},
+  {8665, 8666, 5, 0, 3.0662608f},
+  {8667, 8668, 3, 0, 7.1573887f},
+  {8669, 8670, 3, 0, 17.801981f},
+  {8671, 8672, 9, 0, 3.0f},
+  {8673, 8674, 10, 0, 0.7671752f},
+  {-1, -1, 0, 0, -0.10472937f},
+  {8675, 8676, 1, 0, 9.0107f},
+  {8677, 8678, 1, 0, 12.552255f},
+  {8679, 8680, 8, 0, 1.0f},
+  {8681, 8682, 10, 0, 0.74279755f},
+  {8683, 8684, 10, 0, 0.6094279f},
+  {8685, 8686, 1, 0, 4.63365f},
+  {8687, 8688, 1, 0, 3.0097222f},
+  {8689, 8690, 1, 0, 3.0097222f},
+  {-1, -1, 0, 0, -0.030785525f},
+  {-1, -1, 0, 0, -0.008170701f},
+  {-1, -1, 0, 0, 0.10760488f},
+  {-1, -1, 0, 0, 0.006347561f},
+  {8691, 8692, 0, 0, 0.33f},
+  {8693, 8694, 2, 0, 1.0f},
+  {-1, -1, 0, 0, -0.019036103f},
+  {-1, -1, 0, 0, -0.086395696f},
+  {-1, -1, 0, 0, -0.021329045f},
+  {8695, 8696, 3, 0, 18.418673f},
+  {8697, 8698, 5, 0, 6.9453416f},
+  {8699, 8700, 1, 0, 8.658766f},
+  {8701, 8702, 0, 0, 1.0f},
+  {8703, 8704, 7, 0, 0.0f},
+  {-1, -1, 0, 0, -0.025171146f},
+  {-1, -1, 0, 0, 0.040335085f},
+  {-1, -1, 0, 0, 0.021206364f},
+  {-1, -1, 0, 0, -0.012673939f},
+  {-1, -1, 0, 0, -0.050825834f},
+  {-1, -1, 0, 0, 0.009394696f},
+  {-1, -1, 0, 0, 0.035789013f},
+  {-1, -1, 0, 0, -0.00023982748f},
+  {-1, -1, 0, 0, 0.0049690176f},
+  {-1, -1, 0, 0, -0.012138881f},
+  {-1, -1, 0, 0, 0.014256923f},
+  {-1, -1, 0, 0, -0.052624453f},
+  {-1, -1, 0, 0, 0.028407529f},
+  {-1, -1, 0, 0, -0.0013159373f},
+  {-1, -1, 0, 0, 0.028804824f},
+  {-1, -1, 0, 0, -0.0007013798f},
+  {-1, -1, 0, 0, -0.002389002f},
+  {-1, -1, 0, 0, -0.010713252f},
+  {-1, -1, 0, 0, 0.007510487f},
+  {-1, -1, 0, 0, 0.04396489f},
+  {-1, -1, 0, 0, 0.019409738f},
+  {-1, -1, 0, 0, -0.022276783f},
+  {-1, -1, 0, 0, 0.0111415265f},
+  {-1, -1, 0, 0, -0.009054327f},
+  {-1, -1, 0, 0, 0.049230833f},
+  {-1, -1, 0, 0, 0.007375674f},
+  {-1, -1, 0, 0, -0.02835528f},
+  {-1, -1, 0, 0, 0.023027724f},
+  {-1, -1, 0, 0, -0.0006624136f},
+  {-1, -1, 0, 0, -0.030557564f},
+  {-1, -1, 0, 0, 0.032772224f},
+  {-1, -1, 0, 0, 0.00035685961f},
+  {8706, 8707, 1, 0, 38.58884f},
+  {8708, 8709, 3, 0, 29.96273f},
+  {8710, 8711, 3, 0, 3.025743f},
+  {8712, 8713, 5, 0, 43.30592f},
+  {8714, 8715, 7, 0, 8.0f},
+  {8716, 8717, 1, 0, 46.55334f},
+  {8718, 8719, 1, 0, 41.283264f},
+  {8720, 8721, 1, 0, 31.168713f},
+  {8722, 8723, 7, 0, 0.0f},
+  {8724, 8725, 3, 0, 32.131393f},
+  {8726, 8727, 3, 0, 32.799465f},
+  {8728, 8729, 8, 0, 1.0f},
+  {8730, 8731, 7, 0, 1.0f},
+  {8732, 8733, 3, 0, 20.063751f},
+  {8734, 8735, 10, 0, 0.7729976f},
+  {8736, 8737, 3, 0, 27.815134f},
+  {8738, 8739, 3, 0, 27.815134f},
+  {8740, 8741, 5, 0, 47.428215f},
+  {8742, 8743, 1, 0, 11.328481f},
+  {8744, 8745, 5, 0, 13.62889f},
+  {8746, 8747, 3, 0, 34.17537f},
+  {8748, 8749, 7, 0, 14.0f},
+  {8750, 8751, 3, 0, 34.650505f},
+  {8752, 8753, 7, 0, 0.0f},
+  {-1, -1, 0, 0, 0.023329187f},
+  {-1, -1, 0, 0, -0.005881557f},
+  {-1, -1, 0, 0, 0.03101623f},
+  {8754, 8755, 3, 0, 12.934116f},
+  {8756, 8757, 10, 0, 0.7565905f},
+  {8758, 8759, 1, 0, 49.252625f},
+  {8760, 8761, 3, 0, 26.046522f},
+  {8762, 8763, 3, 0, 26.408699f},
+  {8764, 8765, 7, 0, 0.0f},
+  {8766, 8767, 10, 0, 0.8565808f},
+  {-1, -1, 0, 0, -0.08251346f},
+  {8768, 8769, 8, 0, 1.0f},
+  {-1, -1, 0, 0, -0.012451941f},
+  {8770, 8771, 7, 0, 11.0f},
+  {8772, 8773, 3, 0, 12.183211f},
+  {8774, 8775, 7, 0, 1.0f},
+  {8776, 8777, 5, 0, 44.91239f},
+  {8778, 8779, 10, 0, 0.6455678f},
+  {8780, 8781, 3, 0, 39.509468f},
+  {-1, -1, 0, 0, 0.054059446f},
+  {-1, -1, 0, 0, 0.01533699f},
+  {8782, 8783, 1, 0, 8.214931f},
+  {8784, 8785, 10, 0, 0.6035007f},
+  {8786, 8787, 1, 0, 39.8811f},
+  {8788, 8789, 6, 0, 1.0f},
+  {-1, -1, 0, 0, 0.009919294f},
+  {-1, -1, 0, 0, -0.029772341f},
+  {8790, 8791, 3, 0, 45.361435f},
+  {8792, 8793, 10, 0, 0.87471986f},
+  {8794, 8795, 10, 0, 0.71556145f},
+  {8796, 8797, 3, 0, 18.014326f},
+  {8798, 8799, 1, 0, 45.479824f},
+  {8800, 8801, 1, 0, 49.252625f},
+  {-1, -1, 0, 0, -3.6017773e-05f},
+  {-1, -1, 0, 0, -0.0411057f},
+  {-1, -1, 0, 0, 0.0809096f},
+  {-1, -1, 0, 0, 0.008994867f},
+  {-1, -1, 0, 0, -0.00013613701f},
+  {-1, -1, 0, 0, -0.03798918f},
+  {-1, -1, 0, 0, 0.09053989f},
+  {-1, -1, 0, 0, -0.0012668729f},
+  {-1, -1, 0, 0, -0.021984382f},
+  {-1, -1, 0, 0, 0.01487716f},
+  {-1, -1, 0, 0, 0.030610476f},
+  {-1, -1, 0, 0, -0.0044046403f},
+  {-1, -1, 0, 0, -0.09566401f},
+  {-1, -1, 0, 0, -0.029745946f},
+  {-1, -1, 0, 0, -0.0024242697f},
+  {-1, -1, 0, 0, -0.054736912f},
+  {-1, -1, 0, 0, 0.04011345f},
+  {-1, -1, 0, 0, 0.0014641738f},
+  {-1, -1, 0, 0, -0.017868582f},
+  {-1, -1, 0, 0, -0.00050939905f},
+  {-1, -1, 0, 0, -0.021395905f},
+  {-1, -1, 0, 0, -0.00026474f},
+  {-1, -1, 0, 0, 0.027344456f},
+  {-1, -1, 0, 0, 0.004490432f},
+  {-1, -1, 0, 0, -0.005570531f},
+  {-1, -1, 0, 0, -0.08147533f},
+  {-1, -1, 0, 0, -0.015942914f},
+  {-1, -1, 0, 0, 0.014044309f},
+  {-1, -1, 0, 0, 0.021459235f},
+  {-1, -1, 0, 0, 0.003035593f},
+  {-1, -1, 0, 0, 0.07738282f},
+  {-1, -1, 0, 0, 0.025978569f},
+  {-1, -1, 0, 0, 0.0064424463f},
+  {-1, -1, 0, 0, 0.032145295f},
+  {-1, -1, 0, 0, -0.02195164f},
+  {-1, -1, 0, 0, -0.007047664f},
+  {-1, -1, 0, 0, 0.022860555f},
+  {-1, -1, 0, 0, -0.012323192f},
+  {-1, -1, 0, 0, -0.022555387f},
+  {-1, -1, 0, 0, -0.006182623f},
+  {8803, 8804, 10, 0, 0.6807112f},
+  {8805, 8806, 10, 0, 0.6658525f},
+  {8807, 8808, 10, 0, 0.7266901f},
+  {8809, 8810, 5, 0, 7.070297f},
+  {8811, 8812, 1, 0, 28.756657f},
+  {8813, 8814, 1, 0, 34.839024f},
+  {8815, 8816, 10, 0, 0.78809464f},
+  {8817, 8818, 1, 0, 8.45157f},
+  {8819, 8820, 5, 0, 7.282547f},
+  {8821, 8822, 1, 0, 4.324107f},
+  {8823, 8824, 7, 0, 0.0f},
+  {8825, 8826, 3, 0, 3.471103f},
+  {8827, 8828, 3, 0, 3.025743f},
+  {8829, 8830, 1, 0, 37.049507f},
+  {8831, 8832, 10, 0, 0.7907391f},
+  {8833, 8834, 5, 0, 4.5710354f},
+  {8835, 8836, 1, 0, 9.35647f},
+  {8837, 8838, 3, 0, 3.025743f},
+  {8839, 8840, 0, 0, 0.67f},
+  {8841, 8842, 3, 0, 27.330963f},
+  {8843, 8844, 1, 0, 20.669693f},
+  {-1, -1, 0, 0, 0.0501105f},
+  {8845, 8846, 10, 0, 0.6714846f},
+  {8847, 8848, 2, 0, 1.0f},
+  {8849, 8850, 3, 0, 4.169726f},
+  {8851, 8852, 5, 0, 39.35422f},
+  {8853, 8854, 5, 0, 28.571396f},
+  {8855, 8856, 1, 0, 3.166155f},
+  {8857, 8858, 1, 0, 41.283264f},
+  {8859, 8860, 0, 0, 0.67f},
+  {8861, 8862, 9, 0, 3.0f},
+  {8863, 8864, 5, 0, 3.125053f},
+  {8865, 8866, 7, 0, 13.0f},
+  {8867, 8868, 7, 0, 20.0f},
+  {8869, 8870, 10, 0, 0.6226886f},
+  {-1, -1, 0, 0, -0.010165072f},
+  {-1, -1, 0, 0, -0.060775824f},
+  {8871, 8872, 1, 0, 15.640303f},
+  {8873, 8874, 8, 0, 1.0f},
+  {8875, 8876, 7, 0, 25.0f},
+  {8877, 8878, 1, 0, 3.0097222f},
+  {8879, 8880, 5, 0, 12.42904f},
+  {-1, -1, 0, 0, -0.04323138f},
+  {8881, 8882, 3, 0, 27.330963f},
+  {8883, 8884, 3, 0, 13.972971f},
+  {8885, 8886, 10, 0, 0.71037996f},
+  {8887, 8888, 1, 0, 3.4778516f},
+  {8889, 8890, 9, 0, 3.0f},
+  {8891, 8892, 1, 0, 19.314367f},
+  {-1, -1, 0, 0, -0.06714266f},
+  {-1, -1, 0, 0, 0.0083197355f},
+  {8893, 8894, 1, 0, 40.404446f},
+  {8895, 8896, 7, 0, 4.0f},
+  {8897, 8898, 5, 0, 39.35422f},
+  {8899, 8900, 3, 0, 19.209251f},
+  {8901, 8902, 3, 0, 3.025743f},
+  {8903, 8904, 10, 0, 0.7729976f},
+  {8905, 8906, 1, 0, 5.7235174f},
+  {-1, -1, 0, 0, -0.007830477f},
+  {8907, 8908, 7, 0, 2.0f},
+  {8909, 8910, 10, 0, 0.7930618f},
+  {-1, -1, 0, 0, 0.009150913f},
+  {-1, -1, 0, 0, -0.013484555f},
+  {-1, -1, 0, 0, 0.038600933f},
+  {-1, -1, 0, 0, 0.0059001264f},
+  {-1, -1, 0, 0, -0.049288742f},
+  {-1, -1, 0, 0, 0.016265346f},
+  {-1, -1, 0, 0, 0.020448925f},
+  {-1, -1, 0, 0, -0.021960827f},
+  {-1, -1, 0, 0, 0.00509615f},
+  {-1, -1, 0, 0, -0.008116217f},
+  {-1, -1, 0, 0, -0.021378797f},
+  {-1, -1, 0, 0, 0.0085376045f},
+  {-1, -1, 0, 0, -0.04721717f},
+  {-1, -1, 0, 0, -0.0061968802f},
+  {-1, -1, 0, 0, 0.005061722f},
+  {-1, -1, 0, 0, -0.00093994144f},
+  {-1, -1, 0, 0, -0.013980612f},
+  {-1, -1, 0, 0, 0.008633356f},
+  {-1, -1, 0, 0, 0.02113994f},
+  {-1, -1, 0, 0, 0.0055350065f},
+  {-1, -1, 0, 0, -0.015530332f},
+  {-1, -1, 0, 0, 0.002883816f},
+  {-1, -1, 0, 0, 0.016700812f},
+  {-1, -1, 0, 0, 0.10759979f},
+  {-1, -1, 0, 0, 0.059721757f},
+  {-1, -1, 0, 0, -0.005691642f},
+  {-1, -1, 0, 0, -0.006225459f},
+  {-1, -1, 0, 0, -0.07011481f},
+  {-1, -1, 0, 0, 0.010285597f},
+  {-1, -1, 0, 0, -0.014781344f},
+  {-1, -1, 0, 0, 0.00297668f},
+  {-1, -1, 0, 0, 0.018534204f},
+  {-1, -1, 0, 0, -0.021113086f},
+  {-1, -1, 0, 0, 0.00089423655f},
+  {-1, -1, 0, 0, 0.010673499f},
+  {-1, -1, 0, 0, -0.044729415f},
+  {-1, -1, 0, 0, -0.0061078966f},
+  {-1, -1, 0, 0, -0.02613522f},
+  {-1, -1, 0, 0, -0.0052920105f},
+  {-1, -1, 0, 0, 0.05291617f},
+  {-1, -1, 0, 0, 0.016369045f},
+  {-1, -1, 0, 0, -0.017875765f},
+  {-1, -1, 0, 0, 0.025850391f},
+  {-1, -1, 0, 0, 0.07520413f},
+  {-1, -1, 0, 0, -0.0057174657f},
+  {-1, -1, 0, 0, 0.0020590303f},
+  {-1, -1, 0, 0, 0.07623768f},
+  {-1, -1, 0, 0, 0.006214813f},
+  {8912, 8913, 1, 0, 5.8026752f},
+  {8914, 8915, 1, 0, 4.8713284f},
+  {8916, 8917, 1, 0, 6.2872834f},
+  {8918, 8919, 5, 0, 48.053078f},
+  {8920, 8921, 5, 0, 5.066704f},
+  {8922, 8923, 10, 0, 0.72457737f},
+  {8924, 8925, 1, 0, 6.4866323f},
+  {8926, 8927, 5, 0, 46.093723f},
+  {8928, 8929, 1, 0, 3.1296585f},
+  {8930, 8931, 7, 0, 0.0f},
+  {8932, 8933, 1, 0, 5.0574846f},
+  {8934, 8935, 3, 0, 4.269622f},
+  {8936, 8937, 10, 0, 0.89589566f},
+  {8938, 8939, 5, 0, 7.9532037f},
+  {8940, 8941, 10, 0, 0.9362309f},
+  {8942, 8943, 5, 0, 42.43611f},
+  {-1, -1, 0, 0, 0.033733893f},
+  {-1, -1, 0, 0, -0.035233457f},
+  {-1, -1, 0, 0, -0.008968783f},
+  {8944, 8945, 0, 0, 0.33f},
+  {8946, 8947, 10, 0, 0.68997234f},
+  {8948, 8949, 7, 0, 17.0f},
+  {8950, 8951, 1, 0, 5.315942f},
+  {8952, 8953, 7, 0, 16.0f},
+  {8954, 8955, 8, 0, 0.0f},
+  {8956, 8957, 3, 0, 36.098396f},
+  {8958, 8959, 10, 0, 0.9348987f},
+  {8960, 8961, 0, 0, 1.0f},
+  {8962, 8963, 7, 0, 0.0f},
+  {8964, 8965, 10, 0, 0.9192665f},
+  {8966, 8967, 3, 0, 44.016357f},
+  {8968, 8969, 5, 0, 28.571396f},
+  {8970, 8971, 9, 0, 1.0f},
+  {-1, -1, 0, 0, -0.014591026f},
+  {8972, 8973, 10, 0, 0.9181752f},
+  {8974, 8975, 8, 0, 0.0f},
+  {8976, 8977, 1, 0, 4.9454913f},
+  {8978, 8979, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.008057403f},
+  {8980, 8981, 7, 0, 13.0f},
+  {8982, 8983, 3, 0, 5.203249f},
+  {8984, 8985, 0, 0, 0.67f},
+  {-1, -1, 0, 0, -0.012872188f},
+  {8986, 8987, 1, 0, 6.0881815f},
+  {8988, 8989, 3, 0, 46.39685f},
+  {8990, 8991, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, -0.052073f},
+  {8992, 8993, 5, 0, 5.9959955f},
+  {8994, 8995, 1, 0, 5.937119f},
+  {8996, 8997, 3, 0, 6.417849f},
+  {-1, -1, 0, 0, -0.0060814857f},
+  {-1, -1, 0, 0, -0.02820088f},
+  {8998, 8999, 8, 0, 1.0f},
+  {9000, 9001, 1, 0, 6.9175615f},
+  {9002, 9003, 1, 0, 7.3127937f},
+  {9004, 9005, 5, 0, 5.8729773f},
+  {-1, -1, 0, 0, 0.018978024f},
+  {-1, -1, 0, 0, -0.00011566173f},
+  {-1, -1, 0, 0, 0.013867015f},
+  {-1, -1, 0, 0, -0.040541008f},
+  {-1, -1, 0, 0, 0.007541243f},
+  {-1, -1, 0, 0, 0.057453807f},
+  {-1, -1, 0, 0, 0.009121704f},
+  {-1, -1, 0, 0, -0.025250053f},
+  {-1, -1, 0, 0, 0.021032298f},
+  {-1, -1, 0, 0, 0.017967701f},
+  {-1, -1, 0, 0, -0.023373092f},
+  {-1, -1, 0, 0, -0.02414372f},
+  {-1, -1, 0, 0, -0.08624819f},
+  {-1, -1, 0, 0, -0.007479459f},
+  {-1, -1, 0, 0, 0.0151727125f},
+  {-1, -1, 0, 0, -0.041985072f},
+  {-1, -1, 0, 0, -0.0063707563f},
+  {-1, -1, 0, 0, 0.0013827205f},
+  {-1, -1, 0, 0, 0.0323401f},
+  {-1, -1, 0, 0, -0.0037281036f},
+  {-1, -1, 0, 0, 0.0344944f},
+  {-1, -1, 0, 0, -0.025386397f},
+  {-1, -1, 0, 0, 0.02471657f},
+  {-1, -1, 0, 0, 0.009340706f},
+  {-1, -1, 0, 0, 0.050459336f},
+  {-1, -1, 0, 0, -0.051138617f},
+  {-1, -1, 0, 0, -0.008168062f},
+  {-1, -1, 0, 0, 0.01078043f},
+  {-1, -1, 0, 0, 0.046426106f},
+  {-1, -1, 0, 0, -0.020481253f},
+  {-1, -1, 0, 0, -0.05638981f},
+  {-1, -1, 0, 0, 0.021916807f},
+  {-1, -1, 0, 0, -0.008402952f},
+  {-1, -1, 0, 0, 0.011138615f},
+  {-1, -1, 0, 0, -0.00060121214f},
+  {-1, -1, 0, 0, -0.012608386f},
+  {-1, -1, 0, 0, 0.02620669f},
+  {-1, -1, 0, 0, -0.034439955f},
+  {-1, -1, 0, 0, -0.005510831f},
+  {9007, 9008, 1, 0, 5.8026752f},
+  {9009, 9010, 1, 0, 4.8713284f},
+  {9011, 9012, 1, 0, 6.2872834f},
+  {9013, 9014, 5, 0, 48.053078f},
+  {9015, 9016, 5, 0, 5.066704f},
+  {9017, 9018, 10, 0, 0.72457737f},
+  {9019, 9020, 1, 0, 6.4866323f},
+  {9021, 9022, 10, 0, 0.64811784f},
+  {9023, 9024, 1, 0, 3.0097222f},
+  {9025, 9026, 7, 0, 0.0f},
+  {9027, 9028, 1, 0, 5.0574846f},
+  {9029, 9030, 3, 0, 4.269622f},
+  {9031, 9032, 10, 0, 0.89589566f},
+  {9033, 9034, 5, 0, 7.9532037f},
+  {9035, 9036, 10, 0, 0.9362309f},
+  {9037, 9038, 10, 0, 0.6320151f},
+  {9039, 9040, 10, 0, 0.6807112f},
+  {-1, -1, 0, 0, -0.03605985f},
+  {-1, -1, 0, 0, -0.013074987f},
+  {9041, 9042, 0, 0, 0.33f},
+  {9043, 9044, 10, 0, 0.68997234f},
+  {9045, 9046, 7, 0, 17.0f},
+  {9047, 9048, 1, 0, 5.315942f},
+  {9049, 9050, 7, 0, 16.0f},
+  {9051, 9052, 8, 0, 0.0f},
+  {9053, 9054, 3, 0, 36.098396f},
+  {9055, 9056, 10, 0, 0.9348987f},
+  {9057, 9058, 3, 0, 25.580477f},
+  {9059, 9060, 5, 0, 41.56447f},
+  {9061, 9062, 10, 0, 0.8872101f},
+  {9063, 9064, 3, 0, 44.016357f},
+  {9065, 9066, 7, 0, 3.0f},
+  {9067, 9068, 8, 0, 1.0f},
+  {9069, 9070, 7, 0, 24.0f},
+  {9071, 9072, 10, 0, 0.6837547f},
+  {-1, -1, 0, 0, -0.013861465f},
+  {9073, 9074, 3, 0, 3.025743f},
+  {9075, 9076, 8, 0, 0.0f},
+  {9077, 9078, 10, 0, 0.8055525f},
+  {9079, 9080, 0, 0, 0.67f},
+  {-1, -1, 0, 0, 0.0076545714f},
+  {9081, 9082, 1, 0, 5.2587895f},
+  {9083, 9084, 1, 0, 5.4009275f},
+  {9085, 9086, 0, 0, 0.67f},
+  {-1, -1, 0, 0, -0.012014008f},
+  {9087, 9088, 1, 0, 6.0881815f},
+  {9089, 9090, 3, 0, 46.39685f},
+  {9091, 9092, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, -0.04946935f},
+  {9093, 9094, 5, 0, 5.9959955f},
+  {9095, 9096, 1, 0, 5.937119f},
+  {9097, 9098, 3, 0, 7.178031f},
+  {-1, -1, 0, 0, -0.0043863775f},
+  {9099, 9100, 5, 0, 20.319654f},
+  {-1, -1, 0, 0, 0.029336452f},
+  {9101, 9102, 10, 0, 0.847138f},
+  {9103, 9104, 7, 0, 27.0f},
+  {9105, 9106, 7, 0, 15.0f},
+  {-1, -1, 0, 0, 0.017712815f},
+  {-1, -1, 0, 0, -0.027639285f},
+  {-1, -1, 0, 0, 0.011418976f},
+  {-1, -1, 0, 0, 0.015973335f},
+  {-1, -1, 0, 0, 0.09613439f},
+  {-1, -1, 0, 0, -0.008955604f},
+  {-1, -1, 0, 0, -0.048719525f},
+  {-1, -1, 0, 0, 0.03990934f},
+  {-1, -1, 0, 0, 0.00012823007f},
+  {-1, -1, 0, 0, 0.016449546f},
+  {-1, -1, 0, 0, 0.056795727f},
+  {-1, -1, 0, 0, -0.02398758f},
+  {-1, -1, 0, 0, 0.01919197f},
+  {-1, -1, 0, 0, -0.029451137f},
+  {-1, -1, 0, 0, -0.0020672118f},
+  {-1, -1, 0, 0, -0.022332931f},
+  {-1, -1, 0, 0, -0.07934832f},
+  {-1, -1, 0, 0, -0.0023839276f},
+  {-1, -1, 0, 0, 0.023704084f},
+  {-1, -1, 0, 0, -0.050031107f},
+  {-1, -1, 0, 0, -0.010799191f},
+  {-1, -1, 0, 0, 0.0012790085f},
+  {-1, -1, 0, 0, 0.029914571f},
+  {-1, -1, 0, 0, -0.0034795124f},
+  {-1, -1, 0, 0, 0.03276968f},
+  {-1, -1, 0, 0, -0.023043003f},
+  {-1, -1, 0, 0, 0.023480749f},
+  {-1, -1, 0, 0, 0.008593484f},
+  {-1, -1, 0, 0, 0.045653727f},
+  {-1, -1, 0, 0, -0.04730325f},
+  {-1, -1, 0, 0, -0.0076235454f},
+  {-1, -1, 0, 0, 0.0102414135f},
+  {-1, -1, 0, 0, 0.044104766f},
+  {-1, -1, 0, 0, -0.024818834f},
+  {-1, -1, 0, 0, -0.05688257f},
+  {-1, -1, 0, 0, -0.00022180557f},
+  {-1, -1, 0, 0, -0.026320806f},
+  {-1, -1, 0, 0, 0.0015764342f},
+  {-1, -1, 0, 0, -0.013129738f},
+  {-1, -1, 0, 0, 0.01268833f},
+  {-1, -1, 0, 0, -0.015895959f},
+  {-1, -1, 0, 0, -0.02521368f},
+  {-1, -1, 0, 0, 0.009966612f},
+  {9108, 9109, 1, 0, 49.252625f},
+  {9110, 9111, 1, 0, 38.58884f},
+  {9112, 9113, 5, 0, 29.886265f},
+  {9114, 9115, 3, 0, 29.96273f},
+  {9116, 9117, 3, 0, 3.025743f},
+  {-1, -1, 0, 0, -0.00814287f},
+  {-1, -1, 0, 0, -0.021721268f},
+  {9118, 9119, 5, 0, 43.30592f},
+  {9120, 9121, 7, 0, 8.0f},
+  {9122, 9123, 1, 0, 46.55334f},
+  {9124, 9125, 7, 0, 0.0f},
+  {9126, 9127, 1, 0, 31.168713f},
+  {9128, 9129, 7, 0, 0.0f},
+  {9130, 9131, 3, 0, 32.131393f},
+  {9132, 9133, 3, 0, 32.799465f},
+  {9134, 9135, 10, 0, 0.7067397f},
+  {9136, 9137, 7, 0, 1.0f},
+  {9138, 9139, 3, 0, 12.934116f},
+  {9140, 9141, 10, 0, 0.87471986f},
+  {9142, 9143, 3, 0, 27.815134f},
+  {9144, 9145, 3, 0, 27.815134f},
+  {9146, 9147, 5, 0, 47.428215f},
+  {9148, 9149, 1, 0, 11.328481f},
+  {9150, 9151, 5, 0, 13.62889f},
+  {9152, 9153, 1, 0, 37.34242f},
+  {9154, 9155, 0, 0, 0.67f},
+  {9156, 9157, 3, 0, 34.650505f},
+  {9158, 9159, 7, 0, 0.0f},
+  {9160, 9161, 10, 0, 0.7139662f},
+  {-1, -1, 0, 0, -0.0046150587f},
+  {-1, -1, 0, 0, 0.02684617f},
+  {9162, 9163, 0, 0, 0.33f},
+  {-1, -1, 0, 0, 0.04477888f},
+  {9164, 9165, 3, 0, 45.69609f},
+  {9166, 9167, 3, 0, 46.052345f},
+  {-1, -1, 0, 0, -0.00039750655f},
+  {-1, -1, 0, 0, 0.019514233f},
+  {-1, -1, 0, 0, -0.0066135265f},
+  {-1, -1, 0, 0, -0.07593586f},
+  {-1, -1, 0, 0, 0.057188958f},
+  {-1, -1, 0, 0, -0.009917564f},
+  {-1, -1, 0, 0, -0.0071889395f},
+  {-1, -1, 0, 0, 0.01630241f},
+  {-1, -1, 0, 0, -0.059956092f},
+  {-1, -1, 0, 0, -0.014282514f},
+  {-1, -1, 0, 0, -0.00069020863f},
+  {-1, -1, 0, 0, -0.041336015f},
+  {-1, -1, 0, 0, 0.052841853f},
+  {-1, -1, 0, 0, 0.01795261f},
+  {-1, -1, 0, 0, -0.017297745f},
+  {-1, -1, 0, 0, 0.0061952868f},
+  {-1, -1, 0, 0, 0.019608451f},
+  {-1, -1, 0, 0, -0.009149649f},
+  {-1, -1, 0, 0, -0.074093185f},
+  {-1, -1, 0, 0, -0.01190803f},
+  {-1, -1, 0, 0, 0.0027790784f},
+  {-1, -1, 0, 0, 0.011080361f},
+  {-1, -1, 0, 0, 0.012880084f},
+  {-1, -1, 0, 0, -0.014988884f},
+  {-1, -1, 0, 0, -0.012037522f},
+  {-1, -1, 0, 0, 0.0155702f},
+};
+
+constexpr uint16_t ROOTS[100] = {
+  0, 75, 150, 227, 308, 385, 472, 551, 626, 701, 776, 851,
+  944, 1025, 1116, 1207, 1302, 1403, 1498, 1601, 1708, 1803, 1902, 1993,
+  2112, 2219, 2332, 2431, 2548, 2655, 2772, 2889, 2996, 3119, 3238, 3353,
+  3466, 3587, 3688, 3807, 3922, 4025, 4128, 4243, 4342, 4447, 4548, 4643,
+  4744, 4851, 4950, 5061, 5138, 5239, 5352, 5435, 5544, 5645, 5746, 5839,
+  5922, 5997, 6092, 6157, 6246, 6313, 6424, 6479, 6568, 6655, 6732, 6821,
+  6890, 6985, 7098, 7197, 7240, 7319, 7374, 7441, 7544, 7617, 7664, 7739,
+  7778, 7885, 7954, 8013, 8084, 8187, 8250, 8323, 8432, 8541, 8620, 8705,
+  8802, 8911, 9006, 9107,
+};
+
+constexpr TreeEnsemble MODEL = {NODES, ROOTS, 100, FEATURE_COUNT, 12.081667f};
+
+}  // namespace capacity_model
@@ -7,9 +7,18 @@
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
+#include <ConnectionManager.h>
+#include <HttpSession.h>
+#include <LcdRenderer.h>
+#include "capacity_model.h"  // generated by server/flask/Deployment/export_model_header.py
+#include "ESP32MQTTClient.h"
+#include "esp_heap_caps.h"
+#include <new>
 
 // Audio Libraries (ESP8266Audio)
 #include "AudioFileSourceSD.h"
+#include "AudioFileSourceBuffer.h"
+#include "AudioFileSourcePROGMEM.h"
 #include "AudioOutputI2S.h"
 #include "AudioGeneratorMP3.h"
 
@@ -36,28 +45,71 @@ const char* password = ""; //Input WIFI or Hotspot Password
 
 // Server Configuration
 const char* serverURL = ""; //Input Server URL with predict Endpoint
+const char* mqttServer = "mqtt://157.230.250.226:1883";
+const char* mqttHealthTopic = "nus-smartstop-diag/actuator/health";  // not ingested by Telegraf
+// Retained; published by background_predictor.py on every new prediction
+const char* mqttPredictionTopic = "nus-smartstop-pred/capacity";
+// Live readings for the local model: single samples on the data topics,
+// bursts (JSON arrays, newest last) on the batch topics
+const char* mqttIrTopic = "nus-smartstop/ir-sensor/data";
+const char* mqttIrBatchTopic = "nus-smartstop-batch/ir-sensor";
+const char* mqttUltrasonicTopic = "nus-smartstop/ultrasonic/data";
+const char* mqttUltrasonicBatchTopic = "nus-smartstop-batch/ultrasonic";
+const int MQTT_MAX_PACKET = 4096;  // a full IR or ultrasonic burst in one DATA event
+
+// 1: predictions are pushed over MQTT and HTTP polling only runs while the
+// broker is unreachable or the topic goes quiet. 0: always poll serverURL.
+#ifndef PREDICTION_MQTT
+#define PREDICTION_MQTT 1
+#endif
 
 // ============================
 // ====== OBJECTS & VARS ======
 // ============================
 // LCD: I2C address 0x27, 16x2 display
 LiquidCrystal_I2C lcd(0x27, 16, 2);
+LcdRenderer screen(0x27);  // shadow-buffered redraws after init
 Servo myServo;
+ConnectionManager net;  // background WiFi reconnect with backoff
+ESP32MQTTClient mqttClient;  // health metrics; esp-mqtt reconnects on its own
 
-AudioFileSourceSD *fileSource = NULL;
+// Sources are static and reopened per clip, and the decoder runs in
+// mp3Space instead of mallocing its buffers in every begin(), so switching
+// tracks never touches the heap. The prefetch wrapper has no way to rebind
+// its input, so it is rebuilt in place in prefetchSlot.
+AudioFileSource   *fileSource = NULL;   // what the decoder reads: ramFile or prefetch
+AudioFileSourceSD sdFile;
+AudioFileSourcePROGMEM ramFile;
+alignas(AudioFileSourceBuffer) uint8_t prefetchSlot[sizeof(AudioFileSourceBuffer)];
+AudioFileSourceBuffer *prefetch = NULL;  // lives in prefetchSlot while streaming
 AudioOutputI2S    *out = NULL;
 AudioGeneratorMP3 *mp3 = NULL;
+alignas(4) uint8_t mp3Space[AudioGeneratorMP3::preAllocSize()];
 
 // Timing Variables
 unsigned long lastUpdate = 0;
-const unsigned long UPDATE_INTERVAL = 2000; // Update LCD & Data every 2 seconds
+const unsigned long UPDATE_INTERVAL = 2000; // Update Data every 2 seconds
+
+unsigned long lastLcdRefresh = 0;
+const unsigned long LCD_REFRESH_INTERVAL = 200; // Redraw LCD every 200 ms (only changed cells are sent)
+unsigned long lastPredictionMs = 0;  // when the last good server prediction arrived
+bool predictionIsLocal = false;      // predictedCapacity comes from the on-device model
+
+const unsigned long PREDICTION_INTERVAL = 10000; // Request prediction every 10 seconds (fetched off the main loop)
+const unsigned long PREDICTION_STALE_MS = 90000; // MQTT silent this long (3 predictor cycles) -> poll HTTP again
+// Idle time after which the prediction socket is reopened. It must exceed the
+// poll gap or every poll pays a fresh handshake; the Flask server keeps
+// idle HTTP/1.1 connections open, so only NAT/AP timeouts bound it.
+const unsigned long PREDICTION_IDLE_MS = PREDICTION_INTERVAL + 5000;
+static_assert(PREDICTION_IDLE_MS > PREDICTION_INTERVAL, "prediction polls would never reuse the socket");
+const unsigned long SENSOR_STALE_MS = 60000;     // node readings older than this count as missing
 
-unsigned long lastPredictionRequest = 0;
-const unsigned long PREDICTION_INTERVAL = 30000; // Request prediction every 30 seconds
+unsigned long lastHealth = 0;
+const unsigned long HEALTH_INTERVAL = 30000; // Publish heap/audio health every 30 seconds
 
-// State & Data Variables
+// State & Data Variables (latest node readings, copied from sensorFeed)
 int peopleCount = 0;
-float distance = 0.0;
+float distance = 0.0;   // centre zone, cm
 bool voiceDetected = false;
 float predictedCapacity = 0.0;  // New: Store predicted capacity from server
 
@@ -65,204 +117,582 @@ float predictedCapacity = 0.0;  // New: Store predicted capacity from server
 bool isFullCapacity = false;
 int normalPlaylistIndex = 0;
 bool audioAvailable = false;  // Track if audio is available
-bool predictionInProgress = false;  // Track if prediction request is ongoing
-unsigned long predictionStartTime = 0;
-HTTPClient* asyncHttp = NULL;  // For non-blocking HTTP 
 
-// Audio pause/resume state
-bool audioWasPausedForPrediction = false; 
+// Audio task: owns the decoder, SD reads and playlist. It runs on core 1
+// above loop()'s priority (core 0 has WiFi and the prediction task), so
+// LCD/servo work only runs in the gaps the decoder leaves.
+#define AUDIO_TASK_PRIORITY   3
+#define AUDIO_STALL_MS        30                // gap between decoder calls that risks an I2S underrun
+#define PREFETCH_BYTES_PSRAM  (64 * 1024)
+#define PREFETCH_BYTES_DRAM   (8 * 1024)
+#define PRELOAD_BUDGET_PSRAM  (1024 * 1024)     // clips kept in RAM at boot
+#define PRELOAD_BUDGET_DRAM   (32 * 1024)       // enough for the warning clip alone
+
+struct AudioClip {
+  const char *path;
+  uint8_t *data;  // preloaded copy, NULL when streamed from SD
+  uint32_t len;
+};
+// Warning first so it wins the preload budget
+AudioClip clips[] = {
+  { "/MP3/fullcapacity.mp3", NULL, 0 },
+  { "/MP3/bus3min.mp3", NULL, 0 },
+  { "/MP3/bus1min.mp3", NULL, 0 },
+  { "/MP3/busbreakdown.mp3", NULL, 0 },
+};
+const int CLIP_FULL = 0;
+const int CLIP_COUNT = sizeof(clips) / sizeof(clips[0]);
+
+QueueHandle_t audioModeQueue = NULL;  // loop() -> audio task: isFullCapacity changes
+uint8_t *prefetchBuf = NULL;
+uint32_t prefetchBytes = 0;
+volatile uint32_t audioUnderruns = 0;  // prefetch buffer ran dry
+volatile uint32_t audioStalls = 0;     // decoder starved for > AUDIO_STALL_MS
+
+// Prediction task (core 0) -> loop(); one-slot mailbox, newest result wins
+struct PredictionResult {
+  bool ok;
+  float capacity;
+  int httpCode;           // 0 when pushed over MQTT
+  unsigned long durationMs;
+};
+QueueHandle_t predictionQueue = NULL;
+volatile unsigned long lastPushedPredictionMs = 0;  // written from the MQTT task
+// The broker replays the retained prediction on every (re)subscribe, however
+// old. Without a synced clock its age is unknown, so that first message is
+// dropped and HTTP polling covers the gap. MQTT task only.
+bool predictionReplayPending = false;
+const time_t CLOCK_VALID_AFTER = 1600000000;  // time(nullptr) below this: SNTP has not synced
+HttpSession predictSession;  // keep-alive connection, owned by the prediction task
+#define PREDICT_BODY_MAX 1024
+char predictBody[PREDICT_BODY_MAX];  // only for chunked replies and draining error bodies
 
 // ============================
 // ====== AUDIO HELPER ========
 // ============================
-void playFile(const char* filename) {
+void onPrefetchStatus(void *cbData, int code, const char *msg) {
+  if (code == AudioFileSourceBuffer::STATUS_UNDERFLOW) audioUnderruns++;
+}
+
+void stopPlayback() {
   if (mp3->isRunning()) mp3->stop();
-  
-  if (fileSource != NULL) {
-    delete fileSource;
-    fileSource = NULL;
+  if (prefetch) {
+    prefetch->~AudioFileSourceBuffer();  // app-owned buffer, nothing freed
+    prefetch = NULL;
   }
+  if (sdFile.isOpen()) sdFile.close();
+  if (ramFile.isOpen()) ramFile.close();
+  fileSource = NULL;
+}
+
+void playClip(int id) {
+  stopPlayback();
+  AudioClip &clip = clips[id];
+  Serial.printf("Playing: %s%s\n", clip.path, clip.data ? " (RAM)" : "");
 
-  Serial.printf("Playing: %s\n", filename);
-  fileSource = new AudioFileSourceSD(filename);
+  if (clip.data) {
+    ramFile.open(clip.data, clip.len);
+    fileSource = &ramFile;
+  } else {
+    if (!sdFile.open(clip.path)) {
+      Serial.printf("Cannot open %s\n", clip.path);
+      return;
+    }
+    prefetch = new (prefetchSlot) AudioFileSourceBuffer(&sdFile, prefetchBuf, prefetchBytes);
+    prefetch->RegisterStatusCB(onPrefetchStatus, NULL);
+    fileSource = prefetch;
+  }
   mp3->begin(fileSource, out);
 }
 
-void handleAudioLogic() {
-  // Skip if audio not available
-  if (!audioAvailable) return;
-  
-  // 1. If MP3 is playing, keep it running
-  if (mp3->isRunning()) {
-    if (!mp3->loop()) { 
-      mp3->stop(); // Song finished
+// Reads clips into RAM at boot, in table order, until the budget runs out
+void preloadClips() {
+  uint32_t budget = psramFound() ? PRELOAD_BUDGET_PSRAM : PRELOAD_BUDGET_DRAM;
+  for (int i = 0; i < CLIP_COUNT; i++) {
+    File f = SD.open(clips[i].path);
+    if (!f) continue;
+    uint32_t len = f.size();
+    uint8_t *buf = NULL;
+    if (len > 0 && len <= budget) {
+      buf = (uint8_t *)(psramFound() ? ps_malloc(len) : malloc(len));
+    }
+    if (buf && f.read(buf, len) == len) {
+      clips[i].data = buf;
+      clips[i].len = len;
+      budget -= len;
+      Serial.printf("Preloaded %s (%u bytes)\n", clips[i].path, (unsigned)len);
+    } else {
+      free(buf);
     }
-  } 
-  // 2. If MP3 stopped/idle, decide what to play next
-  else {
-    if (isFullCapacity) {
-      // Only play warning once every 10 seconds to avoid infinite loop
-      static unsigned long lastWarning = 0;
-      if (millis() - lastWarning >= 5000) {  // 10 second interval
-        playFile("/MP3/fullcapacity.mp3");
+    f.close();
+  }
+}
+
+void audioTask(void *param) {
+  bool full = false;
+  unsigned long lastWarning = 0;
+  unsigned long lastDecode = 0;
+
+  for (;;) {
+    // Capacity change: cut whatever is playing straight away
+    bool newFull;
+    TickType_t wait = mp3->isRunning() ? 0 : pdMS_TO_TICKS(50);
+    if (xQueueReceive(audioModeQueue, &newFull, wait) == pdTRUE && newFull != full) {
+      full = newFull;
+      stopPlayback();
+      if (full) {
+        playClip(CLIP_FULL);
+        lastWarning = millis();
+      }
+    }
+
+    // 1. If MP3 is playing, keep it running
+    if (mp3->isRunning()) {
+      unsigned long now = millis();
+      if (lastDecode && now - lastDecode > AUDIO_STALL_MS) audioStalls++;
+      lastDecode = now;
+      if (!mp3->loop()) {
+        stopPlayback(); // Song finished
+        lastDecode = 0;
+      }
+      vTaskDelay(1);  // let loop() run between decoder calls
+    }
+    // 2. If MP3 stopped/idle, decide what to play next
+    else if (full) {
+      // Repeat the warning every 5 seconds
+      if (millis() - lastWarning >= 5000) {
+        playClip(CLIP_FULL);
         lastWarning = millis();
       }
     } else {
-      // Normal playlist - cycle through songs
-      const char* normalFiles[] = {"/MP3/bus3min.mp3", "/MP3/bus1min.mp3", "/MP3/busbreakdown.mp3"};
-      playFile(normalFiles[normalPlaylistIndex]);
+      // Normal playlist - cycle through the remaining clips
+      playClip(1 + normalPlaylistIndex);
       normalPlaylistIndex++;
-      if (normalPlaylistIndex > 2) normalPlaylistIndex = 0; 
+      if (normalPlaylistIndex > CLIP_COUNT - 2) normalPlaylistIndex = 0;
     }
   }
 }
 
+void startAudioTask() {
+  prefetchBytes = psramFound() ? PREFETCH_BYTES_PSRAM : PREFETCH_BYTES_DRAM;
+  prefetchBuf = (uint8_t *)(psramFound() ? ps_malloc(prefetchBytes) : malloc(prefetchBytes));
+  if (!prefetchBuf) {
+    Serial.println("Audio prefetch buffer alloc failed! Audio disabled");
+    audioAvailable = false;
+    return;
+  }
+  preloadClips();
+  audioModeQueue = xQueueCreate(4, sizeof(bool));
+  xTaskCreatePinnedToCore(audioTask, "audio", 8192, NULL, AUDIO_TASK_PRIORITY, NULL, 1);
+}
+
+// Hands a capacity change to the audio task (no-op without audio)
+void setAudioMode(bool full) {
+  if (audioAvailable) xQueueSend(audioModeQueue, &full, 0);
+}
+
 // ============================
 // ====== PREDICTION API ======
 // ============================
-void startPredictionRequest() {
-  // Check WiFi
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("WiFi not connected, skipping prediction");
-    return;
-  }
-  
-  if (predictionInProgress) {
-    Serial.println("Prediction already in progress, skipping");
-    return;
-  }
-  
-  Serial.println("Starting capacity prediction request...");
-  Serial.printf("WiFi RSSI: %d dBm\n", WiFi.RSSI());
-  
-  // Pause audio if playing
-  if (audioAvailable && mp3->isRunning()) {
-    Serial.println("Pausing audio for prediction...");
-    mp3->stop();
-    audioWasPausedForPrediction = true;
-  }
-  
-  // Create HTTP client
-  asyncHttp = new HTTPClient();
-  asyncHttp->setTimeout(10000);  // 10 seconds (cache should respond in <1s)
-  
-  // Make request
-  if (!asyncHttp->begin(serverURL)) {
+// Runs on core 0 so a slow or dead server never stalls audio, LCD or servo.
+// Only this task touches predictSession.
+PredictionResult fetchPrediction() {
+  PredictionResult result = { false, -1.0, 0, 0 };
+  unsigned long start = millis();
+
+  predictSession.timeoutMs = 10000;  // 10 seconds (cache should respond in <1s)
+  predictSession.maxIdleMs = PREDICTION_IDLE_MS;
+  if (!predictSession.begin(serverURL)) {
     Serial.println("HTTP client init failed");
-    delete asyncHttp;
-    asyncHttp = NULL;
-    return;
+    return result;
   }
-  
-  asyncHttp->setReuse(false);  // Disable connection reuse to avoid keepalive issues
-  
-  predictionInProgress = true;
-  predictionStartTime = millis();
-  
-  // Start the GET request (non-blocking via streaming)
-  int httpCode = asyncHttp->GET();
-  
-  if (httpCode != 200) {
-    Serial.printf("HTTP Error: %d\n", httpCode);
-    
-    if (httpCode == -1) {
+
+  result.httpCode = predictSession.http().GET();
+  if (result.httpCode != 200) {
+    // Drain the error body so the socket can be reused
+    if (result.httpCode > 0) predictSession.readBody(predictBody, sizeof(predictBody));
+    predictSession.end(result.httpCode);
+    Serial.printf("HTTP Error: %d\n", result.httpCode);
+    if (result.httpCode == -1) {
       Serial.println("  -> Connection failed");
-    } else if (httpCode == -11) {
+    } else if (result.httpCode == -11) {
       Serial.println("  -> Timeout (server took too long)");
     }
-    
-    asyncHttp->end();
-    delete asyncHttp;
-    asyncHttp = NULL;
-    predictionInProgress = false;
-    
-    // Resume audio if it was paused
-    if (audioWasPausedForPrediction) {
-      audioWasPausedForPrediction = false;
-      Serial.println("Prediction failed - audio will resume in next loop");
-    }
-    
-    return;
+    return result;
   }
-  
-  // Get response
-  String response = asyncHttp->getString();
-  asyncHttp->end();
-  delete asyncHttp;
-  asyncHttp = NULL;
-  predictionInProgress = false;
-  
-  unsigned long duration = millis() - predictionStartTime;
-  Serial.printf("Response received in %lu ms\n", duration);
-  
-  // Parse JSON
-  StaticJsonDocument<1024> doc;
-  DeserializationError error = deserializeJson(doc, response);
-  
+
+  // Parse straight off the socket, keeping only the two fields we use;
+  // everything else (features, timestamps) is skipped as it streams past
+  StaticJsonDocument<32> filter;
+  filter["success"] = true;
+  filter["capacity"] = true;
+  StaticJsonDocument<64> doc;
+  DeserializationError error;
+  if (predictSession.http().getSize() >= 0) {
+    error = deserializeJson(doc, predictSession.http().getStream(), DeserializationOption::Filter(filter));
+  } else {
+    // Chunked framing would confuse the parser; go through the fixed buffer
+    int bodyLen = predictSession.readBody(predictBody, sizeof(predictBody));
+    error = bodyLen < 0 ? DeserializationError(DeserializationError::NoMemory)
+                        : deserializeJson(doc, predictBody, bodyLen, DeserializationOption::Filter(filter));
+  }
+  predictSession.end(result.httpCode);  // drops any trailing bytes before reuse
+  result.durationMs = millis() - start;
+
   if (error) {
     Serial.print("JSON Parse Error: ");
     Serial.println(error.c_str());
-    
-    // Resume audio if it was paused
-    if (audioWasPausedForPrediction) {
-      audioWasPausedForPrediction = false;
-      Serial.println("JSON error - audio will resume in next loop");
+    return result;
+  }
+
+  bool success = doc["success"];
+  float capacity = doc["capacity"];
+  result.ok = success && capacity >= 0;
+  if (result.ok) result.capacity = capacity;
+  return result;
+}
+
+// ============================
+// ====== SENSOR FEEDS ========
+// ============================
+// Written by the MQTT task, read by loop(); times are 0 until a node reports
+struct SensorFeed {
+  int people;
+  bool voice;
+  unsigned long irMs;
+  float zoneDistance[3];  // LEFT, CENTER, RIGHT, cm
+  bool zoneOccupied[3];
+  float density;
+  unsigned long ultrasonicMs;
+};
+SensorFeed sensorFeed = {};
+portMUX_TYPE sensorFeedLock = portMUX_INITIALIZER_UNLOCKED;
+const char *ZONE_NAMES[3] = { "LEFT", "CENTER", "RIGHT" };
+
+// Bursts are arrays; only the newest element matters here
+static JsonVariant newestSample(JsonDocument &doc) {
+  if (doc.is<JsonArray>()) {
+    JsonArray arr = doc.as<JsonArray>();
+    return arr.size() ? arr[arr.size() - 1] : JsonVariant();
+  }
+  return doc.as<JsonVariant>();
+}
+
+// Same filter for a single sample and for every element of a burst
+static DeserializationError parseSample(const std::string &payload, JsonDocument &doc, JsonDocument &filter) {
+  bool burst = !payload.empty() && payload[0] == '[';
+  StaticJsonDocument<384> wrapped;
+  if (burst) wrapped[0].set(filter.as<JsonVariant>());
+  return deserializeJson(doc, payload.data(), payload.size(),
+                         DeserializationOption::Filter(burst ? wrapped : filter));
+}
+
+void onIrMessage(const std::string &payload) {
+  StaticJsonDocument<64> filter;
+  filter["people_count"] = true;
+  filter["voice"] = true;
+  StaticJsonDocument<512> doc;
+  if (parseSample(payload, doc, filter)) return;
+  JsonVariant smp = newestSample(doc);
+  if (!smp.containsKey("people_count")) return;
+
+  portENTER_CRITICAL(&sensorFeedLock);
+  sensorFeed.people = smp["people_count"];
+  sensorFeed.voice = smp["voice"];
+  sensorFeed.irMs = millis();
+  portEXIT_CRITICAL(&sensorFeedLock);
+}
+
+void onUltrasonicMessage(const std::string &payload) {
+  StaticJsonDocument<256> filter;
+  for (int z = 0; z < 3; z++) {
+    filter["sensors"][ZONE_NAMES[z]]["distance"] = true;
+    filter["sensors"][ZONE_NAMES[z]]["occupied"] = true;
+  }
+  filter["density"] = true;
+  StaticJsonDocument<1024> doc;
+  if (parseSample(payload, doc, filter)) return;
+  JsonVariant smp = newestSample(doc);
+  if (!smp.containsKey("sensors")) return;
+
+  SensorFeed f;
+  for (int z = 0; z < 3; z++) {
+    JsonVariant zone = smp["sensors"][ZONE_NAMES[z]];
+    f.zoneDistance[z] = zone["distance"] | -1.0f;
+    f.zoneOccupied[z] = zone["occupied"] | 0;
+  }
+  f.density = smp["density"] | -1.0f;
+
+  portENTER_CRITICAL(&sensorFeedLock);
+  memcpy(sensorFeed.zoneDistance, f.zoneDistance, sizeof(f.zoneDistance));
+  memcpy(sensorFeed.zoneOccupied, f.zoneOccupied, sizeof(f.zoneOccupied));
+  sensorFeed.density = f.density;
+  sensorFeed.ultrasonicMs = millis();
+  portEXIT_CRITICAL(&sensorFeedLock);
+}
+
+SensorFeed readSensorFeed() {
+  portENTER_CRITICAL(&sensorFeedLock);
+  SensorFeed f = sensorFeed;
+  portEXIT_CRITICAL(&sensorFeedLock);
+  return f;
+}
+
+static bool feedFresh(unsigned long ms) {
+  return ms && millis() - ms < SENSOR_STALE_MS;
+}
+
+// MQTT task context: same filter as the HTTP path, result goes to the same mailbox
+void onPredictionMessage(const std::string &payload) {
+  bool replay = predictionReplayPending;
+  predictionReplayPending = false;
+  if (payload.empty()) return;  // retained message cleared by the predictor
+
+  PredictionResult result = { false, -1.0, 0, 0 };
+  StaticJsonDocument<48> filter;
+  filter["success"] = true;
+  filter["capacity"] = true;
+  filter["ts"] = true;
+  StaticJsonDocument<96> doc;
+  DeserializationError error = deserializeJson(doc, payload.data(), payload.size(), DeserializationOption::Filter(filter));
+  if (error) {
+    Serial.print("MQTT prediction parse error: ");
+    Serial.println(error.c_str());
+    return;
+  }
+  time_t now = time(nullptr);
+  long ts = doc["ts"] | 0L;  // unix seconds
+  if (now >= CLOCK_VALID_AFTER && ts > 0) {
+    if ((now - ts) * 1000LL > (long long)PREDICTION_STALE_MS) {
+      Serial.printf("MQTT prediction is %llds old, ignored\n", (long long)(now - ts));
+      return;
     }
-    
+  } else if (replay) {
+    Serial.println("MQTT prediction may be a stale replay, ignored");
     return;
   }
-  
-  // Extract data
   bool success = doc["success"];
   float capacity = doc["capacity"];
-  
-  if (success && capacity >= 0) {
-    predictedCapacity = capacity;
-    Serial.printf("Predicted Capacity: %.1f people\n", predictedCapacity);
-    
-    // Update isFullCapacity based on prediction
-    bool newState = (predictedCapacity > 15);
-    
-    if (newState != isFullCapacity) {
-      isFullCapacity = newState;
-      if (isFullCapacity) {
-        Serial.println("State: FULL -> Servo 90");
-        myServo.write(90); 
-        if (audioAvailable) {
-          // Stop current audio and play warning (don't resume old audio)
-          if (mp3->isRunning()) mp3->stop();
-          playFile("/MP3/fullcapacity.mp3");
-          audioWasPausedForPrediction = false;  // Clear flag - playing warning now
-        }
-      } else {
-        Serial.println("State: NORMAL -> Servo 0");
-        myServo.write(0);
-        if (audioAvailable && mp3->isRunning()) {
-          mp3->stop();
-        }
-        // Let audio resume naturally in next handleAudioLogic() call
-        if (audioWasPausedForPrediction) {
-          audioWasPausedForPrediction = false;
-          Serial.println("Resuming normal audio...");
-        }
-      }
-    } else {
-      // State didn't change - resume audio if it was paused
-      if (audioWasPausedForPrediction) {
-        audioWasPausedForPrediction = false;
-        Serial.println("No state change - audio will resume in next loop");
-      }
+  result.ok = success && capacity >= 0;
+  if (result.ok) result.capacity = capacity;
+  lastPushedPredictionMs = millis();
+  xQueueOverwrite(predictionQueue, &result);
+}
+
+// Pushed predictions are arriving; no need to poll
+bool predictionPushLive() {
+  return PREDICTION_MQTT && mqttClient.isConnected() && lastPushedPredictionMs &&
+         millis() - lastPushedPredictionMs < PREDICTION_STALE_MS;
+}
+
+void predictionTask(void *param) {
+  TickType_t lastWake = xTaskGetTickCount();
+  for (;;) {
+    if (WiFi.status() == WL_CONNECTED && !predictionPushLive()) {
+      PredictionResult result = fetchPrediction();
+      xQueueOverwrite(predictionQueue, &result);
     }
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(PREDICTION_INTERVAL));
+  }
+}
+
+void startPredictionTask() {
+  // HTTP/lwIP call depth; the JSON documents are under 100 bytes now
+  xTaskCreatePinnedToCore(predictionTask, "predict", 6144, NULL, 1, NULL, 0);
+}
+
+// Servo/audio react to every capacity, whether from the server or local
+void applyCapacity(float capacity, bool local) {
+  predictedCapacity = capacity;
+  predictionIsLocal = local;
+
+  // Update isFullCapacity based on prediction
+  bool newState = (predictedCapacity > 15);
+  if (newState == isFullCapacity) return;
+
+  isFullCapacity = newState;
+  if (isFullCapacity) {
+    Serial.println("State: FULL -> Servo 90");
+    myServo.write(90);
   } else {
-    Serial.println("Prediction failed or no data");
-    predictedCapacity = -1.0;
-    
-    // Resume audio if it was paused
-    if (audioWasPausedForPrediction) {
-      audioWasPausedForPrediction = false;
-      Serial.println("Prediction failed - audio will resume in next loop");
+    Serial.println("State: NORMAL -> Servo 0");
+    myServo.write(0);
+  }
+  // Warning starts immediately (preloaded), or playlist resumes
+  setAudioMode(isFullCapacity);
+}
+
+// ============================
+// ====== LOCAL MODEL =========
+// ============================
+// Same XGBoost model as the server, compiled into flash, fed with the IR and
+// ultrasonic readings this node receives over MQTT. Missing or stale
+// features stay -1, the server pipeline's marker for a missing reading; the
+// camera's crowd level is never available here. Returns false when neither
+// node has reported recently, so the model never runs on defaults alone.
+bool localCapacity(float &capacity) {
+  using namespace capacity_model;
+  SensorFeed f = readSensorFeed();
+  bool irLive = feedFresh(f.irMs), usLive = feedFresh(f.ultrasonicMs);
+  if (!irLive && !usLive) return false;
+
+  float x[FEATURE_COUNT];
+  for (int i = 0; i < FEATURE_COUNT; i++) x[i] = -1;
+  if (irLive) {
+    x[PEOPLE_COUNT] = f.people;
+    x[VOICE] = f.voice ? 1 : 0;
+  }
+  if (usLive) {
+    const Feature dist[3] = { SENSORS_LEFT_DISTANCE, SENSORS_CENTER_DISTANCE, SENSORS_RIGHT_DISTANCE };
+    const Feature occ[3] = { SENSORS_LEFT_OCCUPIED, SENSORS_CENTER_OCCUPIED, SENSORS_RIGHT_OCCUPIED };
+    for (int z = 0; z < 3; z++) {
+      x[dist[z]] = f.zoneDistance[z];
+      x[occ[z]] = f.zoneOccupied[z] ? 1 : 0;
     }
+    x[DENSITY] = f.density;
+  }
+
+  unsigned long t0 = micros();
+  capacity = MODEL.predict(x);
+  Serial.printf("Local model: %.1f people (%lu us)\n", capacity, micros() - t0);
+  if (capacity < 0) capacity = 0;
+  return true;
+}
+
+// Falls back to the local model, or blanks the display (servo and audio
+// keep their state) when there is nothing real to run it on
+void applyLocalCapacity() {
+  float capacity;
+  if (localCapacity(capacity)) {
+    applyCapacity(capacity, true);
+  } else {
+    predictedCapacity = -1;  // "Cap:--"
+    predictionIsLocal = false;
+  }
+}
+
+// No good server prediction for PREDICTION_STALE_MS (or ever, since boot)
+bool serverPredictionStale() {
+  unsigned long since = lastPredictionMs ? millis() - lastPredictionMs : millis();
+  return since > PREDICTION_STALE_MS;
+}
+
+// Called from loop(); applies the newest result without waiting
+void handlePredictionResult() {
+  PredictionResult result;
+  if (xQueueReceive(predictionQueue, &result, 0) != pdTRUE) return;
+
+  if (!result.ok) {
+    Serial.println("Prediction failed or no data - using local model");
+    applyLocalCapacity();
+    return;
+  }
+
+  if (result.httpCode) {
+    Serial.printf("Response received in %lu ms\n", result.durationMs);
+  } else {
+    Serial.println("Prediction pushed over MQTT");
+  }
+  lastPredictionMs = millis();
+  Serial.printf("Predicted Capacity: %.1f people\n", result.capacity);
+  applyCapacity(result.capacity, false);
+}
+
+// ============================
+// ====== HEAP HEALTH =========
+// ============================
+// Internal RAM only: that is where long-lived fragmentation hurts (I2S, WiFi
+// and TLS buffers need contiguous DRAM). frag_pct is the share of free
+// memory outside the largest block.
+struct HeapStats {
+  uint32_t freeBytes;
+  uint32_t largestBlock;
+  uint32_t minFree;
+  uint8_t fragPct;
+};
+
+HeapStats readHeap() {
+  const uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+  HeapStats h;
+  h.freeBytes = heap_caps_get_free_size(caps);
+  h.largestBlock = heap_caps_get_largest_free_block(caps);
+  h.minFree = heap_caps_get_minimum_free_size(caps);
+  h.fragPct = h.freeBytes ? 100 - (uint64_t)h.largestBlock * 100 / h.freeBytes : 0;
+  return h;
+}
+
+void publishHealth() {
+  HeapStats h = readHeap();
+  char payload[256];
+  snprintf(payload, sizeof(payload),
+           "{\"deviceId\": \"%s\", \"free_heap\": %u, \"largest_block\": %u, \"min_free_heap\": %u, "
+           "\"frag_pct\": %u, \"audio_underruns\": %u, \"audio_stalls\": %u, "
+           "\"http_requests\": %u, \"http_reused\": %u}",
+           WiFi.macAddress().c_str(), (unsigned)h.freeBytes, (unsigned)h.largestBlock, (unsigned)h.minFree,
+           (unsigned)h.fragPct, (unsigned)audioUnderruns, (unsigned)audioStalls,
+           (unsigned)predictSession.requests(), (unsigned)predictSession.reused());
+  Serial.printf("Heap: %u free, %u largest block (%u%% fragmented), %u min\n",
+                (unsigned)h.freeBytes, (unsigned)h.largestBlock, (unsigned)h.fragPct, (unsigned)h.minFree);
+  if (mqttClient.isConnected()) mqttClient.publish(mqttHealthTopic, payload, 0, false);
+}
+
+void onMqttConnect(esp_mqtt_client* client) {
+  Serial.println("MQTT Connected!");
+  // Retained: the broker replays the latest prediction right away
+  if (PREDICTION_MQTT) {
+    predictionReplayPending = true;
+    mqttClient.subscribe(mqttPredictionTopic, onPredictionMessage, 1);
+  }
+  mqttClient.subscribe(mqttIrTopic, onIrMessage, 0);
+  mqttClient.subscribe(mqttIrBatchTopic, onIrMessage, 0);
+  mqttClient.subscribe(mqttUltrasonicTopic, onUltrasonicMessage, 0);
+  mqttClient.subscribe(mqttUltrasonicBatchTopic, onUltrasonicMessage, 0);
+}
+
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0)
+esp_err_t handleMQTT(esp_mqtt_event_handle_t event) {
+  mqttClient.onEventCallback(event);
+  return ESP_OK;
+}
+#else
+void handleMQTT(void *handler_args, esp_event_base_t base, int32_t event_id, void *event_data) {
+  auto *event = static_cast<esp_mqtt_event_handle_t>(event_data);
+  mqttClient.onEventCallback(event);
+}
+#endif
+
+// ============================
+// ====== LCD =================
+// ============================
+// Redraws the whole frame every call; the renderer only sends the cells
+// that differ from the panel, so the age counter costs one or two cells.
+void drawScreen() {
+  char line[LcdRenderer::COLS + 1];
+  screen.clear();
+
+  // Line 1: Predicted Capacity, age of the prediction right-aligned
+  screen.setCursor(0, 0);
+  if (predictedCapacity >= 0) {
+    snprintf(line, sizeof(line), "Cap:%d", (int)predictedCapacity);
+  } else {
+    snprintf(line, sizeof(line), "Cap:--");
+  }
+  screen.print(line);
+  if (predictionIsLocal) {
+    snprintf(line, sizeof(line), "LOC");
+    screen.setCursor(LcdRenderer::COLS - strlen(line), 0);
+    screen.print(line);
+  } else if (lastPredictionMs) {
+    snprintf(line, sizeof(line), "%3lus", (millis() - lastPredictionMs) / 1000);
+    screen.setCursor(LcdRenderer::COLS - strlen(line), 0);
+    screen.print(line);
   }
+
+  // Line 2: Predicted Status
+  screen.setCursor(0, 1);
+  screen.print(isFullCapacity ? "[FULL]" : "[OK]");
+
+  screen.render();
 }
 
 // ============================
@@ -282,26 +712,16 @@ void setup() {
   // 2. Connect to WiFi
   lcd.setCursor(0, 1);
   lcd.print("WiFi...");
-  WiFi.begin(ssid, password);
-  
-  int wifiAttempts = 0;
-  while (WiFi.status() != WL_CONNECTED && wifiAttempts < 20) {
-    delay(500);
-    Serial.print(".");
-    wifiAttempts++;
-  }
-  
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("\nWiFi Connected!");
-    Serial.print("IP: ");
-    Serial.println(WiFi.localIP());
-    lcd.setCursor(0, 1);
-    lcd.print("WiFi OK         ");
-  } else {
-    Serial.println("\nWiFi Failed!");
-    lcd.setCursor(0, 1);
-    lcd.print("WiFi Fail       ");
-  }
+  // Connects in the background; loop() keeps polling it
+  net.begin(ssid, password);
+  net.poll();
+  configTime(0, 0, "pool.ntp.org");  // dates pushed predictions, see onPredictionMessage
+  // Before MQTT starts: the retained prediction can arrive immediately
+  predictionQueue = xQueueCreate(1, sizeof(PredictionResult));
+  mqttClient.setURI(mqttServer);
+  mqttClient.setKeepAlive(30);
+  mqttClient.setMaxPacketSize(MQTT_MAX_PACKET);
+  mqttClient.loopStart();
   delay(1000);
 
   // 3. Init SD Card
@@ -321,65 +741,65 @@ void setup() {
   if (audioAvailable) {
     out = new AudioOutputI2S();
     out->SetPinout(I2S_BCLK, I2S_LRCK, I2S_DOUT);
-    mp3 = new AudioGeneratorMP3();
-    Serial.println("Audio Init OK");
+    mp3 = new AudioGeneratorMP3(mp3Space, sizeof(mp3Space));
+    startAudioTask();
+    if (audioAvailable) Serial.println("Audio Init OK");
   }
 
   // 5. Init Servo
   myServo.attach(SERVO_PIN);
   myServo.write(0); // Start closed
 
+  // 6. Start prediction fetching in the background
+  startPredictionTask();
+
   delay(1000);
-  lcd.clear();
+  screen.begin();  // clears the panel; from here on only changed cells are sent
 }
 
 // ============================
 // ====== LOOP ================
 // ============================
 void loop() {
-  handleAudioLogic();
+  net.poll();
+  if (net.takeOnlineEdge()) {
+    Serial.print("WiFi Connected! IP: ");
+    Serial.println(WiFi.localIP());
+  }
 
-  // --- PREDICTION REQUEST (Every 30 Seconds) ---
-  // Only start if not already in progress
-  if (!predictionInProgress && millis() - lastPredictionRequest >= PREDICTION_INTERVAL) {
-    lastPredictionRequest = millis();
-    startPredictionRequest();
+  // --- PREDICTION RESULT (fetched by predictionTask) ---
+  handlePredictionResult();
+
+  // --- HEALTH METRICS (Every 30 Seconds) ---
+  if (millis() - lastHealth >= HEALTH_INTERVAL) {
+    lastHealth = millis();
+    publishHealth();
+  }
+
+  // --- LCD REFRESH (Every 200 ms) ---
+  if (millis() - lastLcdRefresh >= LCD_REFRESH_INTERVAL) {
+    lastLcdRefresh = millis();
+    drawScreen();
   }
 
   // --- NON-BLOCKING UPDATE (Every 2 Seconds) ---
   if (millis() - lastUpdate >= UPDATE_INTERVAL) {
     lastUpdate = millis();
 
-    // 1. GENERATE DATA 
-    // We simulate sensors here. 
-    peopleCount = random(0, 12);        // Mock people count (0 to 12)
-    distance = random(20, 200) / 10.0;  // Mock distance
-    voiceDetected = random(0, 2);       // Mock voice
-
-    // 2. UPDATE LCD 
-    lcd.clear();
-    
-    // Line 1: Predicted Capacity
-    lcd.setCursor(0, 0);
-    if (predictedCapacity >= 0) {
-      lcd.print("Cap:");
-      lcd.print((int)predictedCapacity);
-      lcd.print(" ");
-    } else {
-      lcd.print("Cap:-- ");
-    }
+    // 1. LATEST NODE READINGS (pushed over MQTT)
+    SensorFeed feed = readSensorFeed();
+    peopleCount = feed.people;
+    distance = feed.zoneDistance[1];
+    voiceDetected = feed.voice;
 
-    // Line 2: Predicted Status
-    lcd.setCursor(0, 1);
-    // Simple status indicator
-    if (isFullCapacity) {
-        lcd.print("[FULL]");
-    } else {
-        lcd.print("[OK]  ");
+    // Server down or silent: keep the local model tracking the readings
+    if (predictionIsLocal || serverPredictionStale()) {
+      applyLocalCapacity();
     }
 
     // Debug Serial
-    Serial.printf("Ppl: %d | Dist: %.1f | Cap: %.1f | Full: %d\n", 
-                  peopleCount, distance, predictedCapacity, isFullCapacity);
+    Serial.printf("Ppl: %d | Dist: %.1f cm | Cap: %.1f | Full: %d | Underruns: %u | Stalls: %u\n", 
+                  peopleCount, distance, predictedCapacity, isFullCapacity,
+                  (unsigned)audioUnderruns, (unsigned)audioStalls);
   }
 }
\ No newline at end of file
@@ -4,6 +4,12 @@
 #include <driver/i2s.h>
 #include <arduinoFFT.h>
 #include "driver/gpio.h"
+#include <ConnectionManager.h>
+#include <SampleBatch.h>
+#include <PerfStats.h>
+#include "esp_timer.h"
+#include <atomic>
+#include <sys/time.h>
 
 // ================= WIFI / MQTT ================
 const char* WIFI_SSID = "test";
@@ -18,8 +24,55 @@ const char* TOPIC_IR    = "nus-smartstop/ir-sensor/data";
 const char* TOPIC_VOICE = "nus-smartstop/voice";
 const char* DEVICE_ID   = "esp32-smartstop-01";
 
-unsigned long lastPubMs = 0;
-const unsigned long PUB_INTERVAL = 1000;
+// Payload format for the IR/mic telemetry (-D IR_PAYLOAD_FORMAT=...).
+// The binary layout goes to TOPIC_IR_BIN/<deviceId>, outside the
+// nus-smartstop/# JSON subscription, and server/mqtt/binary_bridge.py
+// republishes it as JSON on TOPIC_IR_BATCH, or TOPIC_IR before NTP sync.
+#define IR_PAYLOAD_JSON   0
+#define IR_PAYLOAD_BINARY 1
+#ifndef IR_PAYLOAD_FORMAT
+#define IR_PAYLOAD_FORMAT IR_PAYLOAD_JSON
+#endif
+const char* TOPIC_IR_BIN = "nus-smartstop-bin/ir-sensor";
+const uint8_t IR_BIN_VERSION = 2;
+
+// Batched JSON: an array of timestamped samples ("ts", unix ms), on its
+// own root so Telegraf can parse it with json_time_key (see telegraf.conf)
+const char* TOPIC_IR_BATCH = "nus-smartstop-batch/ir-sensor";
+
+// PublisherTask sleeps on pubEvents and wakes when IRTask commits a count,
+// VoiceTask toggles voiceActive, or the heartbeat timer fires
+const unsigned long HEARTBEAT_MS = 5000;      // sampling period when nothing changes
+const unsigned long MQTT_SERVICE_MS = 5000;   // max sleep between mqtt.loop() calls
+const unsigned long NET_RETRY_POLL_MS = 200;  // wake rate while reconnecting
+#define EV_COUNT     (1 << 0)
+#define EV_VOICE     (1 << 1)
+#define EV_HEARTBEAT (1 << 2)
+EventGroupHandle_t pubEvents;
+TimerHandle_t heartbeatTimer;
+
+// Samples are buffered and sent in bursts so the radio can stay in modem
+// sleep in between. BATCH_MAX_SAMPLES = 1 publishes every sample as before.
+#ifndef BATCH_MAX_SAMPLES
+#define BATCH_MAX_SAMPLES 10
+#endif
+const unsigned long BATCH_WINDOW_MS = 10000;  // max age of the oldest buffered sample
+const uint32_t BATCH_FLUSH_PEOPLE = 1;        // flush early once this many people moved
+#define BATCH_RING_SIZE 32                    // samples kept while offline
+#define IR_BATCH_BUF_SIZE 2048                // MQTT packet buffer, fits a full batch
+
+// Timing histograms, heap and task stacks, published every PERF_INTERVAL_MS
+// on nus-smartstop-diag/<deviceId>/perf (PerfMonitor in smartstop_core);
+// outside nus-smartstop/# so Telegraf keeps it out of the sensor measurement
+const char* TOPIC_PERF_FMT = "nus-smartstop-diag/%s/perf";
+const unsigned long PERF_INTERVAL_MS = 30000;
+#define PERF_BUF_SIZE 1024
+
+// -D SMARTSTOP_BENCH=1 (pio run -e bench) replaces the node with a benchmark
+// of the filter, FFT and JSON kernels over recorded mic audio
+#ifndef SMARTSTOP_BENCH
+#define SMARTSTOP_BENCH 0
+#endif
 
 // ================ IR PEOPLE COUNT =============
 // --- SET 1 (Bus Entrance) ---
@@ -34,22 +87,71 @@ const int IR_TX_D = 18;
 const int IR_RX_C = 19;
 const int IR_RX_D = 17;
 
-volatile int32_t peopleCount = 0;     // atomic on ESP32
+// One entry per doorway. Each has an outer and an inner beam; breaking
+// outer then inner is an entry, inner then outer an exit.
+typedef struct {
+  const char* name;
+  char outerId, innerId;   // labels for log output
+  int txOuter, txInner;
+  int rxOuter, rxInner;
+} DoorConfig;
+
+const DoorConfig DOORS[] = {
+  { "Door 1", 'A', 'B', IR_TX_A, IR_TX_B, IR_RX_A, IR_RX_B },
+  { "Door 2", 'C', 'D', IR_TX_C, IR_TX_D, IR_RX_C, IR_RX_D },
+};
+constexpr int N_DOORS = sizeof(DOORS) / sizeof(DOORS[0]);
+
+enum : uint8_t { BEAM_OUTER = 0, BEAM_INNER = 1 };
+
+// Monotonic per-door totals, written by IRTask (core 1) and read by the
+// publisher (core 0). They only ever increase and wrap at 2^32.
+typedef struct {
+  std::atomic<uint32_t> entries;
+  std::atomic<uint32_t> exits;
+} DoorCounters;
+
+DoorCounters doorCounts[N_DOORS];
+
+// Totals covered by the last telemetry sample (publisher side only)
+uint32_t sampledEntries[N_DOORS] = {0}, sampledExits[N_DOORS] = {0};
+uint32_t sampleSeq = 0;
+
 const uint32_t SEQ_WINDOW = 1000;     // Increased slightly to allow slower walking
 constexpr gpio_int_type_t EDGE_TYPE = GPIO_INTR_NEGEDGE; 
 
-// Structure to hold event data
-typedef struct { 
-  uint8_t sensor; // 'A', 'B', 'C', or 'D'
-  uint32_t t_ms; 
+// Beam edge, timestamped in the ISR
+typedef struct {
+  int64_t t_us;
+  uint8_t beam;   // BEAM_OUTER / BEAM_INNER
 } IrEdgeEvent;
 
-QueueHandle_t irQueue;
-
-// State tracking variables for Door 1
-volatile uint32_t tA_fall_ms = 0, tB_fall_ms = 0;
-// State tracking variables for Door 2
-volatile uint32_t tC_fall_ms = 0, tD_fall_ms = 0;
+// Lock-free single-producer/single-consumer ring, one per door. Both beam
+// ISRs of a door run from the same GPIO ISR dispatcher, so they never
+// preempt each other and act as a single producer; IRTask is the consumer.
+#define IR_RING_SIZE 32   // power of two
+typedef struct {
+  IrEdgeEvent buf[IR_RING_SIZE];
+  std::atomic<uint32_t> head;       // next slot to write (ISR)
+  std::atomic<uint32_t> tail;       // next slot to read (IRTask)
+  std::atomic<uint32_t> overflows;  // edges dropped because the ring was full
+} IrRing;
+
+IrRing irRings[N_DOORS];
+
+// ISR argument for each beam
+typedef struct { uint8_t door, beam; } IrBeam;
+IrBeam irBeams[N_DOORS][2];
+
+TaskHandle_t irTaskHandle = nullptr;
+TaskHandle_t micTaskHandle = nullptr, voiceTaskHandle = nullptr, publisherTaskHandle = nullptr;
+
+PerfMonitor perf;
+PerfTimer irEdgeLatency("ir_edge");   // ISR timestamp to IRTask pickup
+PerfTimer micHopTime("mic_hop");      // slide + high-pass of one I2S read
+PerfTimer voiceFrameTime("voice_frame");
+PerfTimer encodeTime("encode");       // telemetry payload encoding
+PerfTimer flushTime("flush");         // batch publish incl. socket writes
 
 // ================== ULTRASONIC =================
 float distance = 0.0; // placeholder
@@ -64,9 +166,50 @@ float distance = 0.0; // placeholder
 #define N_SAMPLES   512
 #define SAMPLE_RATE 16000.0
 
-int32_t rawBuf[N_SAMPLES];
+// Spectral backend, picked at compile time (-D VOICE_FFT_BACKEND=...).
+// The ESP32 FPU is single precision only, so the double path runs in
+// software emulation and is kept only as a reference for tuning.
+#define VOICE_FFT_ARDUINO_DOUBLE 0   // ArduinoFFT<double>
+#define VOICE_FFT_ARDUINO_FLOAT  1   // ArduinoFFT<float>
+#define VOICE_FFT_ESPDSP_F32     2   // esp-dsp radix-2 float32 kernels
+#ifndef VOICE_FFT_BACKEND
+#define VOICE_FFT_BACKEND VOICE_FFT_ESPDSP_F32
+#endif
+
+// Capture: MicTask reads VOICE_HOP samples at a time into a sliding
+// window and hands complete frames to VoiceTask through two ping-pong
+// buffers. VOICE_HOP = N_SAMPLES/2 gives 50% overlap, N_SAMPLES none.
+#ifndef VOICE_HOP
+#define VOICE_HOP (N_SAMPLES / 2)
+#endif
+static_assert(VOICE_HOP > 0 && VOICE_HOP <= N_SAMPLES, "VOICE_HOP must be in 1..N_SAMPLES");
+
+int32_t rawBuf[VOICE_HOP];
+
+#if VOICE_FFT_BACKEND == VOICE_FFT_ARDUINO_DOUBLE
+typedef double spec_t;
 double  vReal[N_SAMPLES], vImag[N_SAMPLES];
-ArduinoFFT FFT(vReal, vImag, N_SAMPLES, SAMPLE_RATE);
+ArduinoFFT<double> FFT(vReal, vImag, N_SAMPLES, SAMPLE_RATE);
+#elif VOICE_FFT_BACKEND == VOICE_FFT_ARDUINO_FLOAT
+typedef float spec_t;
+float vReal[N_SAMPLES], vImag[N_SAMPLES];
+ArduinoFFT<float> FFT(vReal, vImag, N_SAMPLES, (float)SAMPLE_RATE);
+#elif VOICE_FFT_BACKEND == VOICE_FFT_ESPDSP_F32
+#include "esp_dsp.h"
+typedef float spec_t;
+// Interleaved re/im, half the size of the double vReal/vImag pair.
+// After computeSpectrum() the first N/2 entries hold the power spectrum.
+__attribute__((aligned(16))) float fftBuf[2 * N_SAMPLES];
+float hammingHalf[N_SAMPLES / 2];  // window is symmetric, store one half
+#else
+#error "Unknown VOICE_FFT_BACKEND"
+#endif
+
+spec_t micWindow[N_SAMPLES];        // newest N_SAMPLES high-passed samples
+spec_t micFrames[2][N_SAMPLES];     // ping-pong frames for VoiceTask
+QueueHandle_t micFreeQueue;         // indices of frames VoiceTask released
+QueueHandle_t micReadyQueue;        // indices of frames ready for analysis
+volatile uint32_t micFramesDropped = 0;  // hops skipped because both frames were busy
 
 bool  voiceActive = false;
 float ratioEMA = 0.0f;
@@ -79,21 +222,12 @@ const float  SFM_ON_MAX = 0.65f, SFM_OFF_MIN = 0.80f;
 const uint8_t K_ON = 2, K_OFF = 4;
 
 // ------------- WiFi / MQTT helpers -------------
-void ensureWifi() {
-  if (WiFi.status() == WL_CONNECTED) return;
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(WIFI_SSID, WIFI_PASS);
-  while (WiFi.status() != WL_CONNECTED) { delay(200); }
-}
+// Reconnects run in the background via ConnectionManager; samples taken
+// while offline stay in the batch ring and are replayed on reconnect.
+ConnectionManager net;
 
-void ensureMqtt() {
-  if (mqtt.connected()) return;
-  mqtt.setServer(MQTT_HOST, MQTT_PORT);
-  while (!mqtt.connected()) {
-    mqtt.connect(DEVICE_ID);
-    if (!mqtt.connected()) delay(500);
-  }
-}
+static bool mqttUp() { return mqtt.connected(); }
+static bool mqttConnect() { return mqtt.connect(DEVICE_ID); }
 
 // ------------- I2S (mic) setup -----------------
 void setupI2S() {
@@ -121,33 +255,172 @@ void setupI2S() {
   i2s_start(I2S_PORT);
 }
 
+// ------------- Spectral engine -----------------
+void setupSpectrum() {
+#if VOICE_FFT_BACKEND == VOICE_FFT_ESPDSP_F32
+  esp_err_t err = dsps_fft2r_init_fc32(NULL, N_SAMPLES);
+  if (err != ESP_OK) Serial.printf("FFT init failed (0x%x)\n", err);
+  // Same Hamming coefficients ArduinoFFT applies
+  for (int i = 0; i < N_SAMPLES / 2; i++) {
+    hammingHalf[i] = 0.54f - 0.46f * cosf(2.0f * (float)M_PI * i / (N_SAMPLES - 1));
+  }
+#endif
+}
+
+// Store high-passed sample i of the next frame
+static inline void spectrumLoad(int i, spec_t x) {
+#if VOICE_FFT_BACKEND == VOICE_FFT_ESPDSP_F32
+  int w = (i < N_SAMPLES / 2) ? i : (N_SAMPLES - 1 - i);
+  fftBuf[2 * i]     = x * hammingHalf[w];
+  fftBuf[2 * i + 1] = 0.0f;
+#else
+  vReal[i] = x;
+  vImag[i] = 0;
+#endif
+}
+
+// Window + FFT + power spectrum of the loaded frame
+void computeSpectrum() {
+#if VOICE_FFT_BACKEND == VOICE_FFT_ESPDSP_F32
+  dsps_fft2r_fc32(fftBuf, N_SAMPLES);
+  dsps_bit_rev_fc32(fftBuf, N_SAMPLES);
+  // In place: slot i is written only after slots 2i / 2i+1 were read
+  for (int i = 0; i < N_SAMPLES / 2; i++) {
+    float re = fftBuf[2 * i], im = fftBuf[2 * i + 1];
+    fftBuf[i] = re * re + im * im;
+  }
+#else
+  FFT.windowing(FFTWindow::Hamming, FFTDirection::Forward);
+  FFT.compute(FFTDirection::Forward);
+  FFT.complexToMagnitude();
+#endif
+}
+
+// Power of bin i, valid for 0 <= i < N_SAMPLES/2 after computeSpectrum()
+static inline spec_t binPower(int i) {
+#if VOICE_FFT_BACKEND == VOICE_FFT_ESPDSP_F32
+  return fftBuf[i];
+#else
+  return vReal[i] * vReal[i];
+#endif
+}
+
+// ------------- Spectral features ---------------
+#define N_BINS (N_SAMPLES / 2)
+
+// Band membership of each FFT bin, resolved at compile time
+enum : uint8_t { BAND_VOICE = 1 << 0, BAND_LOW = 1 << 1, BAND_MID = 1 << 2, BAND_SFM = 1 << 3 };
+
+constexpr bool binInBand(int i, double loHz, double hiHz) {
+  return (i * SAMPLE_RATE) / N_SAMPLES >= loHz && (i * SAMPLE_RATE) / N_SAMPLES <= hiHz;
+}
+
+struct BandTable {
+  uint8_t mask[N_BINS];
+  constexpr BandTable() : mask() {
+    for (int i = 1; i < N_BINS; i++) {
+      mask[i] = (binInBand(i, 120, 3400) ? BAND_VOICE : 0)
+              | (binInBand(i, 80,  300)  ? BAND_LOW   : 0)
+              | (binInBand(i, 500, 1500) ? BAND_MID   : 0)
+              | (binInBand(i, 200, 3400) ? BAND_SFM   : 0);
+    }
+  }
+};
+constexpr BandTable BANDS;
+
+typedef struct {
+  spec_t totalE, voiceE, lowE, midE;
+  spec_t sfmLin, sfmLog;  // sum and log-sum of SFM band power
+  int    sfmBins;
+} SpectralFeatures;
+
+// All per-frame features in one pass over the bins. The SFM log-sum is
+// kept as a running mantissa/exponent product, so there is one log()
+// per frame instead of one per bin.
+void extractFeatures(SpectralFeatures& ft) {
+  spec_t totalE = 0, voiceE = 0, lowE = 0, midE = 0, sfmLin = 0;
+  spec_t logMant = 1; int logExp = 0, nb = 0;
+
+  for (int i = 1; i < N_BINS; i++) {
+    spec_t p = binPower(i);
+    uint8_t m = BANDS.mask[i];
+    totalE += p;
+    if (m & BAND_VOICE) voiceE += p;
+    if (m & BAND_LOW)   lowE += p;
+    if (m & BAND_MID)   midE += p;
+    if (m & BAND_SFM) {
+      spec_t q = p + (spec_t)1e-9;
+      int e;
+      sfmLin += q;
+      logMant = frexp(logMant * q, &e);
+      logExp += e;
+      nb++;
+    }
+  }
+
+  ft.totalE = totalE; ft.voiceE = voiceE;
+  ft.lowE = lowE; ft.midE = midE;
+  ft.sfmLin = sfmLin;
+  ft.sfmLog = log(logMant) + logExp * (spec_t)M_LN2;
+  ft.sfmBins = nb;
+}
+
 // ------------- IR ISR handlers -----------------
-void IRAM_ATTR send_ir_event(char id) {
-    IrEdgeEvent ev = { (uint8_t)id, (uint32_t)millis() };
+static void IRAM_ATTR isr_ir_beam(void* arg) {
+  const IrBeam* beam = (const IrBeam*)arg;
+  IrRing& r = irRings[beam->door];
+
+  uint32_t head = r.head.load(std::memory_order_relaxed);
+  if (head - r.tail.load(std::memory_order_acquire) >= IR_RING_SIZE) {
+    r.overflows.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  r.buf[head & (IR_RING_SIZE - 1)] = { esp_timer_get_time(), beam->beam };
+  r.head.store(head + 1, std::memory_order_release);
+
+  if (irTaskHandle) {
     BaseType_t hpw = pdFALSE;
-    xQueueSendFromISR(irQueue, &ev, &hpw);
+    vTaskNotifyGiveFromISR(irTaskHandle, &hpw);
     if (hpw) portYIELD_FROM_ISR();
+  }
 }
 
-static void IRAM_ATTR isr_ir_a(void* arg) { send_ir_event('A'); }
-static void IRAM_ATTR isr_ir_b(void* arg) { send_ir_event('B'); }
-static void IRAM_ATTR isr_ir_c(void* arg) { send_ir_event('C'); }
-static void IRAM_ATTR isr_ir_d(void* arg) { send_ir_event('D'); }
+static bool irRingPop(IrRing& r, IrEdgeEvent& ev) {
+  uint32_t tail = r.tail.load(std::memory_order_relaxed);
+  if (tail == r.head.load(std::memory_order_acquire)) return false;
+  ev = r.buf[tail & (IR_RING_SIZE - 1)];
+  r.tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
 
-// ------------- IR GPIO init --------------------
-void setupIRGPIO() {
-  pinMode(IR_TX_A, OUTPUT); digitalWrite(IR_TX_A, HIGH);
-  pinMode(IR_TX_B, OUTPUT); digitalWrite(IR_TX_B, HIGH);
-  pinMode(IR_RX_A, INPUT_PULLUP);
-  pinMode(IR_RX_B, INPUT_PULLUP);
+// Net people inside, derived from the totals. Clamped for display only;
+// the counters themselves never lose an event.
+int32_t peopleOccupancy() {
+  int32_t net = 0;
+  for (int d = 0; d < N_DOORS; d++) {
+    net += (int32_t)(doorCounts[d].entries.load(std::memory_order_relaxed)
+                   - doorCounts[d].exits.load(std::memory_order_relaxed));
+  }
+  return net < 0 ? 0 : net;
+}
 
-  pinMode(IR_TX_C, OUTPUT); digitalWrite(IR_TX_C, HIGH);
-  pinMode(IR_TX_D, OUTPUT); digitalWrite(IR_TX_D, HIGH);
-  pinMode(IR_RX_C, INPUT_PULLUP);
-  pinMode(IR_RX_D, INPUT_PULLUP);
+uint32_t irOverflowTotal() {
+  uint32_t total = 0;
+  for (int d = 0; d < N_DOORS; d++) total += irRings[d].overflows.load(std::memory_order_relaxed);
+  return total;
+}
 
+// ------------- IR GPIO init --------------------
+void setupIRGPIO() {
   gpio_config_t cfg = {};
-  cfg.pin_bit_mask = (1ULL << IR_RX_A) | (1ULL << IR_RX_B) | (1ULL << IR_RX_C) | (1ULL << IR_RX_D);
+  for (int d = 0; d < N_DOORS; d++) {
+    const DoorConfig& door = DOORS[d];
+    pinMode(door.txOuter, OUTPUT); digitalWrite(door.txOuter, HIGH);
+    pinMode(door.txInner, OUTPUT); digitalWrite(door.txInner, HIGH);
+    pinMode(door.rxOuter, INPUT_PULLUP);
+    pinMode(door.rxInner, INPUT_PULLUP);
+    cfg.pin_bit_mask |= (1ULL << door.rxOuter) | (1ULL << door.rxInner);
+  }
   cfg.mode = GPIO_MODE_INPUT;
   cfg.pull_up_en = GPIO_PULLUP_ENABLE;
   cfg.pull_down_en = GPIO_PULLDOWN_DISABLE;
@@ -155,183 +428,160 @@ void setupIRGPIO() {
   gpio_config(&cfg);
 
   gpio_install_isr_service(0);
-  gpio_isr_handler_add((gpio_num_t)IR_RX_A, isr_ir_a, nullptr);
-  gpio_isr_handler_add((gpio_num_t)IR_RX_B, isr_ir_b, nullptr);
-  gpio_isr_handler_add((gpio_num_t)IR_RX_C, isr_ir_c, nullptr);
-  gpio_isr_handler_add((gpio_num_t)IR_RX_D, isr_ir_d, nullptr);
+  for (int d = 0; d < N_DOORS; d++) {
+    irBeams[d][BEAM_OUTER] = { (uint8_t)d, BEAM_OUTER };
+    irBeams[d][BEAM_INNER] = { (uint8_t)d, BEAM_INNER };
+    gpio_isr_handler_add((gpio_num_t)DOORS[d].rxOuter, isr_ir_beam, &irBeams[d][BEAM_OUTER]);
+    gpio_isr_handler_add((gpio_num_t)DOORS[d].rxInner, isr_ir_beam, &irBeams[d][BEAM_INNER]);
+  }
 }
 
 // ================== FreeRTOS tasks =============
+// Per-door sequence state, all times in microseconds (0 = unset)
+typedef struct {
+  int64_t tFall[2];      // last accepted fall per beam
+  int64_t lastEdge[2];   // debounce
+  int64_t lastCount;     // cooldown after a valid count
+} DoorState;
+
+// Completing a sequence on this beam: inner after outer is an entry,
+// outer after inner an exit
+const int8_t COUNT_DELTA[2] = { -1, +1 };
+
 // IR task with COOLDOWN LOGIC added
 void IRTask(void* pv) {
-  IrEdgeEvent ev;
-  const uint32_t DEBOUNCE_MS = 50;     // Ignore super short glitches
-  const uint32_t COUNT_COOLDOWN = 1500; // 1.5 seconds blocked after a valid count
-  
-  // Debounce timestamps
-  static uint32_t lastA_ms = 0, lastB_ms = 0;
-  static uint32_t lastC_ms = 0, lastD_ms = 0;
+  const int64_t DEBOUNCE_US = 50 * 1000LL;        // Ignore super short glitches
+  const int64_t COUNT_COOLDOWN_US = 1500 * 1000LL; // 1.5 seconds blocked after a valid count
+  const int64_t SEQ_WINDOW_US = SEQ_WINDOW * 1000LL;
 
-  // Cooldown timestamps (When was the last successful count?)
-  static uint32_t lastCountTime1 = 0;
-  static uint32_t lastCountTime2 = 0;
+  static DoorState doors[N_DOORS] = {};
 
   for (;;) {
-    if (xQueueReceive(irQueue, &ev, pdMS_TO_TICKS(50)) == pdTRUE) {
-      uint32_t now = ev.t_ms;
-
-      // ================= DOOR 1 LOGIC (A & B) =================
-      if (ev.sensor == 'A' || ev.sensor == 'B') {
-        
-        // If we just counted someone here < 1.5s ago, ignore EVERYTHING for Door 1
-        if (now - lastCountTime1 < COUNT_COOLDOWN) {
-            // Reset sequence triggers to prevent latent firing
-            tA_fall_ms = 0;
-            tB_fall_ms = 0;
-            continue; 
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(50));
+
+    for (int d = 0; d < N_DOORS; d++) {
+      DoorState& st = doors[d];
+      IrEdgeEvent ev;
+
+      while (irRingPop(irRings[d], ev)) {
+        irEdgeLatency.record((uint32_t)(esp_timer_get_time() - ev.t_us));
+        int64_t now = ev.t_us;
+        uint8_t b = ev.beam, other = b ^ 1;
+
+        // If we just counted someone here < 1.5s ago, ignore EVERYTHING for this door
+        if (st.lastCount && now - st.lastCount < COUNT_COOLDOWN_US) {
+          // Reset sequence triggers to prevent latent firing
+          st.tFall[0] = st.tFall[1] = 0;
+          continue;
         }
 
-        if (ev.sensor == 'A') {
-          if (now - lastA_ms < DEBOUNCE_MS) continue;
-          lastA_ms = now;
-          tA_fall_ms = now;
-
-          // Check Exit Sequence (B -> A)
-          if (tB_fall_ms && (tA_fall_ms >= tB_fall_ms) && (tA_fall_ms - tB_fall_ms <= SEQ_WINDOW)) {
-            peopleCount--;
-            if (peopleCount < 0) peopleCount = 0;
-            Serial.printf("Door 1 Exit (B->A). Count=%ld\n", (long)peopleCount);
-            
-            // SUCCESS! Set cooldown and reset triggers
-            lastCountTime1 = now;
-            tA_fall_ms = tB_fall_ms = 0; 
-          }
-        } else { // Sensor B
-          if (now - lastB_ms < DEBOUNCE_MS) continue;
-          lastB_ms = now;
-          tB_fall_ms = now;
-
-          // Check Entry Sequence (A -> B)
-          if (tA_fall_ms && (tB_fall_ms >= tA_fall_ms) && (tB_fall_ms - tA_fall_ms <= SEQ_WINDOW)) {
-            peopleCount++;
-            Serial.printf("Door 1 Entry (A->B). Count=%ld\n", (long)peopleCount);
-            
-            // SUCCESS! Set cooldown and reset triggers
-            lastCountTime1 = now;
-            tA_fall_ms = tB_fall_ms = 0; 
-          }
+        if (st.lastEdge[b] && now - st.lastEdge[b] < DEBOUNCE_US) continue;
+        st.lastEdge[b] = now;
+        st.tFall[b] = now;
+
+        // Other beam broke first and recently enough -> complete sequence
+        if (st.tFall[other] && now >= st.tFall[other] && now - st.tFall[other] <= SEQ_WINDOW_US) {
+          int8_t delta = COUNT_DELTA[b];
+          if (delta > 0) doorCounts[d].entries.fetch_add(1, std::memory_order_relaxed);
+          else           doorCounts[d].exits.fetch_add(1, std::memory_order_relaxed);
+          xEventGroupSetBits(pubEvents, EV_COUNT);
+
+          const DoorConfig& door = DOORS[d];
+          char first  = (b == BEAM_INNER) ? door.outerId : door.innerId;
+          char second = (b == BEAM_INNER) ? door.innerId : door.outerId;
+          Serial.printf("%s %s (%c->%c). Count=%ld\n", door.name, delta > 0 ? "Entry" : "Exit",
+                        first, second, (long)peopleOccupancy());
+
+          // SUCCESS! Set cooldown and reset triggers
+          st.lastCount = now;
+          st.tFall[0] = st.tFall[1] = 0;
         }
       }
 
-      // ================= DOOR 2 LOGIC (C & D) =================
-      else if (ev.sensor == 'C' || ev.sensor == 'D') {
-
-        // If we just counted someone here < 1.5s ago, ignore EVERYTHING for Door 2
-        if (now - lastCountTime2 < COUNT_COOLDOWN) {
-            tC_fall_ms = 0;
-            tD_fall_ms = 0;
-            continue; 
-        }
-
-        if (ev.sensor == 'C') {
-          if (now - lastC_ms < DEBOUNCE_MS) continue;
-          lastC_ms = now;
-          tC_fall_ms = now;
-
-          // Check Exit Sequence (D -> C)
-          if (tD_fall_ms && (tC_fall_ms >= tD_fall_ms) && (tC_fall_ms - tD_fall_ms <= SEQ_WINDOW)) {
-            peopleCount--;
-            if (peopleCount < 0) peopleCount = 0;
-            Serial.printf("Door 2 Exit (D->C). Count=%ld\n", (long)peopleCount);
-            
-            // SUCCESS! Set cooldown and reset triggers
-            lastCountTime2 = now;
-            tC_fall_ms = tD_fall_ms = 0; 
-          }
-        } else { // Sensor D
-          if (now - lastD_ms < DEBOUNCE_MS) continue;
-          lastD_ms = now;
-          tD_fall_ms = now;
-
-          // Check Entry Sequence (C -> D)
-          if (tC_fall_ms && (tD_fall_ms >= tC_fall_ms) && (tD_fall_ms - tC_fall_ms <= SEQ_WINDOW)) {
-            peopleCount++;
-            Serial.printf("Door 2 Entry (C->D). Count=%ld\n", (long)peopleCount);
-            
-            // SUCCESS! Set cooldown and reset triggers
-            lastCountTime2 = now;
-            tC_fall_ms = tD_fall_ms = 0; 
-          }
-        }
+      // Cleanup stale triggers (Timeout)
+      int64_t now2 = esp_timer_get_time();
+      for (int k = 0; k < 2; k++) {
+        if (st.tFall[k] && (now2 - st.tFall[k] > SEQ_WINDOW_US)) st.tFall[k] = 0;
       }
     }
+  }
+}
 
-    // Cleanup stale triggers (Timeout)
-    uint32_t now2 = millis();
-    if (tA_fall_ms && (now2 - tA_fall_ms > SEQ_WINDOW)) tA_fall_ms = 0;
-    if (tB_fall_ms && (now2 - tB_fall_ms > SEQ_WINDOW)) tB_fall_ms = 0;
-    if (tC_fall_ms && (now2 - tC_fall_ms > SEQ_WINDOW)) tC_fall_ms = 0;
-    if (tD_fall_ms && (now2 - tD_fall_ms > SEQ_WINDOW)) tD_fall_ms = 0;
+// Slide the window and append n new raw I2S samples, DC-blocked by a
+// one-pole high-pass. n <= VOICE_HOP.
+void micPushHop(const int32_t* raw, int n) {
+  static spec_t hp_y = 0, hp_x1 = 0;
+  const spec_t alphaHP = 0.997;
+
+  memmove(micWindow, micWindow + n, (N_SAMPLES - n) * sizeof(spec_t));
+  spec_t* dst = micWindow + (N_SAMPLES - n);
+  for (int i = 0; i < n; i++) {
+    int32_t s = raw[i] >> 8;
+    spec_t x = (spec_t)s;
+    hp_y = alphaHP * (hp_y + x - hp_x1);
+    hp_x1 = x;
+    dst[i] = hp_y;
   }
 }
 
-void VoiceTask(void* pv) {
+// Mic reader: keeps the DMA ring drained while VoiceTask runs the FFT
+void MicTask(void* pv) {
+  int filled = 0, pending = 0;
+
   for (;;) {
     size_t br = 0;
     i2s_read(I2S_PORT, (void*)rawBuf, sizeof(rawBuf), &br, portMAX_DELAY);
     int nRead = br / sizeof(int32_t);
     if (nRead <= 0) { vTaskDelay(1); continue; }
 
-    static double hp_y = 0.0, hp_x1 = 0.0;
-    const double alphaHP = 0.997;
-    for (int i = 0; i < nRead; i++) {
-      int32_t s = rawBuf[i] >> 8;
-      double x = (double)s;
-      hp_y = alphaHP * (hp_y + x - hp_x1);
-      hp_x1 = x;
-      vReal[i] = hp_y;
-      vImag[i] = 0.0;
+    {
+      PerfScope t(micHopTime);
+      micPushHop(rawBuf, nRead);
     }
+    if (filled < N_SAMPLES) filled += nRead;
+    pending += nRead;
+    if (filled < N_SAMPLES || pending < VOICE_HOP) continue;
+    pending = 0;
+
+    uint8_t idx;
+    if (xQueueReceive(micFreeQueue, &idx, 0) != pdTRUE) {
+      micFramesDropped++;
+      continue;
+    }
+    memcpy(micFrames[idx], micWindow, sizeof(micWindow));
+    xQueueSend(micReadyQueue, &idx, 0);
+  }
+}
 
-    FFT.windowing(FFTWindow::Hamming, FFTDirection::Forward);
-    FFT.compute(FFTDirection::Forward);
-    FFT.complexToMagnitude();
+void VoiceTask(void* pv) {
+  for (;;) {
+    uint8_t idx;
+    xQueueReceive(micReadyQueue, &idx, portMAX_DELAY);
+    uint32_t frameStart = ESP.getCycleCount();
+    const spec_t* frame = micFrames[idx];
+    for (int i = 0; i < N_SAMPLES; i++) spectrumLoad(i, frame[i]);
+    xQueueSend(micFreeQueue, &idx, 0);
 
-    double totalE = 0.0, voiceE = 0.0;
-    for (int i = 1; i < N_SAMPLES/2; i++) {
-      double f = (i * SAMPLE_RATE) / N_SAMPLES;
-      double p = vReal[i] * vReal[i];
-      totalE += p;
-      if (f >= 120 && f <= 3400) voiceE += p;
-    }
-    double rms   = sqrt(totalE / (N_SAMPLES/2));
-    double ratio = (totalE > 0.0) ? (voiceE / totalE) : 0.0;
+    computeSpectrum();
+    bool wasActive = voiceActive;
+
+    SpectralFeatures ft;
+    extractFeatures(ft);
+
+    spec_t rms   = sqrt(ft.totalE / N_BINS);
+    spec_t ratio = (ft.totalE > 0) ? (ft.voiceE / ft.totalE) : 0;
     ratioEMA = 0.25f * ratio + 0.75f * ratioEMA;
 
     if (rms < QUIET_RMS_MIN) {
       voiceActive = false;
     } else {
-      double lowE = 0.0, midE = 0.0;
-      for (int i = 1; i < N_SAMPLES/2; i++) {
-        double f = (i * SAMPLE_RATE) / N_SAMPLES;
-        double p = vReal[i] * vReal[i];
-        if (f >= 80  && f <= 300)  lowE += p;
-        if (f >= 500 && f <= 1500) midE += p;
-      }
-      double voicingDb = 10.0 * log10((lowE + 1e-9) / (midE + 1e-9));
-
-      double sumLog = 0.0, sumLin = 0.0; int nb = 0;
-      for (int i = 1; i < N_SAMPLES/2; i++) {
-        double f = (i * SAMPLE_RATE) / N_SAMPLES;
-        if (f < 200 || f > 3400) continue;
-        double p = vReal[i] * vReal[i] + 1e-9;
-        sumLog += log(p); sumLin += p; nb++;
-      }
-      double sfm = 1.0;
-      if (nb > 0) {
-        double geom  = exp(sumLog / nb);
-        double arith = sumLin / nb;
-        sfm = (arith > 0) ? (geom / arith) : 1.0;
+      spec_t voicingDb = 10 * log10((ft.lowE + (spec_t)1e-9) / (ft.midE + (spec_t)1e-9));
+
+      spec_t sfm = 1;
+      if (ft.sfmBins > 0) {
+        spec_t geom  = exp(ft.sfmLog / ft.sfmBins);
+        spec_t arith = ft.sfmLin / ft.sfmBins;
+        sfm = (arith > 0) ? (geom / arith) : 1;
       }
 
       static uint8_t upCnt = 0, downCnt = 0;
@@ -347,48 +597,387 @@ void VoiceTask(void* pv) {
       }
     }
 
+    if (voiceActive != wasActive) xEventGroupSetBits(pubEvents, EV_VOICE);
+    voiceFrameTime.recordCycles(ESP.getCycleCount() - frameStart);
+
     if (millis() - lastVoicePrint > 1000) {
       lastVoicePrint = millis();
-      Serial.printf("Voice=%s  Count=%ld\n", voiceActive ? "YES" : "NO", (long)peopleCount);
+      Serial.printf("Voice=%s  Count=%ld  MicDropped=%lu\n", voiceActive ? "YES" : "NO",
+                    (long)peopleOccupancy(), (unsigned long)micFramesDropped);
     }
     taskYIELD(); 
   }
 }
 
-void publishData() {
+// One telemetry sample: per-door entry/exit deltas since the previous
+// sample plus node status
+typedef struct {
+  uint32_t seq;
+  uint32_t seqFirst; // oldest seq folded into this sample (== seq if none)
+  uint64_t ts;      // unix ms, 0 until NTP has synced
+  int32_t  people;
+  bool     voice;
+  uint32_t micDropped, irOverflow;
+  uint32_t dIn[N_DOORS], dOut[N_DOORS];
+} IrTelemetry;
+
+// Pending samples, oldest first. Only touched from the publisher task.
+SampleBatch<IrTelemetry, BATCH_RING_SIZE> batch;
+bool lastSampledVoice = false;
+
+uint64_t wallClockMs() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  if (tv.tv_sec < 1600000000) return 0;   // not synced yet
+  return (uint64_t)tv.tv_sec * 1000ULL + tv.tv_usec / 1000;
+}
+
+void sampleTelemetry() {
+  // Ring full (e.g. broker down): fold the oldest sample's deltas and seq
+  // range into the next one so no counts are lost, only time resolution.
+  // The server sees seq_first..seq as covered rather than as a gap.
+  if (batch.full()) {
+    IrTelemetry& oldest = batch.at(0);
+    IrTelemetry& next = batch.at(1);
+    for (int d = 0; d < N_DOORS; d++) { next.dIn[d] += oldest.dIn[d]; next.dOut[d] += oldest.dOut[d]; }
+    next.seqFirst = oldest.seqFirst;
+    batch.pop(1);
+  }
+
+  IrTelemetry& t = batch.push();
+  t.seq = sampleSeq++;
+  t.seqFirst = t.seq;
+  t.ts = wallClockMs();
+  t.people = peopleOccupancy();
+  t.voice = voiceActive;
+  t.micDropped = micFramesDropped;
+  t.irOverflow = irOverflowTotal();
+
+  uint32_t moved = 0;
+  for (int d = 0; d < N_DOORS; d++) {
+    uint32_t entries = doorCounts[d].entries.load(std::memory_order_relaxed);
+    uint32_t exits   = doorCounts[d].exits.load(std::memory_order_relaxed);
+    t.dIn[d]  = entries - sampledEntries[d];
+    t.dOut[d] = exits - sampledExits[d];
+    sampledEntries[d] = entries;
+    sampledExits[d] = exits;
+    moved += t.dIn[d] + t.dOut[d];
+  }
+
+  // Significant change: people moved or voice toggled
+  if (moved >= BATCH_FLUSH_PEOPLE || t.voice != lastSampledVoice) batch.requestFlush();
+  lastSampledVoice = t.voice;
+}
+
+// JSON object for one sample: dN_in / dN_out (N = 1..N_DOORS) plus a
+// sequence number so the server can spot gaps (seq_first when earlier
+// samples were folded in). people_count is kept for the inference
+// pipeline. Returns length, or -1 if it does not fit.
+int writeJsonSample(char* buf, size_t cap, const IrTelemetry& t, bool withTs) {
+  int len = snprintf(buf, cap,
+  "{\"deviceId\":\"%s\",\"seq\":%lu,\"people_count\":%ld,\"voice\":%s,\"mic_dropped\":%lu,\"ir_overflow\":%lu",
+  DEVICE_ID, (unsigned long)t.seq, (long)t.people, t.voice ? "true" : "false",
+  (unsigned long)t.micDropped, (unsigned long)t.irOverflow);
+  if (t.seqFirst != t.seq && len < (int)cap) {
+    len += snprintf(buf + len, cap - len, ",\"seq_first\":%lu", (unsigned long)t.seqFirst);
+  }
+  if (withTs && len < (int)cap) {
+    len += snprintf(buf + len, cap - len, ",\"ts\":%llu", (unsigned long long)t.ts);
+  }
+  for (int d = 0; d < N_DOORS && len < (int)cap; d++) {
+    len += snprintf(buf + len, cap - len, ",\"d%d_in\":%lu,\"d%d_out\":%lu",
+                    d + 1, (unsigned long)t.dIn[d], d + 1, (unsigned long)t.dOut[d]);
+  }
+  if (len >= (int)cap - 1) return -1;
+  buf[len++] = '}'; buf[len] = '\0';
+  return len;
+}
+
+bool publishJson(const IrTelemetry& t) {
+  char msg[256];
+  int len;
+  {
+    PerfScope timer(encodeTime);
+    len = writeJsonSample(msg, sizeof(msg), t, false);
+  }
+  if (len < 0) {
+    Serial.println("IR payload truncated, skipping publish");
+    return false;
+  }
+  return mqtt.publish(TOPIC_IR, msg, false);
+}
+
+// Publishes up to `avail` timestamped samples from the ring tail as one
+// JSON array; returns how many were sent (0 on failure)
+uint8_t publishJsonBatch(uint8_t avail) {
+  static char msg[IR_BATCH_BUF_SIZE];
+  int len = 0;
+  uint8_t n = 0;
+  uint32_t start = ESP.getCycleCount();
+  msg[len++] = '[';
+  while (n < avail) {
+    const IrTelemetry& t = batch.at(n);
+    if (t.ts == 0) break;
+    if (n) msg[len++] = ',';
+    int w = writeJsonSample(msg + len, sizeof(msg) - len - 2, t, true);
+    if (w < 0) { if (n) len--; break; }
+    len += w;
+    n++;
+  }
+  if (n == 0) return 0;
+  msg[len++] = ']'; msg[len] = '\0';
+  encodeTime.recordCycles(ESP.getCycleCount() - start);
+  return mqtt.publish(TOPIC_IR_BATCH, msg, false) ? n : 0;
+}
+
+// Binary v2, little-endian, 28 + 4*N_DOORS bytes:
+//   u8 version | u8 flags (bit0 voice) | u8 nDoors | u8 folded (seq - seq_first, saturated)
+//   u32 seq | i32 people_count | u32 mic_dropped | u32 ir_overflow
+//   u64 ts (unix ms at sampling, 0 before NTP sync)
+//   nDoors x { u16 in | u16 out }   (deltas, saturated)
+// v1 was the same without ts.
+// Must match server/mqtt/binary_bridge.py.
+static inline uint8_t* putU16(uint8_t* p, uint16_t v) { p[0] = v; p[1] = v >> 8; return p + 2; }
+static inline uint8_t* putU32(uint8_t* p, uint32_t v) {
+  p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; return p + 4;
+}
+static inline uint8_t* putU64(uint8_t* p, uint64_t v) {
+  return putU32(putU32(p, (uint32_t)v), (uint32_t)(v >> 32));
+}
+
+bool publishBinary(const IrTelemetry& t) {
+  uint8_t buf[28 + 4 * N_DOORS];
+  uint32_t start = ESP.getCycleCount();
+  uint8_t* p = buf;
+  *p++ = IR_BIN_VERSION;
+  *p++ = t.voice ? 0x01 : 0x00;
+  *p++ = N_DOORS;
+  *p++ = t.seq - t.seqFirst > 0xFF ? 0xFF : t.seq - t.seqFirst;
+  p = putU32(p, t.seq);
+  p = putU32(p, (uint32_t)t.people);
+  p = putU32(p, t.micDropped);
+  p = putU32(p, t.irOverflow);
+  p = putU64(p, t.ts);
+  for (int d = 0; d < N_DOORS; d++) {
+    p = putU16(p, t.dIn[d]  > 0xFFFF ? 0xFFFF : t.dIn[d]);
+    p = putU16(p, t.dOut[d] > 0xFFFF ? 0xFFFF : t.dOut[d]);
+  }
+  encodeTime.recordCycles(ESP.getCycleCount() - start);
+
+  char topic[64];
+  snprintf(topic, sizeof(topic), "%s/%s", TOPIC_IR_BIN, DEVICE_ID);
+  return mqtt.publish(topic, buf, (unsigned)(p - buf), false);
+}
+
+// Drains the ring; samples stay buffered if the broker is unreachable
+void flushBatch() {
   if (!mqtt.connected()) return;
-  int32_t count_snapshot = peopleCount;
-  char msg[128];
-  snprintf(msg, sizeof(msg),
-  "{\"deviceId\":\"%s\",\"people_count\":%ld,\"voice\":%s}",
-  DEVICE_ID, (long)count_snapshot, voiceActive ? "true" : "false");
 
-  mqtt.publish(TOPIC_IR, msg, false);
+  while (!batch.empty()) {
+    const IrTelemetry& front = batch.front();
+#if IR_PAYLOAD_FORMAT == IR_PAYLOAD_BINARY
+    if (!publishBinary(front)) return;
+    batch.pop(1);
+#else
+    // Samples taken before NTP sync have no timestamp: send them singly
+    if (BATCH_MAX_SAMPLES == 1 || front.ts == 0) {
+      if (!publishJson(front)) return;
+      batch.pop(1);
+      continue;
+    }
+    uint8_t sent = publishJsonBatch(batch.size());
+    if (sent == 0) return;
+    batch.pop(sent);
+#endif
+  }
+}
+
+void publishPerf() {
+  static char msg[PERF_BUF_SIZE];
+  if (perf.writeJson(msg, sizeof(msg), DEVICE_ID) < 0) {
+    Serial.println("Perf report truncated, skipping publish");
+    return;
+  }
+  char topic[64];
+  snprintf(topic, sizeof(topic), TOPIC_PERF_FMT, DEVICE_ID);
+  mqtt.publish(topic, msg, false);
 }
 
+static void onHeartbeat(TimerHandle_t) { xEventGroupSetBits(pubEvents, EV_HEARTBEAT); }
+
+void PublisherTask(void* pv) {
+  unsigned long lastPerfMs = millis();
+  for (;;) {
+    unsigned long waitMs = net.online() ? MQTT_SERVICE_MS : NET_RETRY_POLL_MS;
+    EventBits_t bits = xEventGroupWaitBits(pubEvents, EV_COUNT | EV_VOICE | EV_HEARTBEAT,
+                                           pdTRUE, pdFALSE, pdMS_TO_TICKS(waitMs));
+    net.poll();
+    if (net.online()) {
+      mqtt.loop();
+      if (net.takeOnlineEdge()) batch.requestFlush();   // replay what was buffered
+    }
+
+    if (bits & (EV_COUNT | EV_VOICE | EV_HEARTBEAT)) sampleTelemetry();
+    if (batch.due(BATCH_MAX_SAMPLES, BATCH_WINDOW_MS)) {
+      PerfScope t(flushTime);
+      flushBatch();
+    }
+    if (millis() - lastPerfMs >= PERF_INTERVAL_MS && mqtt.connected()) {
+      lastPerfMs = millis();
+      publishPerf();
+    }
+  }
+}
+
+// ================== BENCHMARK =================
+#if SMARTSTOP_BENCH
+// Records BENCH_RECORD_SAMPLES of mic audio once, then replays it through
+// the same kernels the node runs: micPushHop() (filter), spectrumLoad +
+// computeSpectrum + extractFeatures (FFT) and writeJsonSample() (JSON).
+#define BENCH_RECORD_SAMPLES 16000   // 1 s at SAMPLE_RATE, 64 KB
+#define BENCH_ROUNDS 5               // replays per report
+#define BENCH_REPEAT_MS 10000
+
+#if VOICE_FFT_BACKEND == VOICE_FFT_ARDUINO_DOUBLE
+const char* BENCH_BACKEND = "arduinoFFT<double>";
+#elif VOICE_FFT_BACKEND == VOICE_FFT_ARDUINO_FLOAT
+const char* BENCH_BACKEND = "arduinoFFT<float>";
+#else
+const char* BENCH_BACKEND = "esp-dsp f32";
+#endif
+
+int32_t benchAudio[BENCH_RECORD_SAMPLES];
+int benchRecorded = 0;
+
+int benchRecord() {
+  int got = 0;
+  while (got < BENCH_RECORD_SAMPLES) {
+    size_t br = 0;
+    i2s_read(I2S_PORT, benchAudio + got, (BENCH_RECORD_SAMPLES - got) * sizeof(int32_t), &br, pdMS_TO_TICKS(2000));
+    if (br == 0) break;
+    got += br / sizeof(int32_t);
+  }
+  return got;
+}
+
+// items of `unit` per second over the summed kernel time
+void benchReport(const char* kernel, PerfTimer& t, uint32_t items, const char* unit) {
+  PerfTimer::Summary s = t.take();
+  float rate = s.totalUs ? items * 1e6f / s.totalUs : 0;
+  Serial.printf("%-12s %6lu calls  mean %6lu us  p99 <= %6lu us  max %6lu us  %10.0f %s/s\n",
+                kernel, (unsigned long)s.count, (unsigned long)s.meanUs, (unsigned long)s.p99Us,
+                (unsigned long)s.maxUs, rate, unit);
+}
+
+void runBench() {
+  if (benchRecorded < N_SAMPLES) {
+    benchRecorded = benchRecord();
+    Serial.printf("Bench: recorded %d mic samples\n", benchRecorded);
+    if (benchRecorded < N_SAMPLES) { Serial.println("Bench: no mic input, nothing to replay"); return; }
+  }
+
+  PerfTimer filterT("filter"), fftT("fft"), jsonT("json");
+  uint32_t samples = 0, frames = 0, encoded = 0, bytes = 0;
+  int filled = 0;
+  SpectralFeatures ft;
+  volatile spec_t sink = 0;   // keeps the feature pass from being optimised out
+
+  for (int round = 0; round < BENCH_ROUNDS; round++) {
+    for (int off = 0; off + VOICE_HOP <= benchRecorded; off += VOICE_HOP) {
+      {
+        PerfScope t(filterT);
+        micPushHop(benchAudio + off, VOICE_HOP);
+      }
+      samples += VOICE_HOP;
+      if (filled < N_SAMPLES) filled += VOICE_HOP;
+      if (filled < N_SAMPLES) continue;
+
+      {
+        PerfScope t(fftT);
+        for (int i = 0; i < N_SAMPLES; i++) spectrumLoad(i, micWindow[i]);
+        computeSpectrum();
+        extractFeatures(ft);
+      }
+      sink = sink + ft.voiceE;
+      frames++;
+    }
+  }
+
+  // Telemetry shaped like a busy stop: a few people per sample, voice on/off
+  char msg[256];
+  IrTelemetry t = {};
+  for (uint32_t i = 0; i < 1000; i++) {
+    t.seq = t.seqFirst = i;
+    t.ts = 1700000000000ULL + i * HEARTBEAT_MS;
+    t.people = i % 40;
+    t.voice = i & 1;
+    for (int d = 0; d < N_DOORS; d++) { t.dIn[d] = i % 3; t.dOut[d] = (i + d) % 2; }
+    int len;
+    {
+      PerfScope timer(jsonT);
+      len = writeJsonSample(msg, sizeof(msg), t, true);
+    }
+    if (len > 0) { encoded++; bytes += len; }
+  }
+
+  Serial.printf("\n=== Bench: %s, N=%d, hop=%d, %d rounds ===\n", BENCH_BACKEND, N_SAMPLES, VOICE_HOP, BENCH_ROUNDS);
+  PerfTimer::Summary fs = fftT.take(false);
+  benchReport("filter", filterT, samples, "samples");
+  benchReport("fft", fftT, frames, "frames");
+  benchReport("json", jsonT, encoded, "msgs");
+  // A frame has to finish within one hop of audio to keep up
+  float hopUs = VOICE_HOP * 1e6f / SAMPLE_RATE;
+  Serial.printf("fft realtime headroom %.1fx (hop %.0f us), json %.0f bytes/msg, heap min %u\n",
+                fs.meanUs ? hopUs / fs.meanUs : 0, hopUs, encoded ? bytes / (float)encoded : 0,
+                (unsigned)ESP.getMinFreeHeap());
+}
+#endif
+
 void setup() {
   Serial.begin(921600); 
+#if SMARTSTOP_BENCH
+  setupI2S();
+  setupSpectrum();
+  perf.begin();   // cycle counter -> us at the running CPU clock
+  return;
+#endif
   
-  irQueue = xQueueCreate(32, sizeof(IrEdgeEvent));
+  pubEvents = xEventGroupCreate();
+  micFreeQueue  = xQueueCreate(2, sizeof(uint8_t));
+  micReadyQueue = xQueueCreate(2, sizeof(uint8_t));
+  for (uint8_t i = 0; i < 2; i++) xQueueSend(micFreeQueue, &i, 0);
   setupIRGPIO();
   setupI2S();
+  setupSpectrum();
 
-  ensureWifi();
-  ensureMqtt();
-
-  xTaskCreatePinnedToCore(IRTask,    "IRTask",    2048, nullptr, 3, nullptr, 1);
-  xTaskCreatePinnedToCore(VoiceTask, "VoiceTask", 4096, nullptr, 2, nullptr, 0);
+  mqtt.setServer(MQTT_HOST, MQTT_PORT);
+  mqtt.setSocketTimeout(2);   // bound a single connect attempt
+  mqtt.setBufferSize(IR_BATCH_BUF_SIZE + 64);   // + MQTT header and topic
+  net.begin(WIFI_SSID, WIFI_PASS, mqttUp, mqttConnect);
+  WiFi.setSleep(true);   // modem sleep between bursts
+  configTime(0, 0, "pool.ntp.org");
+
+  xTaskCreatePinnedToCore(IRTask,    "IRTask",    2048, nullptr, 3, &irTaskHandle, 1);
+  xTaskCreatePinnedToCore(MicTask,   "MicTask",   2048, nullptr, 4, &micTaskHandle, 0);
+  xTaskCreatePinnedToCore(VoiceTask, "VoiceTask", 4096, nullptr, 2, &voiceTaskHandle, 0);
+  xTaskCreatePinnedToCore(PublisherTask, "PublisherTask", 6144, nullptr, 1, &publisherTaskHandle, 1);
+
+  perf.begin();
+  PerfTimer* timers[] = { &irEdgeLatency, &micHopTime, &voiceFrameTime, &encodeTime, &flushTime };
+  for (PerfTimer* t : timers) perf.add(*t);
+  TaskHandle_t tasks[] = { irTaskHandle, micTaskHandle, voiceTaskHandle, publisherTaskHandle };
+  for (TaskHandle_t h : tasks) perf.addTask(h);
+
+  heartbeatTimer = xTimerCreate("heartbeat", pdMS_TO_TICKS(HEARTBEAT_MS), pdTRUE, nullptr, onHeartbeat);
+  xTimerStart(heartbeatTimer, 0);
 }
 
 void loop() {
-  mqtt.loop();
-  ensureWifi();
-  ensureMqtt();
-
-  unsigned long now = millis();
-  if (now - lastPubMs >= PUB_INTERVAL) {
-    lastPubMs = now;
-    publishData();
-  }
-  delay(1); 
-}
\ No newline at end of file
+#if SMARTSTOP_BENCH
+  runBench();
+  delay(BENCH_REPEAT_MS);
+  return;
+#endif
+  // All work happens in the FreeRTOS tasks; PublisherTask owns MQTT
+  vTaskDelete(NULL);
+}
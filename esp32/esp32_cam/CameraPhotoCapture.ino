@@ -1,6 +1,8 @@
 #include "esp_camera.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
+#include <HttpSession.h>
+#include <CameraSetup.h>
 
 //
 // ESP32 Camera Photo Capture & Upload to Flask Server
@@ -33,7 +35,7 @@
 //#define CAMERA_MODEL_ESP32S3_CAM_LCD
 //#define CAMERA_MODEL_DFRobot_FireBeetle2_ESP32S3 // Has PSRAM
 //#define CAMERA_MODEL_DFRobot_Romeo_ESP32S3 // Has PSRAM
-#include "camera_pins.h"
+#include <CameraPins.h>
 
 // ===========================
 // Configuration
@@ -49,6 +51,9 @@ const char* serverURL = "http://157.230.250.226:5000/upload";  // Update this wi
 #define SLEEP_DURATION 60       // Deep sleep duration in seconds (60 seconds = 1 minute)
 #define BUTTON_PIN 0           // GPIO0 (Boot button) for manual capture
 
+// Retries reuse the same keep-alive connection
+HttpSession upload;
+
 // Function declarations
 void setupCamera();
 void setupWiFi();
@@ -114,32 +119,7 @@ void setup() {
 void setupCamera() {
   Serial.println("Initializing camera...");
   
-  camera_config_t config;
-  config.ledc_channel = LEDC_CHANNEL_0;
-  config.ledc_timer = LEDC_TIMER_0;
-  config.pin_d0 = Y2_GPIO_NUM;
-  config.pin_d1 = Y3_GPIO_NUM;
-  config.pin_d2 = Y4_GPIO_NUM;
-  config.pin_d3 = Y5_GPIO_NUM;
-  config.pin_d4 = Y6_GPIO_NUM;
-  config.pin_d5 = Y7_GPIO_NUM;
-  config.pin_d6 = Y8_GPIO_NUM;
-  config.pin_d7 = Y9_GPIO_NUM;
-  config.pin_xclk = XCLK_GPIO_NUM;
-  config.pin_pclk = PCLK_GPIO_NUM;
-  config.pin_vsync = VSYNC_GPIO_NUM;
-  config.pin_href = HREF_GPIO_NUM;
-  config.pin_sccb_sda = SIOD_GPIO_NUM;
-  config.pin_sccb_scl = SIOC_GPIO_NUM;
-  config.pin_pwdn = PWDN_GPIO_NUM;
-  config.pin_reset = RESET_GPIO_NUM;
-  config.xclk_freq_hz = 20000000;
-  config.frame_size = FRAMESIZE_UXGA;
-  config.pixel_format = PIXFORMAT_JPEG;  // for photo capture
-  config.grab_mode = CAMERA_GRAB_WHEN_EMPTY;
-  config.fb_location = CAMERA_FB_IN_PSRAM;
-  config.jpeg_quality = 12;
-  config.fb_count = 1;
+  camera_config_t config = makeCameraConfig<BoardPins>(CAMERA_JPEG_PSRAM);
 
   // if PSRAM IC present, init with UXGA resolution and higher JPEG quality
   if (config.pixel_format == PIXFORMAT_JPEG) {
@@ -275,13 +255,12 @@ bool uploadToServer(camera_fb_t * fb, int attemptNum) {
     return false;
   }
   
-  HTTPClient http;
-  http.setTimeout(30000); // 30 second timeout
-  
-  if (!http.begin(serverURL)) {
+  upload.timeoutMs = 30000; // 30 second timeout
+  if (!upload.begin(serverURL)) {
     Serial.println("HTTP client begin failed");
     return false;
   }
+  HTTPClient& http = upload.http();
   
   // Set headers for raw JPEG upload
   // Flask server expects: Content-Type: image/jpeg and optional Device-ID header
@@ -300,7 +279,8 @@ bool uploadToServer(camera_fb_t * fb, int attemptNum) {
   int httpResponseCode = http.POST(fb->buf, fb->len);
   
   // Get response
-  String response = http.getString();
+  char response[256];
+  int responseLen = httpResponseCode > 0 ? upload.readBody(response, sizeof(response)) : -1;
   
   Serial.printf("HTTP Response Code: %d\n", httpResponseCode);
   
@@ -324,12 +304,12 @@ bool uploadToServer(camera_fb_t * fb, int attemptNum) {
     Serial.println("SUCCESS: Photo uploaded!");
   }
   
-  if (response.length() > 0) {
+  if (responseLen > 0) {
     Serial.println("Server response:");
     Serial.println(response);
   }
   
-  http.end();
+  upload.end(httpResponseCode);
   
   // Check if upload was successful (HTTP 200)
   return (httpResponseCode == 200);
@@ -1,3 +1,12 @@
+#pragma once
+
+// GPIO map for the supported camera boards. Define exactly one
+// CAMERA_MODEL_* before including this header:
+//
+//   #define CAMERA_MODEL_AI_THINKER
+//   #include <CameraPins.h>
+//   camera_config_t config = makeCameraConfig<BoardPins>(profile);
+
 
 #if defined(CAMERA_MODEL_WROVER_KIT)
 #define PWDN_GPIO_NUM  -1
@@ -336,3 +345,12 @@
 #else
 #error "Camera model not selected"
 #endif
+
+// The selected board as a pin profile type for makeCameraConfig()
+struct BoardPins {
+  static constexpr int pwdn = PWDN_GPIO_NUM, reset = RESET_GPIO_NUM, xclk = XCLK_GPIO_NUM;
+  static constexpr int sda = SIOD_GPIO_NUM, scl = SIOC_GPIO_NUM;
+  static constexpr int d0 = Y2_GPIO_NUM, d1 = Y3_GPIO_NUM, d2 = Y4_GPIO_NUM, d3 = Y5_GPIO_NUM;
+  static constexpr int d4 = Y6_GPIO_NUM, d5 = Y7_GPIO_NUM, d6 = Y8_GPIO_NUM, d7 = Y9_GPIO_NUM;
+  static constexpr int vsync = VSYNC_GPIO_NUM, href = HREF_GPIO_NUM, pclk = PCLK_GPIO_NUM;
+};
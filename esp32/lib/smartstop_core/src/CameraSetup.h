@@ -0,0 +1,49 @@
+#pragma once
+#include <esp_camera.h>
+
+// Camera settings a node picks per mode; the pins come from a board profile
+// (see BoardPins in CameraPins.h) so they are fixed at compile time.
+struct CameraProfile {
+  pixformat_t format;
+  framesize_t frameSize;
+  int jpegQuality;
+  size_t fbCount;
+  camera_fb_location_t fbLocation;
+  camera_grab_mode_t grabMode;
+};
+
+// JPEG into PSRAM, the default for the uploader and SD capture nodes
+constexpr CameraProfile CAMERA_JPEG_PSRAM = {
+  PIXFORMAT_JPEG, FRAMESIZE_UXGA, 12, 1, CAMERA_FB_IN_PSRAM, CAMERA_GRAB_WHEN_EMPTY
+};
+
+template <class Pins>
+camera_config_t makeCameraConfig(const CameraProfile& p) {
+  camera_config_t c = {};
+  c.pin_pwdn = Pins::pwdn;
+  c.pin_reset = Pins::reset;
+  c.pin_xclk = Pins::xclk;
+  c.pin_sccb_sda = Pins::sda;
+  c.pin_sccb_scl = Pins::scl;
+  c.pin_d7 = Pins::d7;
+  c.pin_d6 = Pins::d6;
+  c.pin_d5 = Pins::d5;
+  c.pin_d4 = Pins::d4;
+  c.pin_d3 = Pins::d3;
+  c.pin_d2 = Pins::d2;
+  c.pin_d1 = Pins::d1;
+  c.pin_d0 = Pins::d0;
+  c.pin_vsync = Pins::vsync;
+  c.pin_href = Pins::href;
+  c.pin_pclk = Pins::pclk;
+  c.xclk_freq_hz = 20000000;
+  c.ledc_timer = LEDC_TIMER_0;
+  c.ledc_channel = LEDC_CHANNEL_0;
+  c.pixel_format = p.format;
+  c.frame_size = p.frameSize;
+  c.jpeg_quality = p.jpegQuality;
+  c.fb_count = p.fbCount;
+  c.fb_location = p.fbLocation;
+  c.grab_mode = p.grabMode;
+  return c;
+}
@@ -0,0 +1,104 @@
+#include "ConnectionManager.h"
+
+ConnectionManager* ConnectionManager::instance = nullptr;
+
+// Delay doubles per failure up to maxMs; "equal jitter" picks a point in
+// [d/2, d] so a fleet of nodes does not reconnect in lockstep
+void ConnectionManager::Backoff::fail(unsigned long now, uint32_t minMs, uint32_t maxMs) {
+  uint32_t d = minMs << (attempt < 16 ? attempt : 16);
+  if (d > maxMs || d < minMs) d = maxMs;
+  if (attempt < 255) attempt++;
+  d = d / 2 + esp_random() % (d / 2 + 1);
+  nextMs = now + d;
+}
+
+void ConnectionManager::onWiFiEvent(WiFiEvent_t event) {
+  if (!instance) return;
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) instance->wifiConnected = true;
+  else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) instance->wifiConnected = false;
+}
+
+void ConnectionManager::begin(const char* ssid_, const char* pass_, LinkFn linkUp_, LinkFn linkConnect_) {
+  ssid = ssid_;
+  pass = pass_;
+  linkUp = linkUp_;
+  linkConnect = linkConnect_;
+  instance = this;
+
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(false);   // retries are ours, with backoff
+  WiFi.onEvent(onWiFiEvent);
+  state = WIFI_IDLE;
+}
+
+bool ConnectionManager::online() const {
+  return state == ONLINE;
+}
+
+bool ConnectionManager::takeOnlineEdge() {
+  bool edge = onlineEdge;
+  onlineEdge = false;
+  return edge;
+}
+
+void ConnectionManager::poll() {
+  unsigned long now = millis();
+
+  // WiFi dropped underneath us
+  if (!wifiConnected && state != WIFI_IDLE && state != WIFI_CONNECTING) {
+    Serial.println("[net] WiFi lost");
+    state = WIFI_IDLE;
+    wifiBackoff.reset();
+  }
+
+  switch (state) {
+    case WIFI_IDLE:
+      if (!wifiBackoff.ready(now)) return;
+      Serial.printf("[net] WiFi connecting to %s\n", ssid);
+      WiFi.disconnect();
+      WiFi.begin(ssid, pass);
+      connectStartMs = now;
+      state = WIFI_CONNECTING;
+      return;
+
+    case WIFI_CONNECTING:
+      if (wifiConnected) {
+        Serial.printf("[net] WiFi up, IP %s\n", WiFi.localIP().toString().c_str());
+        wifiBackoff.reset();
+        linkBackoff.reset();
+        state = LINK_DOWN;
+      } else if (now - connectStartMs >= wifiConnectTimeoutMs) {
+        wifiBackoff.fail(now, minBackoffMs, maxBackoffMs);
+        Serial.printf("[net] WiFi timeout, retry in %lu ms\n", wifiBackoff.nextMs - now);
+        state = WIFI_IDLE;
+      }
+      return;
+
+    case LINK_DOWN:
+      if (!linkUp || linkUp()) {
+        state = ONLINE;
+        onlineEdge = true;
+        reconnectCount++;
+        return;
+      }
+      // Without linkConnect the client reconnects itself; just wait for linkUp
+      if (!linkConnect || !linkBackoff.ready(now)) return;
+      if (linkConnect()) {
+        linkBackoff.reset();
+        state = ONLINE;
+        onlineEdge = true;
+        reconnectCount++;
+      } else {
+        linkBackoff.fail(now, minBackoffMs, maxBackoffMs);
+        Serial.printf("[net] link connect failed, retry in %lu ms\n", linkBackoff.nextMs - now);
+      }
+      return;
+
+    case ONLINE:
+      if (linkUp && !linkUp()) {
+        Serial.println("[net] link lost");
+        state = LINK_DOWN;
+      }
+      return;
+  }
+}
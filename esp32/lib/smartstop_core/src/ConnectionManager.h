@@ -0,0 +1,54 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+
+// Non-blocking WiFi (+ optional second-stage link such as MQTT) reconnect
+// engine. Call poll() often; it never waits, apart from a single link
+// connect attempt. Retries use exponential backoff with jitter, and WiFi
+// drops are picked up from WiFi events rather than polling status().
+class ConnectionManager {
+public:
+  typedef bool (*LinkFn)();
+
+  // linkUp/linkConnect are optional: without linkUp online() == wifiUp(),
+  // without linkConnect the client is trusted to reconnect on its own
+  void begin(const char* ssid, const char* pass,
+             LinkFn linkUp = nullptr, LinkFn linkConnect = nullptr);
+  void poll();
+
+  bool wifiUp() const { return wifiConnected; }
+  bool online() const;
+  // True once after every transition to online (use it to replay buffers)
+  bool takeOnlineEdge();
+  uint32_t reconnects() const { return reconnectCount; }
+
+  uint32_t minBackoffMs = 500;
+  uint32_t maxBackoffMs = 30000;
+  uint32_t wifiConnectTimeoutMs = 15000;
+
+private:
+  enum State : uint8_t { WIFI_IDLE, WIFI_CONNECTING, LINK_DOWN, ONLINE };
+
+  struct Backoff {
+    uint8_t attempt = 0;
+    unsigned long nextMs = 0;
+    void reset() { attempt = 0; nextMs = 0; }
+    void fail(unsigned long now, uint32_t minMs, uint32_t maxMs);
+    bool ready(unsigned long now) const { return (long)(now - nextMs) >= 0; }
+  };
+
+  static void onWiFiEvent(WiFiEvent_t event);
+  static ConnectionManager* instance;
+
+  const char* ssid = nullptr;
+  const char* pass = nullptr;
+  LinkFn linkUp = nullptr;
+  LinkFn linkConnect = nullptr;
+
+  State state = WIFI_IDLE;
+  volatile bool wifiConnected = false;   // written from the WiFi event task
+  bool onlineEdge = false;
+  unsigned long connectStartMs = 0;
+  uint32_t reconnectCount = 0;
+  Backoff wifiBackoff, linkBackoff;
+};
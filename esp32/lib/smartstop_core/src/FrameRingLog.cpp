@@ -0,0 +1,175 @@
+#include "FrameRingLog.h"
+#include <esp_rom_crc.h>
+#include <time.h>
+#include <algorithm>
+
+static const uint32_t INDEX_MAGIC = 0x534D5249;  // "SMRI"
+static const uint32_t SLOT_MAGIC = 0x534D5346;   // "SMSF"
+
+template <typename T>
+static uint32_t structCrc(const T& v) {
+  return esp_rom_crc32_le(0, (const uint8_t*)&v, offsetof(T, crc));
+}
+
+bool FrameRingLog::begin(fs::FS& fs, const char* path, uint32_t slotSize, uint32_t slotCount, bool reformat) {
+  end();
+  if (slotSize <= SECTOR || slotSize % SECTOR || slotCount == 0) return false;
+
+  if (fs.exists(path)) {
+    file = fs.open(path, "r+");
+    bool indexOk = file && loadIndex();
+    if (indexOk && idx.slotSize == slotSize && idx.slotCount == slotCount) {
+      isOpen = true;
+      return true;
+    }
+    if (file) file.close();
+    if (!reformat) {
+      if (indexOk) {
+        Serial.printf("[frame log] %s is %u x %u B, expected %u x %u B; not reformatting it\n", path,
+                      (unsigned)idx.slotCount, (unsigned)idx.slotSize, (unsigned)slotCount, (unsigned)slotSize);
+      } else {
+        Serial.printf("[frame log] %s has no valid index; not reformatting it\n", path);
+      }
+      return false;
+    }
+  }
+
+  // "w+", not FILE_WRITE: the same handle serves peek()/read() afterwards
+  file = fs.open(path, "w+");
+  if (!file) return false;
+  isOpen = format(slotSize, slotCount);
+  return isOpen;
+}
+
+void FrameRingLog::end() {
+  if (file) file.close();
+  isOpen = false;
+}
+
+// One-off cost: extend the file to its final size so later writes never
+// allocate clusters
+bool FrameRingLog::format(uint32_t slotSize, uint32_t slotCount) {
+  idx = {};
+  idx.magic = INDEX_MAGIC;
+  idx.slotSize = slotSize;
+  idx.slotCount = slotCount;
+
+  uint32_t total = 2 * SECTOR + slotSize * slotCount;
+  uint8_t zero = 0;
+  if (!file.seek(total - 1) || file.write(&zero, 1) != 1) return false;
+  // Both index copies, so a stale copy from an older geometry cannot win
+  if (!writeIndex() || !writeIndex()) return false;
+  return true;
+}
+
+bool FrameRingLog::loadIndex() {
+  Index copies[2];
+  bool valid[2];
+  for (int i = 0; i < 2; i++) {
+    valid[i] = file.seek(i * SECTOR) && file.read((uint8_t*)&copies[i], sizeof(Index)) == sizeof(Index) &&
+               copies[i].magic == INDEX_MAGIC && copies[i].crc == structCrc(copies[i]);
+  }
+  if (!valid[0] && !valid[1]) return false;
+  int best = (valid[0] && valid[1]) ? (copies[1].generation > copies[0].generation) : valid[1];
+  idx = copies[best];
+  return true;
+}
+
+bool FrameRingLog::writeIndex() {
+  idx.generation++;
+  idx.crc = structCrc(idx);
+  bool ok = file.seek((idx.generation % 2) * SECTOR) && file.write((const uint8_t*)&idx, sizeof(Index)) == sizeof(Index);
+  file.flush();
+  return ok;
+}
+
+bool FrameRingLog::append(const uint8_t* data, size_t len, uint32_t meta) {
+  if (!isOpen || len == 0 || len > maxFrameBytes()) return false;
+
+  SlotHeader hdr = {};
+  hdr.magic = SLOT_MAGIC;
+  hdr.seq = idx.head;
+  hdr.len = len;
+  hdr.meta = meta;
+  hdr.capturedAt = clockSynced() ? time(nullptr) : 0;
+  hdr.dataCrc = esp_rom_crc32_le(0, data, len);
+  hdr.crc = structCrc(hdr);
+
+  uint32_t off = slotOffset(idx.head);
+  if (staging) {
+    if (!writeStaged(off, hdr, data, len)) return false;
+  } else {
+    if (!file.seek(off) || file.write((const uint8_t*)&hdr, sizeof(hdr)) != sizeof(hdr)) return false;
+    if (!file.seek(off + SECTOR) || file.write(data, len) != len) return false;
+  }
+  file.flush();
+
+  // Commit only after the data is down; a crash before this leaves the slot invisible
+  if (pending() == idx.slotCount) {
+    idx.tail++;
+    idx.dropped++;
+  }
+  idx.head++;
+  return writeIndex();
+}
+
+void FrameRingLog::setStaging(uint8_t* buf, size_t size) {
+  size -= size % SECTOR;
+  staging = size ? buf : nullptr;
+  stagingSize = size;
+}
+
+// Slot offsets are sector multiples, so every chunk starts on a sector
+// boundary; the last one is zero-padded to a whole sector (the pad stays
+// inside the slot since len <= slotSize - SECTOR).
+bool FrameRingLog::writeStaged(uint32_t off, const SlotHeader& hdr, const uint8_t* data, size_t len) {
+  if (!file.seek(off)) return false;
+
+  memset(staging, 0, SECTOR);
+  memcpy(staging, &hdr, sizeof(hdr));
+  size_t fill = SECTOR;
+  size_t done = 0;
+  while (fill > 0 || done < len) {
+    size_t n = std::min(stagingSize - fill, len - done);
+    memcpy(staging + fill, data + done, n);
+    fill += n;
+    done += n;
+    if (done == len && fill % SECTOR) {
+      size_t pad = SECTOR - fill % SECTOR;
+      memset(staging + fill, 0, pad);
+      fill += pad;
+    }
+    if (file.write(staging, fill) != fill) return false;
+    fill = 0;
+  }
+  return true;
+}
+
+bool FrameRingLog::peek(Frame& frame) {
+  while (isOpen && pending()) {
+    SlotHeader hdr;
+    if (file.seek(slotOffset(idx.tail)) && file.read((uint8_t*)&hdr, sizeof(hdr)) == sizeof(hdr) &&
+        hdr.magic == SLOT_MAGIC && hdr.crc == structCrc(hdr) && hdr.seq == idx.tail &&
+        hdr.len <= maxFrameBytes()) {
+      frame = { hdr.seq, hdr.len, hdr.meta, hdr.capturedAt };
+      return true;
+    }
+    idx.dropped++;
+    pop();  // unreadable slot, skip it
+  }
+  return false;
+}
+
+bool FrameRingLog::read(const Frame& frame, uint8_t* buf) {
+  SlotHeader hdr;
+  uint32_t off = slotOffset(frame.seq);
+  if (!file.seek(off) || file.read((uint8_t*)&hdr, sizeof(hdr)) != sizeof(hdr)) return false;
+  if (!file.seek(off + SECTOR) || file.read(buf, frame.len) != frame.len) return false;
+  return esp_rom_crc32_le(0, buf, frame.len) == hdr.dataCrc;
+}
+
+bool FrameRingLog::pop() {
+  if (!isOpen || !pending()) return false;
+  idx.tail++;
+  return writeIndex();
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+
+// Append-only ring of fixed-size frame slots inside one preallocated file.
+// The file never changes size after creation, so a store is a couple of
+// in-place sector writes with no FAT allocation or directory churn.
+//
+// Layout (512-byte sectors):
+//   sector 0, 1   index copies, written alternately (newest valid one wins)
+//   slot i        at 2*512 + i*slotSize: 512-byte slot header, then data
+class FrameRingLog {
+public:
+  static const uint32_t SECTOR = 512;
+
+  struct Frame {
+    uint32_t seq;
+    uint32_t len;
+    uint32_t meta;        // caller-defined (e.g. capture settings)
+    int64_t capturedAt;   // unix seconds at append, 0 if the clock was not synced
+  };
+
+  // time(nullptr) counts from boot until SNTP has set it
+  static bool clockSynced() { return time(nullptr) >= 1600000000; }
+
+  // Opens path, creating and preallocating it if missing. An existing file
+  // whose geometry differs from slotSize/slotCount (or whose index is
+  // unreadable) is only wiped when reformat is set; otherwise begin() logs
+  // and fails, so collected frames are never lost to a constant change.
+  // slotSize must be a multiple of SECTOR.
+  bool begin(fs::FS& fs, const char* path, uint32_t slotSize, uint32_t slotCount, bool reformat = false);
+  void end();
+
+  // Optional DMA-capable bounce buffer (size a multiple of SECTOR). When set,
+  // append() copies header + data through it in whole sectors, so the SD
+  // driver gets multi-sector DMA transfers instead of per-sector copies out
+  // of PSRAM and FATFS never read-modify-writes a partial sector.
+  void setStaging(uint8_t* buf, size_t size);
+
+  // Stores one frame, overwriting the oldest pending one when full
+  bool append(const uint8_t* data, size_t len, uint32_t meta = 0);
+  // Oldest pending frame, verified against its CRC; corrupt slots are skipped
+  bool peek(Frame& frame);
+  // Reads the whole data of the frame returned by peek() into buf
+  bool read(const Frame& frame, uint8_t* buf);
+  // Acknowledges the oldest pending frame
+  bool pop();
+
+  uint32_t pending() const { return idx.head - idx.tail; }
+  uint32_t dropped() const { return idx.dropped; }
+  uint32_t capacity() const { return idx.slotCount; }
+  uint32_t maxFrameBytes() const { return idx.slotSize - SECTOR; }
+  bool ready() const { return isOpen; }
+
+private:
+  struct Index {
+    uint32_t magic;
+    uint32_t slotSize, slotCount;
+    uint32_t head, tail;  // sequence numbers; slot = seq % slotCount
+    uint32_t generation;
+    uint32_t dropped;
+    uint32_t crc;
+  };
+  struct SlotHeader {
+    uint32_t magic;
+    uint32_t seq, len, meta;
+    int64_t capturedAt;
+    uint32_t dataCrc;
+    uint32_t crc;
+  };
+
+  bool loadIndex();
+  bool writeIndex();
+  bool format(uint32_t slotSize, uint32_t slotCount);
+  bool writeStaged(uint32_t off, const SlotHeader& hdr, const uint8_t* data, size_t len);
+  uint32_t slotOffset(uint32_t seq) const { return 2 * SECTOR + (seq % idx.slotCount) * idx.slotSize; }
+
+  fs::File file;
+  Index idx = {};
+  bool isOpen = false;
+  uint8_t* staging = nullptr;
+  size_t stagingSize = 0;
+};
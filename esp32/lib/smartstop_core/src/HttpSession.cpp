@@ -0,0 +1,72 @@
+#include "HttpSession.h"
+
+bool HttpSession::begin(const char* url) {
+  if (tcp.connected()) {
+    if (millis() - lastUseMs > maxIdleMs) tcp.stop();  // server has likely closed it
+    else reuseCount++;
+  }
+  client.setReuse(true);
+  client.setTimeout(timeoutMs);
+  if (!client.begin(tcp, url)) {
+    failureCount++;
+    return false;
+  }
+  return true;
+}
+
+void HttpSession::end(int code) {
+  client.end();  // keeps the socket when the server agreed to keep-alive
+  requestCount++;
+  lastUseMs = millis();
+  if (code < 0) {
+    failureCount++;
+    tcp.stop();
+  }
+}
+
+namespace {
+// writeToStream() target that fills a fixed buffer; reports every byte as
+// written so the client keeps draining after it is full
+class FixedSink : public Stream {
+public:
+  FixedSink(char* buf, size_t cap) : buf(buf), cap(cap) {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* data, size_t n) override {
+    size_t room = cap - len;
+    size_t take = n < room ? n : room;
+    memcpy(buf + len, data, take);
+    len += take;
+    if (take < n) overflow = true;
+    return n;
+  }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+
+  char* buf;
+  size_t cap;
+  size_t len = 0;
+  bool overflow = false;
+};
+}  // namespace
+
+int HttpSession::readBody(char* buf, size_t cap) {
+  if (cap == 0) return -1;
+  FixedSink sink(buf, cap - 1);
+  int written = client.writeToStream(&sink);
+  buf[sink.len] = '\0';
+  if (written < 0 || sink.overflow) return -1;
+  return sink.len;
+}
+
+bool HttpSession::check(const char* url) {
+  if (!begin(url)) return false;
+  int code = client.GET();
+  end(code);
+  return code == HTTP_CODE_OK;
+}
+
+void HttpSession::reset() {
+  client.end();
+  tcp.stop();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+
+// One statically allocated keep-alive HTTP connection. Requests to the same
+// host reuse the open socket; a transport error or a long idle gap drops it
+// so the next request reconnects cleanly instead of writing into a dead one.
+//
+//   if (session.begin(url)) {
+//     session.http().addHeader(...);
+//     int code = session.http().POST(buf, len);
+//     ...read the response...
+//     session.end(code);
+//   }
+class HttpSession {
+public:
+  bool begin(const char* url);
+  HTTPClient& http() { return client; }
+  // Always pair with begin(); code is the value the request returned
+  void end(int code);
+  // Copies the response body (chunked or not) into buf, NUL-terminated,
+  // without a heap String. Returns the length, or -1 on a transport error
+  // or if it did not fit (the rest is still drained so the socket stays
+  // reusable).
+  int readBody(char* buf, size_t cap);
+  // GET url and expect 200, e.g. the server's /health endpoint
+  bool check(const char* url);
+  void reset();
+
+  uint32_t requests() const { return requestCount; }
+  uint32_t reused() const { return reuseCount; }
+  uint32_t failures() const { return failureCount; }
+
+  uint16_t timeoutMs = 10000;
+  uint32_t maxIdleMs = 15000;  // stay below the server's keep-alive timeout
+
+private:
+  WiFiClient tcp;
+  HTTPClient client;
+  unsigned long lastUseMs = 0;
+  uint32_t requestCount = 0;
+  uint32_t reuseCount = 0;
+  uint32_t failureCount = 0;
+};
@@ -0,0 +1,91 @@
+#include "LcdRenderer.h"
+
+// PCF8574 backpack wiring used by LiquidCrystal_I2C: P0 RS, P1 RW, P2 EN,
+// P3 backlight, P4-P7 D4-D7
+static const uint8_t PIN_RS = 0x01;
+static const uint8_t PIN_EN = 0x04;
+static const uint8_t CMD_CLEAR = 0x01;
+static const uint8_t CMD_SET_DDRAM = 0x80;
+static const uint8_t ROW_OFFSET[] = { 0x00, 0x40 };
+// Unchanged cells shorter than this between two changes are resent rather
+// than paying for another cursor move
+static const uint8_t MERGE_GAP = 2;
+
+void LcdRenderer::begin() {
+  pushByte(CMD_CLEAR, false);
+  flushTx();
+  delay(2);  // clear is the one slow HD44780 instruction
+  memset(front, ' ', sizeof(front));
+  clear();
+}
+
+void LcdRenderer::clear() {
+  memset(back, ' ', sizeof(back));
+  col = row = 0;
+}
+
+void LcdRenderer::setCursor(uint8_t c, uint8_t r) {
+  col = c;
+  row = r < ROWS ? r : ROWS - 1;
+}
+
+size_t LcdRenderer::write(uint8_t c) {
+  if (col >= COLS) return 0;
+  back[row][col++] = c;
+  return 1;
+}
+
+uint8_t LcdRenderer::render() {
+  uint8_t sent = 0;
+  for (uint8_t r = 0; r < ROWS; r++) {
+    uint8_t c = 0;
+    while (c < COLS) {
+      if (front[r][c] == back[r][c]) {
+        c++;
+        continue;
+      }
+      // Extend the run over short unchanged gaps
+      uint8_t end = c + 1, last = c;
+      while (end < COLS && end - last <= MERGE_GAP) {
+        if (front[r][end] != back[r][end]) last = end;
+        end++;
+      }
+      pushByte(CMD_SET_DDRAM | (ROW_OFFSET[r] + c), false);
+      for (uint8_t i = c; i <= last; i++) {
+        pushByte(back[r][i], true);
+        front[r][i] = back[r][i];
+        sent++;
+      }
+      c = last + 1;
+    }
+  }
+  flushTx();
+  cellCount += sent;
+  return sent;
+}
+
+// Each nibble is three expander writes (set, EN high, EN low). Back to back
+// in one transaction, the ~25 us per byte at 400 kHz already covers the
+// controller's 37 us per-instruction execution time.
+void LcdRenderer::pushByte(uint8_t value, bool data) {
+  if (txLen + 6u > sizeof(tx)) flushTx();
+  uint8_t mode = data ? PIN_RS : 0;
+  pushNibble((value & 0xF0) | mode);
+  pushNibble(((value << 4) & 0xF0) | mode);
+}
+
+void LcdRenderer::pushNibble(uint8_t bits) {
+  bits |= backlightBit;
+  tx[txLen++] = bits;
+  tx[txLen++] = bits | PIN_EN;
+  tx[txLen++] = bits;
+}
+
+void LcdRenderer::flushTx() {
+  if (!txLen) return;
+  wire.beginTransmission(addr);
+  wire.write(tx, txLen);
+  wire.endTransmission();
+  txLen = 0;
+  txCount++;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+
+// Shadow-buffered renderer for a 16x2 HD44780 behind a PCF8574 I2C backpack.
+// Draw the whole screen every frame with setCursor()/print(); render() diffs
+// it against what the panel already shows and sends only the changed runs,
+// each as one I2C transaction instead of one per nibble. No clear() needed,
+// so there is no flicker.
+//
+//   lcd.init(); lcd.backlight();   // LiquidCrystal_I2C still does the init
+//   screen.begin();
+//   screen.setCursor(0, 0); screen.print("Cap:"); screen.print(n);
+//   screen.render();
+class LcdRenderer : public Print {
+public:
+  static const uint8_t COLS = 16;
+  static const uint8_t ROWS = 2;
+
+  explicit LcdRenderer(uint8_t addr, TwoWire& wire = Wire) : addr(addr), wire(wire) {}
+
+  // Clears the panel once and syncs the shadow buffer to it
+  void begin();
+  // Blanks the frame being drawn (not the panel)
+  void clear();
+  void setCursor(uint8_t col, uint8_t row);
+  size_t write(uint8_t c) override;  // clipped at the end of the line
+  using Print::write;
+  // Sends what changed since the last render(); returns cells written
+  uint8_t render();
+  void setBacklight(bool on) { backlightBit = on ? 0x08 : 0; }
+
+  uint32_t cellsSent() const { return cellCount; }
+  uint32_t transactions() const { return txCount; }
+
+private:
+  void pushByte(uint8_t value, bool data);
+  void pushNibble(uint8_t bits);
+  void flushTx();
+
+  uint8_t addr;
+  TwoWire& wire;
+  char front[ROWS][COLS];  // what the panel shows
+  char back[ROWS][COLS];   // frame being drawn
+  uint8_t col = 0, row = 0;
+  uint8_t backlightBit = 0x08;
+  uint8_t tx[96];          // under the 128-byte Wire buffer
+  uint8_t txLen = 0;
+  uint32_t cellCount = 0;
+  uint32_t txCount = 0;
+};
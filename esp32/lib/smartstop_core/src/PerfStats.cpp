@@ -0,0 +1,126 @@
+#include "PerfStats.h"
+#include "esp_heap_caps.h"
+
+#define PERF_RUNTIME_STATS (configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS)
+
+uint32_t PerfTimer::cyclesPerUs = 240;
+
+void PerfTimer::add(uint32_t us, uint64_t cycles) {
+  int k = us ? 32 - __builtin_clz(us) : 0;
+  if (k >= BUCKETS) k = BUCKETS - 1;
+  portENTER_CRITICAL_SAFE(&lock);
+  buckets[k]++;
+  count++;
+  totalCycles += cycles;
+  if (cycles > maxCycles) maxCycles = cycles;
+  portEXIT_CRITICAL_SAFE(&lock);
+}
+
+PerfTimer::Summary PerfTimer::take(bool reset) {
+  uint32_t b[BUCKETS];
+  uint64_t total, max;
+  Summary s;
+  portENTER_CRITICAL_SAFE(&lock);
+  memcpy(b, buckets, sizeof(b));
+  s.count = count;
+  max = maxCycles;
+  total = totalCycles;
+  if (reset) {
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    maxCycles = totalCycles = 0;
+  }
+  portEXIT_CRITICAL_SAFE(&lock);
+
+  // One rounded conversion per window instead of a truncation per sample
+  const uint64_t cpu = cyclesPerUs;
+  s.totalUs = (total + cpu / 2) / cpu;
+  s.maxUs = (max + cpu / 2) / cpu;
+  s.meanUs = s.count ? (total + s.count * cpu / 2) / (s.count * cpu) : 0;
+  uint32_t* const pct[3] = { &s.p50Us, &s.p90Us, &s.p99Us };
+  const uint32_t rank[3] = { 50, 90, 99 };
+  for (int p = 0; p < 3; p++) {
+    // Smallest bucket covering rank% of the samples
+    uint64_t need = ((uint64_t)s.count * rank[p] + 99) / 100, seen = 0;
+    uint32_t bound = 0;
+    for (int k = 0; k < BUCKETS && s.count; k++) {
+      seen += b[k];
+      if (seen >= need) {
+        bound = (k == BUCKETS - 1) ? s.maxUs : k ? (1u << k) - 1 : 0;
+        break;
+      }
+    }
+    *pct[p] = bound < s.maxUs ? bound : s.maxUs;
+  }
+  return s;
+}
+
+void PerfMonitor::begin() {
+  PerfTimer::cyclesPerUs = getCpuFrequencyMhz();
+  windowStartMs = millis();
+}
+
+bool PerfMonitor::add(PerfTimer& t) {
+  if (timerCount >= MAX_TIMERS) return false;
+  timers[timerCount++] = &t;
+  return true;
+}
+
+bool PerfMonitor::addTask(TaskHandle_t task) {
+  if (!task || taskCount >= MAX_TASKS) return false;
+  tasks[taskCount++] = task;
+  return true;
+}
+
+int PerfMonitor::writeJson(char* buf, size_t cap, const char* deviceId) {
+  unsigned long now = millis();
+  uint32_t windowMs = now - windowStartMs;
+  windowStartMs = now;
+
+  const uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+  int len = snprintf(buf, cap,
+                     "{\"deviceId\":\"%s\",\"uptime_s\":%lu,\"window_s\":%lu,\"heap_free\":%u,"
+                     "\"heap_min\":%u,\"heap_largest\":%u,\"timers\":{",
+                     deviceId, now / 1000, (unsigned long)(windowMs / 1000),
+                     (unsigned)heap_caps_get_free_size(caps), (unsigned)heap_caps_get_minimum_free_size(caps),
+                     (unsigned)heap_caps_get_largest_free_block(caps));
+
+  for (int i = 0; i < timerCount && len < (int)cap; i++) {
+    PerfTimer::Summary s = timers[i]->take();
+    uint32_t busyPermille = windowMs ? s.totalUs / windowMs : 0;  // us per ms
+    len += snprintf(buf + len, cap - len,
+                    "%s\"%s\":{\"n\":%lu,\"mean_us\":%lu,\"p50_us\":%lu,\"p90_us\":%lu,\"p99_us\":%lu,"
+                    "\"max_us\":%lu,\"busy_pct\":%lu.%lu}",
+                    i ? "," : "", timers[i]->name(), (unsigned long)s.count, (unsigned long)s.meanUs,
+                    (unsigned long)s.p50Us, (unsigned long)s.p90Us, (unsigned long)s.p99Us,
+                    (unsigned long)s.maxUs, (unsigned long)(busyPermille / 10), (unsigned long)(busyPermille % 10));
+  }
+  if (len < (int)cap) len += snprintf(buf + len, cap - len, "},\"tasks\":{");
+
+#if PERF_RUNTIME_STATS
+  static TaskStatus_t status[24];
+  uint32_t totalRunTime = 0;
+  UBaseType_t n = uxTaskGetSystemState(status, 24, &totalRunTime);
+  uint32_t totalDelta = totalRunTime - lastTotalRunTime;
+  lastTotalRunTime = totalRunTime;
+#endif
+
+  for (int i = 0; i < taskCount && len < (int)cap; i++) {
+    len += snprintf(buf + len, cap - len, "%s\"%s\":{\"stack_free\":%u",
+                    i ? "," : "", pcTaskGetName(tasks[i]), (unsigned)uxTaskGetStackHighWaterMark(tasks[i]));
+#if PERF_RUNTIME_STATS
+    for (UBaseType_t t = 0; t < n && len < (int)cap; t++) {
+      if (status[t].xHandle != tasks[i]) continue;
+      uint32_t delta = status[t].ulRunTimeCounter - lastRunTime[i];
+      lastRunTime[i] = status[t].ulRunTimeCounter;
+      uint32_t permille = totalDelta ? (uint64_t)delta * 1000 / totalDelta : 0;
+      len += snprintf(buf + len, cap - len, ",\"cpu_pct\":%lu.%lu",
+                      (unsigned long)(permille / 10), (unsigned long)(permille % 10));
+      break;
+    }
+#endif
+    if (len < (int)cap) len += snprintf(buf + len, cap - len, "}");
+  }
+  if (len < (int)cap) len += snprintf(buf + len, cap - len, "}}");
+  return len < (int)cap ? len : -1;
+}
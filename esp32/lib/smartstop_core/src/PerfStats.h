@@ -0,0 +1,87 @@
+#pragma once
+#include <Arduino.h>
+
+// Lightweight on-device timing. A PerfTimer keeps a log2 histogram of
+// durations in microseconds; PerfScope times a block with the CPU cycle
+// counter, which is per core, so only time code that cannot migrate
+// (pinned tasks). Spans that cross contexts, e.g. ISR to task, should
+// record esp_timer_get_time() deltas instead.
+//
+// PerfMonitor reports the registered timers plus heap and task stack/CPU
+// figures as one JSON document, and starts a new window each time.
+//
+//   PerfTimer voiceFrame("voice_frame");
+//   { PerfScope t(voiceFrame); ...one frame... }
+//
+//   perf.add(voiceFrame);
+//   perf.addTask(voiceTaskHandle);
+//   int len = perf.writeJson(buf, sizeof(buf), DEVICE_ID);
+class PerfTimer {
+public:
+  static constexpr int BUCKETS = 24;  // bucket k holds [2^(k-1), 2^k) us, the last (> 4 s) is open-ended
+
+  struct Summary {
+    uint32_t count;
+    uint32_t meanUs, maxUs;
+    uint32_t p50Us, p90Us, p99Us;  // bucket upper bounds, capped at maxUs
+    uint64_t totalUs;
+  };
+
+  explicit PerfTimer(const char* name) : label(name) {}
+
+  void record(uint32_t us) { add(us, (uint64_t)us * cyclesPerUs); }
+  // Sums stay in cycles so sub-microsecond remainders are not truncated
+  // away per sample; they are converted once in take()
+  void recordCycles(uint32_t cycles) { add(cycles / cyclesPerUs, cycles); }
+  // Summary of the current window; reset starts a new one
+  Summary take(bool reset = true);
+  const char* name() const { return label; }
+
+  static uint32_t cyclesPerUs;  // set by PerfMonitor::begin()
+
+private:
+  void add(uint32_t us, uint64_t cycles);
+
+  const char* label;
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+  uint32_t buckets[BUCKETS] = {};  // by whole us; exact, as bucket bounds are integers
+  uint32_t count = 0;
+  uint64_t maxCycles = 0, totalCycles = 0;
+};
+
+class PerfScope {
+public:
+  explicit PerfScope(PerfTimer& t) : timer(t), start(ESP.getCycleCount()) {}
+  ~PerfScope() { timer.recordCycles(ESP.getCycleCount() - start); }
+
+private:
+  PerfTimer& timer;
+  uint32_t start;
+};
+
+class PerfMonitor {
+public:
+  static constexpr int MAX_TIMERS = 8;
+  static constexpr int MAX_TASKS = 8;
+
+  void begin();
+  bool add(PerfTimer& t);
+  bool addTask(TaskHandle_t task);
+
+  // {"deviceId", "uptime_s", "window_s", heap figures,
+  //  "timers": {name: {n, mean_us, p50_us, p90_us, p99_us, max_us, busy_pct}},
+  //  "tasks": {name: {stack_free[, cpu_pct]}}}
+  // stack_free is the task's stack high-water mark in bytes; cpu_pct (share
+  // of one core) needs FreeRTOS run-time stats enabled in sdkconfig.
+  // Returns the length, or -1 if it does not fit.
+  int writeJson(char* buf, size_t cap, const char* deviceId);
+
+private:
+  PerfTimer* timers[MAX_TIMERS];
+  int timerCount = 0;
+  TaskHandle_t tasks[MAX_TASKS];
+  uint32_t lastRunTime[MAX_TASKS] = {};
+  int taskCount = 0;
+  uint32_t lastTotalRunTime = 0;
+  unsigned long windowStartMs = 0;
+};
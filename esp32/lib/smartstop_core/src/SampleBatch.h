@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+
+// Fixed ring of pending telemetry samples, oldest first. Samples are
+// flushed as one burst when the batch is due, so the radio can stay in
+// modem sleep in between; while offline the ring keeps the newest
+// Capacity samples. Each slot remembers when it was pushed, so the window
+// always runs from the oldest sample still held. Not thread safe, keep it
+// on one task.
+//
+//   if (batch.full()) batch.pop(1);   // or fold batch.at(0) into at(1) first
+//   Sample& s = batch.push();
+//   ...fill s...
+//   if (batch.due(MAX_SAMPLES, WINDOW_MS)) { ...publish batch.at(0..n-1)...; batch.pop(n); }
+template <class T, size_t Capacity>
+class SampleBatch {
+public:
+  size_t size() const { return len; }
+  bool empty() const { return len == 0; }
+  bool full() const { return len == Capacity; }
+  static constexpr size_t capacity() { return Capacity; }
+
+  // i = 0 is the oldest sample
+  T& at(size_t i) { return ring[(tail + i) % Capacity]; }
+  const T& at(size_t i) const { return ring[(tail + i) % Capacity]; }
+  T& front() { return ring[tail]; }
+
+  // Appends a slot for the caller to fill, dropping the oldest if full
+  T& push() {
+    if (len == Capacity) pop(1);
+    size_t i = (tail + len) % Capacity;
+    pushedMs[i] = millis();
+    len++;
+    return ring[i];
+  }
+
+  void pop(size_t n) {
+    if (n > len) n = len;
+    tail = (tail + n) % Capacity;
+    len -= n;
+    if (len == 0) flushNow = false;
+  }
+
+  // Publish now rather than waiting for the batch to fill
+  void requestFlush() { flushNow = true; }
+
+  bool due(size_t maxSamples, unsigned long windowMs) const {
+    if (len == 0) return false;
+    return flushNow || len >= maxSamples || millis() - pushedMs[tail] >= windowMs;
+  }
+
+private:
+  T ring[Capacity];
+  unsigned long pushedMs[Capacity];  // millis() at push, per slot
+  size_t tail = 0, len = 0;
+  bool flushNow = false;
+};
@@ -0,0 +1,40 @@
+#pragma once
+#include <stdint.h>
+#include <math.h>
+
+// Flattened gradient-boosted regression trees (XGBoost layout), evaluated
+// with no allocation in a few microseconds. All trees share one node array;
+// a node with left < 0 is a leaf whose value is its weight, otherwise the
+// walk goes left when x[feature] < value (or when it is NaN and defaultLeft
+// is set), matching XGBoost's split rule.
+//
+// Model headers are generated by server/flask/Deployment/export_model_header.py.
+struct TreeNode {
+  int16_t left, right;
+  uint8_t feature;
+  uint8_t defaultLeft;
+  float value;  // split threshold, or leaf weight
+};
+
+struct TreeEnsemble {
+  const TreeNode* nodes;
+  const uint16_t* roots;
+  uint16_t treeCount;
+  uint8_t featureCount;
+  float baseScore;
+
+  // x holds featureCount values in training column order
+  float predict(const float* x) const {
+    float sum = baseScore;
+    for (uint16_t t = 0; t < treeCount; t++) {
+      const TreeNode* n = &nodes[roots[t]];
+      while (n->left >= 0) {
+        float v = x[n->feature];
+        bool goLeft = isnan(v) ? n->defaultLeft : v < n->value;
+        n = &nodes[goLeft ? n->left : n->right];
+      }
+      sum += n->value;
+    }
+    return sum;
+  }
+};
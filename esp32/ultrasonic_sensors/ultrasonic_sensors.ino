@@ -1,11 +1,27 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include "ESP32MQTTClient.h"
+#include <ConnectionManager.h>
+#include <SampleBatch.h>
+#include <PerfStats.h>
+#include <Preferences.h>
+#include <sys/time.h>
+#include <atomic>
+#include "driver/gpio.h"
+#include "esp_timer.h"
 
 const char* ssid = ""; 
 const char* pass = ""; 
 const char* mqttServer = "mqtt://157.230.250.226:1883";
 const char* mqttTopic = "nus-smartstop/ultrasonic/data";
+// Batched samples ("ts" in unix ms) go to their own root so Telegraf can
+// parse them with json_time_key (see telegraf.conf)
+const char* mqttBatchTopic = "nus-smartstop-batch/ultrasonic";
+const char* deviceId = "esp32-ultrasonic-01";
+// Timing histograms, heap and stack high-water marks (PerfMonitor), outside
+// nus-smartstop/# so Telegraf keeps them out of the sensor measurement
+const char* mqttPerfTopicFmt = "nus-smartstop-diag/%s/perf";
+const unsigned long PERF_INTERVAL_MS = 30000;
 
 const int SENSOR_COUNT = 3;
 const int trigPins[SENSOR_COUNT] = {5, 22, 13};
@@ -13,42 +29,243 @@ const int echoPins[SENSOR_COUNT] = {18, 23, 14};
 const String SECTION_NAMES[SENSOR_COUNT] = {"LEFT", "CENTER", "RIGHT"};
 
 const float MIN_DISTANCE = 0.0; // cm
-const int READ_INTERVAL = 3000; 
+const int READ_INTERVAL = 3000; // report/sample period, ranging runs continuously
+
+// ====== RANGING ENGINE ======
+// Triggers are time-sliced: each slot fires the sensors in its mask, and
+// echoes are timed by GPIO edge interrupts. Sensors whose cones do not
+// overlap can share a slot to raise the sweep rate.
+const uint32_t RANGING_SLOT_US = 30000;   // ~5 m round trip, same as the old pulseIn timeout
+const uint8_t RANGING_SLOTS[] = {1 << 0, 1 << 1, 1 << 2};
+const int N_RANGING_SLOTS = sizeof(RANGING_SLOTS) / sizeof(RANGING_SLOTS[0]);
+const int SWEEP_QUEUE_LEN = 8;
+const int CALIBRATION_SWEEPS = 20;        // valid echoes to learn a baseline from scratch
+
+struct EchoChannel {
+  gpio_num_t pin;
+  // Low 32 bits of the rise time, 0 when no pulse is in flight. Shared with
+  // the esp_timer task on the other core, so it must be one atomic word: a
+  // 64-bit value could be read half-updated. Echoes last < 30 ms, so the
+  // 71 min wrap never matters.
+  std::atomic<uint32_t> riseUs{0};
+  std::atomic<uint32_t> widthUs{0};       // last completed pulse, 0 = none this slot
+};
+
+struct RangingSweep {
+  int64_t t_us;
+  float cm[SENSOR_COUNT];                 // 0 = no echo / out of range
+};
+
+EchoChannel echoCh[SENSOR_COUNT];
+QueueHandle_t sweepQueue;
+esp_timer_handle_t rangingTimer;
+int rangingSlot = -1;
+RangingSweep rangingPending;
+std::atomic<uint32_t> rangingTimeouts{0};
+std::atomic<uint32_t> rangingDropped{0};
+std::atomic<float> soundCmPerUs{0.034f};  // speed of sound, see updateSoundSpeed()
+
+// ====== FILTER ======
+// Per-sweep pipeline: median-of-K spike rejection -> O(1) running mean over
+// Window samples -> optional EMA. Echo misses (0) are skipped rather than
+// averaged in; only a run of MISS_LIMIT misses forces the output to 0.
+const int FILTER_WINDOW = 8;    // ~0.7 s of sweeps
+const int MEDIAN_K = 3;
+const float EMA_ALPHA = 0.0;    // 0 = EMA stage off
+const int MISS_LIMIT = 5;
+
+template <int N, int Window, int K = MEDIAN_K>
+class Filter {
+  static_assert(K >= 1 && K % 2 == 1, "median window must be odd");
+  static_assert(Window >= 1, "mean window must be non-empty");
+
+ public:
+  float emaAlpha = EMA_ALPHA;
+
+  void reset(float cm) {
+    for (int c = 0; c < N; c++) reset(c, cm);
+  }
+
+  // Prime one channel (e.g. with its calibrated baseline)
+  void reset(int c, float cm) {
+    Channel& ch = chans[c];
+    int32_t v = toFixed(cm);
+    for (int k = 0; k < K; k++) ch.recent[k] = v;
+    for (int w = 0; w < Window; w++) ch.window[w] = v;
+    ch.sum = v * Window;
+    ch.head = ch.recentHead = ch.misses = 0;
+    ch.out = cm;
+  }
+
+  float push(int c, float cm) {
+    Channel& ch = chans[c];
+    if (cm <= 0) {
+      if (++ch.misses >= MISS_LIMIT) ch.out = 0;
+      return ch.out;
+    }
+    ch.misses = 0;
+
+    ch.recent[ch.recentHead] = toFixed(cm);
+    ch.recentHead = (ch.recentHead + 1) % K;
+    int32_t med = median(ch.recent);
 
-// Moving average parameters
-const int MOVING_AVG_SIZE = 3;  // Number of samples in the moving average
-float sensorBuffer[SENSOR_COUNT][MOVING_AVG_SIZE]; 
-int bufferIndex[SENSOR_COUNT] = {0};
+    ch.sum += med - ch.window[ch.head];
+    ch.window[ch.head] = med;
+    ch.head = (ch.head + 1) % Window;
+    float mean = ch.sum / (100.0f * Window);
+
+    ch.out = (emaAlpha > 0 && ch.out > 0) ? ch.out + emaAlpha * (mean - ch.out) : mean;
+    return ch.out;
+  }
+
+  float value(int c) const { return chans[c].out; }
+
+ private:
+  // Fixed point (0.01 cm) keeps the running sum drift-free
+  struct Channel {
+    int32_t recent[K];
+    int32_t window[Window];
+    int32_t sum;
+    uint8_t head, recentHead, misses;
+    float out;
+  };
+  Channel chans[N];
+
+  static int32_t toFixed(float cm) { return (int32_t)lroundf(cm * 100.0f); }
+
+  static int32_t median(const int32_t (&v)[K]) {
+    int32_t tmp[K];
+    for (int i = 0; i < K; i++) {
+      int j = i;
+      for (; j > 0 && tmp[j - 1] > v[i]; j--) tmp[j] = tmp[j - 1];
+      tmp[j] = v[i];
+    }
+    return tmp[K / 2];
+  }
+};
+
+Filter<SENSOR_COUNT, FILTER_WINDOW> distanceFilter;
 
 float baseline[SENSOR_COUNT];       // baseline floor distances
 float triggerThreshold[SENSOR_COUNT]; // baseline - buffer
 const float BUFFER = 0.2;           // buffer in cm below baseline to prevent false positives
 
+// ====== BASELINE TRACKING ======
+// The floor distance is learned in the background, so drift never needs a
+// reboot. Updates use the median of the last few raw echoes and a gate that
+// is symmetric around the baseline, independent of the occupancy decision:
+// with a 0.2 cm trigger buffer, gating on "empty" would learn only upward
+// drift and ratchet the floor away. Learning freezes only once something has
+// sat clearly above the floor for a while (a bag, a person standing still).
+// It is persisted to NVS so a restart is valid from the first sweep.
+const float BASELINE_ALPHA = 0.002;          // per sweep, ~45 s time constant
+const float BASELINE_GATE = 15.0;            // cm either way, larger deviations are not learned
+const int BASELINE_MEDIAN_N = 9;             // raw echoes per median, ~0.8 s
+const float BASELINE_FREEZE_DELTA = 5.0;     // cm above the floor that counts as an object
+const int BASELINE_FREEZE_SWEEPS = 22;       // ~2 s of that before learning stops
+const float BASELINE_SAVE_DELTA = 1.0;       // cm moved before it is worth a flash write
+const unsigned long BASELINE_SAVE_MS = 600000; // at most one NVS write per 10 min
+const char* NVS_NAMESPACE = "ultrasonic";
+
+Preferences prefs;
+bool baselineReady[SENSOR_COUNT] = {false};
+float learnSum[SENSOR_COUNT] = {0};
+int learnCount[SENSOR_COUNT] = {0};
+float savedBaseline[SENSOR_COUNT] = {0};
+float recentRaw[SENSOR_COUNT][BASELINE_MEDIAN_N];
+uint8_t recentRawCount[SENSOR_COUNT] = {0};
+uint8_t recentRawHead[SENSOR_COUNT] = {0};
+int objectSweeps[SENSOR_COUNT] = {0};  // consecutive sweeps with the median > FREEZE_DELTA above the floor
+unsigned long lastBaselineSaveMs = 0;
+
+// Temperature compensation hook: point this at a sensor read returning
+// degrees C (NAN if unavailable). Left unset, 0.034 cm/us is used and the
+// tracker absorbs the drift instead.
+float (*ambientTempC)() = nullptr;
+
 float sensorDistances[SENSOR_COUNT];
 bool sensorStates[SENSOR_COUNT];
 float density = 0.0;
 
-ESP32MQTTClient mqttClient;
+// Readings are buffered and published in bursts so the radio can stay in
+// modem sleep in between. BATCH_MAX_SAMPLES = 1 publishes every reading.
+#ifndef BATCH_MAX_SAMPLES
+#define BATCH_MAX_SAMPLES 5
+#endif
+const unsigned long BATCH_WINDOW_MS = 15000; // max age of the oldest buffered sample
+const int BATCH_RING_SIZE = 20;              // samples kept while offline
+
+struct UltrasonicSample {
+  uint64_t ts;    // unix ms, 0 until NTP has synced
+  float distance[SENSOR_COUNT];
+  bool occupied[SENSOR_COUNT];
+  uint32_t dwellMs[SENSOR_COUNT];     // continuous occupied time, 0 when empty
+  uint16_t transitions[SENSOR_COUNT]; // state flips since the previous sample
+  float duty[SENSOR_COUNT];           // fraction of sweeps occupied since the previous sample
+  float density;
+};
+
+// Upper bound for one writeSample() object, scales with SENSOR_COUNT
+const size_t SAMPLE_JSON_MAX = 64 + SENSOR_COUNT * 128;
+const size_t PAYLOAD_BUF_SIZE = BATCH_MAX_SAMPLES * (SAMPLE_JSON_MAX + 1) + 2;
+
+SampleBatch<UltrasonicSample, BATCH_RING_SIZE> batch;
+uint32_t oversizeDropped = 0;         // samples too large for one payload, never sent
+
+// ====== ZONE TRACKER ======
+// Runs at the sweep rate so dwell and transitions are resolved far finer
+// than the READ_INTERVAL sample period.
+struct ZoneTracker {
+  bool occupied;
+  int64_t sinceUs;          // time of the last state flip
+  uint16_t transitions;     // flips since the last sample
+  uint16_t sweeps, occupiedSweeps;
+};
+
+ZoneTracker zones[SENSOR_COUNT];
 
-float readSensor(int index);
-void readAllSensors();
+ESP32MQTTClient mqttClient;
+char mqttPerfTopic[64];
+
+PerfMonitor perf;
+PerfTimer sweepTime("sweep");        // readAllSensors() work per sweep
+PerfTimer sweepLatency("sweep_age"); // slot timer to loop() pickup
+PerfTimer publishTime("publish");
+// WiFi reconnects with backoff; esp-mqtt reconnects the broker on its own.
+// Samples taken while offline stay in the batch ring and are replayed.
+ConnectionManager net;
+bool mqttLinkUp() { return mqttClient.isConnected(); }
+
+void startRanging();
+int readAllSensors(TickType_t wait);
+void printReadings();
 void publishData();
+void sampleData();
+uint64_t wallClockMs();
+int writeSample(char* buf, size_t cap, const UltrasonicSample& smp, bool withTs);
 int occupiedVal(bool state);
+void trackZone(int i, bool occupied, int64_t t_us);
 void calculateDensity();
 void calibrateSensors();
-float movingAverage(int sensorIndex, float newReading);
+bool loadBaseline();
+void saveBaseline(bool force);
+void updateBaseline(int i, float raw);
+void updateSoundSpeed();
 
 void setup() {
   Serial.begin(115200);
-  WiFi.begin(ssid, pass);
+  net.begin(ssid, pass, mqttLinkUp);
+  net.poll();
+  WiFi.setSleep(true); // modem sleep between bursts
+  configTime(0, 0, "pool.ntp.org");
   delay(500);
 
   for (int i = 0; i < SENSOR_COUNT; i++) {
     pinMode(trigPins[i], OUTPUT);
-    pinMode(echoPins[i], INPUT);
     digitalWrite(trigPins[i], LOW);
-    for (int j = 0; j < MOVING_AVG_SIZE; j++) sensorBuffer[i][j] = 0;
   }
+  distanceFilter.reset(0);
+  startRanging();
 
   // Setup MQTT
   mqttClient.enableDebuggingMessages();
@@ -58,111 +275,265 @@ void setup() {
   mqttClient.loopStart();
   delay(2000);
 
-  calibrateSensors(); // calibrate baseline and set thresholds
+  snprintf(mqttPerfTopic, sizeof(mqttPerfTopic), mqttPerfTopicFmt, deviceId);
+  perf.begin();
+  perf.add(sweepTime);
+  perf.add(sweepLatency);
+  perf.add(publishTime);
+  perf.addTask(xTaskGetCurrentTaskHandle()); // loopTask
+
+  updateSoundSpeed();
+  if (!loadBaseline()) calibrateSensors(); // learn in the background
+}
+
+void publishPerf() {
+  static char payload[512];
+  if (perf.writeJson(payload, sizeof(payload), deviceId) < 0) {
+    Serial.println("Perf report truncated, skipping publish");
+    return;
+  }
+  mqttClient.publish(mqttPerfTopic, payload, 0, false);
 }
 
 void loop() {
-  readAllSensors();
-  calculateDensity();
-  publishData();
-  delay(READ_INTERVAL);
+  static unsigned long lastReportMs = 0, lastPerfMs = 0;
+
+  // Blocks until the next sweep lands (~90 ms) instead of busy-waiting
+  readAllSensors(pdMS_TO_TICKS(200));
+
+  net.poll();
+  if (net.takeOnlineEdge()) batch.requestFlush(); // replay what was buffered
+  if (Serial.available() && Serial.read() == 'c') calibrateSensors(); // node moved: relearn
+
+  if (millis() - lastReportMs >= (unsigned long)READ_INTERVAL) {
+    lastReportMs = millis();
+    updateSoundSpeed();
+    saveBaseline(false);
+    printReadings();
+    calculateDensity();
+    sampleData();
+  }
+  if (batch.due(BATCH_MAX_SAMPLES, BATCH_WINDOW_MS)) {
+    PerfScope t(publishTime);
+    publishData();
+  }
+  if (millis() - lastPerfMs >= PERF_INTERVAL_MS && mqttClient.isConnected()) {
+    lastPerfMs = millis();
+    publishPerf();
+  }
 }
 
-void calibrateSensors() {
-  Serial.println("\nCALIBRATION MODE");
-  delay(4000); 
+// ------------- ranging -------------
+static void IRAM_ATTR isr_echo(void* arg) {
+  EchoChannel* ch = (EchoChannel*)arg;
+  uint32_t now = (uint32_t)esp_timer_get_time();
+  if (gpio_get_level(ch->pin)) {
+    ch->riseUs.store(now | 1, std::memory_order_relaxed);  // never the 0 sentinel
+  } else if (uint32_t rise = ch->riseUs.exchange(0, std::memory_order_relaxed)) {
+    ch->widthUs.store(now - rise, std::memory_order_relaxed);
+  }
+}
 
-  for (int i = 0; i < SENSOR_COUNT; i++) {
-    float total = 0;
-    const int samples = 5;
-    Serial.print("Calibrating ");
-    Serial.println(SECTION_NAMES[i]);
-
-    for (int j = 0; j < samples; j++) {
-      float d = readSensor(i);
-      total += d;
-      delay(400);
+// Runs every RANGING_SLOT_US: closes out the previous slot, then fires the next
+static void onRangingSlot(void*) {
+  if (rangingSlot >= 0) {
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+      if (!(RANGING_SLOTS[rangingSlot] & (1 << i))) continue;
+      uint32_t w = echoCh[i].widthUs.exchange(0, std::memory_order_relaxed);
+      if (echoCh[i].riseUs.exchange(0, std::memory_order_relaxed))
+        rangingTimeouts.fetch_add(1, std::memory_order_relaxed); // still high
+      rangingPending.cm[i] = w ? w * soundCmPerUs.load(std::memory_order_relaxed) / 2.0f : 0;
     }
-    baseline[i] = total / samples;
-    triggerThreshold[i] = baseline[i] - BUFFER;
-
-    for (int k = 0; k < MOVING_AVG_SIZE; k++) sensorBuffer[i][k] = baseline[i];
+  }
 
-    Serial.print("Baseline for ");
-    Serial.print(SECTION_NAMES[i]);
-    Serial.print(": ");
-    Serial.print(baseline[i]);
-    Serial.print(" cm, Trigger threshold: ");
-    Serial.println(triggerThreshold[i]);
+  rangingSlot = (rangingSlot + 1) % N_RANGING_SLOTS;
+  if (rangingSlot == 0) {
+    rangingPending.t_us = esp_timer_get_time();
+    if (xQueueSend(sweepQueue, &rangingPending, 0) != pdTRUE) {
+      rangingDropped.fetch_add(1, std::memory_order_relaxed);
+    }
   }
-  Serial.println("Calibration complete!");
+
+  uint8_t mask = RANGING_SLOTS[rangingSlot];
+  for (int i = 0; i < SENSOR_COUNT; i++) if (mask & (1 << i)) gpio_set_level((gpio_num_t)trigPins[i], 1);
+  delayMicroseconds(10);
+  for (int i = 0; i < SENSOR_COUNT; i++) if (mask & (1 << i)) gpio_set_level((gpio_num_t)trigPins[i], 0);
 }
 
-void readAllSensors() {
-  Serial.println("\nReading sensors");
+void startRanging() {
+  sweepQueue = xQueueCreate(SWEEP_QUEUE_LEN, sizeof(RangingSweep));
 
-  for (int i = 0; i < SENSOR_COUNT; i++) {
+  gpio_config_t cfg = {};
+  cfg.mode = GPIO_MODE_INPUT;
+  cfg.pull_up_en = GPIO_PULLUP_DISABLE;
+  cfg.pull_down_en = GPIO_PULLDOWN_DISABLE;
+  cfg.intr_type = GPIO_INTR_ANYEDGE;
+  for (int i = 0; i < SENSOR_COUNT; i++) cfg.pin_bit_mask |= (1ULL << echoPins[i]);
+  gpio_config(&cfg);
 
-    delay(80);
+  gpio_install_isr_service(0);
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    echoCh[i].pin = (gpio_num_t)echoPins[i];
+    gpio_isr_handler_add(echoCh[i].pin, isr_echo, &echoCh[i]);
+  }
 
-    float rawReading = readSensor(i);
-    sensorDistances[i] = movingAverage(i, rawReading);
-    sensorStates[i] = (sensorDistances[i] > 0 && sensorDistances[i] <= triggerThreshold[i]);
+  esp_timer_create_args_t args = {};
+  args.callback = onRangingSlot;
+  args.name = "ranging";
+  esp_timer_create(&args, &rangingTimer);
+  esp_timer_start_periodic(rangingTimer, RANGING_SLOT_US);
+  Serial.printf("Ranging: %d slots x %u us -> %.1f Hz per sensor\n", N_RANGING_SLOTS,
+                (unsigned)RANGING_SLOT_US, 1e6f / (N_RANGING_SLOTS * RANGING_SLOT_US));
+}
 
-    delay(60);
+// Forget the baseline and relearn it from the next CALIBRATION_SWEEPS echoes.
+// Non-blocking: zones read EMPTY until their baseline is ready.
+void calibrateSensors() {
+  Serial.printf("\nCALIBRATION MODE: learning %d sensors over %d echoes\n", SENSOR_COUNT, CALIBRATION_SWEEPS);
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    baselineReady[i] = false;
+    learnSum[i] = 0;
+    learnCount[i] = 0;
+    baseline[i] = 0;
+    triggerThreshold[i] = 0;
+    recentRawCount[i] = recentRawHead[i] = 0;
+    objectSweeps[i] = 0;
   }
+}
+
+bool loadBaseline() {
+  prefs.begin(NVS_NAMESPACE, true);
+  bool ok = prefs.getBytesLength("baseline") == sizeof(baseline) &&
+            prefs.getBytes("baseline", baseline, sizeof(baseline)) == sizeof(baseline);
+  prefs.end();
+  if (!ok) return false;
 
-  Serial.println("\nSensor Readings");
   for (int i = 0; i < SENSOR_COUNT; i++) {
-    Serial.print(SECTION_NAMES[i]);
-    Serial.print(": ");
-    Serial.print(sensorDistances[i]);
-    Serial.print(" cm -> ");
-    Serial.println(sensorStates[i] ? "OCCUPIED" : "EMPTY");
+    baselineReady[i] = baseline[i] > 0;
+    savedBaseline[i] = baseline[i];
+    triggerThreshold[i] = baseline[i] - BUFFER;
+    distanceFilter.reset(i, baseline[i]);
+    Serial.printf("Baseline for %s: %.2f cm (from NVS)\n", SECTION_NAMES[i].c_str(), baseline[i]);
   }
+  lastBaselineSaveMs = millis();
+  return true;
 }
 
+void saveBaseline(bool force) {
+  if (!force && millis() - lastBaselineSaveMs < BASELINE_SAVE_MS) return;
 
-float movingAverage(int sensorIndex, float newReading) {
-  sensorBuffer[sensorIndex][bufferIndex[sensorIndex]] = newReading;
-  bufferIndex[sensorIndex] = (bufferIndex[sensorIndex] + 1) % MOVING_AVG_SIZE;
+  bool moved = force;
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    if (!baselineReady[i]) return; // only persist a complete set
+    if (fabsf(baseline[i] - savedBaseline[i]) >= BASELINE_SAVE_DELTA) moved = true;
+  }
+  if (!moved) return;
+
+  prefs.begin(NVS_NAMESPACE, false);
+  prefs.putBytes("baseline", baseline, sizeof(baseline));
+  prefs.end();
+  for (int i = 0; i < SENSOR_COUNT; i++) savedBaseline[i] = baseline[i];
+  lastBaselineSaveMs = millis();
+  Serial.println("Baseline saved to NVS");
+}
 
-  float sum = 0;
-  for (int i = 0; i < MOVING_AVG_SIZE; i++) sum += sensorBuffer[sensorIndex][i];
-  return sum / MOVING_AVG_SIZE;
+// Median of the last BASELINE_MEDIAN_N raw echoes of zone i (fewer after a reset)
+float recentRawMedian(int i) {
+  float tmp[BASELINE_MEDIAN_N];
+  int n = recentRawCount[i];
+  for (int k = 0; k < n; k++) {
+    float v = recentRaw[i][k];
+    int j = k;
+    for (; j > 0 && tmp[j - 1] > v; j--) tmp[j] = tmp[j - 1];
+    tmp[j] = v;
+  }
+  return tmp[n / 2];
 }
 
-float readSensor(int i) {
-  const int samples = 3;
-  float total = 0;
-  int validCount = 0;
+// raw: unfiltered echo distance (0 = miss)
+void updateBaseline(int i, float raw) {
+  if (raw <= 0) return;
+
+  recentRaw[i][recentRawHead[i]] = raw;
+  recentRawHead[i] = (recentRawHead[i] + 1) % BASELINE_MEDIAN_N;
+  if (recentRawCount[i] < BASELINE_MEDIAN_N) recentRawCount[i]++;
+
+  if (!baselineReady[i]) {
+    learnSum[i] += raw;
+    if (++learnCount[i] < CALIBRATION_SWEEPS) return;
+    baseline[i] = learnSum[i] / learnCount[i];
+    baselineReady[i] = true;
+    distanceFilter.reset(i, baseline[i]);
+    Serial.printf("Baseline for %s: %.2f cm, Trigger threshold: %.2f\n",
+                  SECTION_NAMES[i].c_str(), baseline[i], baseline[i] - BUFFER);
+    saveBaseline(true);
+  } else {
+    float med = recentRawMedian(i);
+    if (med >= baseline[i] - BASELINE_FREEZE_DELTA) objectSweeps[i] = 0;
+    else if (objectSweeps[i] < BASELINE_FREEZE_SWEEPS) objectSweeps[i]++;
+    if (objectSweeps[i] < BASELINE_FREEZE_SWEEPS && fabsf(med - baseline[i]) <= BASELINE_GATE) {
+      baseline[i] += BASELINE_ALPHA * (med - baseline[i]);
+    }
+  }
+  triggerThreshold[i] = baseline[i] - BUFFER;
+}
 
-  for (int s = 0; s < samples; s++) {
-    delay(5);
-    digitalWrite(trigPins[i], LOW);
-    delayMicroseconds(3);
-    digitalWrite(trigPins[i], HIGH);
-    delayMicroseconds(10);
-    digitalWrite(trigPins[i], LOW);
-    long duration = pulseIn(echoPins[i], HIGH, 30000);
+// c = 331.3 + 0.606 * T m/s
+void updateSoundSpeed() {
+  if (!ambientTempC) return;
+  float t = ambientTempC();
+  if (isnan(t)) return;
+  soundCmPerUs.store((331.3f + 0.606f * t) / 10000.0f, std::memory_order_relaxed);
+}
 
-    if (duration > 0) {
-      float distance = duration * 0.034 / 2.0;
-      total += distance;
-      validCount++;
+// Applies every queued sweep; waits up to `wait` for the first one.
+// Returns the number of sweeps consumed.
+int readAllSensors(TickType_t wait) {
+  RangingSweep sweep;
+  int n = 0;
+  while (xQueueReceive(sweepQueue, &sweep, n ? 0 : wait) == pdTRUE) {
+    sweepLatency.record((uint32_t)(esp_timer_get_time() - sweep.t_us));
+    PerfScope t(sweepTime);
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+      sensorDistances[i] = distanceFilter.push(i, sweep.cm[i]);
+      sensorStates[i] = baselineReady[i] && sensorDistances[i] > 0 && sensorDistances[i] <= triggerThreshold[i];
+      updateBaseline(i, sweep.cm[i]);
+      trackZone(i, sensorStates[i], sweep.t_us);
     }
-
-    delay(40);  
+    n++;
   }
+  return n;
+}
 
-  if (validCount == 0) return 0;
-  return total / validCount;
+void printReadings() {
+  Serial.printf("\nSensor Readings (timeouts %u, dropped sweeps %u, oversized samples %u)\n",
+                (unsigned)rangingTimeouts.load(), (unsigned)rangingDropped.load(),
+                (unsigned)oversizeDropped);
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    Serial.print(SECTION_NAMES[i]);
+    Serial.print(": ");
+    Serial.print(sensorDistances[i]);
+    Serial.print(" cm -> ");
+    Serial.println(sensorStates[i] ? "OCCUPIED" : "EMPTY");
+  }
 }
 
+
 int occupiedVal(bool state) {
   return state ? 1 : 0;
 }
 
+void trackZone(int i, bool occupied, int64_t t_us) {
+  ZoneTracker& z = zones[i];
+  z.sweeps++;
+  if (occupied) z.occupiedSweeps++;
+  if (occupied != z.occupied) {
+    z.occupied = occupied;
+    z.sinceUs = t_us;
+    z.transitions++;
+  }
+}
+
 void calculateDensity() {
   int triggeredCount = 0;
   for (int i = 0; i < SENSOR_COUNT; i++) {
@@ -173,28 +544,95 @@ void calculateDensity() {
   Serial.println(density);
 }
 
+uint64_t wallClockMs() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  if (tv.tv_sec < 1600000000) return 0; // not synced yet
+  return (uint64_t)tv.tv_sec * 1000ULL + tv.tv_usec / 1000;
+}
+
+void sampleData() {
+  // Ring full (broker down): push() drops the oldest sample
+  UltrasonicSample& smp = batch.push();
+  smp.ts = wallClockMs();
+  smp.density = density;
+  int64_t now = esp_timer_get_time();
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    ZoneTracker& z = zones[i];
+    smp.distance[i] = sensorDistances[i];
+    smp.occupied[i] = z.occupied;
+    smp.dwellMs[i] = z.occupied ? (uint32_t)((now - z.sinceUs) / 1000) : 0;
+    smp.transitions[i] = z.transitions;
+    smp.duty[i] = z.sweeps ? z.occupiedSweeps / (float)z.sweeps : (z.occupied ? 1.0f : 0.0f);
+    // Significant change: a zone flipped between empty and occupied
+    if (z.transitions) batch.requestFlush();
+    z.transitions = z.sweeps = z.occupiedSweeps = 0;
+  }
+}
+
+// {"sensors": {"<NAME>": {"distance": .., "occupied": .., "dwell_s": .., "transitions": .., "duty": ..}, ...},
+//  "density": ..[, "ts": ..]}
+// Returns length, or -1 if it does not fit.
+int writeSample(char* buf, size_t cap, const UltrasonicSample& smp, bool withTs) {
+  int len = snprintf(buf, cap, "{\"sensors\": {");
+  for (int i = 0; i < SENSOR_COUNT && len < (int)cap; i++) {
+    len += snprintf(buf + len, cap - len,
+                    "%s\"%s\": {\"distance\": %.2f, \"occupied\": %d, \"dwell_s\": %.1f, \"transitions\": %u, \"duty\": %.2f}",
+                    i ? ", " : "", SECTION_NAMES[i].c_str(), smp.distance[i], occupiedVal(smp.occupied[i]),
+                    smp.dwellMs[i] / 1000.0f, (unsigned)smp.transitions[i], smp.duty[i]);
+  }
+  if (len < (int)cap) len += snprintf(buf + len, cap - len, "}, \"density\": %.2f", smp.density);
+  if (withTs && len < (int)cap) len += snprintf(buf + len, cap - len, ", \"ts\": %llu", (unsigned long long)smp.ts);
+  if (len >= (int)cap - 1) return -1;
+  buf[len++] = '}'; buf[len] = '\0';
+  return len;
+}
+
 void publishData() {
   if (!mqttClient.isConnected()) {
-    Serial.println("MQTT not connected. Skipping publish");
+    Serial.println("MQTT not connected. Keeping samples buffered");
     return;
   }
 
-  char payload[400];
-  snprintf(payload, sizeof(payload),
-           "{\"sensors\": {"
-           "\"LEFT\": {\"distance\": %.2f, \"occupied\": %d}, "
-           "\"CENTER\": {\"distance\": %.2f, \"occupied\": %d}, "
-           "\"RIGHT\": {\"distance\": %.2f, \"occupied\": %d}}, "
-           "\"density\": %.2f}",
-           sensorDistances[0], occupiedVal(sensorStates[0]),
-           sensorDistances[1], occupiedVal(sensorStates[1]),
-           sensorDistances[2], occupiedVal(sensorStates[2]),
-           density
-  );
-
-  Serial.println("\nPublishing to MQTT:");
-  Serial.println(payload);
-  mqttClient.publish(mqttTopic, payload, 0, false);
+  static char payload[PAYLOAD_BUF_SIZE];
+  while (!batch.empty()) {
+    const UltrasonicSample& front = batch.front();
+    int n = 0, len = 0;
+
+    if (BATCH_MAX_SAMPLES == 1 || front.ts == 0) {
+      // Single reading on the legacy topic (also used before NTP sync)
+      if (writeSample(payload, sizeof(payload), front, false) < 0) {
+        // Would never fit; drop it rather than stall the queue behind it
+        oversizeDropped++;
+        batch.pop(1);
+        continue;
+      }
+      if (!mqttClient.publish(mqttTopic, payload, 0, false)) return;
+      n = 1;
+    } else {
+      payload[len++] = '[';
+      while (n < (int)batch.size()) {
+        const UltrasonicSample& smp = batch.at(n);
+        if (smp.ts == 0) break;
+        if (n) payload[len++] = ',';
+        int w = writeSample(payload + len, sizeof(payload) - len - 2, smp, true);
+        if (w < 0) { if (n) len--; break; }
+        len += w;
+        n++;
+      }
+      if (n == 0) {
+        oversizeDropped++;
+        batch.pop(1);
+        continue;
+      }
+      payload[len++] = ']'; payload[len] = '\0';
+      if (!mqttClient.publish(mqttBatchTopic, payload, 0, false)) return;
+    }
+
+    Serial.println("\nPublished to MQTT:");
+    Serial.println(payload);
+    batch.pop(n);
+  }
 }
 
 void onMqttConnect(esp_mqtt_client* client) {
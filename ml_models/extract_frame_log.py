@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Extracts JPEG frames from a FrameRingLog file
+=============================================
+
+The dataset sketch (esp32/Capture Image to SD Card) stores frames in
+/dataset.log and the camera uploader keeps its backlog in /frames.log, both
+in the FrameRingLog slot format (esp32/lib/smartstop_core/src/FrameRingLog.h).
+This writes every pending frame as image<seq>.jpg, oldest first, with the
+file time set to the capture time when the device clock was synced.
+
+    python3 extract_frame_log.py /media/sdcard/dataset.log dataset_images
+"""
+
+import os
+import sys
+import struct
+import zlib
+import argparse
+
+SECTOR = 512
+INDEX_MAGIC = 0x534D5249  # "SMRI"
+SLOT_MAGIC = 0x534D5346   # "SMSF"
+
+# Both little-endian, crc over every byte before it (esp_rom_crc32_le(0, ...)
+# is the standard zlib CRC-32)
+INDEX = struct.Struct('<IIIIIIII')  # magic, slotSize, slotCount, head, tail, generation, dropped, crc
+SLOT = struct.Struct('<IIIIqII')    # magic, seq, len, meta, capturedAt, dataCrc, crc
+
+
+def load_index(f):
+    """
+    Reads both index copies and returns the newest valid one.
+
+    Returns:
+        dict with slot_size, slot_count, head, tail and dropped
+
+    Raises:
+        ValueError if neither copy is valid
+    """
+    best = None
+    for i in range(2):
+        f.seek(i * SECTOR)
+        raw = f.read(INDEX.size)
+        if len(raw) < INDEX.size:
+            continue
+        magic, slot_size, slot_count, head, tail, generation, dropped, crc = INDEX.unpack(raw)
+        if magic != INDEX_MAGIC or crc != zlib.crc32(raw[:-4]):
+            continue
+        if best is None or generation > best['generation']:
+            best = {'slot_size': slot_size, 'slot_count': slot_count, 'head': head,
+                    'tail': tail, 'generation': generation, 'dropped': dropped}
+    if best is None:
+        raise ValueError("no valid index; not a FrameRingLog file?")
+    return best
+
+
+def read_frame(f, idx, seq):
+    """
+    Returns (meta, captured_at, jpeg) for one slot, or None if it is corrupt
+    or holds a different sequence number
+    """
+    off = 2 * SECTOR + (seq % idx['slot_count']) * idx['slot_size']
+    f.seek(off)
+    raw = f.read(SLOT.size)
+    if len(raw) < SLOT.size:
+        return None
+    magic, hdr_seq, length, meta, captured_at, data_crc, crc = SLOT.unpack(raw)
+    if magic != SLOT_MAGIC or crc != zlib.crc32(raw[:-4]) or hdr_seq != seq:
+        return None
+    if length > idx['slot_size'] - SECTOR:
+        return None
+    f.seek(off + SECTOR)
+    data = f.read(length)
+    if len(data) != length or zlib.crc32(data) != data_crc:
+        return None
+    return meta, captured_at, data
+
+
+def extract(log_path, out_dir):
+    """Writes every pending frame to out_dir; returns (written, skipped)"""
+    os.makedirs(out_dir, exist_ok=True)
+    written = skipped = 0
+    with open(log_path, 'rb') as f:
+        idx = load_index(f)
+        pending = (idx['head'] - idx['tail']) & 0xFFFFFFFF
+        print(f"{log_path}: {idx['slot_count']} slots of {idx['slot_size']} B, "
+              f"{pending} pending, {idx['dropped']} overwritten on the device")
+        for i in range(pending):
+            seq = (idx['tail'] + i) & 0xFFFFFFFF
+            frame = read_frame(f, idx, seq)
+            if frame is None:
+                print(f"[WARN] slot for seq {seq} is corrupt, skipped")
+                skipped += 1
+                continue
+            _, captured_at, data = frame
+            path = os.path.join(out_dir, f"image{seq}.jpg")
+            with open(path, 'wb') as out:
+                out.write(data)
+            if captured_at > 0:
+                os.utime(path, (captured_at, captured_at))
+            written += 1
+    return written, skipped
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Extract JPEG frames from a FrameRingLog file')
+    parser.add_argument('log', help='dataset.log or frames.log copied from the SD card')
+    parser.add_argument('output', help='directory for the image<seq>.jpg files')
+    args = parser.parse_args()
+
+    try:
+        written, skipped = extract(args.log, args.output)
+    except (OSError, ValueError) as e:
+        print(f"[ERROR] {e}")
+        sys.exit(1)
+    print(f"[OK] {written} frames written to {args.output}, {skipped} skipped")
+
+
+if __name__ == '__main__':
+    main()
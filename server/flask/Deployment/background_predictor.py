@@ -1,21 +1,41 @@
 #!/usr/bin/env python3
 """
 Background prediction service - runs every 30 seconds
-Updates cached prediction file for instant ESP32 responses
+Updates cached prediction file for instant ESP32 responses, and publishes
+each prediction as a retained MQTT message so the actuator reacts at once
 Run this with: nohup python3 background_predictor.py &
 """
 
+import os
 import subprocess
 import sys
 import json
 import time
 from datetime import datetime
+import paho.mqtt.client as mqtt
 
 CACHE_FILE = '/root/cs3237_server/prediction_cache.json' # Path to cache file
 INFERENCE_SCRIPT = '/root/cs3237_server/Deployment/run_inference.py' # Path to inference script
 PYTHON_PATH = '/root/venv/bin/python' # Path to Python interpreter
 UPDATE_INTERVAL = 30  # Seconds between predictions
 
+MQTT_BROKER = os.getenv('MQTT_BROKER', 'localhost')
+MQTT_PORT = int(os.getenv('MQTT_PORT', 1883))
+# Retained, one message per cycle. Outside nus-smartstop/# so Telegraf does not
+# store predictions in the measurement inference reads its features from.
+PREDICTION_TOPIC = 'nus-smartstop-pred/capacity'
+
+def connect_mqtt():
+    """Connects to the broker; paho keeps reconnecting in the background"""
+    client = mqtt.Client(client_id='smartstop_background_predictor')
+    try:
+        client.connect_async(MQTT_BROKER, MQTT_PORT, 60)
+        client.loop_start()
+        print(f"MQTT broker: {MQTT_BROKER}:{MQTT_PORT}, topic: {PREDICTION_TOPIC}")
+    except Exception as e:
+        print(f"[ERROR] MQTT setup failed: {e}")
+    return client
+
 def run_prediction():
     """Runs inference and returns capacity"""
     try:
@@ -46,26 +66,46 @@ def run_prediction():
         print(f"[ERROR] Prediction failed: {e}")
         return -1
 
-def update_cache(capacity):
+def make_prediction(capacity):
+    """Prediction document shared by the cache file and the MQTT topic"""
+    return {
+        "success": capacity >= 0,
+        "capacity": round(capacity, 2),
+        "timestamp": datetime.now().isoformat(),
+        "ts": int(time.time()),  # unix seconds, lets subscribers reject stale retained replays
+        "message": "Prediction successful" if capacity >= 0 else "No data available"
+    }
+
+def update_cache(cache_data):
     """Writes prediction to cache file"""
     try:
-        cache_data = {
-            "success": capacity >= 0,
-            "capacity": round(capacity, 2),
-            "timestamp": datetime.now().isoformat(),
-            "message": "Prediction successful" if capacity >= 0 else "No data available"
-        }
-        
         with open(CACHE_FILE, 'w') as f:
             json.dump(cache_data, f, indent=2)
         
-        print(f"[OK] Cache updated: capacity={capacity}")
+        print(f"[OK] Cache updated: capacity={cache_data['capacity']}")
         return True
         
     except Exception as e:
         print(f"[ERROR] Cache write failed: {e}")
         return False
 
+def publish_prediction(client, cache_data):
+    """Publishes the prediction retained, so new subscribers get it on connect"""
+    if not client.is_connected():
+        print("[WARN] MQTT not connected, prediction not pushed")
+        return False
+    client.publish(PREDICTION_TOPIC, json.dumps(cache_data), qos=1, retain=True)
+    print(f"[OK] Published to {PREDICTION_TOPIC}")
+    return True
+
+def clear_prediction(client):
+    """Removes the retained prediction so subscribers stop getting it after shutdown"""
+    if not client.is_connected():
+        return
+    info = client.publish(PREDICTION_TOPIC, b'', qos=1, retain=True)
+    info.wait_for_publish(timeout=5)
+    print(f"[OK] Cleared retained {PREDICTION_TOPIC}")
+
 def main():
     print("=" * 70)
     print("BACKGROUND PREDICTION SERVICE")
@@ -75,14 +115,18 @@ def main():
     print(f"Press Ctrl+C to stop")
     print("=" * 70)
     print()
+
+    client = connect_mqtt()
     
     while True:
         try:
             # Run prediction
             capacity = run_prediction()
             
-            # Update cache
-            update_cache(capacity)
+            # Update cache, then push to subscribers
+            prediction = make_prediction(capacity)
+            update_cache(prediction)
+            publish_prediction(client, prediction)
             
             # Wait before next update
             print(f"Waiting {UPDATE_INTERVAL} seconds...\n")
@@ -90,6 +134,9 @@ def main():
             
         except KeyboardInterrupt:
             print("\nStopping background service...")
+            clear_prediction(client)
+            client.loop_stop()
+            client.disconnect()
             break
         except Exception as e:
             print(f"[ERROR] {e}")
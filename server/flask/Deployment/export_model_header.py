@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""
+Exports the XGBoost capacity model as a constexpr C++ header
+=============================================================
+
+Flattens every tree of busstop_xgboost.json into one TreeNode array (see
+esp32/lib/smartstop_core/src/TreeEnsemble.h) so the actuator can predict
+capacity on-device when the prediction server is unreachable.
+
+Run this again after retraining:
+    python3 export_model_header.py
+    python3 export_model_header.py --check   # also compare with xgboost
+"""
+
+import os
+import sys
+import json
+import math
+import random
+import argparse
+
+BASE_DIR = os.path.dirname(os.path.abspath(__file__))
+MODEL_PATH = os.path.join(BASE_DIR, 'busstop_xgboost.json')
+HEADER_PATH = os.path.join(BASE_DIR, '..', '..', '..', 'esp32', 'ESP32_Actuator',
+                           'cs3237lcdspeakerservomotorcombined', 'capacity_model.h')
+
+MAX_NODES = 32767  # TreeNode child indices are int16
+
+
+def load_model(path):
+    """
+    Reads an XGBoost JSON model into flat node lists.
+
+    Returns:
+        (feature_names, base_score, nodes, roots) where each node is
+        (left, right, feature, default_left, value) with absolute indices
+    """
+    with open(path) as f:
+        learner = json.load(f)['learner']
+
+    objective = learner['objective']['name']
+    if objective != 'reg:squarederror':
+        raise ValueError(f"unsupported objective {objective}")
+
+    base_score = float(learner['learner_model_param']['base_score'].strip('[]'))
+    feature_names = learner['feature_names']
+
+    nodes, roots = [], []
+    for tree in learner['gradient_booster']['model']['trees']:
+        if any(tree['split_type']):
+            raise ValueError(f"tree {tree['id']} has categorical splits")
+        offset = len(nodes)
+        roots.append(offset)
+        for i, left in enumerate(tree['left_children']):
+            if left < 0:
+                nodes.append((-1, -1, 0, 0, tree['split_conditions'][i]))
+            else:
+                nodes.append((offset + left, offset + tree['right_children'][i],
+                              tree['split_indices'][i], tree['default_left'][i],
+                              tree['split_conditions'][i]))
+
+    if len(nodes) > MAX_NODES:
+        raise ValueError(f"{len(nodes)} nodes do not fit int16 indices")
+    return feature_names, base_score, nodes, roots
+
+
+def predict(model, x):
+    """Same walk as TreeEnsemble::predict(), for checking the export"""
+    _, base_score, nodes, roots = model
+    total = base_score
+    for root in roots:
+        left, right, feature, default_left, value = nodes[root]
+        while left >= 0:
+            v = x[feature]
+            go_left = default_left if math.isnan(v) else v < value
+            left, right, feature, default_left, value = nodes[left if go_left else right]
+        total += value
+    return total
+
+
+def c_float(v):
+    """Shortest literal that round-trips to the same float32"""
+    s = f"{v:.9g}"
+    if 'e' not in s and '.' not in s:
+        s += '.0'
+    return s + 'f'
+
+
+def write_header(model, path, source):
+    feature_names, base_score, nodes, roots = model
+    enum = ',\n'.join(f"  {name.upper()}" for name in feature_names)
+
+    lines = [
+        f"// Generated by server/flask/Deployment/export_model_header.py from {source}.",
+        "// Do not edit; re-run the exporter after retraining.",
+        "#pragma once",
+        "#include <TreeEnsemble.h>",
+        "",
+        "namespace capacity_model {",
+        "",
+        "// Training column order (BusStopPredictor.feature_columns); -1 marks a",
+        "// missing reading, as in run_inference.py",
+        "enum Feature : uint8_t {",
+        f"{enum},",
+        "  FEATURE_COUNT",
+        "};",
+        "",
+        f"constexpr TreeNode NODES[{len(nodes)}] = {{",
+    ]
+    for left, right, feature, default_left, value in nodes:
+        lines.append(f"  {{{left}, {right}, {feature}, {default_left}, {c_float(value)}}},")
+    lines += [
+        "};",
+        "",
+        f"constexpr uint16_t ROOTS[{len(roots)}] = {{",
+    ]
+    for i in range(0, len(roots), 12):
+        lines.append("  " + ", ".join(str(r) for r in roots[i:i + 12]) + ",")
+    lines += [
+        "};",
+        "",
+        f"constexpr TreeEnsemble MODEL = {{NODES, ROOTS, {len(roots)}, FEATURE_COUNT, {c_float(base_score)}}};",
+        "",
+        "}  // namespace capacity_model",
+        "",
+    ]
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def check_against_xgboost(model, samples=200):
+    """Compares the flattened walk with xgboost on random feature vectors"""
+    try:
+        import numpy as np
+        import xgboost as xgb
+    except ImportError:
+        print("[WARN] numpy/xgboost not installed, skipping check")
+        return True
+
+    booster = xgb.Booster()
+    booster.load_model(MODEL_PATH)
+    rows = [[random.choice([-1.0, random.uniform(0, 300)]) for _ in model[0]] for _ in range(samples)]
+    expected = booster.predict(xgb.DMatrix(np.array(rows, dtype=np.float32), feature_names=model[0]))
+    worst = max(abs(predict(model, r) - e) for r, e in zip(rows, expected))
+    print(f"[CHECK] max |export - xgboost| over {samples} samples: {worst:.6f}")
+    return worst < 1e-3
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Export the XGBoost model as a C++ header')
+    parser.add_argument('--model', default=MODEL_PATH)
+    parser.add_argument('--output', default=HEADER_PATH)
+    parser.add_argument('--check', action='store_true', help='compare with xgboost predictions')
+    args = parser.parse_args()
+
+    model = load_model(args.model)
+    write_header(model, args.output, os.path.basename(args.model))
+    print(f"[OK] {len(model[3])} trees, {len(model[2])} nodes -> {os.path.normpath(args.output)}")
+
+    if args.check and not check_against_xgboost(model):
+        print("[ERROR] exported model disagrees with xgboost")
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -1,10 +1,11 @@
 from flask import Flask, request, jsonify, send_file
-from datetime import datetime
+from datetime import datetime, timedelta
 import os
 import csv
 import json
 import subprocess
 import sys
+import threading
 
 app = Flask(__name__)
 import torch
@@ -22,13 +23,19 @@ IMAGE_FOLDER = os.path.join(BASE_DIR, 'images')
 METADATA_FILE = os.path.join(BASE_DIR, 'metadata.csv')
 MODEL_PATH = os.path.join(BASE_DIR, 'smartstop_mobilenet_v2_esp32cam.pth')
 CLASSES_PATH = os.path.join(BASE_DIR, 'class_names.json')
+PARTIAL_FOLDER = os.path.join(BASE_DIR, 'partial_uploads')  # resumable uploads in flight
+PARTIAL_MAX_AGE_S = 3600
+COMPLETED_UPLOAD_TTL_S = 600  # how long a finished upload id is answered from memory
 
 # MQTT Config
 MQTT_BROKER = "127.0.0.1"  # Localhost because it's on the same server
 MQTT_PORT = 1883
 MQTT_TOPIC = "nus-smartstop/crowd/data"
+MQTT_CAMERA_METRICS_TOPIC = "nus-smartstop-diag/{}/wake"  # diagnostics, kept out of the Telegraf sensor measurement
+MQTT_PERF_TOPIC = "nus-smartstop-diag/{}/perf"  # same layout the MQTT nodes publish, not ingested by Telegraf
 
 os.makedirs(IMAGE_FOLDER, exist_ok=True)
+os.makedirs(PARTIAL_FOLDER, exist_ok=True)
 
 # Initialize metadata CSV
 if not os.path.exists(METADATA_FILE):
@@ -161,6 +168,94 @@ def publish_mqtt(device_id, result, confidence):
     except Exception as e:
         print(f"⚠️ [MQTT Error] {e}")
 
+def publish_wake_metrics(device_id, headers):
+    """Forwards the camera's boot timing headers to its diagnostics topic"""
+    if 'X-Wake-Ms' not in headers:
+        return
+    try:
+        payload = {
+            "deviceId": device_id,
+            "wake_ms": int(headers['X-Wake-Ms']),
+            "fast_wake": headers.get('X-Fast-Wake') == '1',
+        }
+        if 'X-Prev-Wake-To-Upload-Ms' in headers:
+            payload["prev_wake_to_upload_ms"] = int(headers['X-Prev-Wake-To-Upload-Ms'])
+        # Change gate: how many blocks moved, and how many wakes were skipped before this one
+        if 'X-Change-Blocks' in headers:
+            payload["change_blocks"] = int(headers['X-Change-Blocks'])
+        if 'X-Skipped-Wakes' in headers:
+            payload["skipped_wakes"] = int(headers['X-Skipped-Wakes'])
+        # Resolution controller selection for this frame
+        if 'X-Capture-Level' in headers:
+            payload["capture_level"] = int(headers['X-Capture-Level'])
+            payload["jpeg_quality"] = int(headers.get('X-JPEG-Quality', 0))
+            payload["byte_budget"] = int(headers.get('X-Byte-Budget', 0))
+        MQTT_CLIENT.publish(MQTT_CAMERA_METRICS_TOPIC.format(device_id), json.dumps(payload))
+    except Exception as e:
+        print(f"⚠️ [MQTT Error] {e}")
+
+def publish_perf(device_id, headers):
+    """Forwards the previous wake's phase timings (X-Perf: k=v,...) once per wake"""
+    perf = headers.get('X-Perf')
+    # Every frame of a burst repeats the header; backlog frames are from older wakes
+    if not perf or 'X-Backlog-Seq' in headers or headers.get('X-Burst-Index', '0') != '0':
+        return
+    try:
+        payload = {"deviceId": device_id}
+        for item in perf.split(','):
+            key, _, value = item.partition('=')
+            payload[key.strip()] = int(value)
+        MQTT_CLIENT.publish(MQTT_PERF_TOPIC.format(device_id), json.dumps(payload))
+    except Exception as e:
+        print(f"⚠️ [Perf Error] {e}")
+
+def store_image(image_data, device_id, headers):
+    """Saves a complete JPEG, runs inference, logs it and returns the response body"""
+    # Generate filename (burst frames share a second, so suffix the index)
+    timestamp = datetime.now()
+    burst_index = headers.get('X-Burst-Index', '')
+    suffix = f"_{int(burst_index)}" if burst_index.isdigit() else ''
+
+    # Frames replayed from the camera's SD backlog carry their age instead
+    backlog_seq = headers.get('X-Backlog-Seq', '')
+    age_s = headers.get('X-Captured-Age-S', '')
+    if backlog_seq.isdigit():
+        suffix = f"_b{int(backlog_seq)}"
+        if age_s.isdigit():
+            timestamp -= timedelta(seconds=int(age_s))
+    filename = f"{device_id}_{timestamp.strftime('%Y%m%d_%H%M%S')}{suffix}.jpg"
+    filepath = os.path.join(IMAGE_FOLDER, filename)
+
+    # Save image
+    with open(filepath, 'wb') as f:
+        f.write(image_data)
+        print(f"✅ Image saved: {filename} ({len(image_data)} bytes, "
+              f"{request.headers.get('X-Frame-Size', '?')} q{request.headers.get('X-JPEG-Quality', '?')})")
+
+    # Run ML Inference immediately
+    ml_result, ml_conf = run_inference(filepath)
+    if ml_result:
+        print(f"🤖 [ML] {filename} -> {ml_result} ({ml_conf:.1f}%)")
+        # 3. Publish to MQTT for InfluxDB
+        publish_mqtt(device_id, ml_result, ml_conf)
+
+    # Log to CSV (updated with ML results)
+    with open(METADATA_FILE, 'a', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow([
+            timestamp.isoformat(), filename, len(image_data),
+            device_id, ml_result, round(ml_conf, 2)
+        ])
+
+    return {
+        'success': True,
+        'filename': filename,
+        'size': len(image_data),
+        'url': f'/images/{filename}',
+        'ml_result': ml_result,
+        'confidence': ml_conf
+    }
+
 @app.route('/upload', methods=['POST'])
 @require_api_key
 def upload_image():
@@ -173,41 +268,116 @@ def upload_image():
         
         # Get device ID from headers (optional)
         device_id = request.headers.get('Device-ID', 'esp32cam')
+
+        publish_wake_metrics(device_id, request.headers)
+        publish_perf(device_id, request.headers)
+        result = store_image(image_data, device_id, request.headers)
+        return jsonify(result), 200
         
-        # Generate filename
-        timestamp = datetime.now()
-        filename = f"{device_id}_{timestamp.strftime('%Y%m%d_%H%M%S')}.jpg"
-        filepath = os.path.join(IMAGE_FOLDER, filename)
-        
-        # Save image
-        with open(filepath, 'wb') as f:
-            f.write(image_data)
-            print(f"✅ Image saved: {filename} ({len(image_data)} bytes)")
-            
-        # Run ML Inference immediately
-        ml_result, ml_conf = run_inference(filepath)
-        if ml_result:
-            print(f"🤖 [ML] {filename} -> {ml_result} ({ml_conf:.1f}%)")
-            # 3. Publish to MQTT for InfluxDB
-            publish_mqtt(device_id, ml_result, ml_conf)
-        
-        # Log to CSV (updated with ML results)
-        with open(METADATA_FILE, 'a', newline='') as f:
-            writer = csv.writer(f)
-            writer.writerow([
-                timestamp.isoformat(), filename, len(image_data), 
-                device_id, ml_result, round(ml_conf, 2)
-            ])
-        
-        return jsonify({
-            'success': True,
-            'filename': filename,
-            'size': len(image_data),
-            'url': f'/images/{filename}',
-            'ml_result': ml_result,
-            'confidence': ml_conf
-        }), 200
-        
+    except Exception as e:
+        print(f"❌ Error: {str(e)}")
+        return jsonify({'error': str(e)}), 500
+
+# upload id -> (finished at, total, /upload result). A final chunk whose
+# response was lost is retried by the device; without this the retry finds
+# no partial, restarts from 0 and the frame is stored twice.
+completed_uploads = {}
+completed_uploads_lock = threading.Lock()
+
+def remember_completed(upload_id, total, result):
+    now = datetime.now().timestamp()
+    with completed_uploads_lock:
+        for key in [k for k, (t, _, _) in completed_uploads.items() if now - t > COMPLETED_UPLOAD_TTL_S]:
+            del completed_uploads[key]
+        completed_uploads[upload_id] = (now, total, result)
+
+def lookup_completed(upload_id):
+    with completed_uploads_lock:
+        entry = completed_uploads.get(upload_id)
+    if entry and datetime.now().timestamp() - entry[0] <= COMPLETED_UPLOAD_TTL_S:
+        return entry[1], entry[2]
+    return None
+
+def int_header(name):
+    """Non-negative integer header, or None if missing or malformed"""
+    value = request.headers.get(name, '').strip()
+    return int(value) if value.isdigit() else None
+
+def cleanup_partials():
+    """Drops resumable uploads that were abandoned (e.g. device slept mid-frame)"""
+    now = datetime.now().timestamp()
+    for name in os.listdir(PARTIAL_FOLDER):
+        path = os.path.join(PARTIAL_FOLDER, name)
+        if now - os.path.getmtime(path) > PARTIAL_MAX_AGE_S:
+            os.remove(path)
+
+@app.route('/upload/chunk', methods=['POST'])
+@require_api_key
+def upload_chunk():
+    """
+    Range-based resumable upload. Each request carries one chunk:
+      X-Upload-Id:     unique id for this frame
+      X-Upload-Offset: byte offset of this chunk
+      X-Upload-Total:  full JPEG size
+    Re-sending a chunk at the same offset is idempotent, so a device only
+    retransmits the chunk that failed. A gap (offset past what we hold)
+    returns 409 with the offset to resume from. The final chunk is
+    handled exactly like /upload; repeats of a finished upload id get the
+    stored result for COMPLETED_UPLOAD_TTL_S instead of a second image.
+    """
+    try:
+        upload_id = request.headers.get('X-Upload-Id', '')
+        offset = int_header('X-Upload-Offset')
+        total = int_header('X-Upload-Total')
+
+        if not upload_id.replace('-', '').isalnum() or offset is None or not total:
+            return jsonify({'error': 'Missing or invalid upload headers'}), 400
+
+        done = lookup_completed(upload_id)
+        if done:
+            done_total, result = done
+            print(f"↩️ Upload {upload_id} already stored, replaying result")
+            resp = jsonify(result)
+            resp.headers['X-Upload-Offset'] = str(done_total)
+            return resp, 200
+
+        chunk = request.get_data()
+        if len(chunk) == 0 or offset + len(chunk) > total:
+            return jsonify({'error': 'Chunk out of range'}), 400
+
+        device_id = request.headers.get('Device-ID', 'esp32cam')
+        part_path = os.path.join(PARTIAL_FOLDER, f"{upload_id}.part")
+        if offset == 0:
+            cleanup_partials()
+        held = os.path.getsize(part_path) if os.path.exists(part_path) else 0
+
+        if offset > held:
+            resp = jsonify({'error': 'Offset ahead of received data', 'offset': held})
+            resp.headers['X-Upload-Offset'] = str(held)
+            return resp, 409
+
+        with open(part_path, 'r+b' if held else 'wb') as f:
+            f.seek(offset)
+            f.write(chunk)
+            f.truncate()
+        received = offset + len(chunk)
+
+        if received < total:
+            resp = jsonify({'success': True, 'offset': received})
+            resp.headers['X-Upload-Offset'] = str(received)
+            return resp, 200
+
+        with open(part_path, 'rb') as f:
+            image_data = f.read()
+        os.remove(part_path)
+        publish_wake_metrics(device_id, request.headers)
+        publish_perf(device_id, request.headers)
+        result = store_image(image_data, device_id, request.headers)
+        remember_completed(upload_id, total, result)
+        resp = jsonify(result)
+        resp.headers['X-Upload-Offset'] = str(received)
+        return resp, 200
+
     except Exception as e:
         print(f"❌ Error: {str(e)}")
         return jsonify({'error': str(e)}), 500
@@ -370,4 +540,7 @@ if __name__ == '__main__':
     MQTT_CLIENT = mqtt.Client()
     MQTT_CLIENT.connect(MQTT_BROKER, MQTT_PORT)
     MQTT_CLIENT.loop_start()
+    # HTTP/1.1 so ESP32 clients can keep one connection open across requests
+    from werkzeug.serving import WSGIRequestHandler
+    WSGIRequestHandler.protocol_version = "HTTP/1.1"
     app.run(host='0.0.0.0', port=5000, debug=False)
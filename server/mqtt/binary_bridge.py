@@ -0,0 +1,146 @@
+"""
+Binary Telemetry Bridge for Smart Bus Stop
+==========================================
+
+Decodes the compact binary payload published by the IR/mic node
+(esp32/cs3237irmiccombined.ino built with IR_PAYLOAD_FORMAT=IR_PAYLOAD_BINARY)
+and republishes it as the usual JSON document on the JSON topic, so Telegraf
+and the InfluxDB schema stay unchanged.
+
+Binary topic: nus-smartstop-bin/ir-sensor/<deviceId>
+JSON topic:   nus-smartstop/ir-sensor/data (samples without a device timestamp)
+Batch topic:  nus-smartstop-batch/ir-sensor (timestamped samples, Telegraf
+              uses their ts as the point time)
+
+The binary root is deliberately outside nus-smartstop/# so the Telegraf JSON
+consumer never sees raw binary frames.
+"""
+
+import os
+import json
+import struct
+import paho.mqtt.client as mqtt
+from dotenv import load_dotenv
+import logging
+
+# Load environment variables
+load_dotenv()
+
+# Setup logging
+logging.basicConfig(level=logging.INFO)
+logger = logging.getLogger(__name__)
+
+BIN_TOPIC_ROOT = 'nus-smartstop-bin/ir-sensor'
+JSON_TOPIC = 'nus-smartstop/ir-sensor/data'
+BATCH_TOPIC = 'nus-smartstop-batch/ir-sensor'
+
+# v2 layout, little-endian (must match publishBinary() on the device)
+#   u8 version | u8 flags | u8 nDoors | u8 folded (older samples merged in, saturated)
+#   u32 seq | i32 people_count | u32 mic_dropped | u32 ir_overflow
+#   u64 ts (unix ms, 0 before the device synced its clock)
+#   nDoors x { u16 in | u16 out }
+# v1 is the same without ts.
+IR_HEADER_V1 = struct.Struct('<BBBBIiII')
+IR_HEADER_V2 = struct.Struct('<BBBBIiIIQ')
+IR_DOOR_V1 = struct.Struct('<HH')
+FLAG_VOICE = 0x01
+
+
+def decode_ir_payload(data, device_id):
+    """
+    Decode one binary IR/mic payload into the JSON field layout.
+
+    Returns:
+        dict with the same keys the JSON firmware path publishes, including
+        ts when the frame carries a device timestamp
+
+    Raises:
+        ValueError on unknown version or truncated payload
+    """
+    if len(data) < IR_HEADER_V1.size:
+        raise ValueError(f"payload too short ({len(data)} bytes)")
+
+    version = data[0]
+    if version == 1:
+        header = IR_HEADER_V1
+    elif version == 2:
+        header = IR_HEADER_V2
+    else:
+        raise ValueError(f"unsupported payload version {version}")
+    if len(data) < header.size:
+        raise ValueError(f"payload too short ({len(data)} bytes)")
+
+    values = header.unpack_from(data, 0)
+    _, flags, n_doors, folded, seq, people, mic_dropped, ir_overflow = values[:8]
+    ts = values[8] if version >= 2 else 0
+
+    expected = header.size + n_doors * IR_DOOR_V1.size
+    if len(data) < expected:
+        raise ValueError(f"payload truncated ({len(data)} of {expected} bytes)")
+
+    fields = {
+        'deviceId': device_id,
+        'seq': seq,
+        'people_count': people,
+        'voice': bool(flags & FLAG_VOICE),
+        'mic_dropped': mic_dropped,
+        'ir_overflow': ir_overflow,
+    }
+    if folded:
+        fields['seq_first'] = seq - folded
+    if ts:
+        fields['ts'] = ts
+    offset = header.size
+    for door in range(1, n_doors + 1):
+        d_in, d_out = IR_DOOR_V1.unpack_from(data, offset)
+        fields[f'd{door}_in'] = d_in
+        fields[f'd{door}_out'] = d_out
+        offset += IR_DOOR_V1.size
+    return fields
+
+
+class BinaryBridge:
+    """Subscribes to binary telemetry and republishes it as JSON"""
+
+    def __init__(self):
+        self.broker = os.getenv('MQTT_BROKER', 'localhost')
+        self.port = int(os.getenv('MQTT_PORT', 1883))
+
+        self.client = mqtt.Client(client_id='smartstop_binary_bridge')
+        self.client.on_connect = self.on_connect
+        self.client.on_message = self.on_message
+
+    def on_connect(self, client, userdata, flags, rc):
+        """Callback for when client connects to MQTT broker"""
+        if rc == 0:
+            client.subscribe(f"{BIN_TOPIC_ROOT}/+")
+            logger.info(f"Connected to {self.broker}:{self.port}, subscribed to {BIN_TOPIC_ROOT}/+")
+        else:
+            logger.error(f"Failed to connect to MQTT broker, return code: {rc}")
+
+    def on_message(self, client, userdata, msg):
+        """Decode a binary frame and forward it as JSON"""
+        device_id = msg.topic.rsplit('/', 1)[-1]
+        try:
+            fields = decode_ir_payload(msg.payload, device_id)
+        except (ValueError, struct.error) as e:
+            logger.error(f"Dropping payload from '{msg.topic}': {e}")
+            return
+
+        # Timestamped samples keep their sampling time via the batch consumer
+        topic = BATCH_TOPIC if 'ts' in fields else JSON_TOPIC
+        client.publish(topic, json.dumps(fields))
+        logger.debug(f"Bridged {len(msg.payload)} bytes from {device_id}: {fields}")
+
+    def start(self):
+        """Connect and run the network loop until interrupted"""
+        self.client.connect(self.broker, self.port, 60)
+        try:
+            self.client.loop_forever()
+        except KeyboardInterrupt:
+            logger.info("Binary bridge stopped by user")
+            self.client.disconnect()
+
+
+if __name__ == '__main__':
+    BinaryBridge().start()